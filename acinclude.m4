@@ -1,11 +1,18 @@
 dnl Checks for required headers and functions
 dnl
-dnl Version: 20260606
+dnl Version: 20261016
 
 dnl Function to detect if libsigscan dependencies are available
 AC_DEFUN([AX_LIBSIGSCAN_CHECK_LOCAL],
   [dnl Check for internationalization functions in libsigscan/libsigscan_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for memory mapping functions in libsigscan/libsigscan_compiled_file.c and libsigscan/libsigscan_scanner.c
+  AC_CHECK_HEADERS([fcntl.h sys/mman.h sys/stat.h unistd.h])
+  AC_CHECK_FUNCS([close fstat madvise mmap munmap open])
+
+  dnl Check for file I/O functions in libsigscan/libsigscan_file_io_handle.c and libsigscan/libsigscan_sparse_file.c
+  AC_CHECK_FUNCS([lseek posix_fadvise pread])
 ])
 
 dnl Function to check if DLL support is needed
@@ -0,0 +1,1195 @@
+/*
+ * Aho-Corasick automaton functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_automaton.h"
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcnotify.h"
+#include "libsigscan_signature.h"
+
+/* Creates an automaton
+ * Make sure the value automaton is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_automaton_initialize(
+     libsigscan_automaton_t **automaton,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_automaton_initialize";
+	uint32_t state_index  = 0;
+
+	if( automaton == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( *automaton != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid automaton value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*automaton = memory_allocate_structure(
+	              libsigscan_automaton_t );
+
+	if( *automaton == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create automaton.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *automaton,
+	     0,
+	     sizeof( libsigscan_automaton_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear automaton.",
+		 function );
+
+		memory_free(
+		 *automaton );
+
+		*automaton = NULL;
+
+		return( -1 );
+	}
+	/* Index 0 of the transitions and outputs arrays is used to indicate
+	 * the end of a list and is therefore not used
+	 */
+	( *automaton )->number_of_transitions = 1;
+	( *automaton )->number_of_outputs     = 1;
+
+	/* The root state is stored at index 0
+	 */
+	if( libsigscan_automaton_append_state(
+	     *automaton,
+	     &state_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append root state.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *automaton != NULL )
+	{
+		libsigscan_automaton_free(
+		 automaton,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an automaton
+ * The signatures are not freed since they are owned by the signatures list
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_automaton_free(
+     libsigscan_automaton_t **automaton,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_automaton_free";
+
+	if( automaton == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( *automaton != NULL )
+	{
+		if( ( *automaton )->outputs != NULL )
+		{
+			memory_free(
+			 ( *automaton )->outputs );
+		}
+		if( ( *automaton )->transitions != NULL )
+		{
+			memory_free(
+			 ( *automaton )->transitions );
+		}
+		if( ( *automaton )->states != NULL )
+		{
+			memory_free(
+			 ( *automaton )->states );
+		}
+		memory_free(
+		 *automaton );
+
+		*automaton = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an empty state
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_automaton_append_state(
+     libsigscan_automaton_t *automaton,
+     uint32_t *state_index,
+     libcerror_error_t **error )
+{
+	libsigscan_automaton_state_t *states = NULL;
+	static char *function                = "libsigscan_automaton_append_state";
+	size_t states_size                   = 0;
+	uint32_t number_of_allocated_states  = 0;
+
+	if( automaton == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( automaton->number_of_states >= (uint32_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid automaton - number of states value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( state_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state index.",
+		 function );
+
+		return( -1 );
+	}
+	if( automaton->number_of_states >= automaton->number_of_allocated_states )
+	{
+		if( automaton->number_of_allocated_states == 0 )
+		{
+			number_of_allocated_states = 16;
+		}
+		else
+		{
+			number_of_allocated_states = automaton->number_of_allocated_states * 2;
+		}
+		if( number_of_allocated_states > (uint32_t) INT32_MAX )
+		{
+			number_of_allocated_states = (uint32_t) INT32_MAX;
+		}
+		states_size = sizeof( libsigscan_automaton_state_t ) * number_of_allocated_states;
+
+		if( states_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid states size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		states = (libsigscan_automaton_state_t *) memory_reallocate(
+		                                           automaton->states,
+		                                           states_size );
+
+		if( states == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize states.",
+			 function );
+
+			return( -1 );
+		}
+		automaton->states                     = states;
+		automaton->number_of_allocated_states = number_of_allocated_states;
+	}
+	states = &( automaton->states[ automaton->number_of_states ] );
+
+	if( memory_set(
+	     states,
+	     0,
+	     sizeof( libsigscan_automaton_state_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear state.",
+		 function );
+
+		return( -1 );
+	}
+	*state_index = automaton->number_of_states;
+
+	automaton->number_of_states += 1;
+
+	return( 1 );
+}
+
+/* Appends a transition from a state to a target state
+ * Transitions of the root state are stored in the root transitions table
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_automaton_append_transition(
+     libsigscan_automaton_t *automaton,
+     uint32_t state_index,
+     uint8_t byte_value,
+     uint32_t target_state_index,
+     libcerror_error_t **error )
+{
+	libsigscan_automaton_transition_t *transitions = NULL;
+	static char *function                          = "libsigscan_automaton_append_transition";
+	size_t transitions_size                        = 0;
+	uint32_t number_of_allocated_transitions       = 0;
+
+	if( automaton == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( state_index >= automaton->number_of_states )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid state index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( target_state_index == 0 )
+	 || ( target_state_index >= automaton->number_of_states ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid target state index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( state_index == 0 )
+	{
+		automaton->root_transitions[ byte_value ] = target_state_index;
+
+		return( 1 );
+	}
+	if( automaton->number_of_transitions >= (uint32_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid automaton - number of transitions value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( automaton->number_of_transitions >= automaton->number_of_allocated_transitions )
+	{
+		if( automaton->number_of_allocated_transitions == 0 )
+		{
+			number_of_allocated_transitions = 16;
+		}
+		else
+		{
+			number_of_allocated_transitions = automaton->number_of_allocated_transitions * 2;
+		}
+		if( number_of_allocated_transitions > (uint32_t) INT32_MAX )
+		{
+			number_of_allocated_transitions = (uint32_t) INT32_MAX;
+		}
+		transitions_size = sizeof( libsigscan_automaton_transition_t ) * number_of_allocated_transitions;
+
+		if( transitions_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid transitions size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		transitions = (libsigscan_automaton_transition_t *) memory_reallocate(
+		                                                     automaton->transitions,
+		                                                     transitions_size );
+
+		if( transitions == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize transitions.",
+			 function );
+
+			return( -1 );
+		}
+		automaton->transitions                     = transitions;
+		automaton->number_of_allocated_transitions = number_of_allocated_transitions;
+	}
+	transitions = &( automaton->transitions[ automaton->number_of_transitions ] );
+
+	transitions->target_state_index    = target_state_index;
+	transitions->next_transition_index = automaton->states[ state_index ].first_transition_index;
+	transitions->byte_value            = byte_value;
+
+	automaton->states[ state_index ].first_transition_index = automaton->number_of_transitions;
+
+	automaton->number_of_transitions += 1;
+
+	return( 1 );
+}
+
+/* Appends an output to a state
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_automaton_append_output(
+     libsigscan_automaton_t *automaton,
+     uint32_t state_index,
+     libsigscan_signature_t *signature,
+     libcerror_error_t **error )
+{
+	libsigscan_automaton_output_t *outputs = NULL;
+	static char *function                  = "libsigscan_automaton_append_output";
+	size_t outputs_size                    = 0;
+	uint32_t number_of_allocated_outputs   = 0;
+
+	if( automaton == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( automaton->number_of_outputs >= (uint32_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid automaton - number of outputs value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( state_index >= automaton->number_of_states )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid state index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( automaton->number_of_outputs >= automaton->number_of_allocated_outputs )
+	{
+		if( automaton->number_of_allocated_outputs == 0 )
+		{
+			number_of_allocated_outputs = 16;
+		}
+		else
+		{
+			number_of_allocated_outputs = automaton->number_of_allocated_outputs * 2;
+		}
+		if( number_of_allocated_outputs > (uint32_t) INT32_MAX )
+		{
+			number_of_allocated_outputs = (uint32_t) INT32_MAX;
+		}
+		outputs_size = sizeof( libsigscan_automaton_output_t ) * number_of_allocated_outputs;
+
+		if( outputs_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid outputs size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		outputs = (libsigscan_automaton_output_t *) memory_reallocate(
+		                                             automaton->outputs,
+		                                             outputs_size );
+
+		if( outputs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize outputs.",
+			 function );
+
+			return( -1 );
+		}
+		automaton->outputs                     = outputs;
+		automaton->number_of_allocated_outputs = number_of_allocated_outputs;
+	}
+	outputs = &( automaton->outputs[ automaton->number_of_outputs ] );
+
+	outputs->signature         = signature;
+	outputs->next_output_index = automaton->states[ state_index ].first_output_index;
+
+	automaton->states[ state_index ].first_output_index = automaton->number_of_outputs;
+
+	automaton->number_of_outputs += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the target state index of the transition of a state for a specific byte value
+ * Failure states are not followed
+ * Returns 1 if successful, 0 if no such transition or -1 on error
+ */
+int libsigscan_automaton_get_transition(
+     libsigscan_automaton_t *automaton,
+     uint32_t state_index,
+     uint8_t byte_value,
+     uint32_t *target_state_index,
+     libcerror_error_t **error )
+{
+	libsigscan_automaton_transition_t *transition = NULL;
+	static char *function                         = "libsigscan_automaton_get_transition";
+	uint32_t transition_index                     = 0;
+
+	if( automaton == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( state_index >= automaton->number_of_states )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid state index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_state_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target state index.",
+		 function );
+
+		return( -1 );
+	}
+	if( state_index == 0 )
+	{
+		*target_state_index = automaton->root_transitions[ byte_value ];
+
+		if( *target_state_index == 0 )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	transition_index = automaton->states[ state_index ].first_transition_index;
+
+	while( transition_index != 0 )
+	{
+		transition = &( automaton->transitions[ transition_index ] );
+
+		if( transition->byte_value == byte_value )
+		{
+			*target_state_index = transition->target_state_index;
+
+			return( 1 );
+		}
+		transition_index = transition->next_transition_index;
+	}
+	return( 0 );
+}
+
+/* Adds the pattern of a signature to the automaton
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_automaton_add_signature(
+     libsigscan_automaton_t *automaton,
+     libsigscan_signature_t *signature,
+     libcerror_error_t **error )
+{
+	static char *function       = "libsigscan_automaton_add_signature";
+	size_t pattern_index        = 0;
+	uint32_t state_index        = 0;
+	uint32_t target_state_index = 0;
+	int result                  = 0;
+
+	if( automaton == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( signature->pattern == NULL )
+	 || ( signature->pattern_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid signature - missing pattern.",
+		 function );
+
+		return( -1 );
+	}
+	for( pattern_index = 0;
+	     pattern_index < signature->pattern_size;
+	     pattern_index++ )
+	{
+		result = libsigscan_automaton_get_transition(
+		          automaton,
+		          state_index,
+		          signature->pattern[ pattern_index ],
+		          &target_state_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve transition.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			if( libsigscan_automaton_append_state(
+			     automaton,
+			     &target_state_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append state.",
+				 function );
+
+				return( -1 );
+			}
+			if( libsigscan_automaton_append_transition(
+			     automaton,
+			     state_index,
+			     signature->pattern[ pattern_index ],
+			     target_state_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append transition.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		state_index = target_state_index;
+	}
+	if( libsigscan_automaton_append_output(
+	     automaton,
+	     state_index,
+	     signature,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append output.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Fills the failure and output states
+ * The states are traversed breadth-first so that the failure state of
+ * a state is always determined before that of its child states
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_automaton_fill_failure_states(
+     libsigscan_automaton_t *automaton,
+     libcerror_error_t **error )
+{
+	libsigscan_automaton_transition_t *transition = NULL;
+	static char *function                         = "libsigscan_automaton_fill_failure_states";
+	uint32_t *states_queue                        = NULL;
+	size_t states_queue_size                      = 0;
+	uint32_t failure_state_index                  = 0;
+	uint32_t queue_end_index                      = 0;
+	uint32_t queue_start_index                    = 0;
+	uint32_t state_index                          = 0;
+	uint32_t target_state_index                   = 0;
+	uint32_t transition_index                     = 0;
+	uint16_t byte_value                           = 0;
+	int result                                    = 0;
+
+	if( automaton == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( automaton->states == NULL )
+	 || ( automaton->number_of_states == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid automaton - missing states.",
+		 function );
+
+		return( -1 );
+	}
+	states_queue_size = sizeof( uint32_t ) * automaton->number_of_states;
+
+	if( states_queue_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid states queue size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	states_queue = (uint32_t *) memory_allocate(
+	                             states_queue_size );
+
+	if( states_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create states queue.",
+		 function );
+
+		goto on_error;
+	}
+	/* The failure state of the child states of the root state is the root state
+	 */
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		target_state_index = automaton->root_transitions[ byte_value ];
+
+		if( target_state_index != 0 )
+		{
+			automaton->states[ target_state_index ].failure_state_index = 0;
+			automaton->states[ target_state_index ].output_state_index  = 0;
+
+			states_queue[ queue_end_index++ ] = target_state_index;
+		}
+	}
+	while( queue_start_index < queue_end_index )
+	{
+		state_index = states_queue[ queue_start_index++ ];
+
+		transition_index = automaton->states[ state_index ].first_transition_index;
+
+		while( transition_index != 0 )
+		{
+			transition = &( automaton->transitions[ transition_index ] );
+
+			failure_state_index = automaton->states[ state_index ].failure_state_index;
+
+			do
+			{
+				result = libsigscan_automaton_get_transition(
+				          automaton,
+				          failure_state_index,
+				          transition->byte_value,
+				          &target_state_index,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve transition.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					failure_state_index = target_state_index;
+
+					break;
+				}
+				else if( failure_state_index == 0 )
+				{
+					break;
+				}
+				failure_state_index = automaton->states[ failure_state_index ].failure_state_index;
+			}
+			while( result == 0 );
+
+			target_state_index = transition->target_state_index;
+
+			automaton->states[ target_state_index ].failure_state_index = failure_state_index;
+
+			if( automaton->states[ failure_state_index ].first_output_index != 0 )
+			{
+				automaton->states[ target_state_index ].output_state_index = failure_state_index;
+			}
+			else
+			{
+				automaton->states[ target_state_index ].output_state_index = automaton->states[ failure_state_index ].output_state_index;
+			}
+			if( queue_end_index >= automaton->number_of_states )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid queue end index value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			states_queue[ queue_end_index++ ] = target_state_index;
+
+			transition_index = transition->next_transition_index;
+		}
+	}
+	memory_free(
+	 states_queue );
+
+	return( 1 );
+
+on_error:
+	if( states_queue != NULL )
+	{
+		memory_free(
+		 states_queue );
+	}
+	return( -1 );
+}
+
+/* Builds the automaton from the unbounded signatures
+ * Returns 1 if successful, 0 if no unbounded signatures were added or -1 on error
+ */
+int libsigscan_automaton_build(
+     libsigscan_automaton_t *automaton,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	static char *function                 = "libsigscan_automaton_build";
+	int number_of_signatures              = 0;
+
+	if( automaton == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_first_element(
+	     signatures_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first list element.",
+		 function );
+
+		return( -1 );
+	}
+	while( list_element != NULL )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature.",
+			 function );
+
+			return( -1 );
+		}
+		if( signature == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET )
+		{
+			if( libsigscan_automaton_add_signature(
+			     automaton,
+			     signature,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add signature.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_signatures++;
+		}
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next list element.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( number_of_signatures == 0 )
+	{
+		return( 0 );
+	}
+	if( libsigscan_automaton_fill_failure_states(
+	     automaton,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to fill failure states.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of signatures\t: %d\n",
+		 function,
+		 number_of_signatures );
+
+		libcnotify_printf(
+		 "%s: number of states\t\t: %" PRIu32 "\n",
+		 function,
+		 automaton->number_of_states );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+}
+
+/* Scans the buffer for patterns
+ * Consumes bytes from buffer offset onwards and updates the state index, which
+ * allows the state to be carried over to the next contiguous buffer
+ * Returns 1 after consuming a byte that completes one or more patterns,
+ * 0 if the end of the buffer was reached or -1 on error
+ */
+int libsigscan_automaton_scan_buffer(
+     libsigscan_automaton_t *automaton,
+     uint32_t *state_index,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t *buffer_offset,
+     libcerror_error_t **error )
+{
+	libsigscan_automaton_state_t *state           = NULL;
+	libsigscan_automaton_transition_t *transition = NULL;
+	static char *function                         = "libsigscan_automaton_scan_buffer";
+	size_t safe_buffer_offset                     = 0;
+	uint32_t safe_state_index                     = 0;
+	uint32_t transition_index                     = 0;
+	uint8_t byte_value                            = 0;
+
+	if( automaton == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( automaton->states == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid automaton - missing states.",
+		 function );
+
+		return( -1 );
+	}
+	if( state_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *state_index >= automaton->number_of_states )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid state index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_buffer_offset = *buffer_offset;
+	safe_state_index   = *state_index;
+
+	while( safe_buffer_offset < buffer_size )
+	{
+		byte_value = buffer[ safe_buffer_offset++ ];
+
+		/* Follow the failure states until a state with a transition
+		 * for the byte value or the root state is found
+		 */
+		while( safe_state_index != 0 )
+		{
+			transition_index = automaton->states[ safe_state_index ].first_transition_index;
+
+			while( transition_index != 0 )
+			{
+				transition = &( automaton->transitions[ transition_index ] );
+
+				if( transition->byte_value == byte_value )
+				{
+					break;
+				}
+				transition_index = transition->next_transition_index;
+			}
+			if( transition_index != 0 )
+			{
+				break;
+			}
+			safe_state_index = automaton->states[ safe_state_index ].failure_state_index;
+		}
+		if( safe_state_index == 0 )
+		{
+			safe_state_index = automaton->root_transitions[ byte_value ];
+		}
+		else
+		{
+			safe_state_index = transition->target_state_index;
+		}
+		state = &( automaton->states[ safe_state_index ] );
+
+		if( ( state->first_output_index != 0 )
+		 || ( state->output_state_index != 0 ) )
+		{
+			*buffer_offset = safe_buffer_offset;
+			*state_index   = safe_state_index;
+
+			return( 1 );
+		}
+	}
+	*buffer_offset = safe_buffer_offset;
+	*state_index   = safe_state_index;
+
+	return( 0 );
+}
+
@@ -0,0 +1,198 @@
+/*
+ * Aho-Corasick automaton functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_AUTOMATON_H )
+#define _LIBSIGSCAN_AUTOMATON_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_signature.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_automaton_state libsigscan_automaton_state_t;
+
+struct libsigscan_automaton_state
+{
+	/* The first transition index
+	 * 0 if the state has no transitions
+	 */
+	uint32_t first_transition_index;
+
+	/* The failure state index
+	 */
+	uint32_t failure_state_index;
+
+	/* The output state index, which is the nearest state in the failure
+	 * chain that has outputs, 0 if there is no such state
+	 */
+	uint32_t output_state_index;
+
+	/* The first output index
+	 * 0 if the state has no outputs
+	 */
+	uint32_t first_output_index;
+};
+
+typedef struct libsigscan_automaton_transition libsigscan_automaton_transition_t;
+
+struct libsigscan_automaton_transition
+{
+	/* The target state index
+	 */
+	uint32_t target_state_index;
+
+	/* The next transition index of the same state
+	 */
+	uint32_t next_transition_index;
+
+	/* The byte value
+	 */
+	uint8_t byte_value;
+};
+
+typedef struct libsigscan_automaton_output libsigscan_automaton_output_t;
+
+struct libsigscan_automaton_output
+{
+	/* The signature
+	 */
+	libsigscan_signature_t *signature;
+
+	/* The next output index of the same state
+	 */
+	uint32_t next_output_index;
+};
+
+typedef struct libsigscan_automaton libsigscan_automaton_t;
+
+struct libsigscan_automaton
+{
+	/* The root state transitions per byte value
+	 */
+	uint32_t root_transitions[ 256 ];
+
+	/* The states array
+	 * The root state is stored at index 0
+	 */
+	libsigscan_automaton_state_t *states;
+
+	/* The number of states
+	 */
+	uint32_t number_of_states;
+
+	/* The number of allocated states
+	 */
+	uint32_t number_of_allocated_states;
+
+	/* The transitions array
+	 * Index 0 is not used
+	 */
+	libsigscan_automaton_transition_t *transitions;
+
+	/* The number of transitions
+	 */
+	uint32_t number_of_transitions;
+
+	/* The number of allocated transitions
+	 */
+	uint32_t number_of_allocated_transitions;
+
+	/* The outputs array
+	 * Index 0 is not used
+	 */
+	libsigscan_automaton_output_t *outputs;
+
+	/* The number of outputs
+	 */
+	uint32_t number_of_outputs;
+
+	/* The number of allocated outputs
+	 */
+	uint32_t number_of_allocated_outputs;
+};
+
+int libsigscan_automaton_initialize(
+     libsigscan_automaton_t **automaton,
+     libcerror_error_t **error );
+
+int libsigscan_automaton_free(
+     libsigscan_automaton_t **automaton,
+     libcerror_error_t **error );
+
+int libsigscan_automaton_append_state(
+     libsigscan_automaton_t *automaton,
+     uint32_t *state_index,
+     libcerror_error_t **error );
+
+int libsigscan_automaton_append_transition(
+     libsigscan_automaton_t *automaton,
+     uint32_t state_index,
+     uint8_t byte_value,
+     uint32_t target_state_index,
+     libcerror_error_t **error );
+
+int libsigscan_automaton_append_output(
+     libsigscan_automaton_t *automaton,
+     uint32_t state_index,
+     libsigscan_signature_t *signature,
+     libcerror_error_t **error );
+
+int libsigscan_automaton_get_transition(
+     libsigscan_automaton_t *automaton,
+     uint32_t state_index,
+     uint8_t byte_value,
+     uint32_t *target_state_index,
+     libcerror_error_t **error );
+
+int libsigscan_automaton_add_signature(
+     libsigscan_automaton_t *automaton,
+     libsigscan_signature_t *signature,
+     libcerror_error_t **error );
+
+int libsigscan_automaton_fill_failure_states(
+     libsigscan_automaton_t *automaton,
+     libcerror_error_t **error );
+
+int libsigscan_automaton_build(
+     libsigscan_automaton_t *automaton,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error );
+
+int libsigscan_automaton_scan_buffer(
+     libsigscan_automaton_t *automaton,
+     uint32_t *state_index,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t *buffer_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_AUTOMATON_H ) */
+
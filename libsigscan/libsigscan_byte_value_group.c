@@ -257,9 +257,7 @@ int libsigscan_byte_value_group_get_signature_group(
      libsigscan_signature_group_t **signature_group,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *list_element              = NULL;
-	libsigscan_signature_group_t *safe_signature_group = NULL;
-	static char *function                              = "libsigscan_byte_value_group_get_signature_group";
+	static char *function = "libsigscan_byte_value_group_get_signature_group";
 
 	if( byte_value_group == NULL )
 	{
@@ -272,86 +270,35 @@ int libsigscan_byte_value_group_get_signature_group(
 
 		return( -1 );
 	}
-	if( signature_group == NULL )
+	if( byte_value_group->signature_groups_list == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid signature group.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid byte value group - missing signature groups list.",
 		 function );
 
 		return( -1 );
 	}
-	*signature_group = NULL;
-
-	if( libcdata_list_get_first_element(
-	     byte_value_group->signature_groups_list,
-	     &list_element,
-	     error ) != 1 )
+	if( signature_group == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first list element.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature group.",
 		 function );
 
 		return( -1 );
 	}
-	while( list_element != NULL )
-	{
-		if( libcdata_list_element_get_value(
-		     list_element,
-		     (intptr_t **) &safe_signature_group,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve signature group.",
-			 function );
+	*signature_group = byte_value_group->byte_value_signature_groups[ byte_value ];
 
-			return( -1 );
-		}
-		if( safe_signature_group == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing signature group.",
-			 function );
-
-			return( -1 );
-		}
-		if( safe_signature_group->byte_value == byte_value )
-		{
-			*signature_group = safe_signature_group;
-
-			return( 1 );
-		}
-		if( safe_signature_group->byte_value > byte_value )
-		{
-			break;
-		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
-
-			return( -1 );
-		}
+	if( *signature_group == NULL )
+	{
+		return( 0 );
 	}
-	return( 0 );
+	return( 1 );
 }
 
 /* Inserts a signature for a specific byte value
@@ -431,6 +378,7 @@ int libsigscan_byte_value_group_insert_signature(
 
 			return( -1 );
 		}
+		byte_value_group->byte_value_signature_groups[ byte_value ] = signature_group;
 	}
 	if( libsigscan_signature_group_append_signature(
 	     signature_group,
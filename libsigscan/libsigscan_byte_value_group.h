@@ -45,6 +45,11 @@ struct libsigscan_byte_value_group
 	/* The signature groups list sorted by byte value
 	 */
 	libcdata_list_t *signature_groups_list;
+
+	/* The signature groups per byte value
+	 * Contains references to the signature groups in the signature groups list
+	 */
+	libsigscan_signature_group_t *byte_value_signature_groups[ 256 ];
 };
 
 int libsigscan_byte_value_group_initialize(
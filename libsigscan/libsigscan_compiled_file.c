@@ -0,0 +1,2951 @@
+/*
+ * Compiled file functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libsigscan_compiled_file.h"
+#include "libsigscan_compiled_scan_tree.h"
+#include "libsigscan_definitions.h"
+#include "libsigscan_identifier.h"
+#include "libsigscan_libbfio.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcnotify.h"
+#include "libsigscan_scan_tree.h"
+#include "libsigscan_signature.h"
+
+#include "sigscan_compiled_file.h"
+
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_OPEN ) && defined( HAVE_FSTAT ) && defined( HAVE_CLOSE )
+#define LIBSIGSCAN_COMPILED_FILE_HAVE_MMAP
+#endif
+
+/* The nodes of a compiled scan tree can be used directly from the compiled file data
+ * if the in-memory layout of the nodes matches that of the compiled file
+ */
+#if defined( _BYTE_STREAM_HOST_BYTE_ORDER ) && ( _BYTE_STREAM_HOST_BYTE_ORDER == _BYTE_STREAM_ENDIAN_LITTLE )
+#define LIBSIGSCAN_COMPILED_FILE_HAVE_NATIVE_NODES
+#endif
+
+const uint8_t sigscan_compiled_file_signature[ 8 ] = {
+	'S', 'I', 'G', 'S', 'C', 'A', 'N', 'C' };
+
+/* Creates a compiled file
+ * Make sure the value compiled_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_file_initialize(
+     libsigscan_compiled_file_t **compiled_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_compiled_file_initialize";
+
+	if( compiled_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compiled_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compiled file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*compiled_file = memory_allocate_structure(
+	                  libsigscan_compiled_file_t );
+
+	if( *compiled_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compiled file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *compiled_file,
+	     0,
+	     sizeof( libsigscan_compiled_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compiled file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *compiled_file != NULL )
+	{
+		memory_free(
+		 *compiled_file );
+
+		*compiled_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a compiled file
+ * The signatures are not freed since they are owned by the signatures lists
+ * The scan trees read from the compiled file must be freed before the compiled file
+ * since they can reference the compiled file data
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_file_free(
+     libsigscan_compiled_file_t **compiled_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_compiled_file_free";
+	int result            = 1;
+
+	if( compiled_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compiled_file != NULL )
+	{
+		if( ( *compiled_file )->data != NULL )
+		{
+#if defined( LIBSIGSCAN_COMPILED_FILE_HAVE_MMAP )
+			if( ( *compiled_file )->data_is_mapped != 0 )
+			{
+				if( munmap(
+				     ( *compiled_file )->data,
+				     ( *compiled_file )->data_size ) != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to unmap data.",
+					 function );
+
+					result = -1;
+				}
+			}
+			else
+#endif
+			{
+				memory_free(
+				 ( *compiled_file )->data );
+			}
+		}
+		if( ( *compiled_file )->signatures != NULL )
+		{
+			memory_free(
+			 ( *compiled_file )->signatures );
+		}
+		memory_free(
+		 *compiled_file );
+
+		*compiled_file = NULL;
+	}
+	return( result );
+}
+
+/* Opens a compiled file
+ * The compiled file is mapped into memory if supported by the system
+ * otherwise it is read into memory
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_file_open(
+     libsigscan_compiled_file_t *compiled_file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+#if defined( LIBSIGSCAN_COMPILED_FILE_HAVE_MMAP )
+	struct stat file_statistics;
+
+	void *data                       = NULL;
+	int file_descriptor              = -1;
+#else
+	libbfio_handle_t *file_io_handle = NULL;
+	size_t filename_length           = 0;
+#endif
+	static char *function            = "libsigscan_compiled_file_open";
+
+	if( compiled_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled file.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_file->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compiled file - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBSIGSCAN_COMPILED_FILE_HAVE_MMAP )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_statistics.st_size < (off_t) sizeof( sigscan_compiled_file_header_t ) )
+	 || ( (size64_t) file_statistics.st_size > (size64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The compiled file data is read-only and can be shared between processes
+	 */
+	data = mmap(
+	        NULL,
+	        (size_t) file_statistics.st_size,
+	        PROT_READ,
+	        MAP_PRIVATE,
+	        file_descriptor,
+	        0 );
+
+	if( data == MAP_FAILED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to map file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	compiled_file->data           = (uint8_t *) data;
+	compiled_file->data_size      = (size_t) file_statistics.st_size;
+	compiled_file->data_is_mapped = 1;
+
+	if( close(
+	     file_descriptor ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file: %s.",
+		 function,
+		 filename );
+
+		file_descriptor = -1;
+
+		goto on_error;
+	}
+	file_descriptor = -1;
+
+	if( libsigscan_compiled_file_read_file_header(
+	     compiled_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_compiled_file_open_file_io_handle(
+	     compiled_file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( LIBSIGSCAN_COMPILED_FILE_HAVE_MMAP ) */
+
+	return( 1 );
+
+on_error:
+#if defined( LIBSIGSCAN_COMPILED_FILE_HAVE_MMAP )
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	if( compiled_file->data_is_mapped != 0 )
+	{
+		munmap(
+		 compiled_file->data,
+		 compiled_file->data_size );
+
+		compiled_file->data_is_mapped = 0;
+	}
+#else
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( compiled_file->data != NULL )
+	{
+		memory_free(
+		 compiled_file->data );
+	}
+#endif
+	compiled_file->data      = NULL;
+	compiled_file->data_size = 0;
+
+	return( -1 );
+}
+
+/* Opens a compiled file using a Basic File IO (bfio) handle
+ * The compiled file is read into memory
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_file_open_file_io_handle(
+     libsigscan_compiled_file_t *compiled_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function      = "libsigscan_compiled_file_open_file_io_handle";
+	size64_t file_size         = 0;
+	ssize_t read_count         = 0;
+	int file_io_handle_is_open = 0;
+
+	if( compiled_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled file.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_file->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compiled file - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size < (size64_t) sizeof( sigscan_compiled_file_header_t ) )
+	 || ( file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	compiled_file->data = (uint8_t *) memory_allocate(
+	                                   sizeof( uint8_t ) * (size_t) file_size );
+
+	if( compiled_file->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	compiled_file->data_size = (size_t) file_size;
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              compiled_file->data,
+	              compiled_file->data_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) compiled_file->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_is_open == 0 )
+	{
+		file_io_handle_is_open = 1;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_compiled_file_read_file_header(
+	     compiled_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle_is_open == 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	if( compiled_file->data != NULL )
+	{
+		memory_free(
+		 compiled_file->data );
+
+		compiled_file->data = NULL;
+	}
+	compiled_file->data_size = 0;
+
+	return( -1 );
+}
+
+/* Reads the file header
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_file_read_file_header(
+     libsigscan_compiled_file_t *compiled_file,
+     libcerror_error_t **error )
+{
+	sigscan_compiled_file_header_t *file_header = NULL;
+	static char *function                       = "libsigscan_compiled_file_read_file_header";
+	uint32_t format_version                     = 0;
+	uint32_t header_size                        = 0;
+	uint32_t number_of_scan_trees               = 0;
+	uint32_t number_of_signatures               = 0;
+	uint32_t unbounded_scan_engine              = 0;
+
+	if( compiled_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled file.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_file->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compiled file - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_file->data_size < sizeof( sigscan_compiled_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compiled file - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_header = (sigscan_compiled_file_header_t *) compiled_file->data;
+
+	if( memory_compare(
+	     file_header->signature,
+	     sigscan_compiled_file_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->header_size,
+	 header_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->unbounded_scan_engine,
+	 unbounded_scan_engine );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->number_of_signatures,
+	 number_of_signatures );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->number_of_scan_trees,
+	 number_of_scan_trees );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: header size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 header_size );
+
+		libcnotify_printf(
+		 "%s: unbounded scan engine\t\t: %" PRIu32 "\n",
+		 function,
+		 unbounded_scan_engine );
+
+		libcnotify_printf(
+		 "%s: number of signatures\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_signatures );
+
+		libcnotify_printf(
+		 "%s: number of scan trees\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_scan_trees );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( format_version != LIBSIGSCAN_COMPILED_FILE_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( header_size != (uint32_t) sizeof( sigscan_compiled_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported header size: %" PRIu32 ".",
+		 function,
+		 header_size );
+
+		return( -1 );
+	}
+	if( ( unbounded_scan_engine != LIBSIGSCAN_SCAN_ENGINE_SCAN_TREE )
+	 && ( unbounded_scan_engine != LIBSIGSCAN_SCAN_ENGINE_AHO_CORASICK ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported unbounded scan engine: %" PRIu32 ".",
+		 function,
+		 unbounded_scan_engine );
+
+		return( -1 );
+	}
+	/* Every signature requires at least a signature record
+	 */
+	if( (size_t) number_of_signatures > ( compiled_file->data_size / sizeof( sigscan_compiled_file_signature_record_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of signatures value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_scan_trees != LIBSIGSCAN_COMPILED_FILE_NUMBER_OF_SCAN_TREES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of scan trees: %" PRIu32 ".",
+		 function,
+		 number_of_scan_trees );
+
+		return( -1 );
+	}
+	compiled_file->unbounded_scan_engine = (int) unbounded_scan_engine;
+	compiled_file->number_of_signatures  = number_of_signatures;
+	compiled_file->data_offset           = sizeof( sigscan_compiled_file_header_t );
+
+	return( 1 );
+}
+
+/* Reads the signatures
+ * The signatures bound to an offset range are appended to the range signatures list
+ * and the other signatures to the signatures list
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_file_read_signatures(
+     libsigscan_compiled_file_t *compiled_file,
+     libcdata_list_t *signatures_list,
+     libcdata_list_t *range_signatures_list,
+     libcerror_error_t **error )
+{
+	sigscan_compiled_file_signature_record_t *signature_record = NULL;
+	libsigscan_signature_t *signature                          = NULL;
+	const uint8_t *identifier                                  = NULL;
+	const uint8_t *pattern                                     = NULL;
+	static char *function                                      = "libsigscan_compiled_file_read_signatures";
+	size_t record_data_offset                                  = 0;
+	size_t signatures_size                                     = 0;
+	uint64_t pattern_offset                                    = 0;
+	uint64_t range_end_offset                                  = 0;
+	uint64_t range_start_offset                                = 0;
+	uint32_t identifier_index                                  = 0;
+	uint32_t identifier_length                                 = 0;
+	uint32_t number_of_identifiers                             = 0;
+	uint32_t pattern_size                                      = 0;
+	uint32_t range_flags                                       = 0;
+	uint32_t record_index                                      = 0;
+	uint32_t record_size                                       = 0;
+	uint32_t signature_flags                                   = 0;
+	uint32_t signature_index                                   = 0;
+
+	if( compiled_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled file.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_file->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compiled file - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_file->signatures != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compiled file - signatures value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_file->number_of_signatures == 0 )
+	{
+		return( 1 );
+	}
+	signatures_size = sizeof( libsigscan_signature_t * ) * compiled_file->number_of_signatures;
+
+	if( signatures_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid signatures size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	compiled_file->signatures = (libsigscan_signature_t **) memory_allocate(
+	                                                         signatures_size );
+
+	if( compiled_file->signatures == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create signatures.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     compiled_file->signatures,
+	     0,
+	     signatures_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear signatures.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < compiled_file->number_of_signatures;
+	     record_index++ )
+	{
+		if( ( compiled_file->data_offset > compiled_file->data_size )
+		 || ( sizeof( sigscan_compiled_file_signature_record_t ) > ( compiled_file->data_size - compiled_file->data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid signature: %" PRIu32 " record offset value out of bounds.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		signature_record = (sigscan_compiled_file_signature_record_t *) &( compiled_file->data[ compiled_file->data_offset ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 signature_record->record_size,
+		 record_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 signature_record->signature_index,
+		 signature_index );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 signature_record->signature_flags,
+		 signature_flags );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 signature_record->range_flags,
+		 range_flags );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 signature_record->pattern_offset,
+		 pattern_offset );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 signature_record->range_start_offset,
+		 range_start_offset );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 signature_record->range_end_offset,
+		 range_end_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 signature_record->pattern_size,
+		 pattern_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 signature_record->number_of_identifiers,
+		 number_of_identifiers );
+
+		if( ( record_size < sizeof( sigscan_compiled_file_signature_record_t ) )
+		 || ( ( record_size % 8 ) != 0 )
+		 || ( (size_t) record_size > ( compiled_file->data_size - compiled_file->data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid signature: %" PRIu32 " record size value out of bounds.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( signature_index >= compiled_file->number_of_signatures )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid signature: %" PRIu32 " index value out of bounds.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( compiled_file->signatures[ signature_index ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid signature: %" PRIu32 " index value already set.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		record_data_offset = sizeof( sigscan_compiled_file_signature_record_t );
+
+		if( ( pattern_size == 0 )
+		 || ( (size_t) pattern_size > ( record_size - record_data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid signature: %" PRIu32 " pattern size value out of bounds.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		pattern = &( compiled_file->data[ compiled_file->data_offset + record_data_offset ] );
+
+		record_data_offset += pattern_size;
+
+		if( number_of_identifiers == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid signature: %" PRIu32 " number of identifiers value out of bounds.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( libsigscan_signature_initialize(
+		     &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create signature.",
+			 function );
+
+			goto on_error;
+		}
+		for( identifier_index = 0;
+		     identifier_index < number_of_identifiers;
+		     identifier_index++ )
+		{
+			if( ( record_size - record_data_offset ) < 4 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid signature: %" PRIu32 " identifier: %" PRIu32 " length value out of bounds.",
+				 function,
+				 record_index,
+				 identifier_index );
+
+				goto on_error;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( compiled_file->data[ compiled_file->data_offset + record_data_offset ] ),
+			 identifier_length );
+
+			record_data_offset += 4;
+
+			if( (size_t) identifier_length > ( record_size - record_data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid signature: %" PRIu32 " identifier: %" PRIu32 " length value out of bounds.",
+				 function,
+				 record_index,
+				 identifier_index );
+
+				goto on_error;
+			}
+			identifier = &( compiled_file->data[ compiled_file->data_offset + record_data_offset ] );
+
+			record_data_offset += identifier_length;
+
+			if( identifier_index == 0 )
+			{
+				if( libsigscan_signature_set(
+				     signature,
+				     (const char *) identifier,
+				     (size_t) identifier_length,
+				     (off64_t) pattern_offset,
+				     pattern,
+				     (size_t) pattern_size,
+				     signature_flags,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set signature: %" PRIu32 " values.",
+					 function,
+					 record_index );
+
+					goto on_error;
+				}
+			}
+			else
+			{
+				if( libsigscan_signature_append_identifier(
+				     signature,
+				     (const char *) identifier,
+				     (size_t) identifier_length,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append signature: %" PRIu32 " identifier: %" PRIu32 ".",
+					 function,
+					 record_index,
+					 identifier_index );
+
+					goto on_error;
+				}
+			}
+		}
+		signature->signature_index = (int) signature_index;
+
+		if( range_flags != 0 )
+		{
+			if( libsigscan_signature_set_range(
+			     signature,
+			     (off64_t) range_start_offset,
+			     (off64_t) range_end_offset,
+			     range_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set signature: %" PRIu32 " range.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			/* The signatures are stored in the order of the signatures lists
+			 * hence they can be appended
+			 */
+			if( libcdata_list_append_value(
+			     range_signatures_list,
+			     (intptr_t *) signature,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append signature: %" PRIu32 " to offset range signatures list.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( libcdata_list_append_value(
+			     signatures_list,
+			     (intptr_t *) signature,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append signature: %" PRIu32 " to signatures list.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+		compiled_file->signatures[ signature_index ] = signature;
+
+		signature = NULL;
+
+		compiled_file->data_offset += record_size;
+	}
+	return( 1 );
+
+on_error:
+	if( signature != NULL )
+	{
+		libsigscan_signature_free(
+		 &signature,
+		 NULL );
+	}
+	/* The signatures that were appended are owned by the signatures lists
+	 */
+	if( compiled_file->signatures != NULL )
+	{
+		memory_free(
+		 compiled_file->signatures );
+
+		compiled_file->signatures = NULL;
+	}
+	return( -1 );
+}
+
+/* Reads the nodes and signatures of a compiled scan tree
+ * The nodes are used directly from the compiled file data if the layout matches
+ * otherwise they are copied
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_file_read_compiled_scan_tree(
+     libsigscan_compiled_file_t *compiled_file,
+     size_t data_offset,
+     uint32_t number_of_nodes,
+     uint32_t number_of_signatures,
+     libsigscan_scan_tree_t *scan_tree,
+     libcerror_error_t **error )
+{
+	libsigscan_compiled_scan_tree_t *compiled_scan_tree = NULL;
+	libsigscan_compiled_scan_tree_node_t *node          = NULL;
+	sigscan_compiled_file_scan_tree_node_t *node_data   = NULL;
+	static char *function                               = "libsigscan_compiled_file_read_compiled_scan_tree";
+	size_t nodes_size                                   = 0;
+	size_t signatures_size                              = 0;
+	uint32_t node_index                                 = 0;
+	uint32_t scan_object_index                          = 0;
+	uint32_t scan_object_reference                      = 0;
+	uint32_t signature_index                            = 0;
+	uint32_t value_32bit                                = 0;
+	uint16_t byte_value                                 = 0;
+
+	if( compiled_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled file.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_file->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compiled file - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_nodes == 0 )
+	 || ( number_of_nodes > (uint32_t) LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_INDEX_MASK ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of nodes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_signatures == 0 )
+	 || ( number_of_signatures > (uint32_t) LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_INDEX_MASK ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of signatures value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	signatures_size = ( ( 4 * (size_t) number_of_signatures ) + 7 ) & ~( (size_t) 7 );
+	nodes_size      = sizeof( sigscan_compiled_file_scan_tree_node_t ) * (size_t) number_of_nodes;
+
+	if( ( data_offset > compiled_file->data_size )
+	 || ( signatures_size > ( compiled_file->data_size - data_offset ) )
+	 || ( nodes_size > ( compiled_file->data_size - data_offset - signatures_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree->compiled_scan_tree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan tree - compiled scan tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_compiled_scan_tree_initialize(
+	     &compiled_scan_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compiled scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	compiled_scan_tree->signatures = (libsigscan_signature_t **) memory_allocate(
+	                                                              sizeof( libsigscan_signature_t * ) * number_of_signatures );
+
+	if( compiled_scan_tree->signatures == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create signatures.",
+		 function );
+
+		goto on_error;
+	}
+	compiled_scan_tree->number_of_allocated_signatures = number_of_signatures;
+
+	for( scan_object_index = 0;
+	     scan_object_index < number_of_signatures;
+	     scan_object_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compiled_file->data[ data_offset ] ),
+		 signature_index );
+
+		data_offset += 4;
+
+		if( ( signature_index >= compiled_file->number_of_signatures )
+		 || ( compiled_file->signatures[ signature_index ] == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid signature: %" PRIu32 " index value out of bounds.",
+			 function,
+			 scan_object_index );
+
+			goto on_error;
+		}
+		compiled_scan_tree->signatures[ scan_object_index ] = compiled_file->signatures[ signature_index ];
+	}
+	compiled_scan_tree->number_of_signatures = number_of_signatures;
+
+	data_offset = ( data_offset + 7 ) & ~( (size_t) 7 );
+
+#if defined( LIBSIGSCAN_COMPILED_FILE_HAVE_NATIVE_NODES )
+	if( ( sizeof( libsigscan_compiled_scan_tree_node_t ) == sizeof( sigscan_compiled_file_scan_tree_node_t ) )
+	 && ( ( (intptr_t) &( compiled_file->data[ data_offset ] ) % 8 ) == 0 ) )
+	{
+		compiled_scan_tree->nodes              = (libsigscan_compiled_scan_tree_node_t *) &( compiled_file->data[ data_offset ] );
+		compiled_scan_tree->has_external_nodes = 1;
+	}
+	else
+#endif
+	{
+		if( ( sizeof( libsigscan_compiled_scan_tree_node_t ) * (size_t) number_of_nodes ) > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid nodes size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		compiled_scan_tree->nodes = (libsigscan_compiled_scan_tree_node_t *) memory_allocate(
+		                                                                      sizeof( libsigscan_compiled_scan_tree_node_t ) * number_of_nodes );
+
+		if( compiled_scan_tree->nodes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create nodes.",
+			 function );
+
+			goto on_error;
+		}
+		for( node_index = 0;
+		     node_index < number_of_nodes;
+		     node_index++ )
+		{
+			node_data = (sigscan_compiled_file_scan_tree_node_t *) &( compiled_file->data[ data_offset ] );
+			node      = &( compiled_scan_tree->nodes[ node_index ] );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 node_data->pattern_offset,
+			 node->pattern_offset );
+
+			for( byte_value = 0;
+			     byte_value < 256;
+			     byte_value++ )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 &( node_data->scan_object_references[ byte_value * 4 ] ),
+				 value_32bit );
+
+				node->scan_object_references[ byte_value ] = value_32bit;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 node_data->default_scan_object_reference,
+			 node->default_scan_object_reference );
+
+			data_offset += sizeof( sigscan_compiled_file_scan_tree_node_t );
+		}
+	}
+	compiled_scan_tree->number_of_nodes           = number_of_nodes;
+	compiled_scan_tree->number_of_allocated_nodes = number_of_nodes;
+
+	/* The nodes are stored in depth-first order hence a node only references nodes
+	 * that are stored after it, which also prevents the scan from looping
+	 */
+	for( node_index = 0;
+	     node_index < number_of_nodes;
+	     node_index++ )
+	{
+		node = &( compiled_scan_tree->nodes[ node_index ] );
+
+		for( byte_value = 0;
+		     byte_value <= 256;
+		     byte_value++ )
+		{
+			if( byte_value < 256 )
+			{
+				scan_object_reference = node->scan_object_references[ byte_value ];
+			}
+			else
+			{
+				scan_object_reference = node->default_scan_object_reference;
+			}
+			if( scan_object_reference == LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_NONE )
+			{
+				continue;
+			}
+			scan_object_index = scan_object_reference & LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_INDEX_MASK;
+
+			if( ( scan_object_reference & LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_FLAG_SIGNATURE ) != 0 )
+			{
+				if( scan_object_index >= number_of_signatures )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid node: %" PRIu32 " signature reference value out of bounds.",
+					 function,
+					 node_index );
+
+					goto on_error;
+				}
+			}
+			else if( ( scan_object_index <= node_index )
+			      || ( scan_object_index >= number_of_nodes ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid node: %" PRIu32 " node reference value out of bounds.",
+				 function,
+				 node_index );
+
+				goto on_error;
+			}
+		}
+	}
+	scan_tree->compiled_scan_tree = compiled_scan_tree;
+
+	return( 1 );
+
+on_error:
+	if( compiled_scan_tree != NULL )
+	{
+		libsigscan_compiled_scan_tree_free(
+		 &compiled_scan_tree,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a scan tree record
+ * The tables of the scan tree are rebuilt from the signatures list
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_file_read_scan_tree_record(
+     libsigscan_compiled_file_t *compiled_file,
+     size_t data_offset,
+     size_t data_end_offset,
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     int pattern_offsets_mode,
+     uint8_t is_partition,
+     size_t *record_size,
+     libcerror_error_t **error )
+{
+	libcdata_list_t *partition_signatures_lists[ LIBSIGSCAN_SCAN_TREE_NUMBER_OF_PARTITIONS ];
+
+	sigscan_compiled_file_scan_tree_record_t *scan_tree_record = NULL;
+	libsigscan_scan_tree_t *partition_scan_tree                = NULL;
+	static char *function                                      = "libsigscan_compiled_file_read_scan_tree_record";
+	size_t partition_data_offset                               = 0;
+	size_t partition_record_size                               = 0;
+	uint64_t safe_record_size                                  = 0;
+	uint32_t number_of_nodes                                   = 0;
+	uint32_t number_of_partition_scan_trees                    = 0;
+	uint32_t number_of_signatures                              = 0;
+	uint32_t record_pattern_offsets_mode                       = 0;
+	uint32_t scan_tree_type                                    = 0;
+	int number_of_partitions                                   = 0;
+	int number_of_partition_signatures                         = 0;
+	int partition_index                                        = 0;
+	int result                                                 = 0;
+
+	if( compiled_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled file.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_file->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid compiled file - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_end_offset > compiled_file->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data end offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_offset > data_end_offset )
+	 || ( sizeof( sigscan_compiled_file_scan_tree_record_t ) > ( data_end_offset - data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record size.",
+		 function );
+
+		return( -1 );
+	}
+	for( partition_index = 0;
+	     partition_index < LIBSIGSCAN_SCAN_TREE_NUMBER_OF_PARTITIONS;
+	     partition_index++ )
+	{
+		partition_signatures_lists[ partition_index ] = NULL;
+	}
+	scan_tree_record = (sigscan_compiled_file_scan_tree_record_t *) &( compiled_file->data[ data_offset ] );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 scan_tree_record->record_size,
+	 safe_record_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 scan_tree_record->scan_tree_type,
+	 scan_tree_type );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 scan_tree_record->pattern_offsets_mode,
+	 record_pattern_offsets_mode );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 scan_tree_record->number_of_nodes,
+	 number_of_nodes );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 scan_tree_record->number_of_signatures,
+	 number_of_signatures );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 scan_tree_record->number_of_partition_scan_trees,
+	 number_of_partition_scan_trees );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: record size\t\t\t: %" PRIu64 "\n",
+		 function,
+		 safe_record_size );
+
+		libcnotify_printf(
+		 "%s: scan tree type\t\t\t: %" PRIu32 "\n",
+		 function,
+		 scan_tree_type );
+
+		libcnotify_printf(
+		 "%s: pattern offsets mode\t\t: %" PRIu32 "\n",
+		 function,
+		 record_pattern_offsets_mode );
+
+		libcnotify_printf(
+		 "%s: number of nodes\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_nodes );
+
+		libcnotify_printf(
+		 "%s: number of signatures\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_signatures );
+
+		libcnotify_printf(
+		 "%s: number of partition scan trees\t: %" PRIu32 "\n",
+		 function,
+		 number_of_partition_scan_trees );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( ( safe_record_size < (uint64_t) sizeof( sigscan_compiled_file_scan_tree_record_t ) )
+	 || ( ( safe_record_size % 8 ) != 0 )
+	 || ( safe_record_size > (uint64_t) ( data_end_offset - data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The pattern offsets mode of an empty scan tree is not set
+	 */
+	if( ( scan_tree_type != LIBSIGSCAN_COMPILED_FILE_SCAN_TREE_TYPE_EMPTY )
+	 && ( record_pattern_offsets_mode != (uint32_t) pattern_offsets_mode ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pattern offsets mode: %" PRIu32 ".",
+		 function,
+		 record_pattern_offsets_mode );
+
+		goto on_error;
+	}
+	if( ( is_partition != 0 )
+	 && ( scan_tree_type != LIBSIGSCAN_COMPILED_FILE_SCAN_TREE_TYPE_COMPILED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported partition scan tree type: %" PRIu32 ".",
+		 function,
+		 scan_tree_type );
+
+		goto on_error;
+	}
+	switch( scan_tree_type )
+	{
+		case LIBSIGSCAN_COMPILED_FILE_SCAN_TREE_TYPE_EMPTY:
+			if( libsigscan_scan_tree_fill_range_list(
+			     scan_tree,
+			     signatures_list,
+			     pattern_offsets_mode,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to fill range list.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBSIGSCAN_COMPILED_FILE_SCAN_TREE_TYPE_COMPILED:
+			if( ( safe_record_size - sizeof( sigscan_compiled_file_scan_tree_record_t ) ) != ( ( ( ( 4 * (uint64_t) number_of_signatures ) + 7 ) & ~( (uint64_t) 7 ) ) + ( (uint64_t) sizeof( sigscan_compiled_file_scan_tree_node_t ) * number_of_nodes ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid record size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( libsigscan_scan_tree_fill_range_list(
+			     scan_tree,
+			     signatures_list,
+			     pattern_offsets_mode,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to fill range list.",
+				 function );
+
+				goto on_error;
+			}
+			if( libsigscan_compiled_file_read_compiled_scan_tree(
+			     compiled_file,
+			     data_offset + sizeof( sigscan_compiled_file_scan_tree_record_t ),
+			     number_of_nodes,
+			     number_of_signatures,
+			     scan_tree,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read compiled scan tree.",
+				 function );
+
+				goto on_error;
+			}
+			if( libsigscan_scan_tree_build_tables(
+			     scan_tree,
+			     signatures_list,
+			     pattern_offsets_mode,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to build tables.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBSIGSCAN_COMPILED_FILE_SCAN_TREE_TYPE_AUTOMATON:
+			if( ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+			 || ( compiled_file->unbounded_scan_engine != LIBSIGSCAN_SCAN_ENGINE_AHO_CORASICK ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported automaton scan tree.",
+				 function );
+
+				goto on_error;
+			}
+			/* The automaton is built in linear time of the total pattern size
+			 * hence it is rebuilt instead of stored
+			 */
+			result = libsigscan_scan_tree_build_automaton(
+			          scan_tree,
+			          signatures_list,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to build automaton.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBSIGSCAN_COMPILED_FILE_SCAN_TREE_TYPE_PARTITIONS:
+			if( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported partitions scan tree.",
+				 function );
+
+				goto on_error;
+			}
+			if( libsigscan_scan_tree_get_partition_signatures_lists(
+			     signatures_list,
+			     partition_signatures_lists,
+			     &number_of_partitions,
+			     &number_of_partition_signatures,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve partition signatures lists.",
+				 function );
+
+				goto on_error;
+			}
+			if( number_of_partition_scan_trees != (uint32_t) number_of_partitions )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of partition scan trees value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( libsigscan_scan_tree_fill_range_list(
+			     scan_tree,
+			     signatures_list,
+			     LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to fill range list.",
+				 function );
+
+				goto on_error;
+			}
+			partition_data_offset = data_offset + sizeof( sigscan_compiled_file_scan_tree_record_t );
+
+			/* The partition scan tree records are stored in the order of the non-empty partitions
+			 */
+			for( partition_index = 0;
+			     partition_index < LIBSIGSCAN_SCAN_TREE_NUMBER_OF_PARTITIONS;
+			     partition_index++ )
+			{
+				if( partition_signatures_lists[ partition_index ] == NULL )
+				{
+					continue;
+				}
+				if( libsigscan_scan_tree_initialize(
+				     &partition_scan_tree,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create partition: %d scan tree.",
+					 function,
+					 partition_index );
+
+					goto on_error;
+				}
+				if( libsigscan_compiled_file_read_scan_tree_record(
+				     compiled_file,
+				     partition_data_offset,
+				     data_offset + (size_t) safe_record_size,
+				     partition_scan_tree,
+				     partition_signatures_lists[ partition_index ],
+				     LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+				     1,
+				     &partition_record_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read partition: %d scan tree record.",
+					 function,
+					 partition_index );
+
+					goto on_error;
+				}
+				partition_data_offset += partition_record_size;
+
+				scan_tree->partition_scan_trees[ scan_tree->number_of_partition_scan_trees ] = partition_scan_tree;
+
+				scan_tree->number_of_partition_scan_trees += 1;
+
+				partition_scan_tree = NULL;
+
+				if( libcdata_list_free(
+				     &( partition_signatures_lists[ partition_index ] ),
+				     NULL,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free partition: %d signatures list.",
+					 function,
+					 partition_index );
+
+					goto on_error;
+				}
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported scan tree type: %" PRIu32 ".",
+			 function,
+			 scan_tree_type );
+
+			goto on_error;
+	}
+	if( scan_tree_type != LIBSIGSCAN_COMPILED_FILE_SCAN_TREE_TYPE_EMPTY )
+	{
+		scan_tree->pattern_offsets_mode = pattern_offsets_mode;
+	}
+	*record_size = (size_t) safe_record_size;
+
+	return( 1 );
+
+on_error:
+	if( partition_scan_tree != NULL )
+	{
+		libsigscan_scan_tree_free(
+		 &partition_scan_tree,
+		 NULL );
+	}
+	for( partition_index = 0;
+	     partition_index < LIBSIGSCAN_SCAN_TREE_NUMBER_OF_PARTITIONS;
+	     partition_index++ )
+	{
+		if( partition_signatures_lists[ partition_index ] != NULL )
+		{
+			libcdata_list_free(
+			 &( partition_signatures_lists[ partition_index ] ),
+			 NULL,
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Reads the next scan tree
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_file_read_scan_tree(
+     libsigscan_compiled_file_t *compiled_file,
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     int pattern_offsets_mode,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_compiled_file_read_scan_tree";
+	size_t record_size    = 0;
+
+	if( compiled_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_compiled_file_read_scan_tree_record(
+	     compiled_file,
+	     compiled_file->data_offset,
+	     compiled_file->data_size,
+	     scan_tree,
+	     signatures_list,
+	     pattern_offsets_mode,
+	     0,
+	     &record_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read scan tree record.",
+		 function );
+
+		return( -1 );
+	}
+	compiled_file->data_offset += record_size;
+
+	return( 1 );
+}
+
+/* Retrieves the compiled file scan tree type of a scan tree
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_file_get_scan_tree_type(
+     libsigscan_scan_tree_t *scan_tree,
+     uint32_t *scan_tree_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_compiled_file_get_scan_tree_type";
+
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree type.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree->automaton != NULL )
+	{
+		*scan_tree_type = LIBSIGSCAN_COMPILED_FILE_SCAN_TREE_TYPE_AUTOMATON;
+	}
+	else if( scan_tree->number_of_partition_scan_trees > 0 )
+	{
+		*scan_tree_type = LIBSIGSCAN_COMPILED_FILE_SCAN_TREE_TYPE_PARTITIONS;
+	}
+	else if( scan_tree->compiled_scan_tree != NULL )
+	{
+		*scan_tree_type = LIBSIGSCAN_COMPILED_FILE_SCAN_TREE_TYPE_COMPILED;
+	}
+	else
+	{
+		*scan_tree_type = LIBSIGSCAN_COMPILED_FILE_SCAN_TREE_TYPE_EMPTY;
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the scan tree record including the partition scan tree records
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_file_get_scan_tree_record_size(
+     libsigscan_scan_tree_t *scan_tree,
+     size64_t *record_size,
+     libcerror_error_t **error )
+{
+	static char *function          = "libsigscan_compiled_file_get_scan_tree_record_size";
+	size64_t partition_record_size = 0;
+	size64_t safe_record_size      = 0;
+	uint32_t scan_tree_type        = 0;
+	int partition_index            = 0;
+
+	if( record_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_compiled_file_get_scan_tree_type(
+	     scan_tree,
+	     &scan_tree_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve scan tree type.",
+		 function );
+
+		return( -1 );
+	}
+	safe_record_size = sizeof( sigscan_compiled_file_scan_tree_record_t );
+
+	if( scan_tree_type == LIBSIGSCAN_COMPILED_FILE_SCAN_TREE_TYPE_COMPILED )
+	{
+		safe_record_size += ( ( 4 * (size64_t) scan_tree->compiled_scan_tree->number_of_signatures ) + 7 ) & ~( (size64_t) 7 );
+		safe_record_size += sizeof( sigscan_compiled_file_scan_tree_node_t ) * (size64_t) scan_tree->compiled_scan_tree->number_of_nodes;
+	}
+	else if( scan_tree_type == LIBSIGSCAN_COMPILED_FILE_SCAN_TREE_TYPE_PARTITIONS )
+	{
+		for( partition_index = 0;
+		     partition_index < scan_tree->number_of_partition_scan_trees;
+		     partition_index++ )
+		{
+			if( libsigscan_compiled_file_get_scan_tree_record_size(
+			     scan_tree->partition_scan_trees[ partition_index ],
+			     &partition_record_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve partition: %d scan tree record size.",
+				 function,
+				 partition_index );
+
+				return( -1 );
+			}
+			safe_record_size += partition_record_size;
+		}
+	}
+	*record_size = safe_record_size;
+
+	return( 1 );
+}
+
+/* Writes the file header
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_file_write_file_header(
+     libbfio_handle_t *file_io_handle,
+     int unbounded_scan_engine,
+     int number_of_signatures,
+     libcerror_error_t **error )
+{
+	sigscan_compiled_file_header_t file_header;
+
+	static char *function = "libsigscan_compiled_file_write_file_header";
+	ssize_t write_count   = 0;
+
+	if( number_of_signatures < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of signatures value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &file_header,
+	     0,
+	     sizeof( sigscan_compiled_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     file_header.signature,
+	     sigscan_compiled_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy file signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.format_version,
+	 LIBSIGSCAN_COMPILED_FILE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.header_size,
+	 (uint32_t) sizeof( sigscan_compiled_file_header_t ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.unbounded_scan_engine,
+	 (uint32_t) unbounded_scan_engine );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.number_of_signatures,
+	 (uint32_t) number_of_signatures );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header.number_of_scan_trees,
+	 LIBSIGSCAN_COMPILED_FILE_NUMBER_OF_SCAN_TREES );
+
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               (uint8_t *) &file_header,
+	               sizeof( sigscan_compiled_file_header_t ),
+	               error );
+
+	if( write_count != (ssize_t) sizeof( sigscan_compiled_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a signature record
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_file_write_signature(
+     libbfio_handle_t *file_io_handle,
+     libsigscan_signature_t *signature,
+     libcerror_error_t **error )
+{
+	sigscan_compiled_file_signature_record_t *signature_record = NULL;
+	libsigscan_identifier_t *identifier                        = NULL;
+	uint8_t *record_data                                       = NULL;
+	static char *function                                      = "libsigscan_compiled_file_write_signature";
+	size_t identifier_length                                   = 0;
+	size_t record_data_offset                                  = 0;
+	size_t record_size                                         = 0;
+	ssize_t write_count                                        = 0;
+	int identifier_index                                       = 0;
+	int number_of_identifiers                                  = 0;
+
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( signature->pattern_size == 0 )
+	 || ( signature->pattern_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid signature - pattern size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_number_of_elements(
+	     signature->identifiers_list,
+	     &number_of_identifiers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of identifiers.",
+		 function );
+
+		goto on_error;
+	}
+	record_size = sizeof( sigscan_compiled_file_signature_record_t ) + signature->pattern_size;
+
+	for( identifier_index = 0;
+	     identifier_index < number_of_identifiers;
+	     identifier_index++ )
+	{
+		if( libcdata_list_get_value_by_index(
+		     signature->identifiers_list,
+		     identifier_index,
+		     (intptr_t **) &identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve identifier: %d.",
+			 function,
+			 identifier_index );
+
+			goto on_error;
+		}
+		if( ( identifier == NULL )
+		 || ( identifier->string == NULL )
+		 || ( identifier->string_size == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing identifier: %d.",
+			 function,
+			 identifier_index );
+
+			goto on_error;
+		}
+		record_size += 4 + identifier->string_size - 1;
+	}
+	record_size = ( record_size + 7 ) & ~( (size_t) 7 );
+
+	if( record_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	record_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * record_size );
+
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     record_data,
+	     0,
+	     record_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record data.",
+		 function );
+
+		goto on_error;
+	}
+	signature_record = (sigscan_compiled_file_signature_record_t *) record_data;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 signature_record->record_size,
+	 (uint32_t) record_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 signature_record->signature_index,
+	 (uint32_t) signature->signature_index );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 signature_record->signature_flags,
+	 signature->signature_flags );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 signature_record->range_flags,
+	 signature->range_flags );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 signature_record->pattern_offset,
+	 (uint64_t) signature->pattern_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 signature_record->range_start_offset,
+	 (uint64_t) signature->range_start_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 signature_record->range_end_offset,
+	 (uint64_t) signature->range_end_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 signature_record->pattern_size,
+	 (uint32_t) signature->pattern_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 signature_record->number_of_identifiers,
+	 (uint32_t) number_of_identifiers );
+
+	record_data_offset = sizeof( sigscan_compiled_file_signature_record_t );
+
+	if( memory_copy(
+	     &( record_data[ record_data_offset ] ),
+	     signature->pattern,
+	     signature->pattern_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy pattern.",
+		 function );
+
+		goto on_error;
+	}
+	record_data_offset += signature->pattern_size;
+
+	for( identifier_index = 0;
+	     identifier_index < number_of_identifiers;
+	     identifier_index++ )
+	{
+		if( libcdata_list_get_value_by_index(
+		     signature->identifiers_list,
+		     identifier_index,
+		     (intptr_t **) &identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve identifier: %d.",
+			 function,
+			 identifier_index );
+
+			goto on_error;
+		}
+		/* The identifier is stored without the end-of-string character
+		 */
+		identifier_length = identifier->string_size - 1;
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( record_data[ record_data_offset ] ),
+		 (uint32_t) identifier_length );
+
+		record_data_offset += 4;
+
+		if( memory_copy(
+		     &( record_data[ record_data_offset ] ),
+		     identifier->string,
+		     identifier_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy identifier: %d.",
+			 function,
+			 identifier_index );
+
+			goto on_error;
+		}
+		record_data_offset += identifier_length;
+	}
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               record_data,
+	               record_size,
+	               error );
+
+	if( write_count != (ssize_t) record_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write signature record.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 record_data );
+
+	return( 1 );
+
+on_error:
+	if( record_data != NULL )
+	{
+		memory_free(
+		 record_data );
+	}
+	return( -1 );
+}
+
+/* Writes the signature records of a signatures list
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_file_write_signatures(
+     libbfio_handle_t *file_io_handle,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	static char *function                 = "libsigscan_compiled_file_write_signatures";
+
+	if( libcdata_list_get_first_element(
+	     signatures_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first list element.",
+		 function );
+
+		return( -1 );
+	}
+	while( list_element != NULL )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature.",
+			 function );
+
+			return( -1 );
+		}
+		if( libsigscan_compiled_file_write_signature(
+		     file_io_handle,
+		     signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write signature.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next list element.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes a scan tree record including the partition scan tree records
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_file_write_scan_tree(
+     libbfio_handle_t *file_io_handle,
+     libsigscan_scan_tree_t *scan_tree,
+     libcerror_error_t **error )
+{
+	sigscan_compiled_file_scan_tree_record_t scan_tree_record;
+	sigscan_compiled_file_scan_tree_node_t node_data;
+
+	libsigscan_compiled_scan_tree_t *compiled_scan_tree = NULL;
+	libsigscan_compiled_scan_tree_node_t *node          = NULL;
+	uint8_t *signatures_data                            = NULL;
+	static char *function                               = "libsigscan_compiled_file_write_scan_tree";
+	size64_t record_size                                = 0;
+	size_t signatures_data_size                         = 0;
+	ssize_t write_count                                 = 0;
+	uint32_t node_index                                 = 0;
+	uint32_t scan_tree_type                             = 0;
+	uint32_t signature_index                            = 0;
+	uint16_t byte_value                                 = 0;
+	int partition_index                                 = 0;
+
+	if( libsigscan_compiled_file_get_scan_tree_record_size(
+	     scan_tree,
+	     &record_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve scan tree record size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_compiled_file_get_scan_tree_type(
+	     scan_tree,
+	     &scan_tree_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve scan tree type.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_tree_type == LIBSIGSCAN_COMPILED_FILE_SCAN_TREE_TYPE_COMPILED )
+	{
+		compiled_scan_tree = scan_tree->compiled_scan_tree;
+	}
+	if( memory_set(
+	     &scan_tree_record,
+	     0,
+	     sizeof( sigscan_compiled_file_scan_tree_record_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan tree record.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 scan_tree_record.record_size,
+	 record_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 scan_tree_record.scan_tree_type,
+	 scan_tree_type );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 scan_tree_record.pattern_offsets_mode,
+	 (uint32_t) scan_tree->pattern_offsets_mode );
+
+	if( compiled_scan_tree != NULL )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 scan_tree_record.number_of_nodes,
+		 compiled_scan_tree->number_of_nodes );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 scan_tree_record.number_of_signatures,
+		 compiled_scan_tree->number_of_signatures );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 scan_tree_record.number_of_partition_scan_trees,
+	 (uint32_t) scan_tree->number_of_partition_scan_trees );
+
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               (uint8_t *) &scan_tree_record,
+	               sizeof( sigscan_compiled_file_scan_tree_record_t ),
+	               error );
+
+	if( write_count != (ssize_t) sizeof( sigscan_compiled_file_scan_tree_record_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write scan tree record.",
+		 function );
+
+		goto on_error;
+	}
+	if( compiled_scan_tree != NULL )
+	{
+		signatures_data_size = ( ( 4 * (size_t) compiled_scan_tree->number_of_signatures ) + 7 ) & ~( (size_t) 7 );
+
+		if( ( signatures_data_size == 0 )
+		 || ( signatures_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid signatures data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		signatures_data = (uint8_t *) memory_allocate(
+		                               sizeof( uint8_t ) * signatures_data_size );
+
+		if( signatures_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create signatures data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     signatures_data,
+		     0,
+		     signatures_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear signatures data.",
+			 function );
+
+			goto on_error;
+		}
+		for( signature_index = 0;
+		     signature_index < compiled_scan_tree->number_of_signatures;
+		     signature_index++ )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( signatures_data[ signature_index * 4 ] ),
+			 (uint32_t) compiled_scan_tree->signatures[ signature_index ]->signature_index );
+		}
+		write_count = libbfio_handle_write_buffer(
+		               file_io_handle,
+		               signatures_data,
+		               signatures_data_size,
+		               error );
+
+		if( write_count != (ssize_t) signatures_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write signatures data.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 signatures_data );
+
+		signatures_data = NULL;
+
+#if defined( LIBSIGSCAN_COMPILED_FILE_HAVE_NATIVE_NODES )
+		if( sizeof( libsigscan_compiled_scan_tree_node_t ) == sizeof( sigscan_compiled_file_scan_tree_node_t ) )
+		{
+			write_count = libbfio_handle_write_buffer(
+			               file_io_handle,
+			               (uint8_t *) compiled_scan_tree->nodes,
+			               sizeof( libsigscan_compiled_scan_tree_node_t ) * compiled_scan_tree->number_of_nodes,
+			               error );
+
+			if( write_count != (ssize_t) ( sizeof( libsigscan_compiled_scan_tree_node_t ) * compiled_scan_tree->number_of_nodes ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write nodes.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+#endif
+		{
+			if( memory_set(
+			     &node_data,
+			     0,
+			     sizeof( sigscan_compiled_file_scan_tree_node_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear node data.",
+				 function );
+
+				goto on_error;
+			}
+			for( node_index = 0;
+			     node_index < compiled_scan_tree->number_of_nodes;
+			     node_index++ )
+			{
+				node = &( compiled_scan_tree->nodes[ node_index ] );
+
+				byte_stream_copy_from_uint64_little_endian(
+				 node_data.pattern_offset,
+				 (uint64_t) node->pattern_offset );
+
+				for( byte_value = 0;
+				     byte_value < 256;
+				     byte_value++ )
+				{
+					byte_stream_copy_from_uint32_little_endian(
+					 &( node_data.scan_object_references[ byte_value * 4 ] ),
+					 node->scan_object_references[ byte_value ] );
+				}
+				byte_stream_copy_from_uint32_little_endian(
+				 node_data.default_scan_object_reference,
+				 node->default_scan_object_reference );
+
+				write_count = libbfio_handle_write_buffer(
+				               file_io_handle,
+				               (uint8_t *) &node_data,
+				               sizeof( sigscan_compiled_file_scan_tree_node_t ),
+				               error );
+
+				if( write_count != (ssize_t) sizeof( sigscan_compiled_file_scan_tree_node_t ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write node: %" PRIu32 ".",
+					 function,
+					 node_index );
+
+					goto on_error;
+				}
+			}
+		}
+	}
+	else if( scan_tree_type == LIBSIGSCAN_COMPILED_FILE_SCAN_TREE_TYPE_PARTITIONS )
+	{
+		for( partition_index = 0;
+		     partition_index < scan_tree->number_of_partition_scan_trees;
+		     partition_index++ )
+		{
+			if( libsigscan_compiled_file_write_scan_tree(
+			     file_io_handle,
+			     scan_tree->partition_scan_trees[ partition_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write partition: %d scan tree.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( signatures_data != NULL )
+	{
+		memory_free(
+		 signatures_data );
+	}
+	return( -1 );
+}
+
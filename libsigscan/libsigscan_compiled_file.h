@@ -0,0 +1,164 @@
+/*
+ * Compiled file functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_COMPILED_FILE_H )
+#define _LIBSIGSCAN_COMPILED_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libbfio.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_scan_tree.h"
+#include "libsigscan_signature.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+extern const uint8_t sigscan_compiled_file_signature[ 8 ];
+
+typedef struct libsigscan_compiled_file libsigscan_compiled_file_t;
+
+struct libsigscan_compiled_file
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* Value to indicate the data is mapped into memory
+	 */
+	uint8_t data_is_mapped;
+
+	/* The current data offset
+	 */
+	size_t data_offset;
+
+	/* The unbounded scan engine
+	 */
+	int unbounded_scan_engine;
+
+	/* The number of signatures
+	 */
+	uint32_t number_of_signatures;
+
+	/* The signatures array
+	 * Maps a signature index to the signature, the signatures are owned by the signatures lists
+	 */
+	libsigscan_signature_t **signatures;
+};
+
+int libsigscan_compiled_file_initialize(
+     libsigscan_compiled_file_t **compiled_file,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_file_free(
+     libsigscan_compiled_file_t **compiled_file,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_file_open(
+     libsigscan_compiled_file_t *compiled_file,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_file_open_file_io_handle(
+     libsigscan_compiled_file_t *compiled_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_file_read_file_header(
+     libsigscan_compiled_file_t *compiled_file,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_file_read_signatures(
+     libsigscan_compiled_file_t *compiled_file,
+     libcdata_list_t *signatures_list,
+     libcdata_list_t *range_signatures_list,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_file_read_compiled_scan_tree(
+     libsigscan_compiled_file_t *compiled_file,
+     size_t data_offset,
+     uint32_t number_of_nodes,
+     uint32_t number_of_signatures,
+     libsigscan_scan_tree_t *scan_tree,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_file_read_scan_tree_record(
+     libsigscan_compiled_file_t *compiled_file,
+     size_t data_offset,
+     size_t data_end_offset,
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     int pattern_offsets_mode,
+     uint8_t is_partition,
+     size_t *record_size,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_file_read_scan_tree(
+     libsigscan_compiled_file_t *compiled_file,
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     int pattern_offsets_mode,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_file_get_scan_tree_type(
+     libsigscan_scan_tree_t *scan_tree,
+     uint32_t *scan_tree_type,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_file_get_scan_tree_record_size(
+     libsigscan_scan_tree_t *scan_tree,
+     size64_t *record_size,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_file_write_file_header(
+     libbfio_handle_t *file_io_handle,
+     int unbounded_scan_engine,
+     int number_of_signatures,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_file_write_signature(
+     libbfio_handle_t *file_io_handle,
+     libsigscan_signature_t *signature,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_file_write_signatures(
+     libbfio_handle_t *file_io_handle,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_file_write_scan_tree(
+     libbfio_handle_t *file_io_handle,
+     libsigscan_scan_tree_t *scan_tree,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_COMPILED_FILE_H ) */
+
@@ -0,0 +1,1534 @@
+/*
+ * Compiled scan tree functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_compiled_scan_tree.h"
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcnotify.h"
+#include "libsigscan_scan_object.h"
+#include "libsigscan_scan_tree_node.h"
+#include "libsigscan_signature.h"
+
+/* Creates compiled scan tree
+ * Make sure the value compiled_scan_tree is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_scan_tree_initialize(
+     libsigscan_compiled_scan_tree_t **compiled_scan_tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_compiled_scan_tree_initialize";
+
+	if( compiled_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compiled_scan_tree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compiled scan tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*compiled_scan_tree = memory_allocate_structure(
+	                       libsigscan_compiled_scan_tree_t );
+
+	if( *compiled_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compiled scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *compiled_scan_tree,
+	     0,
+	     sizeof( libsigscan_compiled_scan_tree_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compiled scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *compiled_scan_tree != NULL )
+	{
+		memory_free(
+		 *compiled_scan_tree );
+
+		*compiled_scan_tree = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees compiled scan tree
+ * The signatures are not freed since they are owned by the signatures list
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_scan_tree_free(
+     libsigscan_compiled_scan_tree_t **compiled_scan_tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_compiled_scan_tree_free";
+
+	if( compiled_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compiled_scan_tree != NULL )
+	{
+		if( ( *compiled_scan_tree )->signatures != NULL )
+		{
+			memory_free(
+			 ( *compiled_scan_tree )->signatures );
+		}
+		if( ( ( *compiled_scan_tree )->nodes != NULL )
+		 && ( ( *compiled_scan_tree )->has_external_nodes == 0 ) )
+		{
+			memory_free(
+			 ( *compiled_scan_tree )->nodes );
+		}
+		memory_free(
+		 *compiled_scan_tree );
+
+		*compiled_scan_tree = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an empty node
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_scan_tree_append_node(
+     libsigscan_compiled_scan_tree_t *compiled_scan_tree,
+     off64_t pattern_offset,
+     uint32_t *node_index,
+     libcerror_error_t **error )
+{
+	libsigscan_compiled_scan_tree_node_t *nodes = NULL;
+	static char *function                       = "libsigscan_compiled_scan_tree_append_node";
+	size_t nodes_size                           = 0;
+	uint32_t number_of_allocated_nodes          = 0;
+
+	if( compiled_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_scan_tree->has_external_nodes != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid compiled scan tree - unsupported external nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_scan_tree->number_of_nodes >= (uint32_t) LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_INDEX_MASK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compiled scan tree - number of nodes value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node index.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_scan_tree->number_of_nodes >= compiled_scan_tree->number_of_allocated_nodes )
+	{
+		if( compiled_scan_tree->number_of_allocated_nodes == 0 )
+		{
+			number_of_allocated_nodes = 16;
+		}
+		else
+		{
+			number_of_allocated_nodes = compiled_scan_tree->number_of_allocated_nodes * 2;
+		}
+		if( number_of_allocated_nodes > (uint32_t) LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_INDEX_MASK )
+		{
+			number_of_allocated_nodes = (uint32_t) LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_INDEX_MASK;
+		}
+		nodes_size = sizeof( libsigscan_compiled_scan_tree_node_t ) * number_of_allocated_nodes;
+
+		if( nodes_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid nodes size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		nodes = (libsigscan_compiled_scan_tree_node_t *) memory_reallocate(
+		                                                  compiled_scan_tree->nodes,
+		                                                  nodes_size );
+
+		if( nodes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize nodes.",
+			 function );
+
+			return( -1 );
+		}
+		compiled_scan_tree->nodes                     = nodes;
+		compiled_scan_tree->number_of_allocated_nodes = number_of_allocated_nodes;
+	}
+	nodes = &( compiled_scan_tree->nodes[ compiled_scan_tree->number_of_nodes ] );
+
+	if( memory_set(
+	     nodes,
+	     0,
+	     sizeof( libsigscan_compiled_scan_tree_node_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear node.",
+		 function );
+
+		return( -1 );
+	}
+	nodes->pattern_offset = pattern_offset;
+
+	*node_index = compiled_scan_tree->number_of_nodes;
+
+	compiled_scan_tree->number_of_nodes += 1;
+
+	return( 1 );
+}
+
+/* Appends a signature
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_scan_tree_append_signature(
+     libsigscan_compiled_scan_tree_t *compiled_scan_tree,
+     libsigscan_signature_t *signature,
+     uint32_t *signature_index,
+     libcerror_error_t **error )
+{
+	libsigscan_signature_t **signatures     = NULL;
+	static char *function                   = "libsigscan_compiled_scan_tree_append_signature";
+	size_t signatures_size                  = 0;
+	uint32_t number_of_allocated_signatures = 0;
+
+	if( compiled_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_scan_tree->number_of_signatures >= (uint32_t) LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_INDEX_MASK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compiled scan tree - number of signatures value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature index.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_scan_tree->number_of_signatures >= compiled_scan_tree->number_of_allocated_signatures )
+	{
+		if( compiled_scan_tree->number_of_allocated_signatures == 0 )
+		{
+			number_of_allocated_signatures = 16;
+		}
+		else
+		{
+			number_of_allocated_signatures = compiled_scan_tree->number_of_allocated_signatures * 2;
+		}
+		if( number_of_allocated_signatures > (uint32_t) LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_INDEX_MASK )
+		{
+			number_of_allocated_signatures = (uint32_t) LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_INDEX_MASK;
+		}
+		signatures_size = sizeof( libsigscan_signature_t * ) * number_of_allocated_signatures;
+
+		if( signatures_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid signatures size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		signatures = (libsigscan_signature_t **) memory_reallocate(
+		                                          compiled_scan_tree->signatures,
+		                                          signatures_size );
+
+		if( signatures == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize signatures.",
+			 function );
+
+			return( -1 );
+		}
+		compiled_scan_tree->signatures                     = signatures;
+		compiled_scan_tree->number_of_allocated_signatures = number_of_allocated_signatures;
+	}
+	compiled_scan_tree->signatures[ compiled_scan_tree->number_of_signatures ] = signature;
+
+	*signature_index = compiled_scan_tree->number_of_signatures;
+
+	compiled_scan_tree->number_of_signatures += 1;
+
+	return( 1 );
+}
+
+/* Compiles a scan object into a scan object reference
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_scan_tree_compile_scan_object(
+     libsigscan_compiled_scan_tree_t *compiled_scan_tree,
+     libsigscan_scan_object_t *scan_object,
+     uint32_t *scan_object_reference,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_tree_node_t *scan_tree_node = NULL;
+	libsigscan_signature_t *signature           = NULL;
+	static char *function                       = "libsigscan_compiled_scan_tree_compile_scan_object";
+	uint32_t object_index                       = 0;
+	uint8_t scan_object_type                    = 0;
+
+	if( scan_object_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan object reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_object_get_type(
+	     scan_object,
+	     &scan_object_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve scan object type.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_object_type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE )
+	{
+		if( libsigscan_scan_object_get_value(
+		     scan_object,
+		     (intptr_t **) &scan_tree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan object value.",
+			 function );
+
+			return( -1 );
+		}
+		if( libsigscan_compiled_scan_tree_compile_node(
+		     compiled_scan_tree,
+		     scan_tree_node,
+		     &object_index,
+		     recursion_depth + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to compile scan tree node.",
+			 function );
+
+			return( -1 );
+		}
+		*scan_object_reference = object_index;
+	}
+	else if( scan_object_type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE )
+	{
+		if( libsigscan_scan_object_get_value(
+		     scan_object,
+		     (intptr_t **) &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan object value.",
+			 function );
+
+			return( -1 );
+		}
+		if( libsigscan_compiled_scan_tree_append_signature(
+		     compiled_scan_tree,
+		     signature,
+		     &object_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append signature.",
+			 function );
+
+			return( -1 );
+		}
+		*scan_object_reference = LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_FLAG_SIGNATURE | object_index;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported scan object type: %" PRIu8 ".",
+		 function,
+		 scan_object_type );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compiles a scan tree node and its sub nodes
+ * The nodes are stored in depth-first order so that the nodes of a scan path are close together
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_scan_tree_compile_node(
+     libsigscan_compiled_scan_tree_t *compiled_scan_tree,
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     uint32_t *node_index,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	static char *function          = "libsigscan_compiled_scan_tree_compile_node";
+	uint32_t safe_node_index       = 0;
+	uint32_t scan_object_reference = 0;
+	uint16_t byte_value            = 0;
+
+	if( compiled_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBSIGSCAN_MAXIMUM_SCAN_TREE_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_compiled_scan_tree_append_node(
+	     compiled_scan_tree,
+	     scan_tree_node->pattern_offset,
+	     &safe_node_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append node.",
+		 function );
+
+		return( -1 );
+	}
+	/* Note that the nodes array can be reallocated when compiling the sub nodes
+	 * hence the node is referenced by its index
+	 */
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		if( scan_tree_node->scan_objects_table[ byte_value ] == NULL )
+		{
+			continue;
+		}
+		if( libsigscan_compiled_scan_tree_compile_scan_object(
+		     compiled_scan_tree,
+		     scan_tree_node->scan_objects_table[ byte_value ],
+		     &scan_object_reference,
+		     recursion_depth,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to compile scan object for byte value: 0x%02" PRIx16 ".",
+			 function,
+			 byte_value );
+
+			return( -1 );
+		}
+		compiled_scan_tree->nodes[ safe_node_index ].scan_object_references[ byte_value ] = scan_object_reference;
+	}
+	if( scan_tree_node->default_scan_object != NULL )
+	{
+		if( libsigscan_compiled_scan_tree_compile_scan_object(
+		     compiled_scan_tree,
+		     scan_tree_node->default_scan_object,
+		     &scan_object_reference,
+		     recursion_depth,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to compile default scan object.",
+			 function );
+
+			return( -1 );
+		}
+		compiled_scan_tree->nodes[ safe_node_index ].default_scan_object_reference = scan_object_reference;
+	}
+	*node_index = safe_node_index;
+
+	return( 1 );
+}
+
+/* Compiles a scan tree into the compiled scan tree
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_compiled_scan_tree_compile(
+     libsigscan_compiled_scan_tree_t *compiled_scan_tree,
+     libsigscan_scan_tree_node_t *root_node,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_compiled_scan_tree_compile";
+	uint32_t node_index   = 0;
+
+	if( compiled_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_scan_tree->number_of_nodes != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compiled scan tree - nodes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_compiled_scan_tree_compile_node(
+	     compiled_scan_tree,
+	     root_node,
+	     &node_index,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to compile root scan tree node.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: compiled scan tree with: %" PRIu32 " nodes and: %" PRIu32 " signatures.\n",
+		 function,
+		 compiled_scan_tree->number_of_nodes,
+		 compiled_scan_tree->number_of_signatures );
+	}
+#endif
+	return( 1 );
+}
+
+/* Scans the buffer for a signature that matches starting with a specific node
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libsigscan_compiled_scan_tree_scan_buffer(
+     libsigscan_compiled_scan_tree_t *compiled_scan_tree,
+     uint32_t node_index,
+     int pattern_offsets_mode,
+     off64_t data_offset,
+     size64_t data_size,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libsigscan_signature_t **signature,
+     libcerror_error_t **error )
+{
+	libsigscan_compiled_scan_tree_node_t *node = NULL;
+	static char *function                      = "libsigscan_compiled_scan_tree_scan_buffer";
+	off64_t scan_offset                        = 0;
+	uint32_t scan_object_reference             = 0;
+	int result                                 = 0;
+
+	if( compiled_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_index >= compiled_scan_tree->number_of_nodes )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pattern offsets mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_offset < 0 )
+	 || ( (size64_t) data_offset >= data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset >= buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	*signature = NULL;
+
+	do
+	{
+		node        = &( compiled_scan_tree->nodes[ node_index ] );
+		scan_offset = (off64_t) ( buffer_offset + node->pattern_offset );
+
+		if( (size64_t) scan_offset >= data_size )
+		{
+			/* If the pattern offset exceeds the data size
+			 * continue with the default scan object if available.
+			 */
+			scan_object_reference = node->default_scan_object_reference;
+		}
+		else if( scan_offset >= (off64_t) buffer_size )
+		{
+			/* If the pattern offset exceeds the buffer size of an unbounded scan
+			 * continue with the default scan object if available,
+			 * since signature patterns that do not fit in the buffer do not match.
+			 */
+			if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+			{
+				scan_object_reference = node->default_scan_object_reference;
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid scan offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			scan_object_reference = node->scan_object_references[ buffer[ scan_offset ] ];
+
+			if( scan_object_reference == LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_NONE )
+			{
+				scan_object_reference = node->default_scan_object_reference;
+			}
+		}
+		if( scan_object_reference == LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_NONE )
+		{
+			return( 0 );
+		}
+		if( ( scan_object_reference & LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_FLAG_SIGNATURE ) == 0 )
+		{
+			node_index = scan_object_reference;
+
+			continue;
+		}
+		*signature = compiled_scan_tree->signatures[ scan_object_reference & LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_INDEX_MASK ];
+
+		result = libsigscan_signature_scan_buffer(
+		          *signature,
+		          pattern_offsets_mode,
+		          data_offset,
+		          data_size,
+		          buffer,
+		          buffer_size,
+		          buffer_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan buffer with signature.",
+			 function );
+
+			*signature = NULL;
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+		*signature = NULL;
+
+		/* If the signature does not match continue with the default scan object if available,
+		 * which contains the signatures without a pattern at the pattern offset of the node
+		 */
+		if( ( node->default_scan_object_reference == LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_NONE )
+		 || ( node->default_scan_object_reference == scan_object_reference ) )
+		{
+			break;
+		}
+		if( ( node->default_scan_object_reference & LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_FLAG_SIGNATURE ) != 0 )
+		{
+			*signature = compiled_scan_tree->signatures[ node->default_scan_object_reference & LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_INDEX_MASK ];
+
+			result = libsigscan_signature_scan_buffer(
+			          *signature,
+			          pattern_offsets_mode,
+			          data_offset,
+			          data_size,
+			          buffer,
+			          buffer_size,
+			          buffer_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to scan buffer with default signature.",
+				 function );
+
+				*signature = NULL;
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				return( 1 );
+			}
+			*signature = NULL;
+
+			break;
+		}
+		node_index = node->default_scan_object_reference;
+	}
+	while( 1 );
+
+	return( 0 );
+}
+
+
+/* Inserts a signature into the scan object of a scan object reference
+ * The scan object reference is updated if the scan object is replaced by a node
+ * The fallback scan object reference is the default scan object reference of the node
+ * that contains the scan object reference, or none if the scan object reference
+ * is the default scan object reference itself
+ * Returns 1 if successful, 0 if the signature cannot be inserted or -1 on error
+ */
+int libsigscan_compiled_scan_tree_insert_into_scan_object(
+     libsigscan_compiled_scan_tree_t *compiled_scan_tree,
+     uint32_t *scan_object_reference,
+     uint32_t fallback_scan_object_reference,
+     off64_t node_pattern_offset,
+     libsigscan_signature_t *signature,
+     uint32_t signature_reference,
+     uint8_t *inserted_nodes,
+     uint32_t number_of_nodes,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libsigscan_compiled_scan_tree_node_t *node = NULL;
+	libsigscan_signature_t *existing_signature = NULL;
+	libsigscan_signature_t *largest_signature  = NULL;
+	libsigscan_signature_t *smallest_signature = NULL;
+	static char *function                      = "libsigscan_compiled_scan_tree_insert_into_scan_object";
+	size_t pattern_offset                      = 0;
+	size_t smallest_pattern_size               = 0;
+	uint32_t default_scan_object_reference     = 0;
+	uint32_t largest_scan_object_reference     = 0;
+	uint32_t node_index                        = 0;
+	uint32_t smallest_scan_object_reference    = 0;
+
+	if( compiled_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_object_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan object reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_object_reference == LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_NONE )
+	{
+		*scan_object_reference = signature_reference;
+
+		return( 1 );
+	}
+	if( ( *scan_object_reference & LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_FLAG_SIGNATURE ) == 0 )
+	{
+		return( libsigscan_compiled_scan_tree_insert_into_node(
+		         compiled_scan_tree,
+		         *scan_object_reference,
+		         signature,
+		         signature_reference,
+		         inserted_nodes,
+		         number_of_nodes,
+		         recursion_depth + 1,
+		         error ) );
+	}
+	if( ( *scan_object_reference & LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_INDEX_MASK ) >= compiled_scan_tree->number_of_signatures )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan object reference value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	existing_signature = compiled_scan_tree->signatures[ *scan_object_reference & LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_INDEX_MASK ];
+
+	if( existing_signature == signature )
+	{
+		return( 1 );
+	}
+	if( existing_signature->pattern_size <= signature->pattern_size )
+	{
+		smallest_pattern_size = existing_signature->pattern_size;
+	}
+	else
+	{
+		smallest_pattern_size = signature->pattern_size;
+	}
+	for( pattern_offset = 0;
+	     pattern_offset < smallest_pattern_size;
+	     pattern_offset++ )
+	{
+		if( existing_signature->pattern[ pattern_offset ] != signature->pattern[ pattern_offset ] )
+		{
+			break;
+		}
+	}
+	/* The signature leaf is replaced by a node that distinguishes both signatures
+	 * by the first pattern offset at which their patterns differ
+	 */
+	if( pattern_offset < smallest_pattern_size )
+	{
+		if( libsigscan_compiled_scan_tree_append_node(
+		     compiled_scan_tree,
+		     (off64_t) pattern_offset,
+		     &node_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append node.",
+			 function );
+
+			return( -1 );
+		}
+		node = &( compiled_scan_tree->nodes[ node_index ] );
+
+		node->scan_object_references[ existing_signature->pattern[ pattern_offset ] ] = *scan_object_reference;
+		node->scan_object_references[ signature->pattern[ pattern_offset ] ]          = signature_reference;
+		node->default_scan_object_reference                                           = fallback_scan_object_reference;
+
+		*scan_object_reference = node_index;
+
+		return( 1 );
+	}
+	/* Identical patterns cannot be distinguished by a node
+	 */
+	if( existing_signature->pattern_size == signature->pattern_size )
+	{
+		return( 0 );
+	}
+	/* If the pattern of one signature is a prefix of the other the signature leaf is replaced
+	 * by a node at the pattern offset after the smallest pattern, that contains the largest
+	 * signature. The smallest signature is the default of this node. If there is a fallback
+	 * the smallest signature is contained in a default node at the pattern offset of the parent
+	 * node, where both signatures have the same byte value, that continues with the fallback
+	 */
+	if( existing_signature->pattern_size < signature->pattern_size )
+	{
+		largest_signature              = signature;
+		largest_scan_object_reference  = signature_reference;
+		smallest_signature             = existing_signature;
+		smallest_scan_object_reference = *scan_object_reference;
+	}
+	else
+	{
+		largest_signature              = existing_signature;
+		largest_scan_object_reference  = *scan_object_reference;
+		smallest_signature             = signature;
+		smallest_scan_object_reference = signature_reference;
+	}
+	default_scan_object_reference = smallest_scan_object_reference;
+
+	if( fallback_scan_object_reference != LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_NONE )
+	{
+		if( ( node_pattern_offset < 0 )
+		 || ( (size64_t) node_pattern_offset >= (size64_t) smallest_signature->pattern_size ) )
+		{
+			return( 0 );
+		}
+		if( libsigscan_compiled_scan_tree_append_node(
+		     compiled_scan_tree,
+		     node_pattern_offset,
+		     &node_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append default node.",
+			 function );
+
+			return( -1 );
+		}
+		node = &( compiled_scan_tree->nodes[ node_index ] );
+
+		node->scan_object_references[ smallest_signature->pattern[ node_pattern_offset ] ] = smallest_scan_object_reference;
+		node->default_scan_object_reference                                                 = fallback_scan_object_reference;
+
+		default_scan_object_reference = node_index;
+	}
+	if( libsigscan_compiled_scan_tree_append_node(
+	     compiled_scan_tree,
+	     (off64_t) smallest_pattern_size,
+	     &node_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append node.",
+		 function );
+
+		return( -1 );
+	}
+	node = &( compiled_scan_tree->nodes[ node_index ] );
+
+	node->scan_object_references[ largest_signature->pattern[ smallest_pattern_size ] ] = largest_scan_object_reference;
+	node->default_scan_object_reference                                                = default_scan_object_reference;
+
+	*scan_object_reference = node_index;
+
+	return( 1 );
+}
+
+/* Inserts a signature into a node
+ * Nodes can be shared as the default of multiple nodes, the inserted nodes
+ * array is used to insert the signature only once into the nodes that existed
+ * before the insert. The nodes appended by the insert already contain the signature
+ * Returns 1 if successful, 0 if the signature cannot be inserted or -1 on error
+ */
+int libsigscan_compiled_scan_tree_insert_into_node(
+     libsigscan_compiled_scan_tree_t *compiled_scan_tree,
+     uint32_t node_index,
+     libsigscan_signature_t *signature,
+     uint32_t signature_reference,
+     uint8_t *inserted_nodes,
+     uint32_t number_of_nodes,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	static char *function          = "libsigscan_compiled_scan_tree_insert_into_node";
+	off64_t pattern_offset         = 0;
+	uint32_t scan_object_reference = 0;
+	uint16_t byte_value            = 0;
+	int result                     = 0;
+
+	if( compiled_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_nodes > compiled_scan_tree->number_of_nodes )
+	 || ( node_index >= compiled_scan_tree->number_of_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( inserted_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inserted nodes.",
+		 function );
+
+		return( -1 );
+	}
+	/* A scan tree that became too deep is rebuilt instead
+	 */
+	if( recursion_depth > LIBSIGSCAN_MAXIMUM_SCAN_TREE_RECURSION_DEPTH )
+	{
+		return( 0 );
+	}
+	if( ( node_index >= number_of_nodes )
+	 || ( inserted_nodes[ node_index ] != 0 ) )
+	{
+		return( 1 );
+	}
+	inserted_nodes[ node_index ] = 1;
+
+	pattern_offset = compiled_scan_tree->nodes[ node_index ].pattern_offset;
+
+	if( pattern_offset < 0 )
+	{
+		return( 0 );
+	}
+	if( (size64_t) pattern_offset < (size64_t) signature->pattern_size )
+	{
+		/* The signature is only scanned for with the byte value of its pattern
+		 * at the pattern offset of the node
+		 */
+		byte_value = signature->pattern[ pattern_offset ];
+
+		scan_object_reference = compiled_scan_tree->nodes[ node_index ].scan_object_references[ byte_value ];
+
+		if( scan_object_reference != LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_NONE )
+		{
+			result = libsigscan_compiled_scan_tree_insert_into_scan_object(
+			          compiled_scan_tree,
+			          &scan_object_reference,
+			          compiled_scan_tree->nodes[ node_index ].default_scan_object_reference,
+			          pattern_offset,
+			          signature,
+			          signature_reference,
+			          inserted_nodes,
+			          number_of_nodes,
+			          recursion_depth,
+			          error );
+
+			if( result == 1 )
+			{
+				compiled_scan_tree->nodes[ node_index ].scan_object_references[ byte_value ] = scan_object_reference;
+			}
+		}
+		/* Without a scan object for the byte value the default scan object is scanned,
+		 * which can contain signatures with the same byte value
+		 */
+		else if( compiled_scan_tree->nodes[ node_index ].default_scan_object_reference == LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_NONE )
+		{
+			compiled_scan_tree->nodes[ node_index ].scan_object_references[ byte_value ] = signature_reference;
+
+			result = 1;
+		}
+		else
+		{
+			scan_object_reference = compiled_scan_tree->nodes[ node_index ].default_scan_object_reference;
+
+			result = libsigscan_compiled_scan_tree_insert_into_scan_object(
+			          compiled_scan_tree,
+			          &scan_object_reference,
+			          LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_NONE,
+			          pattern_offset,
+			          signature,
+			          signature_reference,
+			          inserted_nodes,
+			          number_of_nodes,
+			          recursion_depth,
+			          error );
+
+			if( result == 1 )
+			{
+				compiled_scan_tree->nodes[ node_index ].default_scan_object_reference = scan_object_reference;
+			}
+		}
+	}
+	else
+	{
+		/* The pattern of the signature does not contain the pattern offset of the node
+		 * hence the signature is scanned for with every byte value. Signature leafs
+		 * continue with the default scan object if they do not match, but nodes do not
+		 */
+		result = 1;
+
+		for( byte_value = 0;
+		     byte_value < 256;
+		     byte_value++ )
+		{
+			scan_object_reference = compiled_scan_tree->nodes[ node_index ].scan_object_references[ byte_value ];
+
+			if( ( scan_object_reference == LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_NONE )
+			 || ( ( scan_object_reference & LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_FLAG_SIGNATURE ) != 0 ) )
+			{
+				continue;
+			}
+			result = libsigscan_compiled_scan_tree_insert_into_node(
+			          compiled_scan_tree,
+			          scan_object_reference,
+			          signature,
+			          signature_reference,
+			          inserted_nodes,
+			          number_of_nodes,
+			          recursion_depth + 1,
+			          error );
+
+			if( result != 1 )
+			{
+				break;
+			}
+		}
+		if( result == 1 )
+		{
+			scan_object_reference = compiled_scan_tree->nodes[ node_index ].default_scan_object_reference;
+
+			result = libsigscan_compiled_scan_tree_insert_into_scan_object(
+			          compiled_scan_tree,
+			          &scan_object_reference,
+			          LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_NONE,
+			          pattern_offset,
+			          signature,
+			          signature_reference,
+			          inserted_nodes,
+			          number_of_nodes,
+			          recursion_depth,
+			          error );
+
+			if( result == 1 )
+			{
+				compiled_scan_tree->nodes[ node_index ].default_scan_object_reference = scan_object_reference;
+			}
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to insert signature into node: %" PRIu32 ".",
+		 function,
+		 node_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Inserts an unbounded signature into the compiled scan tree
+ * The signature is inserted without rebuilding the compiled scan tree, the resulting
+ * compiled scan tree can contain more nodes than a compiled scan tree built with the signature
+ * If the signature cannot be inserted, the compiled scan tree needs to be rebuilt
+ * Returns 1 if successful, 0 if the signature cannot be inserted or -1 on error
+ */
+int libsigscan_compiled_scan_tree_insert_signature(
+     libsigscan_compiled_scan_tree_t *compiled_scan_tree,
+     libsigscan_signature_t *signature,
+     libcerror_error_t **error )
+{
+	uint8_t *inserted_nodes  = NULL;
+	static char *function    = "libsigscan_compiled_scan_tree_insert_signature";
+	uint32_t number_of_nodes = 0;
+	uint32_t signature_index = 0;
+	int result               = 0;
+
+	if( compiled_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( signature->pattern == NULL )
+	 || ( signature->pattern_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid signature - missing pattern.",
+		 function );
+
+		return( -1 );
+	}
+	/* The nodes of a compiled scan tree read from a compiled file cannot be modified
+	 */
+	if( ( compiled_scan_tree->has_external_nodes != 0 )
+	 || ( compiled_scan_tree->number_of_nodes == 0 ) )
+	{
+		return( 0 );
+	}
+	number_of_nodes = compiled_scan_tree->number_of_nodes;
+
+	inserted_nodes = (uint8_t *) memory_allocate(
+	                              sizeof( uint8_t ) * number_of_nodes );
+
+	if( inserted_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inserted nodes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     inserted_nodes,
+	     0,
+	     sizeof( uint8_t ) * number_of_nodes ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear inserted nodes.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_compiled_scan_tree_append_signature(
+	     compiled_scan_tree,
+	     signature,
+	     &signature_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append signature.",
+		 function );
+
+		goto on_error;
+	}
+	result = libsigscan_compiled_scan_tree_insert_into_node(
+	          compiled_scan_tree,
+	          0,
+	          signature,
+	          LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_FLAG_SIGNATURE | signature_index,
+	          inserted_nodes,
+	          number_of_nodes,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to insert signature into root node.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 inserted_nodes );
+
+	return( result );
+
+on_error:
+	if( inserted_nodes != NULL )
+	{
+		memory_free(
+		 inserted_nodes );
+	}
+	return( -1 );
+}
@@ -0,0 +1,172 @@
+/*
+ * Compiled scan tree functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_COMPILED_SCAN_TREE_H )
+#define _LIBSIGSCAN_COMPILED_SCAN_TREE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libcerror.h"
+#include "libsigscan_scan_object.h"
+#include "libsigscan_scan_tree_node.h"
+#include "libsigscan_signature.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_compiled_scan_tree_node libsigscan_compiled_scan_tree_node_t;
+
+struct libsigscan_compiled_scan_tree_node
+{
+	/* The pattern offset
+	 */
+	off64_t pattern_offset;
+
+	/* The scan object references per byte value
+	 */
+	uint32_t scan_object_references[ 256 ];
+
+	/* The default scan object reference
+	 */
+	uint32_t default_scan_object_reference;
+};
+
+typedef struct libsigscan_compiled_scan_tree libsigscan_compiled_scan_tree_t;
+
+struct libsigscan_compiled_scan_tree
+{
+	/* The nodes array
+	 * The root node is stored at index 0
+	 */
+	libsigscan_compiled_scan_tree_node_t *nodes;
+
+	/* The number of nodes
+	 */
+	uint32_t number_of_nodes;
+
+	/* The number of allocated nodes
+	 */
+	uint32_t number_of_allocated_nodes;
+
+	/* Value to indicate the nodes array is stored externally, such as in a compiled file,
+	 * and is not freed together with the compiled scan tree
+	 */
+	uint8_t has_external_nodes;
+
+	/* The signatures array
+	 */
+	libsigscan_signature_t **signatures;
+
+	/* The number of signatures
+	 */
+	uint32_t number_of_signatures;
+
+	/* The number of allocated signatures
+	 */
+	uint32_t number_of_allocated_signatures;
+};
+
+int libsigscan_compiled_scan_tree_initialize(
+     libsigscan_compiled_scan_tree_t **compiled_scan_tree,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_scan_tree_free(
+     libsigscan_compiled_scan_tree_t **compiled_scan_tree,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_scan_tree_append_node(
+     libsigscan_compiled_scan_tree_t *compiled_scan_tree,
+     off64_t pattern_offset,
+     uint32_t *node_index,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_scan_tree_append_signature(
+     libsigscan_compiled_scan_tree_t *compiled_scan_tree,
+     libsigscan_signature_t *signature,
+     uint32_t *signature_index,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_scan_tree_compile_scan_object(
+     libsigscan_compiled_scan_tree_t *compiled_scan_tree,
+     libsigscan_scan_object_t *scan_object,
+     uint32_t *scan_object_reference,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_scan_tree_compile_node(
+     libsigscan_compiled_scan_tree_t *compiled_scan_tree,
+     libsigscan_scan_tree_node_t *scan_tree_node,
+     uint32_t *node_index,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_scan_tree_compile(
+     libsigscan_compiled_scan_tree_t *compiled_scan_tree,
+     libsigscan_scan_tree_node_t *root_node,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_scan_tree_scan_buffer(
+     libsigscan_compiled_scan_tree_t *compiled_scan_tree,
+     uint32_t node_index,
+     int pattern_offsets_mode,
+     off64_t data_offset,
+     size64_t data_size,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libsigscan_signature_t **signature,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_scan_tree_insert_into_scan_object(
+     libsigscan_compiled_scan_tree_t *compiled_scan_tree,
+     uint32_t *scan_object_reference,
+     uint32_t fallback_scan_object_reference,
+     off64_t node_pattern_offset,
+     libsigscan_signature_t *signature,
+     uint32_t signature_reference,
+     uint8_t *inserted_nodes,
+     uint32_t number_of_nodes,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_scan_tree_insert_into_node(
+     libsigscan_compiled_scan_tree_t *compiled_scan_tree,
+     uint32_t node_index,
+     libsigscan_signature_t *signature,
+     uint32_t signature_reference,
+     uint8_t *inserted_nodes,
+     uint32_t number_of_nodes,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libsigscan_compiled_scan_tree_insert_signature(
+     libsigscan_compiled_scan_tree_t *compiled_scan_tree,
+     libsigscan_signature_t *signature,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_COMPILED_SCAN_TREE_H ) */
+
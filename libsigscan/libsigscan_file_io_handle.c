@@ -0,0 +1,1156 @@
+/*
+ * The I/O strategy file IO handle functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* O_DIRECT is only defined by the GNU C library if _GNU_SOURCE is defined
+ */
+#if !defined( _GNU_SOURCE )
+#define _GNU_SOURCE
+#endif
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include <errno.h>
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_file_io_handle.h"
+#include "libsigscan_libbfio.h"
+#include "libsigscan_libcerror.h"
+
+#if defined( LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX )
+
+#if defined( HAVE_POSIX_FADVISE ) && defined( POSIX_FADV_SEQUENTIAL ) && defined( POSIX_FADV_NOREUSE ) && defined( POSIX_FADV_DONTNEED )
+#define LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX_FADVISE
+#endif
+
+/* Creates an I/O strategy file IO handle
+ * Make sure the value io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_file_io_handle_initialize(
+     libsigscan_file_io_handle_t **io_handle,
+     int io_strategy,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_file_io_handle_initialize";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_strategy != LIBSIGSCAN_IO_STRATEGY_BUFFERED )
+	 && ( io_strategy != LIBSIGSCAN_IO_STRATEGY_DIRECT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported I/O strategy.",
+		 function );
+
+		return( -1 );
+	}
+	*io_handle = memory_allocate_structure(
+	              libsigscan_file_io_handle_t );
+
+	if( *io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_handle,
+	     0,
+	     sizeof( libsigscan_file_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *io_handle )->io_strategy     = io_strategy;
+	( *io_handle )->file_descriptor = -1;
+
+	return( 1 );
+
+on_error:
+	if( *io_handle != NULL )
+	{
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an I/O strategy file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_file_io_handle_free(
+     libsigscan_file_io_handle_t **io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_file_io_handle_free";
+	int result            = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_handle != NULL )
+	{
+		if( ( *io_handle )->file_descriptor != -1 )
+		{
+			if( libsigscan_file_io_handle_close(
+			     *io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->name != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->name );
+		}
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) an I/O strategy file IO handle
+ * The file of the destination IO handle is not opened
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_file_io_handle_clone(
+     libsigscan_file_io_handle_t **destination_io_handle,
+     libsigscan_file_io_handle_t *source_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_file_io_handle_clone";
+
+	if( destination_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_io_handle == NULL )
+	{
+		return( 1 );
+	}
+	if( libsigscan_file_io_handle_initialize(
+	     destination_io_handle,
+	     source_io_handle->io_strategy,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_io_handle->name != NULL )
+	{
+		if( libsigscan_file_io_handle_set_name(
+		     *destination_io_handle,
+		     source_io_handle->name,
+		     source_io_handle->name_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set name in destination IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_io_handle != NULL )
+	{
+		libsigscan_file_io_handle_free(
+		 destination_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a file IO handle that reads the data of a file using an I/O strategy
+ * Make sure the value file_io_handle is referencing, is set to NULL
+ * The I/O strategy file IO handle is managed by the file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_file_io_handle_initialize_bfio_handle(
+     libbfio_handle_t **file_io_handle,
+     libsigscan_file_io_handle_t **io_handle,
+     int io_strategy,
+     libcerror_error_t **error )
+{
+	libsigscan_file_io_handle_t *safe_io_handle = NULL;
+	static char *function                       = "libsigscan_file_io_handle_initialize_bfio_handle";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_file_io_handle_initialize(
+	     &safe_io_handle,
+	     io_strategy,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     file_io_handle,
+	     (intptr_t *) safe_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libsigscan_file_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libsigscan_file_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libsigscan_file_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libsigscan_file_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libsigscan_file_io_handle_read_buffer,
+	     NULL,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libsigscan_file_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libsigscan_file_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libsigscan_file_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libsigscan_file_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	*io_handle = safe_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( safe_io_handle != NULL )
+	{
+		libsigscan_file_io_handle_free(
+		 &safe_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the name
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_file_io_handle_set_name(
+     libsigscan_file_io_handle_t *io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_file_io_handle_set_name";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - file already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length == 0 )
+	 || ( name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->name != NULL )
+	{
+		memory_free(
+		 io_handle->name );
+
+		io_handle->name      = NULL;
+		io_handle->name_size = 0;
+	}
+	io_handle->name = narrow_string_allocate(
+	                   name_length + 1 );
+
+	if( io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_string_copy(
+	     io_handle->name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		memory_free(
+		 io_handle->name );
+
+		io_handle->name = NULL;
+
+		return( -1 );
+	}
+	io_handle->name[ name_length ] = 0;
+
+	io_handle->name_size = name_length + 1;
+
+	return( 1 );
+}
+
+/* Opens the IO handle
+ * Only read access is supported
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_file_io_handle_open(
+     libsigscan_file_io_handle_t *io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_file_io_handle_open";
+	off64_t end_offset    = 0;
+	intptr_t misalignment = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - file already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags - read access required.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags - write access not supported.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->is_direct = 0;
+
+#if defined( O_DIRECT )
+	if( io_handle->io_strategy == LIBSIGSCAN_IO_STRATEGY_DIRECT )
+	{
+		io_handle->file_descriptor = open(
+		                              io_handle->name,
+		                              O_RDONLY | O_DIRECT );
+
+		if( io_handle->file_descriptor != -1 )
+		{
+			io_handle->is_direct = 1;
+		}
+		/* If the file system does not support direct I/O the file is read using buffered I/O
+		 */
+		else if( errno != EINVAL )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to open file: %s.",
+			 function,
+			 io_handle->name );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( io_handle->file_descriptor == -1 )
+	{
+		io_handle->file_descriptor = open(
+		                              io_handle->name,
+		                              O_RDONLY );
+
+		if( io_handle->file_descriptor == -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to open file: %s.",
+			 function,
+			 io_handle->name );
+
+			return( -1 );
+		}
+	}
+	/* The end offset is used as the size so that the size of a device is determined as well
+	 */
+	end_offset = (off64_t) lseek(
+	                        io_handle->file_descriptor,
+	                        0,
+	                        SEEK_END );
+
+	if( end_offset < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to determine size of file: %s.",
+		 function,
+		 io_handle->name );
+
+		goto on_error;
+	}
+	if( io_handle->is_direct != 0 )
+	{
+		io_handle->block_size = LIBSIGSCAN_FILE_IO_HANDLE_DIRECT_BLOCK_SIZE;
+	}
+	else
+	{
+		io_handle->block_size = LIBSIGSCAN_FILE_IO_HANDLE_BUFFERED_BLOCK_SIZE;
+	}
+	/* The block data of direct I/O must be aligned, hence the alignment is allocated in addition to the block size
+	 */
+	io_handle->block_allocation = (uint8_t *) memory_allocate(
+	                                           sizeof( uint8_t ) * ( io_handle->block_size + LIBSIGSCAN_FILE_IO_HANDLE_DIRECT_IO_ALIGNMENT ) );
+
+	if( io_handle->block_allocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block data.",
+		 function );
+
+		goto on_error;
+	}
+	misalignment = (intptr_t) io_handle->block_allocation % LIBSIGSCAN_FILE_IO_HANDLE_DIRECT_IO_ALIGNMENT;
+
+	io_handle->block_data = io_handle->block_allocation;
+
+	if( misalignment != 0 )
+	{
+		io_handle->block_data += LIBSIGSCAN_FILE_IO_HANDLE_DIRECT_IO_ALIGNMENT - misalignment;
+	}
+#if defined( LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX_FADVISE )
+	if( io_handle->is_direct == 0 )
+	{
+		/* The advice is a hint hence failure is ignored
+		 */
+		posix_fadvise(
+		 io_handle->file_descriptor,
+		 0,
+		 0,
+		 POSIX_FADV_SEQUENTIAL );
+
+		posix_fadvise(
+		 io_handle->file_descriptor,
+		 0,
+		 0,
+		 POSIX_FADV_NOREUSE );
+	}
+#endif
+	io_handle->size            = (size64_t) end_offset;
+	io_handle->current_offset  = 0;
+	io_handle->block_offset    = 0;
+	io_handle->block_data_size = 0;
+	io_handle->released_offset = 0;
+
+	return( 1 );
+
+on_error:
+	if( io_handle->block_allocation != NULL )
+	{
+		memory_free(
+		 io_handle->block_allocation );
+
+		io_handle->block_allocation = NULL;
+		io_handle->block_data       = NULL;
+	}
+	close(
+	 io_handle->file_descriptor );
+
+	io_handle->file_descriptor = -1;
+
+	return( -1 );
+}
+
+/* Closes the IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libsigscan_file_io_handle_close(
+     libsigscan_file_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_file_io_handle_close";
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - file not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_allocation != NULL )
+	{
+		memory_free(
+		 io_handle->block_allocation );
+
+		io_handle->block_allocation = NULL;
+		io_handle->block_data       = NULL;
+	}
+	if( close(
+	     io_handle->file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file: %s.",
+		 function,
+		 io_handle->name );
+
+		result = -1;
+	}
+	io_handle->file_descriptor = -1;
+	io_handle->is_direct       = 0;
+	io_handle->block_size      = 0;
+	io_handle->block_data_size = 0;
+
+	return( result );
+}
+
+/* Reads data at the current offset into a buffer
+ * The data is read in blocks of the block size, a buffered read of at least
+ * the block size is read directly into the buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsigscan_file_io_handle_read_buffer(
+         libsigscan_file_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libsigscan_file_io_handle_read_buffer";
+	size_t block_index    = 0;
+	size_t buffer_offset  = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	off64_t read_offset   = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - file not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < size )
+	{
+		if( (size64_t) io_handle->current_offset >= io_handle->size )
+		{
+			break;
+		}
+		read_size = size - buffer_offset;
+
+		if( ( io_handle->current_offset >= io_handle->block_offset )
+		 && ( io_handle->current_offset < (off64_t) ( io_handle->block_offset + io_handle->block_data_size ) ) )
+		{
+			block_index = (size_t) ( io_handle->current_offset - io_handle->block_offset );
+
+			if( read_size > ( io_handle->block_data_size - block_index ) )
+			{
+				read_size = io_handle->block_data_size - block_index;
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( io_handle->block_data[ block_index ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy block data to buffer.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset             += read_size;
+			io_handle->current_offset += (off64_t) read_size;
+
+			continue;
+		}
+		if( ( io_handle->is_direct == 0 )
+		 && ( read_size >= io_handle->block_size ) )
+		{
+			read_count = pread(
+			              io_handle->file_descriptor,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              io_handle->current_offset );
+
+			if( read_count > 0 )
+			{
+				buffer_offset             += (size_t) read_count;
+				io_handle->current_offset += (off64_t) read_count;
+			}
+		}
+		else
+		{
+			/* The blocks of direct I/O are read at aligned offsets
+			 */
+			read_offset = io_handle->current_offset;
+
+			if( io_handle->is_direct != 0 )
+			{
+				read_offset -= read_offset % LIBSIGSCAN_FILE_IO_HANDLE_DIRECT_IO_ALIGNMENT;
+			}
+			io_handle->block_data_size = 0;
+
+			read_count = pread(
+			              io_handle->file_descriptor,
+			              io_handle->block_data,
+			              io_handle->block_size,
+			              read_offset );
+
+			if( read_count > 0 )
+			{
+				io_handle->block_offset    = read_offset;
+				io_handle->block_data_size = (size_t) read_count;
+
+				/* The file is shorter than its size at open
+				 */
+				if( io_handle->current_offset >= (off64_t) ( read_offset + read_count ) )
+				{
+					read_count = 0;
+				}
+			}
+		}
+		if( read_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read from file at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 io_handle->current_offset,
+			 io_handle->current_offset );
+
+			return( -1 );
+		}
+		if( read_count == 0 )
+		{
+			break;
+		}
+	}
+#if defined( LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX_FADVISE )
+	/* The buffered data that has been read is released from the page cache
+	 * so that scanning a large file does not evict the data of other files
+	 */
+	if( ( io_handle->is_direct == 0 )
+	 && ( io_handle->current_offset >= ( io_handle->released_offset + LIBSIGSCAN_FILE_IO_HANDLE_RELEASE_SIZE ) ) )
+	{
+		read_offset = io_handle->current_offset - ( io_handle->current_offset % LIBSIGSCAN_FILE_IO_HANDLE_RELEASE_SIZE );
+
+		posix_fadvise(
+		 io_handle->file_descriptor,
+		 io_handle->released_offset,
+		 read_offset - io_handle->released_offset,
+		 POSIX_FADV_DONTNEED );
+
+		io_handle->released_offset = read_offset;
+	}
+#endif
+	return( (ssize_t) buffer_offset );
+}
+
+/* Seeks a certain offset
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libsigscan_file_io_handle_seek_offset(
+         libsigscan_file_io_handle_t *io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libsigscan_file_io_handle_seek_offset";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - file not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) io_handle->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in file: %s.",
+		 function,
+		 offset,
+		 offset,
+		 io_handle->name );
+
+		return( -1 );
+	}
+	io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if a file exists
+ * Returns 1 if file exists, 0 if not or -1 on error
+ */
+int libsigscan_file_io_handle_exists(
+     libsigscan_file_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_file_io_handle_exists";
+	int file_descriptor   = -1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor != -1 )
+	{
+		return( 1 );
+	}
+	file_descriptor = open(
+	                   io_handle->name,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		if( ( errno == ENOENT )
+		 || ( errno == ENOTDIR ) )
+		{
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 io_handle->name );
+
+		return( -1 );
+	}
+	close(
+	 file_descriptor );
+
+	return( 1 );
+}
+
+/* Check if the file is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libsigscan_file_io_handle_is_open(
+     libsigscan_file_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_file_io_handle_is_open";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the file size
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_file_io_handle_get_size(
+     libsigscan_file_io_handle_t *io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_file_io_handle_get_size";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - file not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = io_handle->size;
+
+	return( 1 );
+}
+
+#endif /* defined( LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX ) */
+
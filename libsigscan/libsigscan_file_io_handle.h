@@ -0,0 +1,167 @@
+/*
+ * The I/O strategy file IO handle functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_FILE_IO_HANDLE_H )
+#define _LIBSIGSCAN_FILE_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libbfio.h"
+#include "libsigscan_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_OPEN ) && defined( HAVE_CLOSE ) && defined( HAVE_LSEEK ) && defined( HAVE_PREAD )
+#define LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX
+#endif
+
+#if defined( LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX )
+
+typedef struct libsigscan_file_io_handle libsigscan_file_io_handle_t;
+
+struct libsigscan_file_io_handle
+{
+	/* The name
+	 */
+	char *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The I/O strategy
+	 */
+	int io_strategy;
+
+	/* The file descriptor
+	 * Contains -1 if the file is not open
+	 */
+	int file_descriptor;
+
+	/* Value to indicate the file was opened for direct I/O
+	 */
+	uint8_t is_direct;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The block allocation
+	 * The block data is aligned within the block allocation
+	 */
+	uint8_t *block_allocation;
+
+	/* The block data
+	 */
+	uint8_t *block_data;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The offset of the data in the block
+	 */
+	off64_t block_offset;
+
+	/* The size of the data in the block
+	 */
+	size_t block_data_size;
+
+	/* The offset up to which the data was released from the page cache
+	 */
+	off64_t released_offset;
+};
+
+int libsigscan_file_io_handle_initialize(
+     libsigscan_file_io_handle_t **io_handle,
+     int io_strategy,
+     libcerror_error_t **error );
+
+int libsigscan_file_io_handle_free(
+     libsigscan_file_io_handle_t **io_handle,
+     libcerror_error_t **error );
+
+int libsigscan_file_io_handle_clone(
+     libsigscan_file_io_handle_t **destination_io_handle,
+     libsigscan_file_io_handle_t *source_io_handle,
+     libcerror_error_t **error );
+
+int libsigscan_file_io_handle_initialize_bfio_handle(
+     libbfio_handle_t **file_io_handle,
+     libsigscan_file_io_handle_t **io_handle,
+     int io_strategy,
+     libcerror_error_t **error );
+
+int libsigscan_file_io_handle_set_name(
+     libsigscan_file_io_handle_t *io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libsigscan_file_io_handle_open(
+     libsigscan_file_io_handle_t *io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libsigscan_file_io_handle_close(
+     libsigscan_file_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+ssize_t libsigscan_file_io_handle_read_buffer(
+         libsigscan_file_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libsigscan_file_io_handle_seek_offset(
+         libsigscan_file_io_handle_t *io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libsigscan_file_io_handle_exists(
+     libsigscan_file_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libsigscan_file_io_handle_is_open(
+     libsigscan_file_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libsigscan_file_io_handle_get_size(
+     libsigscan_file_io_handle_t *io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_FILE_IO_HANDLE_H ) */
+
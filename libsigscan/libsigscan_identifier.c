@@ -301,12 +301,14 @@ int libsigscan_identifier_set(
 
 		return( -1 );
 	}
-	if( string[ string_length - 1 ] != 0 )
+	/* The string does not need to be terminated by an end-of-string character
+	 */
+	if( string[ string_length - 1 ] == 0 )
 	{
-		string_length += 1;
+		string_length -= 1;
 	}
 	identifier->string = (char *) memory_allocate(
-	                               sizeof( char ) * string_length );
+	                               sizeof( char ) * ( string_length + 1 ) );
 
 	if( identifier->string == NULL )
 	{
@@ -319,12 +321,12 @@ int libsigscan_identifier_set(
 
 		goto on_error;
 	}
-	identifier->string_size = string_length;
+	identifier->string_size = string_length + 1;
 
 	if( memory_copy(
 	     identifier->string,
 	     string,
-	     identifier->string_size ) == NULL )
+	     string_length ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -335,6 +337,8 @@ int libsigscan_identifier_set(
 
 		goto on_error;
 	}
+	identifier->string[ string_length ] = 0;
+
 	return( 1 );
 
 on_error:
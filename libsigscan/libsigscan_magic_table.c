@@ -0,0 +1,1060 @@
+/*
+ * Magic table functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcnotify.h"
+#include "libsigscan_magic_table.h"
+#include "libsigscan_signature.h"
+
+/* Creates a magic table
+ * Make sure the value magic_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_magic_table_initialize(
+     libsigscan_magic_table_t **magic_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_magic_table_initialize";
+
+	if( magic_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid magic table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *magic_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid magic table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*magic_table = memory_allocate_structure(
+	                libsigscan_magic_table_t );
+
+	if( *magic_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create magic table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *magic_table,
+	     0,
+	     sizeof( libsigscan_magic_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear magic table.",
+		 function );
+
+		memory_free(
+		 *magic_table );
+
+		*magic_table = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *magic_table != NULL )
+	{
+		memory_free(
+		 *magic_table );
+
+		*magic_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a magic table
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_magic_table_free(
+     libsigscan_magic_table_t **magic_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_magic_table_free";
+	int group_index       = 0;
+
+	if( magic_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid magic table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *magic_table != NULL )
+	{
+		for( group_index = 0;
+		     group_index < LIBSIGSCAN_MAGIC_TABLE_MAXIMUM_NUMBER_OF_GROUPS;
+		     group_index++ )
+		{
+			if( ( *magic_table )->groups[ group_index ].keys != NULL )
+			{
+				memory_free(
+				 ( *magic_table )->groups[ group_index ].keys );
+			}
+			if( ( *magic_table )->groups[ group_index ].signatures != NULL )
+			{
+				memory_free(
+				 ( *magic_table )->groups[ group_index ].signatures );
+			}
+		}
+		memory_free(
+		 *magic_table );
+
+		*magic_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the key of the data
+ * The key is the little-endian value of the first key size bytes of the data
+ * Returns the key
+ */
+uint64_t libsigscan_magic_table_get_key(
+          const uint8_t *data,
+          size_t key_size )
+{
+	uint64_t key         = 0;
+	uint32_t value_32bit = 0;
+
+	if( key_size == 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 data,
+		 key );
+	}
+	else if( key_size == 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 data,
+		 value_32bit );
+
+		key = (uint64_t) value_32bit;
+	}
+	else
+	{
+		while( key_size > 0 )
+		{
+			key_size--;
+
+			key <<= 8;
+			key  |= data[ key_size ];
+		}
+	}
+	return( key );
+}
+
+/* Fills a magic table group
+ * The signatures of the group are stored in a table that is indexed
+ * by a perfect hash of their key
+ * Returns 1 if successful, 0 if no perfect hash could be determined or -1 on error
+ */
+int libsigscan_magic_table_fill_group(
+     libsigscan_magic_table_group_t *group,
+     libcdata_list_t *signatures_list,
+     uint32_t signature_flags,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element = NULL;
+	libsigscan_signature_t **signatures   = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	uint64_t *keys                        = NULL;
+	static char *function                 = "libsigscan_magic_table_fill_group";
+	size_t hash_index                     = 0;
+	uint64_t hash_multiplier              = 0;
+	int attempt_index                     = 0;
+	int number_of_hash_bits               = 0;
+	int number_of_signatures              = 0;
+	int result                            = 0;
+	int signature_index                   = 0;
+	int compare_signature_index           = 0;
+
+	if( group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid group.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( group->number_of_signatures <= 0 )
+	 || ( group->number_of_signatures > ( 1 << ( LIBSIGSCAN_MAGIC_TABLE_MAXIMUM_NUMBER_OF_HASH_BITS - 1 ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid group - number of signatures value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( group->key_size == 0 )
+	 || ( group->key_size > 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid group - key size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( group->keys != NULL )
+	 || ( group->signatures != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid group - keys or signatures value already set.",
+		 function );
+
+		return( -1 );
+	}
+	keys = (uint64_t *) memory_allocate(
+	                     sizeof( uint64_t ) * group->number_of_signatures );
+
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create keys.",
+		 function );
+
+		goto on_error;
+	}
+	signatures = (libsigscan_signature_t **) memory_allocate(
+	                                          sizeof( libsigscan_signature_t * ) * group->number_of_signatures );
+
+	if( signatures == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create signatures.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_list_get_first_element(
+	     signatures_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first list element.",
+		 function );
+
+		goto on_error;
+	}
+	while( list_element != NULL )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature.",
+			 function );
+
+			goto on_error;
+		}
+		if( signature == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == signature_flags )
+		 && ( signature->pattern_offset == group->pattern_offset )
+		 && ( signature->pattern_size == group->pattern_size ) )
+		{
+			if( number_of_signatures >= group->number_of_signatures )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of signatures value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			keys[ number_of_signatures ] = libsigscan_magic_table_get_key(
+			                                signature->pattern,
+			                                group->key_size );
+
+			signatures[ number_of_signatures ] = signature;
+
+			number_of_signatures++;
+		}
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next list element.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( number_of_signatures != group->number_of_signatures )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of signatures value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* Signatures with the same key cannot be distinguished by a perfect hash
+	 */
+	for( signature_index = 0;
+	     signature_index < number_of_signatures;
+	     signature_index++ )
+	{
+		for( compare_signature_index = signature_index + 1;
+		     compare_signature_index < number_of_signatures;
+		     compare_signature_index++ )
+		{
+			if( keys[ signature_index ] == keys[ compare_signature_index ] )
+			{
+				break;
+			}
+		}
+		if( compare_signature_index < number_of_signatures )
+		{
+			break;
+		}
+	}
+	if( signature_index >= number_of_signatures )
+	{
+		/* The hash table is at least twice the number of signatures
+		 */
+		number_of_hash_bits = 1;
+
+		while( ( 1 << number_of_hash_bits ) < ( 2 * number_of_signatures ) )
+		{
+			number_of_hash_bits++;
+		}
+		while( ( result == 0 )
+		    && ( number_of_hash_bits <= LIBSIGSCAN_MAGIC_TABLE_MAXIMUM_NUMBER_OF_HASH_BITS ) )
+		{
+			group->keys = (uint64_t *) memory_allocate(
+			                            sizeof( uint64_t ) << number_of_hash_bits );
+
+			if( group->keys == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create group keys.",
+				 function );
+
+				goto on_error;
+			}
+			group->signatures = (libsigscan_signature_t **) memory_allocate(
+			                                                 sizeof( libsigscan_signature_t * ) << number_of_hash_bits );
+
+			if( group->signatures == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create group signatures.",
+				 function );
+
+				goto on_error;
+			}
+			/* The hash multipliers are taken from a fixed (splitmix64) sequence
+			 * so that the resulting table is reproducible
+			 */
+			for( attempt_index = 0;
+			     attempt_index < LIBSIGSCAN_MAGIC_TABLE_NUMBER_OF_HASH_ATTEMPTS;
+			     attempt_index++ )
+			{
+				hash_multiplier = ( (uint64_t) ( ( number_of_hash_bits << 8 ) | attempt_index ) + 1 ) * 0x9e3779b97f4a7c15ULL;
+				hash_multiplier = ( hash_multiplier ^ ( hash_multiplier >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+				hash_multiplier = ( hash_multiplier ^ ( hash_multiplier >> 27 ) ) * 0x94d049bb133111ebULL;
+				hash_multiplier = ( hash_multiplier ^ ( hash_multiplier >> 31 ) ) | 1;
+
+				if( memory_set(
+				     group->signatures,
+				     0,
+				     sizeof( libsigscan_signature_t * ) << number_of_hash_bits ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to clear group signatures.",
+					 function );
+
+					goto on_error;
+				}
+				for( signature_index = 0;
+				     signature_index < number_of_signatures;
+				     signature_index++ )
+				{
+					hash_index = (size_t) ( ( keys[ signature_index ] * hash_multiplier ) >> ( 64 - number_of_hash_bits ) );
+
+					if( group->signatures[ hash_index ] != NULL )
+					{
+						break;
+					}
+					group->keys[ hash_index ]       = keys[ signature_index ];
+					group->signatures[ hash_index ] = signatures[ signature_index ];
+				}
+				if( signature_index >= number_of_signatures )
+				{
+					group->hash_multiplier     = hash_multiplier;
+					group->number_of_hash_bits = number_of_hash_bits;
+
+					result = 1;
+
+					break;
+				}
+			}
+			if( result == 0 )
+			{
+				memory_free(
+				 group->signatures );
+
+				group->signatures = NULL;
+
+				memory_free(
+				 group->keys );
+
+				group->keys = NULL;
+
+				number_of_hash_bits++;
+			}
+		}
+	}
+	memory_free(
+	 signatures );
+
+	memory_free(
+	 keys );
+
+	return( result );
+
+on_error:
+	if( group->signatures != NULL )
+	{
+		memory_free(
+		 group->signatures );
+
+		group->signatures = NULL;
+	}
+	if( group->keys != NULL )
+	{
+		memory_free(
+		 group->keys );
+
+		group->keys = NULL;
+	}
+	if( signatures != NULL )
+	{
+		memory_free(
+		 signatures );
+	}
+	if( keys != NULL )
+	{
+		memory_free(
+		 keys );
+	}
+	return( -1 );
+}
+
+/* Fills the magic table
+ * The bounded signatures are grouped by pattern offset and size
+ * Returns 1 if successful, 0 if the signatures cannot be stored in the magic table or -1 on error
+ */
+int libsigscan_magic_table_fill(
+     libsigscan_magic_table_t *magic_table,
+     libcdata_list_t *signatures_list,
+     int pattern_offsets_mode,
+     libcerror_error_t **error )
+{
+	libsigscan_magic_table_group_t group;
+
+	libcdata_list_element_t *list_element          = NULL;
+	libsigscan_magic_table_group_t *previous_group = NULL;
+	libsigscan_signature_t *signature              = NULL;
+	static char *function                          = "libsigscan_magic_table_fill";
+	uint32_t signature_flags                       = 0;
+	int group_index                                = 0;
+	int result                                     = 1;
+	int sort_group_index                           = 0;
+
+	if( magic_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid magic table.",
+		 function );
+
+		return( -1 );
+	}
+	if( magic_table->number_of_groups != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid magic table - groups value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+	{
+		signature_flags = LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START;
+	}
+	else if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+	{
+		signature_flags = LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pattern offsets mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_first_element(
+	     signatures_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first list element.",
+		 function );
+
+		goto on_error;
+	}
+	while( list_element != NULL )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature.",
+			 function );
+
+			goto on_error;
+		}
+		if( signature == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == signature_flags )
+		{
+			for( group_index = 0;
+			     group_index < magic_table->number_of_groups;
+			     group_index++ )
+			{
+				if( ( magic_table->groups[ group_index ].pattern_offset == signature->pattern_offset )
+				 && ( magic_table->groups[ group_index ].pattern_size == signature->pattern_size ) )
+				{
+					break;
+				}
+			}
+			if( group_index >= magic_table->number_of_groups )
+			{
+				/* Too many groups are slower to dispatch than the scan tree
+				 */
+				if( magic_table->number_of_groups >= LIBSIGSCAN_MAGIC_TABLE_MAXIMUM_NUMBER_OF_GROUPS )
+				{
+					result = 0;
+
+					break;
+				}
+				magic_table->groups[ group_index ].pattern_offset = signature->pattern_offset;
+				magic_table->groups[ group_index ].pattern_size   = signature->pattern_size;
+
+				if( signature->pattern_size < 8 )
+				{
+					magic_table->groups[ group_index ].key_size = signature->pattern_size;
+				}
+				else
+				{
+					magic_table->groups[ group_index ].key_size = 8;
+				}
+				magic_table->number_of_groups += 1;
+			}
+			magic_table->groups[ group_index ].number_of_signatures += 1;
+		}
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next list element.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( magic_table->number_of_groups == 0 )
+	{
+		result = 0;
+	}
+	if( result != 0 )
+	{
+		/* The groups are scanned in order of their pattern offset in the data,
+		 * where of groups with the same pattern offset the group with the
+		 * largest pattern size is scanned first since its signatures are the most specific
+		 */
+		for( group_index = 1;
+		     group_index < magic_table->number_of_groups;
+		     group_index++ )
+		{
+			group = magic_table->groups[ group_index ];
+
+			for( sort_group_index = group_index;
+			     sort_group_index > 0;
+			     sort_group_index-- )
+			{
+				previous_group = &( magic_table->groups[ sort_group_index - 1 ] );
+
+				if( previous_group->pattern_offset == group.pattern_offset )
+				{
+					if( previous_group->pattern_size >= group.pattern_size )
+					{
+						break;
+					}
+				}
+				else if( ( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+				      == ( previous_group->pattern_offset < group.pattern_offset ) )
+				{
+					break;
+				}
+				magic_table->groups[ sort_group_index ] = magic_table->groups[ sort_group_index - 1 ];
+			}
+			magic_table->groups[ sort_group_index ] = group;
+		}
+		for( group_index = 0;
+		     group_index < magic_table->number_of_groups;
+		     group_index++ )
+		{
+			result = libsigscan_magic_table_fill_group(
+			          &( magic_table->groups[ group_index ] ),
+			          signatures_list,
+			          signature_flags,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to fill group: %d.",
+				 function,
+				 group_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+	}
+	if( result == 0 )
+	{
+		for( group_index = 0;
+		     group_index < magic_table->number_of_groups;
+		     group_index++ )
+		{
+			if( magic_table->groups[ group_index ].signatures != NULL )
+			{
+				memory_free(
+				 magic_table->groups[ group_index ].signatures );
+			}
+			if( magic_table->groups[ group_index ].keys != NULL )
+			{
+				memory_free(
+				 magic_table->groups[ group_index ].keys );
+			}
+		}
+		if( memory_set(
+		     magic_table,
+		     0,
+		     sizeof( libsigscan_magic_table_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear magic table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+
+on_error:
+	for( group_index = 0;
+	     group_index < magic_table->number_of_groups;
+	     group_index++ )
+	{
+		if( magic_table->groups[ group_index ].signatures != NULL )
+		{
+			memory_free(
+			 magic_table->groups[ group_index ].signatures );
+		}
+		if( magic_table->groups[ group_index ].keys != NULL )
+		{
+			memory_free(
+			 magic_table->groups[ group_index ].keys );
+		}
+	}
+	memory_set(
+	 magic_table,
+	 0,
+	 sizeof( libsigscan_magic_table_t ) );
+
+	return( -1 );
+}
+
+/* Scans the buffer for a signature in the magic table
+ * The groups are looked up by the key at their pattern offset where the
+ * signature is confirmed by its full pattern
+ * Returns 1 if a signature matches, 0 if not or -1 on error
+ */
+int libsigscan_magic_table_scan_buffer(
+     libsigscan_magic_table_t *magic_table,
+     int pattern_offsets_mode,
+     off64_t data_offset,
+     size64_t data_size,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libsigscan_signature_t **signature,
+     libcerror_error_t **error )
+{
+	libsigscan_magic_table_group_t *group = NULL;
+	static char *function                 = "libsigscan_magic_table_scan_buffer";
+	off64_t pattern_offset                = 0;
+	size_t hash_index                     = 0;
+	size_t scan_offset                    = 0;
+	uint64_t key                          = 0;
+	int group_index                       = 0;
+	int result                            = 0;
+
+	if( magic_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid magic table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pattern offsets mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_offset < 0 )
+	 || ( (size64_t) data_offset >= data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset >= buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	*signature = NULL;
+
+	for( group_index = 0;
+	     group_index < magic_table->number_of_groups;
+	     group_index++ )
+	{
+		group = &( magic_table->groups[ group_index ] );
+
+		if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+		{
+			pattern_offset = group->pattern_offset;
+		}
+		else
+		{
+			if( (size64_t) group->pattern_offset > data_size )
+			{
+				continue;
+			}
+			pattern_offset = (off64_t) ( data_size - group->pattern_offset );
+		}
+		/* The pattern must be stored in the data and in the buffer
+		 */
+		if( ( pattern_offset < data_offset )
+		 || ( (size64_t) group->pattern_size > data_size )
+		 || ( (size64_t) pattern_offset > ( data_size - group->pattern_size ) ) )
+		{
+			continue;
+		}
+		if( (size64_t) ( pattern_offset - data_offset ) >= (size64_t) ( buffer_size - buffer_offset ) )
+		{
+			continue;
+		}
+		scan_offset = buffer_offset + (size_t) ( pattern_offset - data_offset );
+
+		if( group->pattern_size > ( buffer_size - scan_offset ) )
+		{
+			continue;
+		}
+		key = libsigscan_magic_table_get_key(
+		       &( buffer[ scan_offset ] ),
+		       group->key_size );
+
+		hash_index = (size_t) ( ( key * group->hash_multiplier ) >> ( 64 - group->number_of_hash_bits ) );
+
+		if( ( group->signatures[ hash_index ] == NULL )
+		 || ( group->keys[ hash_index ] != key ) )
+		{
+			continue;
+		}
+		result = libsigscan_signature_scan_buffer(
+		          group->signatures[ hash_index ],
+		          pattern_offsets_mode,
+		          data_offset,
+		          data_size,
+		          buffer,
+		          buffer_size,
+		          buffer_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan buffer with signature.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*signature = group->signatures[ hash_index ];
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_DEBUG_OUTPUT )
+
+/* Prints a magic table
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_magic_table_printf(
+     libsigscan_magic_table_t *magic_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_magic_table_printf";
+	int group_index       = 0;
+
+	if( magic_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid magic table.",
+		 function );
+
+		return( -1 );
+	}
+	libcnotify_printf(
+	 "Magic table:\n" );
+
+	libcnotify_printf(
+	 "\tNumber of groups\t: %d\n",
+	 magic_table->number_of_groups );
+
+	for( group_index = 0;
+	     group_index < magic_table->number_of_groups;
+	     group_index++ )
+	{
+		libcnotify_printf(
+		 "\tGroup: %d\t\t: offset: %" PRIi64 ", size: %" PRIzd ", signatures: %d, hash bits: %d\n",
+		 group_index,
+		 magic_table->groups[ group_index ].pattern_offset,
+		 magic_table->groups[ group_index ].pattern_size,
+		 magic_table->groups[ group_index ].number_of_signatures,
+		 magic_table->groups[ group_index ].number_of_hash_bits );
+	}
+	libcnotify_printf(
+	 "\n" );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
@@ -0,0 +1,138 @@
+/*
+ * Magic table functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_MAGIC_TABLE_H )
+#define _LIBSIGSCAN_MAGIC_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_signature.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_magic_table_group libsigscan_magic_table_group_t;
+
+struct libsigscan_magic_table_group
+{
+	/* The pattern offset
+	 * The offset is relative to the start or end of the data depending on the pattern offsets mode
+	 */
+	off64_t pattern_offset;
+
+	/* The pattern size
+	 */
+	size_t pattern_size;
+
+	/* The key size, which is the number of bytes of the pattern that are used as key
+	 */
+	size_t key_size;
+
+	/* The number of signatures
+	 */
+	int number_of_signatures;
+
+	/* The hash multiplier
+	 */
+	uint64_t hash_multiplier;
+
+	/* The number of hash bits
+	 */
+	int number_of_hash_bits;
+
+	/* The keys per hash
+	 */
+	uint64_t *keys;
+
+	/* The signatures per hash
+	 * NULL if the hash is not used
+	 */
+	libsigscan_signature_t **signatures;
+};
+
+typedef struct libsigscan_magic_table libsigscan_magic_table_t;
+
+struct libsigscan_magic_table
+{
+	/* The groups of signatures with the same pattern offset and size
+	 * The groups are sorted by the pattern offset in the data and pattern size, largest first
+	 */
+	libsigscan_magic_table_group_t groups[ LIBSIGSCAN_MAGIC_TABLE_MAXIMUM_NUMBER_OF_GROUPS ];
+
+	/* The number of groups
+	 */
+	int number_of_groups;
+};
+
+int libsigscan_magic_table_initialize(
+     libsigscan_magic_table_t **magic_table,
+     libcerror_error_t **error );
+
+int libsigscan_magic_table_free(
+     libsigscan_magic_table_t **magic_table,
+     libcerror_error_t **error );
+
+uint64_t libsigscan_magic_table_get_key(
+          const uint8_t *data,
+          size_t key_size );
+
+int libsigscan_magic_table_fill_group(
+     libsigscan_magic_table_group_t *group,
+     libcdata_list_t *signatures_list,
+     uint32_t signature_flags,
+     libcerror_error_t **error );
+
+int libsigscan_magic_table_fill(
+     libsigscan_magic_table_t *magic_table,
+     libcdata_list_t *signatures_list,
+     int pattern_offsets_mode,
+     libcerror_error_t **error );
+
+int libsigscan_magic_table_scan_buffer(
+     libsigscan_magic_table_t *magic_table,
+     int pattern_offsets_mode,
+     off64_t data_offset,
+     size64_t data_size,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     libsigscan_signature_t **signature,
+     libcerror_error_t **error );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+
+int libsigscan_magic_table_printf(
+     libsigscan_magic_table_t *magic_table,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_MAGIC_TABLE_H ) */
+
@@ -0,0 +1,495 @@
+/*
+ * Packed multi-literal matcher functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcnotify.h"
+#include "libsigscan_packed_matcher.h"
+#include "libsigscan_signature.h"
+
+/* Creates a packed matcher
+ * Make sure the value packed_matcher is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_packed_matcher_initialize(
+     libsigscan_packed_matcher_t **packed_matcher,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_packed_matcher_initialize";
+
+	if( packed_matcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid packed matcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( *packed_matcher != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid packed matcher value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*packed_matcher = memory_allocate_structure(
+	                   libsigscan_packed_matcher_t );
+
+	if( *packed_matcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create packed matcher.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *packed_matcher,
+	     0,
+	     sizeof( libsigscan_packed_matcher_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear packed matcher.",
+		 function );
+
+		memory_free(
+		 *packed_matcher );
+
+		*packed_matcher = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *packed_matcher != NULL )
+	{
+		memory_free(
+		 *packed_matcher );
+
+		*packed_matcher = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a packed matcher
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_packed_matcher_free(
+     libsigscan_packed_matcher_t **packed_matcher,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_packed_matcher_free";
+
+	if( packed_matcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid packed matcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( *packed_matcher != NULL )
+	{
+		memory_free(
+		 *packed_matcher );
+
+		*packed_matcher = NULL;
+	}
+	return( 1 );
+}
+
+/* Fills the packed matcher
+ * The prefix of every unbounded signature is assigned to a bucket, where
+ * signatures with the same prefix share a bucket
+ * Returns 1 if successful, 0 if the packed matcher cannot be used or -1 on error
+ */
+int libsigscan_packed_matcher_fill(
+     libsigscan_packed_matcher_t *packed_matcher,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error )
+{
+	uint8_t prefixes[ LIBSIGSCAN_PACKED_MATCHER_MAXIMUM_NUMBER_OF_SIGNATURES ][ LIBSIGSCAN_PACKED_MATCHER_MAXIMUM_PREFIX_SIZE ];
+
+	libcdata_list_element_t *list_element = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	static char *function                 = "libsigscan_packed_matcher_fill";
+	size_t prefix_index                   = 0;
+	size_t smallest_pattern_size          = 0;
+	uint8_t bucket_mask                   = 0;
+	int number_of_signatures              = 0;
+	int pass                              = 0;
+	int prefix_number                     = 0;
+
+	if( packed_matcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid packed matcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( packed_matcher->number_of_signatures != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid packed matcher - already filled.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first pass determines the number of signatures and the smallest pattern size
+	 * the second pass fills the bucket masks
+	 */
+	for( pass = 0;
+	     pass < 2;
+	     pass++ )
+	{
+		if( libcdata_list_get_first_element(
+		     signatures_list,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first list element.",
+			 function );
+
+			return( -1 );
+		}
+		while( list_element != NULL )
+		{
+			if( libcdata_list_element_get_value(
+			     list_element,
+			     (intptr_t **) &signature,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve signature.",
+				 function );
+
+				return( -1 );
+			}
+			if( signature == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing signature.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET )
+			 && ( signature->pattern != NULL ) )
+			{
+				if( pass == 0 )
+				{
+					if( ( number_of_signatures == 0 )
+					 || ( signature->pattern_size < smallest_pattern_size ) )
+					{
+						smallest_pattern_size = signature->pattern_size;
+					}
+					number_of_signatures++;
+				}
+				else
+				{
+					for( prefix_number = 0;
+					     prefix_number < packed_matcher->number_of_prefixes;
+					     prefix_number++ )
+					{
+						if( memory_compare(
+						     prefixes[ prefix_number ],
+						     signature->pattern,
+						     packed_matcher->prefix_size ) == 0 )
+						{
+							break;
+						}
+					}
+					if( prefix_number >= packed_matcher->number_of_prefixes )
+					{
+						if( memory_copy(
+						     prefixes[ prefix_number ],
+						     signature->pattern,
+						     packed_matcher->prefix_size ) == NULL )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_MEMORY,
+							 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+							 "%s: unable to copy prefix.",
+							 function );
+
+							return( -1 );
+						}
+						packed_matcher->number_of_prefixes += 1;
+					}
+					bucket_mask = (uint8_t) ( 1 << ( prefix_number % LIBSIGSCAN_PACKED_MATCHER_NUMBER_OF_BUCKETS ) );
+
+					for( prefix_index = 0;
+					     prefix_index < packed_matcher->prefix_size;
+					     prefix_index++ )
+					{
+						packed_matcher->bucket_masks[ prefix_index ][ signature->pattern[ prefix_index ] ] |= bucket_mask;
+					}
+					packed_matcher->number_of_signatures += 1;
+				}
+			}
+			if( libcdata_list_element_get_next_element(
+			     list_element,
+			     &list_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next list element.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( pass == 0 )
+		{
+			/* A prefix of a single byte value is better handled by the prefilter
+			 */
+			if( ( number_of_signatures == 0 )
+			 || ( number_of_signatures > LIBSIGSCAN_PACKED_MATCHER_MAXIMUM_NUMBER_OF_SIGNATURES )
+			 || ( smallest_pattern_size < 2 ) )
+			{
+				return( 0 );
+			}
+			if( smallest_pattern_size > LIBSIGSCAN_PACKED_MATCHER_MAXIMUM_PREFIX_SIZE )
+			{
+				smallest_pattern_size = LIBSIGSCAN_PACKED_MATCHER_MAXIMUM_PREFIX_SIZE;
+			}
+			packed_matcher->prefix_size = smallest_pattern_size;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the offset of the next candidate position in the buffer
+ * A pattern can only start at a candidate position, where the bytes
+ * at the position match the prefixes of the same bucket
+ * Returns 1 if successful, 0 if the buffer contains no candidate position or -1 on error
+ */
+int libsigscan_packed_matcher_get_candidate_offset(
+     libsigscan_packed_matcher_t *packed_matcher,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t *candidate_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_packed_matcher_get_candidate_offset";
+	size_t last_offset    = 0;
+	size_t scan_offset    = 0;
+	uint8_t bucket_mask   = 0;
+
+	if( packed_matcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid packed matcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( packed_matcher->prefix_size < 2 )
+	 || ( packed_matcher->prefix_size > LIBSIGSCAN_PACKED_MATCHER_MAXIMUM_PREFIX_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid packed matcher - prefix size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( candidate_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid candidate offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* A pattern that does not fit in the remainder of the buffer cannot match
+	 */
+	if( ( buffer_offset >= buffer_size )
+	 || ( packed_matcher->prefix_size > ( buffer_size - buffer_offset ) ) )
+	{
+		return( 0 );
+	}
+	last_offset = buffer_size - packed_matcher->prefix_size;
+
+	/* The bucket masks of the prefix bytes are combined, where a bit that
+	 * remains set indicates that all the prefix bytes of the bucket match
+	 */
+	if( packed_matcher->prefix_size == 3 )
+	{
+		for( scan_offset = buffer_offset;
+		     scan_offset <= last_offset;
+		     scan_offset++ )
+		{
+			bucket_mask = packed_matcher->bucket_masks[ 0 ][ buffer[ scan_offset ] ];
+
+			if( bucket_mask != 0 )
+			{
+				bucket_mask &= packed_matcher->bucket_masks[ 1 ][ buffer[ scan_offset + 1 ] ]
+				             & packed_matcher->bucket_masks[ 2 ][ buffer[ scan_offset + 2 ] ];
+
+				if( bucket_mask != 0 )
+				{
+					*candidate_offset = scan_offset;
+
+					return( 1 );
+				}
+			}
+		}
+	}
+	else
+	{
+		for( scan_offset = buffer_offset;
+		     scan_offset <= last_offset;
+		     scan_offset++ )
+		{
+			bucket_mask = packed_matcher->bucket_masks[ 0 ][ buffer[ scan_offset ] ]
+			            & packed_matcher->bucket_masks[ 1 ][ buffer[ scan_offset + 1 ] ];
+
+			if( bucket_mask != 0 )
+			{
+				*candidate_offset = scan_offset;
+
+				return( 1 );
+			}
+		}
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_DEBUG_OUTPUT )
+
+/* Prints a packed matcher
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_packed_matcher_printf(
+     libsigscan_packed_matcher_t *packed_matcher,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_packed_matcher_printf";
+
+	if( packed_matcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid packed matcher.",
+		 function );
+
+		return( -1 );
+	}
+	libcnotify_printf(
+	 "Packed matcher:\n" );
+
+	libcnotify_printf(
+	 "\tNumber of signatures\t: %d\n",
+	 packed_matcher->number_of_signatures );
+
+	libcnotify_printf(
+	 "\tNumber of prefixes\t: %d\n",
+	 packed_matcher->number_of_prefixes );
+
+	libcnotify_printf(
+	 "\tPrefix size\t\t: %" PRIzd "\n",
+	 packed_matcher->prefix_size );
+
+	libcnotify_printf(
+	 "\n" );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
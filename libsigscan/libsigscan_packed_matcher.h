@@ -0,0 +1,92 @@
+/*
+ * Packed multi-literal matcher functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_PACKED_MATCHER_H )
+#define _LIBSIGSCAN_PACKED_MATCHER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_packed_matcher libsigscan_packed_matcher_t;
+
+struct libsigscan_packed_matcher
+{
+	/* The number of signatures
+	 */
+	int number_of_signatures;
+
+	/* The number of distinct prefixes
+	 */
+	int number_of_prefixes;
+
+	/* The prefix size
+	 */
+	size_t prefix_size;
+
+	/* The bucket masks per prefix byte
+	 * contains a bit for every bucket with a prefix that has the byte value at the prefix offset
+	 */
+	uint8_t bucket_masks[ LIBSIGSCAN_PACKED_MATCHER_MAXIMUM_PREFIX_SIZE ][ 256 ];
+};
+
+int libsigscan_packed_matcher_initialize(
+     libsigscan_packed_matcher_t **packed_matcher,
+     libcerror_error_t **error );
+
+int libsigscan_packed_matcher_free(
+     libsigscan_packed_matcher_t **packed_matcher,
+     libcerror_error_t **error );
+
+int libsigscan_packed_matcher_fill(
+     libsigscan_packed_matcher_t *packed_matcher,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error );
+
+int libsigscan_packed_matcher_get_candidate_offset(
+     libsigscan_packed_matcher_t *packed_matcher,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t *candidate_offset,
+     libcerror_error_t **error );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+
+int libsigscan_packed_matcher_printf(
+     libsigscan_packed_matcher_t *packed_matcher,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_PACKED_MATCHER_H ) */
+
@@ -94,43 +94,47 @@ int libsigscan_pattern_weights_initialize(
 
 		return( -1 );
 	}
-	if( libcdata_list_initialize(
-	     &( ( *pattern_weights )->offset_groups_list ),
-	     error ) != 1 )
+	( *pattern_weights )->offset_groups = (libsigscan_offset_group_t **) memory_allocate(
+	                                                                      sizeof( libsigscan_offset_group_t * ) * 16 );
+
+	if( ( *pattern_weights )->offset_groups == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create offset groups list.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create offset groups.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcdata_list_initialize(
-	     &( ( *pattern_weights )->weight_groups_list ),
-	     error ) != 1 )
+	( *pattern_weights )->number_of_allocated_offset_groups = 16;
+
+	( *pattern_weights )->weight_groups = (libsigscan_weight_group_t **) memory_allocate(
+	                                                                      sizeof( libsigscan_weight_group_t * ) * 16 );
+
+	if( ( *pattern_weights )->weight_groups == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create weight groups list.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create weight groups.",
 		 function );
 
 		goto on_error;
 	}
+	( *pattern_weights )->number_of_allocated_weight_groups = 16;
+
 	return( 1 );
 
 on_error:
 	if( *pattern_weights != NULL )
 	{
-		if( ( *pattern_weights )->offset_groups_list != NULL )
+		if( ( *pattern_weights )->offset_groups != NULL )
 		{
-			libcdata_list_free(
-			 &( ( *pattern_weights )->offset_groups_list ),
-			 NULL,
-			 NULL );
+			memory_free(
+			 ( *pattern_weights )->offset_groups );
 		}
 		memory_free(
 		 *pattern_weights );
@@ -148,6 +152,7 @@ int libsigscan_pattern_weights_free(
      libcerror_error_t **error )
 {
 	static char *function = "libsigscan_pattern_weights_free";
+	int group_index       = 0;
 	int result            = 1;
 
 	if( pattern_weights == NULL )
@@ -163,33 +168,53 @@ int libsigscan_pattern_weights_free(
 	}
 	if( *pattern_weights != NULL )
 	{
-		if( libcdata_list_free(
-		     &( ( *pattern_weights )->offset_groups_list ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_group_free,
-		     error ) != 1 )
+		if( ( *pattern_weights )->offset_groups != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free offset groups list.",
-			 function );
-
-			result = -1;
+			for( group_index = 0;
+			     group_index < ( *pattern_weights )->number_of_offset_groups;
+			     group_index++ )
+			{
+				if( libsigscan_offset_group_free(
+				     &( ( *pattern_weights )->offset_groups[ group_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free offset group: %d.",
+					 function,
+					 group_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *pattern_weights )->offset_groups );
 		}
-		if( libcdata_list_free(
-		     &( ( *pattern_weights )->weight_groups_list ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_weight_group_free,
-		     error ) != 1 )
+		if( ( *pattern_weights )->weight_groups != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free weight groups list.",
-			 function );
-
-			result = -1;
+			for( group_index = 0;
+			     group_index < ( *pattern_weights )->number_of_weight_groups;
+			     group_index++ )
+			{
+				if( libsigscan_weight_group_free(
+				     &( ( *pattern_weights )->weight_groups[ group_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free weight group: %d.",
+					 function,
+					 group_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *pattern_weights )->weight_groups );
 		}
 		memory_free(
 		 *pattern_weights );
@@ -317,7 +342,6 @@ int libsigscan_pattern_weights_get_largest_weight(
      int *largest_weight,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *list_element   = NULL;
 	libsigscan_offset_group_t *offset_group = NULL;
 	static char *function                   = "libsigscan_pattern_weights_get_largest_weight";
 
@@ -332,38 +356,34 @@ int libsigscan_pattern_weights_get_largest_weight(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_last_element(
-	     pattern_weights->offset_groups_list,
-	     &list_element,
-	     error ) != 1 )
+	if( pattern_weights->offset_groups == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve last offset groups list element.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pattern weights - missing offset groups.",
 		 function );
 
 		return( -1 );
 	}
-	if( list_element == NULL )
-	{
-		return( 0 );
-	}
-	if( libcdata_list_element_get_value(
-	     list_element,
-	     (intptr_t **) &offset_group,
-	     error ) != 1 )
+	if( largest_weight == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve last offset group.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid largest weight.",
 		 function );
 
 		return( -1 );
 	}
+	if( pattern_weights->number_of_offset_groups == 0 )
+	{
+		return( 0 );
+	}
+	offset_group = pattern_weights->offset_groups[ pattern_weights->number_of_offset_groups - 1 ];
+
 	if( libsigscan_offset_group_get_weight(
 	     offset_group,
 	     largest_weight,
@@ -381,18 +401,21 @@ int libsigscan_pattern_weights_get_largest_weight(
 	return( 1 );
 }
 
-/* Retrieves a specific offset group
+/* Retrieves the index of the offset group of a specific weight
+ * If no such offset group exists the index is set to where the offset group should be inserted
  * Returns 1 if successful, 0 if no such value or -1 on error
  */
-int libsigscan_pattern_weights_get_offset_group(
+int libsigscan_pattern_weights_get_offset_group_index(
      libsigscan_pattern_weights_t *pattern_weights,
      int weight,
-     libsigscan_offset_group_t **offset_group,
+     int *offset_group_index,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *list_element = NULL;
-	static char *function                 = "libsigscan_pattern_weights_get_offset_group";
-	int result                            = 0;
+	libsigscan_offset_group_t *offset_group = NULL;
+	static char *function                   = "libsigscan_pattern_weights_get_offset_group_index";
+	int first_group_index                   = 0;
+	int group_index                         = 0;
+	int last_group_index                    = 0;
 
 	if( pattern_weights == NULL )
 	{
@@ -405,88 +428,226 @@ int libsigscan_pattern_weights_get_offset_group(
 
 		return( -1 );
 	}
-	if( offset_group == NULL )
+	if( pattern_weights->offset_groups == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset group.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pattern weights - missing offset groups.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_list_get_first_element(
-	     pattern_weights->offset_groups_list,
-	     &list_element,
-	     error ) != 1 )
+	if( offset_group_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first list element.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset group index.",
 		 function );
 
 		return( -1 );
 	}
-	while( list_element != NULL )
+	last_group_index = pattern_weights->number_of_offset_groups;
+
+	while( first_group_index < last_group_index )
 	{
-		if( libcdata_list_element_get_value(
-		     list_element,
-		     (intptr_t **) offset_group,
-		     error ) != 1 )
+		group_index = first_group_index + ( ( last_group_index - first_group_index ) / 2 );
+
+		offset_group = pattern_weights->offset_groups[ group_index ];
+
+		if( offset_group == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve offset group.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing offset group: %d.",
+			 function,
+			 group_index );
 
 			return( -1 );
 		}
-		if( *offset_group == NULL )
+		if( offset_group->weight == weight )
+		{
+			*offset_group_index = group_index;
+
+			return( 1 );
+		}
+		if( offset_group->weight < weight )
+		{
+			first_group_index = group_index + 1;
+		}
+		else
+		{
+			last_group_index = group_index;
+		}
+	}
+	*offset_group_index = first_group_index;
+
+	return( 0 );
+}
+
+/* Retrieves a specific offset group
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libsigscan_pattern_weights_get_offset_group(
+     libsigscan_pattern_weights_t *pattern_weights,
+     int weight,
+     libsigscan_offset_group_t **offset_group,
+     libcerror_error_t **error )
+{
+	static char *function  = "libsigscan_pattern_weights_get_offset_group";
+	int offset_group_index = 0;
+	int result             = 0;
+
+	if( offset_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset group.",
+		 function );
+
+		return( -1 );
+	}
+	result = libsigscan_pattern_weights_get_offset_group_index(
+	          pattern_weights,
+	          weight,
+	          &offset_group_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve offset group index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*offset_group = NULL;
+	}
+	else
+	{
+		*offset_group = pattern_weights->offset_groups[ offset_group_index ];
+	}
+	return( result );
+}
+
+/* Inserts an offset group at a specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_pattern_weights_insert_offset_group(
+     libsigscan_pattern_weights_t *pattern_weights,
+     int offset_group_index,
+     libsigscan_offset_group_t *offset_group,
+     libcerror_error_t **error )
+{
+	libsigscan_offset_group_t **offset_groups = NULL;
+	static char *function                     = "libsigscan_pattern_weights_insert_offset_group";
+	size_t offset_groups_size                 = 0;
+	int group_index                           = 0;
+	int number_of_allocated_offset_groups     = 0;
+
+	if( pattern_weights == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern weights.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern_weights->offset_groups == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pattern weights - missing offset groups.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset_group_index < 0 )
+	 || ( offset_group_index > pattern_weights->number_of_offset_groups ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset group.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern_weights->number_of_offset_groups >= pattern_weights->number_of_allocated_offset_groups )
+	{
+		offset_groups_size = sizeof( libsigscan_offset_group_t * ) * 2 * (size_t) pattern_weights->number_of_allocated_offset_groups;
+
+		if( offset_groups_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing offset group.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid offset groups size value exceeds maximum.",
 			 function );
 
 			return( -1 );
 		}
-		if( ( *offset_group )->weight == weight )
-		{
-			result = 1;
+		number_of_allocated_offset_groups = pattern_weights->number_of_allocated_offset_groups * 2;
 
-			break;
-		}
-		if( ( *offset_group )->weight > weight )
-		{
-			break;
-		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
-		     error ) != 1 )
+		offset_groups = (libsigscan_offset_group_t **) memory_reallocate(
+		                                                pattern_weights->offset_groups,
+		                                                offset_groups_size );
+
+		if( offset_groups == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize offset groups.",
 			 function );
 
 			return( -1 );
 		}
+		pattern_weights->offset_groups                     = offset_groups;
+		pattern_weights->number_of_allocated_offset_groups = number_of_allocated_offset_groups;
 	}
-	if( result == 0 )
+	for( group_index = pattern_weights->number_of_offset_groups;
+	     group_index > offset_group_index;
+	     group_index-- )
 	{
-		*offset_group = NULL;
+		pattern_weights->offset_groups[ group_index ] = pattern_weights->offset_groups[ group_index - 1 ];
 	}
-	return( result );
+	pattern_weights->offset_groups[ offset_group_index ] = offset_group;
+
+	pattern_weights->number_of_offset_groups += 1;
+
+	return( 1 );
 }
 
 /* Inserts an offset for a specific weight
@@ -500,23 +661,13 @@ int libsigscan_pattern_weights_insert_offset(
 {
 	libsigscan_offset_group_t *offset_group = NULL;
 	static char *function                   = "libsigscan_pattern_weights_insert_offset";
+	int offset_group_index                  = 0;
 	int result                              = 0;
 
-	if( pattern_weights == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid pattern weights.",
-		 function );
-
-		return( -1 );
-	}
-	result = libsigscan_pattern_weights_get_offset_group(
+	result = libsigscan_pattern_weights_get_offset_group_index(
 	          pattern_weights,
 	          weight,
-	          &offset_group,
+	          &offset_group_index,
 	          error );
 
 	if( result == -1 )
@@ -525,7 +676,7 @@ int libsigscan_pattern_weights_insert_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve offset group.",
+		 "%s: unable to retrieve offset group index.",
 		 function );
 
 		return( -1 );
@@ -556,18 +707,17 @@ int libsigscan_pattern_weights_insert_offset(
 
 			return( -1 );
 		}
-		if( libcdata_list_insert_value(
-		     pattern_weights->offset_groups_list,
-		     (intptr_t *) offset_group,
-		     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libsigscan_offset_group_compare,
-		     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+		if( libsigscan_pattern_weights_insert_offset_group(
+		     pattern_weights,
+		     offset_group_index,
+		     offset_group,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to insert offset group for weight: %d into offset groups list.",
+			 "%s: unable to insert offset group for weight: %d.",
 			 function,
 			 weight );
 
@@ -578,6 +728,10 @@ int libsigscan_pattern_weights_insert_offset(
 			return( -1 );
 		}
 	}
+	else
+	{
+		offset_group = pattern_weights->offset_groups[ offset_group_index ];
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -606,18 +760,21 @@ int libsigscan_pattern_weights_insert_offset(
 	return( 1 );
 }
 
-/* Retrieves a specific weight group
+/* Retrieves the index of the weight group of a specific pattern offset
+ * If no such weight group exists the index is set to where the weight group should be inserted
  * Returns 1 if successful, 0 if no such value or -1 on error
  */
-int libsigscan_pattern_weights_get_weight_group(
+int libsigscan_pattern_weights_get_weight_group_index(
      libsigscan_pattern_weights_t *pattern_weights,
      off64_t pattern_offset,
-     libsigscan_weight_group_t **weight_group,
+     int *weight_group_index,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *list_element = NULL;
-	static char *function                 = "libsigscan_pattern_weights_get_weight_group";
-	int result                            = 0;
+	libsigscan_weight_group_t *weight_group = NULL;
+	static char *function                   = "libsigscan_pattern_weights_get_weight_group_index";
+	int first_group_index                   = 0;
+	int group_index                         = 0;
+	int last_group_index                    = 0;
 
 	if( pattern_weights == NULL )
 	{
@@ -630,118 +787,256 @@ int libsigscan_pattern_weights_get_weight_group(
 
 		return( -1 );
 	}
-	if( weight_group == NULL )
+	if( pattern_weights->weight_groups == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid weight group.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pattern weights - missing weight groups.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_list_get_first_element(
-	     pattern_weights->weight_groups_list,
-	     &list_element,
-	     error ) != 1 )
+	if( weight_group_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first list element.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid weight group index.",
 		 function );
 
 		return( -1 );
 	}
-	while( list_element != NULL )
+	last_group_index = pattern_weights->number_of_weight_groups;
+
+	while( first_group_index < last_group_index )
 	{
-		if( libcdata_list_element_get_value(
-		     list_element,
-		     (intptr_t **) weight_group,
-		     error ) != 1 )
+		group_index = first_group_index + ( ( last_group_index - first_group_index ) / 2 );
+
+		weight_group = pattern_weights->weight_groups[ group_index ];
+
+		if( weight_group == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve weight group.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing weight group: %d.",
+			 function,
+			 group_index );
 
 			return( -1 );
 		}
-		if( *weight_group == NULL )
+		if( weight_group->pattern_offset == pattern_offset )
+		{
+			*weight_group_index = group_index;
+
+			return( 1 );
+		}
+		if( weight_group->pattern_offset < pattern_offset )
+		{
+			first_group_index = group_index + 1;
+		}
+		else
+		{
+			last_group_index = group_index;
+		}
+	}
+	*weight_group_index = first_group_index;
+
+	return( 0 );
+}
+
+/* Retrieves a specific weight group
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libsigscan_pattern_weights_get_weight_group(
+     libsigscan_pattern_weights_t *pattern_weights,
+     off64_t pattern_offset,
+     libsigscan_weight_group_t **weight_group,
+     libcerror_error_t **error )
+{
+	static char *function  = "libsigscan_pattern_weights_get_weight_group";
+	int weight_group_index = 0;
+	int result             = 0;
+
+	if( weight_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid weight group.",
+		 function );
+
+		return( -1 );
+	}
+	result = libsigscan_pattern_weights_get_weight_group_index(
+	          pattern_weights,
+	          pattern_offset,
+	          &weight_group_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve weight group index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*weight_group = NULL;
+	}
+	else
+	{
+		*weight_group = pattern_weights->weight_groups[ weight_group_index ];
+	}
+	return( result );
+}
+
+/* Inserts a weight group at a specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_pattern_weights_insert_weight_group(
+     libsigscan_pattern_weights_t *pattern_weights,
+     int weight_group_index,
+     libsigscan_weight_group_t *weight_group,
+     libcerror_error_t **error )
+{
+	libsigscan_weight_group_t **weight_groups = NULL;
+	static char *function                     = "libsigscan_pattern_weights_insert_weight_group";
+	size_t weight_groups_size                 = 0;
+	int group_index                           = 0;
+	int number_of_allocated_weight_groups     = 0;
+
+	if( pattern_weights == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern weights.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern_weights->weight_groups == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pattern weights - missing weight groups.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( weight_group_index < 0 )
+	 || ( weight_group_index > pattern_weights->number_of_weight_groups ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid weight group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( weight_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid weight group.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern_weights->number_of_weight_groups >= pattern_weights->number_of_allocated_weight_groups )
+	{
+		weight_groups_size = sizeof( libsigscan_weight_group_t * ) * 2 * (size_t) pattern_weights->number_of_allocated_weight_groups;
+
+		if( weight_groups_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing weight group.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid weight groups size value exceeds maximum.",
 			 function );
 
 			return( -1 );
 		}
-		if( ( *weight_group )->pattern_offset == pattern_offset )
-		{
-			result = 1;
+		number_of_allocated_weight_groups = pattern_weights->number_of_allocated_weight_groups * 2;
 
-			break;
-		}
-		if( ( *weight_group )->pattern_offset > pattern_offset )
-		{
-			break;
-		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
-		     error ) != 1 )
+		weight_groups = (libsigscan_weight_group_t **) memory_reallocate(
+		                                                pattern_weights->weight_groups,
+		                                                weight_groups_size );
+
+		if( weight_groups == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize weight groups.",
 			 function );
 
 			return( -1 );
 		}
+		pattern_weights->weight_groups                     = weight_groups;
+		pattern_weights->number_of_allocated_weight_groups = number_of_allocated_weight_groups;
 	}
-	if( result == 0 )
+	for( group_index = pattern_weights->number_of_weight_groups;
+	     group_index > weight_group_index;
+	     group_index-- )
 	{
-		*weight_group = NULL;
+		pattern_weights->weight_groups[ group_index ] = pattern_weights->weight_groups[ group_index - 1 ];
 	}
-	return( result );
+	pattern_weights->weight_groups[ weight_group_index ] = weight_group;
+
+	pattern_weights->number_of_weight_groups += 1;
+
+	return( 1 );
 }
 
-/* Inserts and adds an weight for a specific offset
+/* Retrieves the weight group of a specific pattern offset and creates it if it does not exist
  * Returns 1 if successful or -1 on error
  */
-int libsigscan_pattern_weights_insert_add_weight(
+int libsigscan_pattern_weights_get_or_insert_weight_group(
      libsigscan_pattern_weights_t *pattern_weights,
      off64_t pattern_offset,
-     int weight,
+     libsigscan_weight_group_t **weight_group,
      libcerror_error_t **error )
 {
-	libsigscan_weight_group_t *weight_group = NULL;
-	static char *function                   = "libsigscan_pattern_weights_insert_add_weight";
-	int result                              = 0;
+	static char *function  = "libsigscan_pattern_weights_get_or_insert_weight_group";
+	int result             = 0;
+	int weight_group_index = 0;
 
-	if( pattern_weights == NULL )
+	if( weight_group == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid pattern weights.",
+		 "%s: invalid weight group.",
 		 function );
 
 		return( -1 );
 	}
-	result = libsigscan_pattern_weights_get_weight_group(
+	result = libsigscan_pattern_weights_get_weight_group_index(
 	          pattern_weights,
 	          pattern_offset,
-	          &weight_group,
+	          &weight_group_index,
 	          error );
 
 	if( result == -1 )
@@ -750,58 +1045,93 @@ int libsigscan_pattern_weights_insert_add_weight(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve weight group.",
+		 "%s: unable to retrieve weight group index.",
 		 function );
 
 		return( -1 );
 	}
-	else if( result == 0 )
+	else if( result != 0 )
 	{
+		*weight_group = pattern_weights->weight_groups[ weight_group_index ];
+
+		return( 1 );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: adding weight group for pattern offset: %" PRIi64 "\n",
-			 function,
-			 pattern_offset );
-		}
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: adding weight group for pattern offset: %" PRIi64 "\n",
+		 function,
+		 pattern_offset );
+	}
 #endif
-		if( libsigscan_weight_group_initialize(
-		     &weight_group,
-		     pattern_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create weight group for pattern offset: %" PRIi64 ".",
-			 function,
-			 pattern_offset );
+	*weight_group = NULL;
 
-			return( -1 );
-		}
-		if( libcdata_list_insert_value(
-		     pattern_weights->weight_groups_list,
-		     (intptr_t *) weight_group,
-		     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libsigscan_weight_group_compare,
-		     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to insert weight group for pattern offset: %" PRIi64 " into weight groups list.",
-			 function,
-			 pattern_offset );
+	if( libsigscan_weight_group_initialize(
+	     weight_group,
+	     pattern_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create weight group for pattern offset: %" PRIi64 ".",
+		 function,
+		 pattern_offset );
 
-			libsigscan_weight_group_free(
-			 &weight_group,
-			 NULL );
+		return( -1 );
+	}
+	if( libsigscan_pattern_weights_insert_weight_group(
+	     pattern_weights,
+	     weight_group_index,
+	     *weight_group,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert weight group for pattern offset: %" PRIi64 ".",
+		 function,
+		 pattern_offset );
 
-			return( -1 );
-		}
+		libsigscan_weight_group_free(
+		 weight_group,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Inserts and adds an weight for a specific offset
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_pattern_weights_insert_add_weight(
+     libsigscan_pattern_weights_t *pattern_weights,
+     off64_t pattern_offset,
+     int weight,
+     libcerror_error_t **error )
+{
+	libsigscan_weight_group_t *weight_group = NULL;
+	static char *function                   = "libsigscan_pattern_weights_insert_add_weight";
+
+	if( libsigscan_pattern_weights_get_or_insert_weight_group(
+	     pattern_weights,
+	     pattern_offset,
+	     &weight_group,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve weight group for pattern offset: %" PRIi64 ".",
+		 function,
+		 pattern_offset );
+
+		return( -1 );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -842,73 +1172,23 @@ int libsigscan_pattern_weights_insert_set_weight(
 {
 	libsigscan_weight_group_t *weight_group = NULL;
 	static char *function                   = "libsigscan_pattern_weights_insert_set_weight";
-	int result                              = 0;
 
-	if( pattern_weights == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid pattern weights.",
-		 function );
-
-		return( -1 );
-	}
-	result = libsigscan_pattern_weights_get_weight_group(
-	          pattern_weights,
-	          pattern_offset,
-	          &weight_group,
-	          error );
-
-	if( result == -1 )
+	if( libsigscan_pattern_weights_get_or_insert_weight_group(
+	     pattern_weights,
+	     pattern_offset,
+	     &weight_group,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve weight group.",
-		 function );
+		 "%s: unable to retrieve weight group for pattern offset: %" PRIi64 ".",
+		 function,
+		 pattern_offset );
 
 		return( -1 );
 	}
-	else if( result == 0 )
-	{
-		if( libsigscan_weight_group_initialize(
-		     &weight_group,
-		     pattern_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create weight group.",
-			 function );
-
-			return( -1 );
-		}
-		if( libcdata_list_insert_value(
-		     pattern_weights->weight_groups_list,
-		     (intptr_t *) weight_group,
-		     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libsigscan_weight_group_compare,
-		     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to insert weight into weight groups list.",
-			 function );
-
-			libsigscan_weight_group_free(
-			 &weight_group,
-			 NULL );
-
-			return( -1 );
-		}
-	}
 	if( libsigscan_weight_group_set_weight(
 	     weight_group,
 	     weight,
@@ -25,7 +25,6 @@
 #include <common.h>
 #include <types.h>
 
-#include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_offset_group.h"
 #include "libsigscan_weight_group.h"
@@ -38,13 +37,31 @@ typedef struct libsigscan_pattern_weights libsigscan_pattern_weights_t;
 
 struct libsigscan_pattern_weights
 {
-	/* The offsets (per weight) groups list
+	/* The offsets (per weight) groups
+	 * Sorted by weight so that an offset group can be looked up using a binary search
 	 */
-	libcdata_list_t *offset_groups_list;
+	libsigscan_offset_group_t **offset_groups;
 
-	/* The weight (per offset) groups list
+	/* The number of offset groups
 	 */
-	libcdata_list_t *weight_groups_list;
+	int number_of_offset_groups;
+
+	/* The number of allocated offset groups
+	 */
+	int number_of_allocated_offset_groups;
+
+	/* The weight (per offset) groups
+	 * Sorted by pattern offset so that a weight group can be looked up using a binary search
+	 */
+	libsigscan_weight_group_t **weight_groups;
+
+	/* The number of weight groups
+	 */
+	int number_of_weight_groups;
+
+	/* The number of allocated weight groups
+	 */
+	int number_of_allocated_weight_groups;
 };
 
 int libsigscan_pattern_weights_initialize(
@@ -72,24 +89,54 @@ int libsigscan_pattern_weights_get_largest_weight(
      int *largest_weight,
      libcerror_error_t **error );
 
+int libsigscan_pattern_weights_get_offset_group_index(
+     libsigscan_pattern_weights_t *pattern_weights,
+     int weight,
+     int *offset_group_index,
+     libcerror_error_t **error );
+
 int libsigscan_pattern_weights_get_offset_group(
      libsigscan_pattern_weights_t *pattern_weights,
      int weight,
      libsigscan_offset_group_t **offset_group,
      libcerror_error_t **error );
 
+int libsigscan_pattern_weights_insert_offset_group(
+     libsigscan_pattern_weights_t *pattern_weights,
+     int offset_group_index,
+     libsigscan_offset_group_t *offset_group,
+     libcerror_error_t **error );
+
 int libsigscan_pattern_weights_insert_offset(
      libsigscan_pattern_weights_t *pattern_weights,
      off64_t pattern_offset,
      int weight,
      libcerror_error_t **error );
 
+int libsigscan_pattern_weights_get_weight_group_index(
+     libsigscan_pattern_weights_t *pattern_weights,
+     off64_t pattern_offset,
+     int *weight_group_index,
+     libcerror_error_t **error );
+
 int libsigscan_pattern_weights_get_weight_group(
      libsigscan_pattern_weights_t *pattern_weights,
      off64_t pattern_offset,
      libsigscan_weight_group_t **weight_group,
      libcerror_error_t **error );
 
+int libsigscan_pattern_weights_insert_weight_group(
+     libsigscan_pattern_weights_t *pattern_weights,
+     int weight_group_index,
+     libsigscan_weight_group_t *weight_group,
+     libcerror_error_t **error );
+
+int libsigscan_pattern_weights_get_or_insert_weight_group(
+     libsigscan_pattern_weights_t *pattern_weights,
+     off64_t pattern_offset,
+     libsigscan_weight_group_t **weight_group,
+     libcerror_error_t **error );
+
 int libsigscan_pattern_weights_insert_add_weight(
      libsigscan_pattern_weights_t *pattern_weights,
      off64_t pattern_offset,
@@ -0,0 +1,535 @@
+/*
+ * Rare byte prefilter functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcnotify.h"
+#include "libsigscan_prefilter.h"
+#include "libsigscan_signature.h"
+
+/* Creates a prefilter
+ * Make sure the value prefilter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_prefilter_initialize(
+     libsigscan_prefilter_t **prefilter,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_prefilter_initialize";
+
+	if( prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *prefilter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid prefilter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*prefilter = memory_allocate_structure(
+	              libsigscan_prefilter_t );
+
+	if( *prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create prefilter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *prefilter,
+	     0,
+	     sizeof( libsigscan_prefilter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear prefilter.",
+		 function );
+
+		memory_free(
+		 *prefilter );
+
+		*prefilter = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *prefilter != NULL )
+	{
+		memory_free(
+		 *prefilter );
+
+		*prefilter = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a prefilter
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_prefilter_free(
+     libsigscan_prefilter_t **prefilter,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_prefilter_free";
+
+	if( prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *prefilter != NULL )
+	{
+		memory_free(
+		 *prefilter );
+
+		*prefilter = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the rank of a byte value
+ * The rank is an estimate of how common the byte value is in typical data,
+ * where 0 represents the least common byte values
+ * Returns the rank
+ */
+int libsigscan_prefilter_get_byte_value_rank(
+     uint8_t byte_value )
+{
+	/* Padding and fill byte values
+	 */
+	if( ( byte_value == 0x00 )
+	 || ( byte_value == 0xff ) )
+	{
+		return( 3 );
+	}
+	/* Text byte values
+	 */
+	if( ( byte_value == (uint8_t) ' ' )
+	 || ( ( byte_value >= (uint8_t) '0' )
+	  &&  ( byte_value <= (uint8_t) '9' ) )
+	 || ( ( byte_value >= (uint8_t) 'A' )
+	  &&  ( byte_value <= (uint8_t) 'Z' ) )
+	 || ( ( byte_value >= (uint8_t) 'a' )
+	  &&  ( byte_value <= (uint8_t) 'z' ) ) )
+	{
+		return( 2 );
+	}
+	if( byte_value < 0x80 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Fills the prefilter
+ * For every unbounded signature a single anchor byte value is selected,
+ * where byte values that are already used as an anchor are preferred
+ * over other byte values and less common byte values over more common ones
+ * Returns 1 if successful, 0 if the prefilter cannot be used or -1 on error
+ */
+int libsigscan_prefilter_fill(
+     libsigscan_prefilter_t *prefilter,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	static char *function                 = "libsigscan_prefilter_fill";
+	size_t anchor_offset                  = 0;
+	size_t pattern_index                  = 0;
+	uint8_t byte_value                    = 0;
+	int anchor_rank                       = 0;
+	int rank                              = 0;
+
+	if( prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefilter->number_of_signatures != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid prefilter - already filled.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_first_element(
+	     signatures_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first list element.",
+		 function );
+
+		return( -1 );
+	}
+	while( list_element != NULL )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature.",
+			 function );
+
+			return( -1 );
+		}
+		if( signature == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET )
+		 && ( signature->pattern != NULL )
+		 && ( signature->pattern_size > 0 ) )
+		{
+			anchor_offset = 0;
+			anchor_rank   = -1;
+
+			for( pattern_index = 0;
+			     pattern_index < signature->pattern_size;
+			     pattern_index++ )
+			{
+				byte_value = signature->pattern[ pattern_index ];
+
+				/* Byte values that are already used as an anchor do not
+				 * increase the number of candidate positions
+				 */
+				if( prefilter->anchor_byte_values_table[ byte_value ] != 0 )
+				{
+					rank = 0;
+				}
+				else
+				{
+					rank = 1 + libsigscan_prefilter_get_byte_value_rank(
+					            byte_value );
+				}
+				if( ( anchor_rank == -1 )
+				 || ( rank < anchor_rank ) )
+				{
+					anchor_offset = pattern_index;
+					anchor_rank   = rank;
+				}
+			}
+			byte_value = signature->pattern[ anchor_offset ];
+
+			if( prefilter->anchor_byte_values_table[ byte_value ] == 0 )
+			{
+				if( prefilter->number_of_anchor_byte_values >= LIBSIGSCAN_PREFILTER_MAXIMUM_NUMBER_OF_ANCHOR_BYTE_VALUES )
+				{
+					return( 0 );
+				}
+				prefilter->anchor_byte_values_table[ byte_value ] = 1;
+
+				prefilter->anchor_byte_values[ prefilter->number_of_anchor_byte_values ] = byte_value;
+
+				prefilter->number_of_anchor_byte_values += 1;
+			}
+			if( ( prefilter->number_of_signatures == 0 )
+			 || ( anchor_offset < prefilter->smallest_anchor_offset ) )
+			{
+				prefilter->smallest_anchor_offset = anchor_offset;
+			}
+			if( ( prefilter->number_of_signatures == 0 )
+			 || ( anchor_offset > prefilter->largest_anchor_offset ) )
+			{
+				prefilter->largest_anchor_offset = anchor_offset;
+			}
+			prefilter->number_of_signatures += 1;
+		}
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next list element.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( prefilter->number_of_signatures == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the offset of the next candidate position in the buffer
+ * A pattern can only start at a candidate position, where an anchor
+ * byte value is found at the anchor offset of one of the signatures
+ * Returns 1 if successful, 0 if the buffer contains no candidate position or -1 on error
+ */
+int libsigscan_prefilter_get_candidate_offset(
+     libsigscan_prefilter_t *prefilter,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t *candidate_offset,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_MEMCHR ) || defined( WINAPI )
+	const uint8_t *anchor_byte = NULL;
+#endif
+	static char *function      = "libsigscan_prefilter_get_candidate_offset";
+	size_t scan_offset         = 0;
+	uint64_t value_64bit       = 0;
+	uint64_t match_64bit       = 0;
+	uint64_t xor_64bit         = 0;
+	int byte_value_index       = 0;
+
+	if( prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( candidate_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid candidate offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_offset >= buffer_size )
+	 || ( prefilter->smallest_anchor_offset >= ( buffer_size - buffer_offset ) ) )
+	{
+		return( 0 );
+	}
+	scan_offset = buffer_offset + prefilter->smallest_anchor_offset;
+
+#if defined( HAVE_MEMCHR ) || defined( WINAPI )
+	if( prefilter->number_of_anchor_byte_values == 1 )
+	{
+		anchor_byte = (const uint8_t *) memchr(
+		                                 (void *) &( buffer[ scan_offset ] ),
+		                                 (int) prefilter->anchor_byte_values[ 0 ],
+		                                 buffer_size - scan_offset );
+
+		if( anchor_byte == NULL )
+		{
+			return( 0 );
+		}
+		scan_offset = (size_t) ( anchor_byte - buffer );
+	}
+	else
+#endif
+	{
+		/* For a small number of anchor byte values 8 bytes are compared
+		 * at a time, where a byte in ( value ^ anchor ) is 0 if it matches
+		 */
+		if( prefilter->number_of_anchor_byte_values <= 4 )
+		{
+			while( ( scan_offset + 8 ) <= buffer_size )
+			{
+				memory_copy(
+				 &value_64bit,
+				 &( buffer[ scan_offset ] ),
+				 8 );
+
+				match_64bit = 0;
+
+				for( byte_value_index = 0;
+				     byte_value_index < prefilter->number_of_anchor_byte_values;
+				     byte_value_index++ )
+				{
+					xor_64bit = value_64bit ^ ( (uint64_t) prefilter->anchor_byte_values[ byte_value_index ] * 0x0101010101010101ULL );
+
+					match_64bit |= ( xor_64bit - 0x0101010101010101ULL ) & ~xor_64bit & 0x8080808080808080ULL;
+				}
+				if( match_64bit != 0 )
+				{
+					break;
+				}
+				scan_offset += 8;
+			}
+		}
+		while( scan_offset < buffer_size )
+		{
+			if( prefilter->anchor_byte_values_table[ buffer[ scan_offset ] ] != 0 )
+			{
+				break;
+			}
+			scan_offset++;
+		}
+		if( scan_offset >= buffer_size )
+		{
+			return( 0 );
+		}
+	}
+	/* The candidate position is determined by the largest anchor offset
+	 * since the signature of the anchor byte is not known here
+	 */
+	if( ( scan_offset - buffer_offset ) > prefilter->largest_anchor_offset )
+	{
+		*candidate_offset = scan_offset - prefilter->largest_anchor_offset;
+	}
+	else
+	{
+		*candidate_offset = buffer_offset;
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_DEBUG_OUTPUT )
+
+/* Prints a prefilter
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_prefilter_printf(
+     libsigscan_prefilter_t *prefilter,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_prefilter_printf";
+	int byte_value_index  = 0;
+
+	if( prefilter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefilter.",
+		 function );
+
+		return( -1 );
+	}
+	libcnotify_printf(
+	 "Prefilter:\n" );
+
+	libcnotify_printf(
+	 "\tNumber of signatures\t: %d\n",
+	 prefilter->number_of_signatures );
+
+	libcnotify_printf(
+	 "\tAnchor offsets\t\t: %" PRIzd " - %" PRIzd "\n",
+	 prefilter->smallest_anchor_offset,
+	 prefilter->largest_anchor_offset );
+
+	for( byte_value_index = 0;
+	     byte_value_index < prefilter->number_of_anchor_byte_values;
+	     byte_value_index++ )
+	{
+		libcnotify_printf(
+		 "\tAnchor byte value\t: 0x%02" PRIx8 "\n",
+		 prefilter->anchor_byte_values[ byte_value_index ] );
+	}
+	libcnotify_printf(
+	 "\n" );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
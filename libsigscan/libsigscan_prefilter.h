@@ -0,0 +1,103 @@
+/*
+ * Rare byte prefilter functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_PREFILTER_H )
+#define _LIBSIGSCAN_PREFILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcdata.h"
+#include "libsigscan_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_prefilter libsigscan_prefilter_t;
+
+struct libsigscan_prefilter
+{
+	/* The number of signatures
+	 */
+	int number_of_signatures;
+
+	/* The anchor byte values table
+	 * contains 1 for every byte value that is used as an anchor
+	 */
+	uint8_t anchor_byte_values_table[ 256 ];
+
+	/* The anchor byte values
+	 */
+	uint8_t anchor_byte_values[ LIBSIGSCAN_PREFILTER_MAXIMUM_NUMBER_OF_ANCHOR_BYTE_VALUES ];
+
+	/* The number of anchor byte values
+	 */
+	int number_of_anchor_byte_values;
+
+	/* The smallest anchor offset relative to the start of the pattern
+	 */
+	size_t smallest_anchor_offset;
+
+	/* The largest anchor offset relative to the start of the pattern
+	 */
+	size_t largest_anchor_offset;
+};
+
+int libsigscan_prefilter_initialize(
+     libsigscan_prefilter_t **prefilter,
+     libcerror_error_t **error );
+
+int libsigscan_prefilter_free(
+     libsigscan_prefilter_t **prefilter,
+     libcerror_error_t **error );
+
+int libsigscan_prefilter_get_byte_value_rank(
+     uint8_t byte_value );
+
+int libsigscan_prefilter_fill(
+     libsigscan_prefilter_t *prefilter,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error );
+
+int libsigscan_prefilter_get_candidate_offset(
+     libsigscan_prefilter_t *prefilter,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t *candidate_offset,
+     libcerror_error_t **error );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+
+int libsigscan_prefilter_printf(
+     libsigscan_prefilter_t *prefilter,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_PREFILTER_H ) */
+
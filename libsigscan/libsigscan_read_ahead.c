@@ -0,0 +1,943 @@
+/*
+ * The read-ahead functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_libbfio.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcthreads.h"
+#include "libsigscan_read_ahead.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates a read-ahead
+ * Make sure the value read_ahead is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_read_ahead_initialize(
+     libsigscan_read_ahead_t **read_ahead,
+     int number_of_buffers,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_read_ahead_initialize";
+	int buffer_index      = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read-ahead value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buffers < 1 )
+	 || ( number_of_buffers > LIBSIGSCAN_READ_AHEAD_MAXIMUM_NUMBER_OF_BUFFERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*read_ahead = memory_allocate_structure(
+	               libsigscan_read_ahead_t );
+
+	if( *read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_ahead,
+	     0,
+	     sizeof( libsigscan_read_ahead_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read-ahead.",
+		 function );
+
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+
+		return( -1 );
+	}
+	( *read_ahead )->buffers = (uint8_t **) memory_allocate(
+	                                         sizeof( uint8_t * ) * number_of_buffers );
+
+	if( ( *read_ahead )->buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *read_ahead )->buffers,
+	     0,
+	     sizeof( uint8_t * ) * number_of_buffers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffers.",
+		 function );
+
+		memory_free(
+		 ( *read_ahead )->buffers );
+
+		( *read_ahead )->buffers = NULL;
+
+		goto on_error;
+	}
+	( *read_ahead )->number_of_buffers = number_of_buffers;
+
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		( *read_ahead )->buffers[ buffer_index ] = (uint8_t *) memory_allocate(
+		                                                        sizeof( uint8_t ) * buffer_size );
+
+		if( ( *read_ahead )->buffers[ buffer_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+	}
+	( *read_ahead )->data_offsets = (off64_t *) memory_allocate(
+	                                             sizeof( off64_t ) * number_of_buffers );
+
+	if( ( *read_ahead )->data_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data offsets.",
+		 function );
+
+		goto on_error;
+	}
+	( *read_ahead )->data_sizes = (size_t *) memory_allocate(
+	                                          sizeof( size_t ) * number_of_buffers );
+
+	if( ( *read_ahead )->data_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data sizes.",
+		 function );
+
+		goto on_error;
+	}
+	( *read_ahead )->buffer_size = buffer_size;
+
+	if( libcthreads_mutex_initialize(
+	     &( ( *read_ahead )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *read_ahead )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *read_ahead != NULL )
+	{
+		libsigscan_read_ahead_free(
+		 read_ahead,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a read-ahead
+ * The reader thread is stopped and joined
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_read_ahead_free(
+     libsigscan_read_ahead_t **read_ahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_read_ahead_free";
+	int buffer_index      = 0;
+	int result            = 1;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead != NULL )
+	{
+		if( ( *read_ahead )->reader_thread != NULL )
+		{
+			if( libsigscan_read_ahead_stop(
+			     *read_ahead,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to stop read-ahead.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *read_ahead )->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *read_ahead )->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *read_ahead )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *read_ahead )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *read_ahead )->read_error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *read_ahead )->read_error ) );
+		}
+		if( ( *read_ahead )->data_sizes != NULL )
+		{
+			memory_free(
+			 ( *read_ahead )->data_sizes );
+		}
+		if( ( *read_ahead )->data_offsets != NULL )
+		{
+			memory_free(
+			 ( *read_ahead )->data_offsets );
+		}
+		if( ( *read_ahead )->buffers != NULL )
+		{
+			for( buffer_index = 0;
+			     buffer_index < ( *read_ahead )->number_of_buffers;
+			     buffer_index++ )
+			{
+				if( ( *read_ahead )->buffers[ buffer_index ] != NULL )
+				{
+					memory_free(
+					 ( *read_ahead )->buffers[ buffer_index ] );
+				}
+			}
+			memory_free(
+			 ( *read_ahead )->buffers );
+		}
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+	}
+	return( result );
+}
+
+/* Starts reading a range of data ahead
+ * The reader thread reads the range into the buffers of the ring while the buffers
+ * that were read before are being scanned. The file IO handle must not be used by
+ * other threads until the read-ahead is stopped. If a sparse file is provided the
+ * holes in the range are skipped
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_read_ahead_start(
+     libsigscan_read_ahead_t *read_ahead,
+     libbfio_handle_t *file_io_handle,
+     libsigscan_sparse_file_t *sparse_file,
+     off64_t range_offset,
+     off64_t range_end_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_read_ahead_start";
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ahead->reader_thread != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read-ahead - reader thread value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( range_offset < 0 )
+	 || ( range_offset > range_end_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ahead->read_error != NULL )
+	{
+		libcerror_error_free(
+		 &( read_ahead->read_error ) );
+	}
+	read_ahead->file_io_handle         = file_io_handle;
+	read_ahead->sparse_file            = sparse_file;
+	read_ahead->read_offset            = range_offset;
+	read_ahead->range_end_offset       = range_end_offset;
+	read_ahead->scan_range_end_offset  = range_offset;
+	read_ahead->read_buffer_index      = 0;
+	read_ahead->scan_buffer_index      = 0;
+	read_ahead->number_of_read_buffers = 0;
+	read_ahead->stop                   = 0;
+
+	if( libcthreads_thread_create(
+	     &( read_ahead->reader_thread ),
+	     NULL,
+	     (int (*)(void *)) &libsigscan_read_ahead_reader,
+	     (void *) read_ahead,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create reader thread.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Stops reading ahead
+ * The reader thread is stopped and joined, the data that was read ahead
+ * but not yet retrieved is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_read_ahead_stop(
+     libsigscan_read_ahead_t *read_ahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_read_ahead_stop";
+	int result            = 1;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ahead->reader_thread == NULL )
+	{
+		return( 1 );
+	}
+	if( libcthreads_mutex_grab(
+	     read_ahead->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	read_ahead->stop = 1;
+
+	if( libcthreads_condition_broadcast(
+	     read_ahead->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     read_ahead->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_thread_join(
+	     &( read_ahead->reader_thread ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join reader thread.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Retrieves the next buffer that was read
+ * Waits for the reader thread if the buffer has not yet been read
+ * The buffer must be released after it has been scanned
+ * Returns 1 if successful, 0 if all the data of the range was retrieved or -1 on error
+ */
+int libsigscan_read_ahead_get_buffer(
+     libsigscan_read_ahead_t *read_ahead,
+     const uint8_t **buffer,
+     off64_t *data_offset,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_read_ahead_get_buffer";
+	int result            = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     read_ahead->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( read_ahead->number_of_read_buffers == 0 )
+	    && ( read_ahead->read_error == NULL )
+	    && ( read_ahead->read_offset < read_ahead->range_end_offset ) )
+	{
+		if( libcthreads_condition_wait(
+		     read_ahead->condition,
+		     read_ahead->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( result != -1 )
+	{
+		if( read_ahead->number_of_read_buffers > 0 )
+		{
+			*buffer      = read_ahead->buffers[ read_ahead->scan_buffer_index ];
+			*data_offset = read_ahead->data_offsets[ read_ahead->scan_buffer_index ];
+			*data_size   = read_ahead->data_sizes[ read_ahead->scan_buffer_index ];
+
+			result = 1;
+		}
+		else if( read_ahead->read_error != NULL )
+		{
+			/* The error of the reader thread is passed on to the caller
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = read_ahead->read_error;
+			}
+			else
+			{
+				libcerror_error_free(
+				 &( read_ahead->read_error ) );
+			}
+			read_ahead->read_error = NULL;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     read_ahead->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Releases the buffer that was last retrieved
+ * The buffer can then be used by the reader thread to read the next data
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_read_ahead_release_buffer(
+     libsigscan_read_ahead_t *read_ahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_read_ahead_release_buffer";
+	int result            = 1;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     read_ahead->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ahead->number_of_read_buffers <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read-ahead - number of read buffers value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		read_ahead->scan_buffer_index = ( read_ahead->scan_buffer_index + 1 ) % read_ahead->number_of_buffers;
+
+		read_ahead->number_of_read_buffers -= 1;
+
+		if( libcthreads_condition_broadcast(
+		     read_ahead->condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     read_ahead->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads the range into the buffers of the ring until all the data of the range
+ * was read or the read-ahead is stopped
+ * This function is the callback function of the reader thread
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_read_ahead_reader(
+     libsigscan_read_ahead_t *read_ahead )
+{
+	libcerror_error_t *read_error = NULL;
+	static char *function         = "libsigscan_read_ahead_reader";
+	size_t read_size              = 0;
+	ssize_t read_count            = 0;
+	off64_t read_offset           = 0;
+	int buffer_index              = 0;
+	int result                    = 1;
+
+	if( read_ahead == NULL )
+	{
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     read_ahead->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	while( ( read_ahead->stop == 0 )
+	    && ( read_ahead->read_offset < read_ahead->range_end_offset ) )
+	{
+		if( read_ahead->number_of_read_buffers >= read_ahead->number_of_buffers )
+		{
+			if( libcthreads_condition_wait(
+			     read_ahead->condition,
+			     read_ahead->mutex,
+			     NULL ) != 1 )
+			{
+				result = -1;
+
+				break;
+			}
+			continue;
+		}
+		if( read_ahead->read_offset >= read_ahead->scan_range_end_offset )
+		{
+			read_ahead->scan_range_end_offset = read_ahead->range_end_offset;
+
+			/* The holes in the range are skipped
+			 */
+			if( read_ahead->sparse_file != NULL )
+			{
+				if( libsigscan_sparse_file_get_scan_range(
+				     read_ahead->sparse_file,
+				     read_ahead->read_offset,
+				     read_ahead->range_end_offset,
+				     &( read_ahead->read_offset ),
+				     &( read_ahead->scan_range_end_offset ),
+				     &read_error ) != 1 )
+				{
+					libcerror_error_set(
+					 &read_error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve scan range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 read_ahead->read_offset,
+					 read_ahead->read_offset );
+
+					read_ahead->read_error = read_error;
+					read_error             = NULL;
+
+					result = -1;
+
+					break;
+				}
+				continue;
+			}
+		}
+		buffer_index = read_ahead->read_buffer_index;
+		read_offset  = read_ahead->read_offset;
+		read_size    = read_ahead->buffer_size;
+
+		if( (off64_t) read_size > ( read_ahead->scan_range_end_offset - read_offset ) )
+		{
+			read_size = (size_t) ( read_ahead->scan_range_end_offset - read_offset );
+		}
+		/* The buffer is not used by the scanning thread until it is marked as read
+		 * hence the data is read without holding the mutex
+		 */
+		if( libcthreads_mutex_release(
+		     read_ahead->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              read_ahead->file_io_handle,
+		              read_ahead->buffers[ buffer_index ],
+		              read_size,
+		              read_offset,
+		              &read_error );
+
+		if( libcthreads_mutex_grab(
+		     read_ahead->mutex,
+		     NULL ) != 1 )
+		{
+			if( read_error != NULL )
+			{
+				libcerror_error_free(
+				 &read_error );
+			}
+			return( -1 );
+		}
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 &read_error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 read_offset,
+			 read_offset );
+
+			read_ahead->read_error = read_error;
+			read_error             = NULL;
+
+			result = -1;
+
+			break;
+		}
+		read_ahead->data_offsets[ buffer_index ] = read_offset;
+		read_ahead->data_sizes[ buffer_index ]   = read_size;
+
+		read_ahead->read_buffer_index = ( buffer_index + 1 ) % read_ahead->number_of_buffers;
+		read_ahead->read_offset      += (off64_t) read_size;
+
+		read_ahead->number_of_read_buffers += 1;
+
+		if( libcthreads_condition_broadcast(
+		     read_ahead->condition,
+		     NULL ) != 1 )
+		{
+			result = -1;
+
+			break;
+		}
+	}
+	if( ( result != 1 )
+	 && ( read_ahead->read_error == NULL ) )
+	{
+		libcerror_error_set(
+		 &( read_ahead->read_error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to read ahead.",
+		 function );
+	}
+	/* The scanning thread is woken up when the reader thread stops
+	 * so that it does not wait for data that will not be read
+	 */
+	if( libcthreads_condition_broadcast(
+	     read_ahead->condition,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     read_ahead->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,160 @@
+/*
+ * The read-ahead functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_READ_AHEAD_H )
+#define _LIBSIGSCAN_READ_AHEAD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libbfio.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcthreads.h"
+#include "libsigscan_sparse_file.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libsigscan_read_ahead libsigscan_read_ahead_t;
+
+struct libsigscan_read_ahead
+{
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The sparse file of which the holes in the range are skipped
+	 * Contains NULL if all the data of the range is read
+	 */
+	libsigscan_sparse_file_t *sparse_file;
+
+	/* The buffers of the ring
+	 */
+	uint8_t **buffers;
+
+	/* The data offsets of the buffers
+	 */
+	off64_t *data_offsets;
+
+	/* The data sizes of the buffers
+	 */
+	size_t *data_sizes;
+
+	/* The number of buffers
+	 */
+	int number_of_buffers;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The offset of the next read
+	 */
+	off64_t read_offset;
+
+	/* The end offset of the range
+	 */
+	off64_t range_end_offset;
+
+	/* The end offset of the part of the range that is read before the next hole is skipped
+	 */
+	off64_t scan_range_end_offset;
+
+	/* The index of the next buffer to read
+	 */
+	int read_buffer_index;
+
+	/* The index of the next buffer to scan
+	 */
+	int scan_buffer_index;
+
+	/* The number of buffers that were read and have not yet been released
+	 */
+	int number_of_read_buffers;
+
+	/* The reader thread
+	 */
+	libcthreads_thread_t *reader_thread;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The error of the reader thread
+	 */
+	libcerror_error_t *read_error;
+
+	/* Value to indicate the reader thread should stop
+	 */
+	int stop;
+};
+
+int libsigscan_read_ahead_initialize(
+     libsigscan_read_ahead_t **read_ahead,
+     int number_of_buffers,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libsigscan_read_ahead_free(
+     libsigscan_read_ahead_t **read_ahead,
+     libcerror_error_t **error );
+
+int libsigscan_read_ahead_start(
+     libsigscan_read_ahead_t *read_ahead,
+     libbfio_handle_t *file_io_handle,
+     libsigscan_sparse_file_t *sparse_file,
+     off64_t range_offset,
+     off64_t range_end_offset,
+     libcerror_error_t **error );
+
+int libsigscan_read_ahead_stop(
+     libsigscan_read_ahead_t *read_ahead,
+     libcerror_error_t **error );
+
+int libsigscan_read_ahead_get_buffer(
+     libsigscan_read_ahead_t *read_ahead,
+     const uint8_t **buffer,
+     off64_t *data_offset,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libsigscan_read_ahead_release_buffer(
+     libsigscan_read_ahead_t *read_ahead,
+     libcerror_error_t **error );
+
+int libsigscan_read_ahead_reader(
+     libsigscan_read_ahead_t *read_ahead );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_READ_AHEAD_H ) */
+
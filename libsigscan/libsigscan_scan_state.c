@@ -23,13 +23,16 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libsigscan_automaton.h"
+#include "libsigscan_compiled_scan_tree.h"
 #include "libsigscan_definitions.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_libcnotify.h"
+#include "libsigscan_magic_table.h"
 #include "libsigscan_scan_result.h"
 #include "libsigscan_scan_state.h"
 #include "libsigscan_scan_tree.h"
-#include "libsigscan_scan_tree_node.h"
+#include "libsigscan_signature.h"
 #include "libsigscan_types.h"
 
 /* Creates scan state
@@ -110,7 +113,9 @@ int libsigscan_scan_state_initialize(
 
 		goto on_error;
 	}
-	internal_scan_state->state = LIBSIGSCAN_SCAN_STATE_INITIALIZED;
+	internal_scan_state->scan_flags      = LIBSIGSCAN_SCAN_FLAGS_ALL;
+	internal_scan_state->match_range_end = -1;
+	internal_scan_state->state           = LIBSIGSCAN_SCAN_STATE_INITIALIZED;
 
 	*scan_state = (libsigscan_scan_state_t *) internal_scan_state;
 
@@ -152,13 +157,28 @@ int libsigscan_scan_state_free(
 		internal_scan_state = (libsigscan_internal_scan_state_t *) *scan_state;
 		*scan_state         = NULL;
 
-		/* The scan_tree and active_node are references and freed elsewhere
+		/* The scan trees are references and freed elsewhere
 		 */
 		if( internal_scan_state->buffer != NULL )
 		{
 			memory_free(
 			 internal_scan_state->buffer );
 		}
+		if( internal_scan_state->header_buffer != NULL )
+		{
+			memory_free(
+			 internal_scan_state->header_buffer );
+		}
+		if( internal_scan_state->footer_buffer != NULL )
+		{
+			memory_free(
+			 internal_scan_state->footer_buffer );
+		}
+		if( internal_scan_state->matched_signatures != NULL )
+		{
+			memory_free(
+			 internal_scan_state->matched_signatures );
+		}
 		if( libcdata_array_free(
 		     &( internal_scan_state->scan_results_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_internal_scan_result_free,
@@ -219,6 +239,259 @@ int libsigscan_scan_state_set_data_size(
 	return( 1 );
 }
 
+/* Sets the scan flags
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_set_scan_flags(
+     libsigscan_scan_state_t *scan_state,
+     uint32_t scan_flags,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_set_scan_flags";
+
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( internal_scan_state->state == LIBSIGSCAN_SCAN_STATE_STARTED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid scan state - unsupported state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_flags == 0 )
+	 || ( ( scan_flags & ~( LIBSIGSCAN_SCAN_FLAGS_ALL ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported scan flags: 0x%08" PRIx32 ".",
+		 function,
+		 scan_flags );
+
+		return( -1 );
+	}
+	internal_scan_state->scan_flags = scan_flags;
+
+	return( 1 );
+}
+
+/* Sets the stop policy
+ * The maximum number of results is only used by the maximum number of results stop policy
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_set_stop_policy(
+     libsigscan_scan_state_t *scan_state,
+     int stop_policy,
+     int maximum_number_of_results,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_set_stop_policy";
+
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( internal_scan_state->state == LIBSIGSCAN_SCAN_STATE_STARTED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid scan state - unsupported state.",
+		 function );
+
+		return( -1 );
+	}
+	switch( stop_policy )
+	{
+		case LIBSIGSCAN_SCAN_STOP_POLICY_NONE:
+		case LIBSIGSCAN_SCAN_STOP_POLICY_EACH_SIGNATURE_ONCE:
+			maximum_number_of_results = 0;
+			break;
+
+		case LIBSIGSCAN_SCAN_STOP_POLICY_FIRST_RESULT:
+			maximum_number_of_results = 1;
+			break;
+
+		case LIBSIGSCAN_SCAN_STOP_POLICY_MAXIMUM_NUMBER_OF_RESULTS:
+			if( maximum_number_of_results <= 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid maximum number of results value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported stop policy.",
+			 function );
+
+			return( -1 );
+	}
+	internal_scan_state->stop_policy               = stop_policy;
+	internal_scan_state->maximum_number_of_results = maximum_number_of_results;
+
+	return( 1 );
+}
+
+/* Determines if the scan is complete, which is when the stop policy has been met
+ * Returns 1 if complete, 0 if not or -1 on error
+ */
+int libsigscan_scan_state_is_complete(
+     libsigscan_scan_state_t *scan_state,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_is_complete";
+
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	return( (int) internal_scan_state->is_complete );
+}
+
+/* Retrieves the scan flags
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_get_scan_flags(
+     libsigscan_scan_state_t *scan_state,
+     uint32_t *scan_flags,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_get_scan_flags";
+
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( scan_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan flags.",
+		 function );
+
+		return( -1 );
+	}
+	*scan_flags = internal_scan_state->scan_flags;
+
+	return( 1 );
+}
+
+/* Copies the scan settings, which are the scan flags and the stop policy, from a source scan state
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_copy_settings(
+     libsigscan_scan_state_t *destination_scan_state,
+     libsigscan_scan_state_t *source_scan_state,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_destination_scan_state = NULL;
+	libsigscan_internal_scan_state_t *internal_source_scan_state      = NULL;
+	static char *function                                             = "libsigscan_scan_state_copy_settings";
+
+	if( destination_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_destination_scan_state = (libsigscan_internal_scan_state_t *) destination_scan_state;
+
+	if( internal_destination_scan_state->state == LIBSIGSCAN_SCAN_STATE_STARTED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid destination scan state - unsupported state.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_source_scan_state = (libsigscan_internal_scan_state_t *) source_scan_state;
+
+	internal_destination_scan_state->scan_flags                = internal_source_scan_state->scan_flags;
+	internal_destination_scan_state->stop_policy               = internal_source_scan_state->stop_policy;
+	internal_destination_scan_state->maximum_number_of_results = internal_source_scan_state->maximum_number_of_results;
+
+	return( 1 );
+}
+
 /* Retrieves the buffer size
  * Returns 1 if successful or -1 on error
  */
@@ -399,22 +672,16 @@ int libsigscan_scan_state_get_footer_range(
 	return( 1 );
 }
 
-/* Starts the scan state
- * Returns 1 if successful or -1 on error
+/* Retrieves the unbounded range
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libsigscan_scan_state_start(
+int libsigscan_scan_state_get_unbounded_range(
      libsigscan_scan_state_t *scan_state,
-     libsigscan_scan_tree_t *header_scan_tree,
-     libsigscan_scan_tree_t *footer_scan_tree,
-     libsigscan_scan_tree_t *scan_tree,
-     size_t scan_buffer_size,
+     uint64_t *unbounded_range_size,
      libcerror_error_t **error )
 {
 	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
-	static char *function                                 = "libsigscan_scan_state_start";
-	uint64_t range_size                                   = 0;
-	uint64_t range_start                                  = 0;
-	int result                                            = 0;
+	static char *function                                 = "libsigscan_scan_state_get_unbounded_range";
 
 	if( scan_state == NULL )
 	{
@@ -429,73 +696,245 @@ int libsigscan_scan_state_start(
 	}
 	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
 
-	if( ( internal_scan_state->state != LIBSIGSCAN_SCAN_STATE_INITIALIZED )
-	 && ( internal_scan_state->state != LIBSIGSCAN_SCAN_STATE_STOPPED ) )
+	if( unbounded_range_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid scan state - unsupported state.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unbounded range size.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_scan_state->buffer != NULL )
+	if( internal_scan_state->unbounded_range_size == 0 )
+	{
+		return( 0 );
+	}
+	*unbounded_range_size = internal_scan_state->unbounded_range_size;
+
+	return( 1 );
+}
+
+/* Retrieves the offset range
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libsigscan_scan_state_get_offset_range(
+     libsigscan_scan_state_t *scan_state,
+     uint64_t *offset_range_start,
+     uint64_t *offset_range_end,
+     uint64_t *offset_range_size,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_get_offset_range";
+
+	if( scan_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid scan state - buffer value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( scan_buffer_size == 0 )
-	 || ( scan_buffer_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( offset_range_start == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid scan buffer size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset range start.",
 		 function );
 
 		return( -1 );
 	}
-	internal_scan_state->buffer = (uint8_t *) memory_allocate(
-	                                           sizeof( uint8_t ) * scan_buffer_size );
-
-	if( internal_scan_state->buffer == NULL )
+	if( offset_range_end == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create scan buffer.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset range end.",
 		 function );
 
 		return( -1 );
 	}
-	if( header_scan_tree != NULL )
+	if( offset_range_size == NULL )
 	{
-		result = libsigscan_scan_tree_get_spanning_range(
-		          header_scan_tree,
-		          &range_start,
-		          &range_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset range size.",
+		 function );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
+		return( -1 );
+	}
+	if( internal_scan_state->offset_range_size == 0 )
+	{
+		return( 0 );
+	}
+	*offset_range_start = internal_scan_state->offset_range_start;
+	*offset_range_end   = internal_scan_state->offset_range_end;
+	*offset_range_size  = internal_scan_state->offset_range_size;
+
+	return( 1 );
+}
+
+/* Starts the scan state
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_start(
+     libsigscan_scan_state_t *scan_state,
+     libsigscan_scan_tree_t *header_scan_tree,
+     libsigscan_scan_tree_t *footer_scan_tree,
+     libsigscan_scan_tree_t *scan_tree,
+     libsigscan_scan_tree_t *range_scan_tree,
+     libcdata_list_t *range_signatures_list,
+     int number_of_signatures,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element                 = NULL;
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	libsigscan_signature_t *signature                     = NULL;
+	static char *function                                 = "libsigscan_scan_state_start";
+	size_t carry_over_size                                = 0;
+	uint64_t largest_pattern_size                         = 0;
+	uint64_t range_end                                    = 0;
+	uint64_t range_size                                   = 0;
+	uint64_t range_start                                  = 0;
+	int resume_data_offset_index                          = 0;
+	int result                                            = 0;
+
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( ( internal_scan_state->state != LIBSIGSCAN_SCAN_STATE_INITIALIZED )
+	 && ( internal_scan_state->state != LIBSIGSCAN_SCAN_STATE_STOPPED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid scan state - unsupported state.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_state->buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan state - buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_signatures < 0 )
+	 || ( (size_t) number_of_signatures > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of signatures value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_scan_state->stop_policy == LIBSIGSCAN_SCAN_STOP_POLICY_EACH_SIGNATURE_ONCE )
+	 && ( number_of_signatures > 0 ) )
+	{
+		internal_scan_state->matched_signatures = (uint8_t *) memory_allocate(
+		                                                       sizeof( uint8_t ) * number_of_signatures );
+
+		if( internal_scan_state->matched_signatures == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create matched signatures.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     internal_scan_state->matched_signatures,
+		     0,
+		     sizeof( uint8_t ) * number_of_signatures ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear matched signatures.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Only use the scan trees of the scan passes selected by the scan flags
+	 */
+	if( ( internal_scan_state->scan_flags & LIBSIGSCAN_SCAN_FLAG_HEADER ) == 0 )
+	{
+		header_scan_tree = NULL;
+	}
+	if( ( internal_scan_state->scan_flags & LIBSIGSCAN_SCAN_FLAG_FOOTER ) == 0 )
+	{
+		footer_scan_tree = NULL;
+	}
+	if( ( internal_scan_state->scan_flags & LIBSIGSCAN_SCAN_FLAG_UNBOUNDED ) == 0 )
+	{
+		scan_tree = NULL;
+	}
+	if( ( internal_scan_state->scan_flags & LIBSIGSCAN_SCAN_FLAG_OFFSET_RANGE ) == 0 )
+	{
+		range_scan_tree = NULL;
+	}
+	internal_scan_state->header_range_start   = 0;
+	internal_scan_state->header_range_end     = 0;
+	internal_scan_state->header_range_size    = 0;
+	internal_scan_state->footer_range_start   = 0;
+	internal_scan_state->footer_range_end     = 0;
+	internal_scan_state->footer_range_size    = 0;
+	internal_scan_state->unbounded_range_size = 0;
+
+	if( header_scan_tree != NULL )
+	{
+		result = libsigscan_scan_tree_get_spanning_range(
+		          header_scan_tree,
+		          &range_start,
+		          &range_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 			 "%s: unable to retrieve header pattern spanning range.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		else if( result != 0 )
 		{
@@ -516,7 +955,7 @@ int libsigscan_scan_state_start(
 			}
 #endif
 		}
-		internal_scan_state->active_header_node = header_scan_tree->root_node;
+		internal_scan_state->active_header_node_index = 0;
 	}
 	if( footer_scan_tree != NULL )
 	{
@@ -535,7 +974,7 @@ int libsigscan_scan_state_start(
 			 "%s: unable to retrieve footer pattern spanning range.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		else if( ( result != 0 )
 		      && ( range_start < internal_scan_state->data_size ) )
@@ -555,7 +994,7 @@ int libsigscan_scan_state_start(
 			}
 #endif
 		}
-		internal_scan_state->active_footer_node = footer_scan_tree->root_node;
+		internal_scan_state->active_footer_node_index = 0;
 	}
 	if( scan_tree != NULL )
 	{
@@ -574,23 +1013,225 @@ int libsigscan_scan_state_start(
 			 "%s: unable to retrieve unbounded pattern spanning range.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		else if( result != 0 )
 		{
 			internal_scan_state->unbounded_range_size = range_size;
 		}
-		internal_scan_state->active_node = scan_tree->root_node;
+		internal_scan_state->active_node_index            = 0;
+		internal_scan_state->active_automaton_state_index = 0;
+	}
+	internal_scan_state->offset_range_start = 0;
+	internal_scan_state->offset_range_end   = 0;
+	internal_scan_state->offset_range_size  = 0;
+
+	if( ( range_scan_tree != NULL )
+	 && ( range_signatures_list != NULL ) )
+	{
+		/* The offset range spans the offset ranges of all the signatures within the data
+		 */
+		if( libcdata_list_get_first_element(
+		     range_signatures_list,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first list element.",
+			 function );
+
+			goto on_error;
+		}
+		while( list_element != NULL )
+		{
+			if( libcdata_list_element_get_value(
+			     list_element,
+			     (intptr_t **) &signature,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve signature.",
+				 function );
+
+				goto on_error;
+			}
+			result = libsigscan_signature_get_data_range(
+			          signature,
+			          internal_scan_state->data_size,
+			          &range_start,
+			          &range_end,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve signature data range.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				if( internal_scan_state->offset_range_size == 0 )
+				{
+					internal_scan_state->offset_range_start = range_start;
+					internal_scan_state->offset_range_end   = range_end;
+				}
+				else
+				{
+					if( range_start < internal_scan_state->offset_range_start )
+					{
+						internal_scan_state->offset_range_start = range_start;
+					}
+					if( range_end > internal_scan_state->offset_range_end )
+					{
+						internal_scan_state->offset_range_end = range_end;
+					}
+				}
+				internal_scan_state->offset_range_size = internal_scan_state->offset_range_end
+				                                       - internal_scan_state->offset_range_start;
+			}
+			if( libcdata_list_element_get_next_element(
+			     list_element,
+			     &list_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next list element.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( libcnotify_verbose != 0 )
+		 && ( internal_scan_state->offset_range_size > 0 ) )
+		{
+			libcnotify_printf(
+			 "%s: offset range signature range: %" PRIu64 " - %" PRIu64 ".\n",
+			 function,
+			 internal_scan_state->offset_range_start,
+			 internal_scan_state->offset_range_end );
+		}
+#endif
+		internal_scan_state->active_range_node_index = 0;
+	}
+	/* A match of the unbounded or offset range scan tree that spans buffers is scanned
+	 * in the carry-over buffer, which requires the last largest pattern size - 1 bytes
+	 * of the previous buffers
+	 */
+	largest_pattern_size = internal_scan_state->unbounded_range_size;
+
+	if( internal_scan_state->offset_range_size > 0 )
+	{
+		result = libsigscan_scan_tree_get_spanning_range(
+		          range_scan_tree,
+		          &range_start,
+		          &range_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset range pattern spanning range.",
+			 function );
+
+			goto on_error;
+		}
+		else if( ( result != 0 )
+		      && ( range_size > largest_pattern_size ) )
+		{
+			largest_pattern_size = range_size;
+		}
+	}
+	if( largest_pattern_size > 1 )
+	{
+		if( ( largest_pattern_size - 1 ) > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid largest pattern size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		carry_over_size = (size_t) ( largest_pattern_size - 1 );
+
+		/* The carry-over buffer contains the carry-over data followed by the start of the next buffer
+		 */
+		internal_scan_state->buffer = (uint8_t *) memory_allocate(
+		                                           sizeof( uint8_t ) * 2 * carry_over_size );
+
+		if( internal_scan_state->buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create carry-over buffer.",
+			 function );
+
+			goto on_error;
+		}
 	}
-	internal_scan_state->data_offset       = 0;
-	internal_scan_state->state             = LIBSIGSCAN_SCAN_STATE_STARTED;
-	internal_scan_state->header_scan_tree  = header_scan_tree;
-	internal_scan_state->footer_scan_tree  = footer_scan_tree;
-	internal_scan_state->scan_tree         = scan_tree;
-	internal_scan_state->buffer_size       = scan_buffer_size;
-	internal_scan_state->buffer_data_size  = 0;
+	for( resume_data_offset_index = 0;
+	     resume_data_offset_index < LIBSIGSCAN_SCAN_STATE_NUMBER_OF_RESUME_DATA_OFFSETS;
+	     resume_data_offset_index++ )
+	{
+		internal_scan_state->resume_data_offsets[ resume_data_offset_index ] = 0;
+	}
+	internal_scan_state->data_offset      = 0;
+	internal_scan_state->state            = LIBSIGSCAN_SCAN_STATE_STARTED;
+	internal_scan_state->header_scan_tree = header_scan_tree;
+	internal_scan_state->header_data_size = 0;
+	internal_scan_state->footer_scan_tree = footer_scan_tree;
+	internal_scan_state->footer_data_size = 0;
+	internal_scan_state->scan_tree        = scan_tree;
+	internal_scan_state->range_scan_tree  = range_scan_tree;
+	internal_scan_state->buffer_size      = carry_over_size;
+	internal_scan_state->buffer_data_size = 0;
+	internal_scan_state->match_range_end  = -1;
+
+	internal_scan_state->number_of_scan_results       = 0;
+	internal_scan_state->number_of_signatures         = number_of_signatures;
+	internal_scan_state->number_of_matched_signatures = 0;
+	internal_scan_state->is_complete                  = 0;
 
 	return( 1 );
+
+on_error:
+	if( internal_scan_state->matched_signatures != NULL )
+	{
+		memory_free(
+		 internal_scan_state->matched_signatures );
+
+		internal_scan_state->matched_signatures = NULL;
+	}
+	if( internal_scan_state->buffer != NULL )
+	{
+		memory_free(
+		 internal_scan_state->buffer );
+
+		internal_scan_state->buffer = NULL;
+	}
+	return( -1 );
 }
 
 /* Stops the scan state
@@ -627,47 +1268,116 @@ int libsigscan_scan_state_stop(
 
 		return( -1 );
 	}
-	if( internal_scan_state->buffer_data_size > 0 )
+	/* A header or footer range of which not all the data has been provided
+	 * is scanned with the data that is available
+	 */
+	if( internal_scan_state->header_range_size > 0 )
 	{
-		if( libsigscan_internal_scan_state_scan_buffer(
+		if( libsigscan_internal_scan_state_flush_range_buffer(
 		     internal_scan_state,
-		     internal_scan_state->data_offset,
-		     internal_scan_state->buffer,
-		     internal_scan_state->buffer_data_size,
-		     0,
+		     internal_scan_state->header_scan_tree,
+		     &( internal_scan_state->active_header_node_index ),
+		     internal_scan_state->header_range_start,
+		     internal_scan_state->header_range_end,
+		     internal_scan_state->header_buffer,
+		     &( internal_scan_state->header_data_size ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to scan buffer.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to flush header range buffer.",
 			 function );
 
 			return( -1 );
 		}
-		internal_scan_state->data_offset     += internal_scan_state->buffer_data_size;
-		internal_scan_state->buffer_data_size = 0;
 	}
-	if( internal_scan_state->buffer != NULL )
+	if( internal_scan_state->footer_range_size > 0 )
 	{
-		memory_free(
-		 internal_scan_state->buffer );
-
-		internal_scan_state->buffer = NULL;
-	}
-	internal_scan_state->buffer_size        = 0;
-	internal_scan_state->state              = LIBSIGSCAN_SCAN_STATE_STOPPED;
-	internal_scan_state->header_scan_tree   = NULL;
-	internal_scan_state->active_header_node = NULL;
-	internal_scan_state->footer_scan_tree   = NULL;
-	internal_scan_state->active_footer_node = NULL;
-	internal_scan_state->scan_tree          = NULL;
-	internal_scan_state->active_node        = NULL;
-
-	return( 1 );
-}
-
+		if( libsigscan_internal_scan_state_flush_range_buffer(
+		     internal_scan_state,
+		     internal_scan_state->footer_scan_tree,
+		     &( internal_scan_state->active_footer_node_index ),
+		     internal_scan_state->footer_range_start,
+		     internal_scan_state->footer_range_end,
+		     internal_scan_state->footer_buffer,
+		     &( internal_scan_state->footer_data_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to flush footer range buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The carry-over data of which not all the data has been provided
+	 * is scanned with the data that is available
+	 */
+	if( libsigscan_internal_scan_state_flush_buffer(
+	     internal_scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to flush carry-over buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scan_state->buffer != NULL )
+	{
+		memory_free(
+		 internal_scan_state->buffer );
+
+		internal_scan_state->buffer = NULL;
+	}
+	if( internal_scan_state->header_buffer != NULL )
+	{
+		memory_free(
+		 internal_scan_state->header_buffer );
+
+		internal_scan_state->header_buffer = NULL;
+	}
+	if( internal_scan_state->footer_buffer != NULL )
+	{
+		memory_free(
+		 internal_scan_state->footer_buffer );
+
+		internal_scan_state->footer_buffer = NULL;
+	}
+	if( internal_scan_state->matched_signatures != NULL )
+	{
+		memory_free(
+		 internal_scan_state->matched_signatures );
+
+		internal_scan_state->matched_signatures = NULL;
+	}
+	internal_scan_state->buffer_size                  = 0;
+	internal_scan_state->buffer_data_size             = 0;
+	internal_scan_state->state                        = LIBSIGSCAN_SCAN_STATE_STOPPED;
+	internal_scan_state->header_scan_tree             = NULL;
+	internal_scan_state->active_header_node_index     = 0;
+	internal_scan_state->footer_scan_tree             = NULL;
+	internal_scan_state->active_footer_node_index     = 0;
+	internal_scan_state->scan_tree                    = NULL;
+	internal_scan_state->active_node_index            = 0;
+	internal_scan_state->active_automaton_state_index = 0;
+	internal_scan_state->range_scan_tree              = NULL;
+	internal_scan_state->active_range_node_index      = 0;
+	internal_scan_state->offset_range_start           = 0;
+	internal_scan_state->offset_range_end             = 0;
+	internal_scan_state->offset_range_size            = 0;
+
+	return( 1 );
+}
+
 /* Flushes the scan state
  * Returns 1 if successful or -1 on error
  */
@@ -702,162 +1412,296 @@ int libsigscan_scan_state_flush(
 
 		return( -1 );
 	}
-	if( internal_scan_state->buffer_data_size > 0 )
+	/* A header or footer range of which not all the data has been provided
+	 * is scanned with the data that is available
+	 */
+	if( internal_scan_state->header_range_size > 0 )
 	{
-		if( libsigscan_internal_scan_state_scan_buffer(
+		if( libsigscan_internal_scan_state_flush_range_buffer(
 		     internal_scan_state,
-		     internal_scan_state->data_offset,
-		     internal_scan_state->buffer,
-		     internal_scan_state->buffer_data_size,
-		     0,
+		     internal_scan_state->header_scan_tree,
+		     &( internal_scan_state->active_header_node_index ),
+		     internal_scan_state->header_range_start,
+		     internal_scan_state->header_range_end,
+		     internal_scan_state->header_buffer,
+		     &( internal_scan_state->header_data_size ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to scan buffer.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to flush header range buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_scan_state->footer_range_size > 0 )
+	{
+		if( libsigscan_internal_scan_state_flush_range_buffer(
+		     internal_scan_state,
+		     internal_scan_state->footer_scan_tree,
+		     &( internal_scan_state->active_footer_node_index ),
+		     internal_scan_state->footer_range_start,
+		     internal_scan_state->footer_range_end,
+		     internal_scan_state->footer_buffer,
+		     &( internal_scan_state->footer_data_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to flush footer range buffer.",
 			 function );
 
 			return( -1 );
 		}
-		internal_scan_state->data_offset     += internal_scan_state->buffer_data_size;
-		internal_scan_state->buffer_data_size = 0;
+	}
+	/* The carry-over data of which not all the data has been provided
+	 * is scanned with the data that is available
+	 */
+	if( libsigscan_internal_scan_state_flush_buffer(
+	     internal_scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to flush carry-over buffer.",
+		 function );
+
+		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Scans the buffer using a specific scan tree and updates the scan state
- * Returns 1 if successful, 0 if data size has been reached or -1 on error
+/* Sets the match range end
+ * The data after the match range end is only used to complete the matches that start before it
+ * A match range end of -1 represents that the match range is not limited
+ * Returns 1 if successful or -1 on error
  */
-int libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
-     libsigscan_internal_scan_state_t *internal_scan_state,
-     libsigscan_scan_tree_t *scan_tree,
-     libsigscan_scan_tree_node_t **active_node,
-     off64_t data_offset,
-     const uint8_t *buffer,
-     size_t buffer_size,
-     size_t buffer_offset,
+int libsigscan_scan_state_set_match_range_end(
+     libsigscan_scan_state_t *scan_state,
+     off64_t match_range_end,
      libcerror_error_t **error )
 {
-	libsigscan_scan_object_t *scan_object = NULL;
-	libsigscan_scan_result_t *scan_result = NULL;
-	libsigscan_signature_t *signature     = NULL;
-	static char *function                 = "libsigscan_internal_scan_state_scan_buffer_by_scan_tree";
-	size_t buffer_end_offset              = 0;
-	size_t skip_value                     = 0;
-	size_t smallest_pattern_size          = 0;
-	uint8_t scan_object_type              = 0;
-	int entry_index                       = 0;
-	int identifier_index                  = 0;
-	int number_of_identifiers             = 0;
-	int result                            = 0;
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_set_match_range_end";
 
-	if( internal_scan_state == NULL )
+	if( scan_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid internal scan state.",
+		 "%s: invalid scan state.",
 		 function );
 
 		return( -1 );
 	}
-	if( scan_tree == NULL )
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( match_range_end < -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid scan tree.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid match range end value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( scan_tree->skip_table == NULL )
+	internal_scan_state->match_range_end = match_range_end;
+
+	return( 1 );
+}
+
+/* Retrieves the resume data offsets
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_get_resume_data_offsets(
+     libsigscan_scan_state_t *scan_state,
+     off64_t *resume_data_offsets,
+     int number_of_resume_data_offsets,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_get_resume_data_offsets";
+	int resume_data_offset_index                          = 0;
+
+	if( scan_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid scan tree - missing skip table.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
 		 function );
 
 		return( -1 );
 	}
-	if( active_node == NULL )
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( resume_data_offsets == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid active scan tree node.",
+		 "%s: invalid resume data offsets.",
 		 function );
 
 		return( -1 );
 	}
-	if( data_offset < 0 )
+	if( number_of_resume_data_offsets != LIBSIGSCAN_SCAN_STATE_NUMBER_OF_RESUME_DATA_OFFSETS )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid data offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of resume data offsets.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer == NULL )
+	for( resume_data_offset_index = 0;
+	     resume_data_offset_index < number_of_resume_data_offsets;
+	     resume_data_offset_index++ )
+	{
+		resume_data_offsets[ resume_data_offset_index ] = internal_scan_state->resume_data_offsets[ resume_data_offset_index ];
+	}
+	return( 1 );
+}
+
+/* Sets the resume data offsets
+ * This is used to continue the scan of the scan trees from a previous scan state
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_set_resume_data_offsets(
+     libsigscan_scan_state_t *scan_state,
+     const off64_t *resume_data_offsets,
+     int number_of_resume_data_offsets,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
+	static char *function                                 = "libsigscan_scan_state_set_resume_data_offsets";
+	int resume_data_offset_index                          = 0;
+
+	if( scan_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 "%s: invalid scan state.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( buffer_size == 0 )
-	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( resume_data_offsets == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid buffer size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resume data offsets.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer_offset >= buffer_size )
+	if( number_of_resume_data_offsets != LIBSIGSCAN_SCAN_STATE_NUMBER_OF_RESUME_DATA_OFFSETS )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid buffer offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of resume data offsets.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_scan_state->data_size == 0 )
-	 || ( (size64_t) data_offset >= internal_scan_state->data_size ) )
+	for( resume_data_offset_index = 0;
+	     resume_data_offset_index < number_of_resume_data_offsets;
+	     resume_data_offset_index++ )
 	{
-		return( 0 );
+		if( resume_data_offsets[ resume_data_offset_index ] < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid resume data offset: %d value out of bounds.",
+			 function,
+			 resume_data_offset_index );
+
+			return( -1 );
+		}
 	}
-	while( buffer_offset < buffer_size )
+	for( resume_data_offset_index = 0;
+	     resume_data_offset_index < number_of_resume_data_offsets;
+	     resume_data_offset_index++ )
 	{
-		result = libsigscan_scan_tree_node_scan_buffer(
-		          *active_node,
-		          scan_tree->pattern_offsets_mode,
-		          data_offset,
+		internal_scan_state->resume_data_offsets[ resume_data_offset_index ] = resume_data_offsets[ resume_data_offset_index ];
+	}
+	return( 1 );
+}
+
+/* Appends a scan result for every identifier of the signature
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_append_scan_results(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     off64_t data_offset,
+     libsigscan_signature_t *signature,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_result_t *scan_result = NULL;
+	static char *function                 = "libsigscan_internal_scan_state_append_scan_results";
+	uint64_t range_end                    = 0;
+	uint64_t range_start                  = 0;
+	int entry_index                       = 0;
+	int identifier_index                  = 0;
+	int number_of_identifiers             = 0;
+	int result                            = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature->range_flags != 0 )
+	{
+		/* The offset range is scanned as a whole, hence a match of a signature
+		 * outside its own offset range is ignored
+		 */
+		result = libsigscan_signature_get_data_range(
+		          signature,
 		          internal_scan_state->data_size,
-		          buffer,
-		          buffer_size,
-		          buffer_offset,
-		          &scan_object,
+		          &range_start,
+		          &range_end,
 		          error );
 
 		if( result == -1 )
@@ -866,214 +1710,2097 @@ int libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to scan buffer.",
+			 "%s: unable to retrieve signature data range.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		else if( result != 0 )
+		else if( ( result == 0 )
+		      || ( (uint64_t) data_offset < range_start )
+		      || ( (uint64_t) data_offset > ( range_end - signature->pattern_size ) ) )
 		{
-			if( libsigscan_scan_object_get_type(
-			     scan_object,
-			     &scan_object_type,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve scan object type.",
-				 function );
+			return( 1 );
+		}
+	}
+	if( internal_scan_state->is_complete != 0 )
+	{
+		return( 1 );
+	}
+	/* With the each signature once stop policy a signature that has been matched is no longer reported
+	 */
+	if( internal_scan_state->matched_signatures != NULL )
+	{
+		if( ( signature->signature_index < 0 )
+		 || ( signature->signature_index >= internal_scan_state->number_of_signatures ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid signature - signature index value out of bounds.",
+			 function );
 
-				goto on_error;
-			}
-			if( scan_object_type != LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported scan object type.",
-				 function );
+			return( -1 );
+		}
+		if( internal_scan_state->matched_signatures[ signature->signature_index ] != 0 )
+		{
+			return( 1 );
+		}
+	}
+	if( libsigscan_signature_get_number_of_identifiers(
+	     signature,
+	     &number_of_identifiers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of identifiers in signature.",
+		 function );
 
-				goto on_error;
-			}
-			if( libsigscan_scan_object_get_value(
-			     scan_object,
-			     (intptr_t **) &signature,
-			     error ) != 1 )
+		goto on_error;
+	}
+	for( identifier_index = 0;
+	     identifier_index < number_of_identifiers;
+	     identifier_index++ )
+	{
+		if( libsigscan_scan_result_initialize(
+		     &scan_result,
+		     data_offset,
+		     signature,
+		     identifier_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan result.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     internal_scan_state->scan_results_array,
+		     &entry_index,
+		     (intptr_t *) scan_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append scan result.",
+			 function );
+
+			goto on_error;
+		}
+		scan_result = NULL;
+
+		internal_scan_state->number_of_scan_results += 1;
+
+		if( ( internal_scan_state->maximum_number_of_results > 0 )
+		 && ( internal_scan_state->number_of_scan_results >= internal_scan_state->maximum_number_of_results ) )
+		{
+			internal_scan_state->is_complete = 1;
+
+			break;
+		}
+	}
+	if( internal_scan_state->matched_signatures != NULL )
+	{
+		internal_scan_state->matched_signatures[ signature->signature_index ] = 1;
+
+		internal_scan_state->number_of_matched_signatures += 1;
+
+		if( internal_scan_state->number_of_matched_signatures >= internal_scan_state->number_of_signatures )
+		{
+			internal_scan_state->is_complete = 1;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( scan_result != NULL )
+	{
+		libsigscan_internal_scan_result_free(
+		 (libsigscan_internal_scan_result_t **) &scan_result,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends the scan results of another scan state that are within a specific data range
+ * The scan results are appended in the order of the other scan state, where the stop policy
+ * of the scan state is applied as if the scan state matched the signatures itself
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_state_append_scan_results_in_range(
+     libsigscan_scan_state_t *scan_state,
+     libsigscan_scan_state_t *source_scan_state,
+     off64_t range_start,
+     off64_t range_end,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scan_result_t *internal_scan_result      = NULL;
+	libsigscan_internal_scan_state_t *internal_scan_state        = NULL;
+	libsigscan_internal_scan_state_t *internal_source_scan_state = NULL;
+	static char *function                                        = "libsigscan_scan_state_append_scan_results_in_range";
+	int number_of_results                                        = 0;
+	int result_index                                             = 0;
+
+	if( scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scan_state = (libsigscan_internal_scan_state_t *) scan_state;
+
+	if( source_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source scan state.",
+		 function );
+
+		return( -1 );
+	}
+	internal_source_scan_state = (libsigscan_internal_scan_state_t *) source_scan_state;
+
+	if( internal_scan_state->state != LIBSIGSCAN_SCAN_STATE_STARTED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid scan state - unsupported state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( range_start < 0 )
+	 || ( range_end < range_start ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_source_scan_state->scan_results_array,
+	     &number_of_results,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of source scan results.",
+		 function );
+
+		return( -1 );
+	}
+	for( result_index = 0;
+	     result_index < number_of_results;
+	     result_index++ )
+	{
+		if( internal_scan_state->is_complete != 0 )
+		{
+			break;
+		}
+		if( libcdata_array_get_entry_by_index(
+		     internal_source_scan_state->scan_results_array,
+		     result_index,
+		     (intptr_t **) &internal_scan_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source scan result: %d.",
+			 function,
+			 result_index );
+
+			return( -1 );
+		}
+		if( internal_scan_result == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing source scan result: %d.",
+			 function,
+			 result_index );
+
+			return( -1 );
+		}
+		/* A match is stored as a scan result for every identifier of the signature
+		 * hence only the first one is used to append the match
+		 */
+		if( ( internal_scan_result->signature_identifier_index != 0 )
+		 || ( internal_scan_result->offset < range_start )
+		 || ( internal_scan_result->offset >= range_end ) )
+		{
+			continue;
+		}
+		if( libsigscan_internal_scan_state_append_scan_results(
+		     internal_scan_state,
+		     internal_scan_result->offset,
+		     internal_scan_result->signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append scan results.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the skip value of a buffer offset at which no signature matches
+ * This function is used by the scan loops, which validate the arguments once per buffer
+ * Returns 1 if successful or -1 on error
+ */
+static int libsigscan_internal_scan_state_get_skip_value(
+            libsigscan_skip_table_t *skip_table,
+            int pattern_offsets_mode,
+            const uint8_t *buffer,
+            size_t buffer_size,
+            size_t buffer_offset,
+            size_t *skip_value,
+            libcerror_error_t **error )
+{
+	static char *function        = "libsigscan_internal_scan_state_get_skip_value";
+	size_t block_data_offset     = 0;
+	size_t buffer_end_offset     = 0;
+	size_t smallest_pattern_size = 0;
+	uint16_t block_hash          = 0;
+	int result                   = 0;
+
+	smallest_pattern_size = skip_table->smallest_pattern_size;
+
+	/* The uniform block and block skip values are only used for unbounded signatures
+	 */
+	if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+	{
+		/* A block of a single repeated byte value, such as a zero-filled sector, is skipped
+		 * at once if no pattern can match within it. The first and last byte of the smallest
+		 * uniform block are compared first to keep the check cheap on other data
+		 */
+		if( ( ( buffer_size - buffer_offset ) >= LIBSIGSCAN_SKIP_TABLE_UNIFORM_BLOCK_SIZE )
+		 && ( buffer[ buffer_offset ] == buffer[ buffer_offset + LIBSIGSCAN_SKIP_TABLE_UNIFORM_BLOCK_SIZE - 1 ] )
+		 && ( skip_table->uniform_block_values[ buffer[ buffer_offset ] ] == 0 ) )
+		{
+			result = libsigscan_skip_table_get_uniform_block_skip_value(
+			          skip_table,
+			          &( buffer[ buffer_offset ] ),
+			          buffer_size - buffer_offset,
+			          skip_value,
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve scan object value.",
+				 "%s: unable to retrieve uniform block skip value.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
-			if( libsigscan_signature_get_number_of_identifiers(
-			     signature,
-			     &number_of_identifiers,
-			     error ) != 1 )
+			else if( result != 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve number of identifiers in signature.",
-				 function );
-
-				goto on_error;
+				return( 1 );
 			}
-			for( identifier_index = 0;
-			     identifier_index < number_of_identifiers;
-			     identifier_index++ )
+		}
+		if( ( skip_table->block_skip_values != NULL )
+		 && ( skip_table->block_size > 0 )
+		 && ( smallest_pattern_size <= ( buffer_size - buffer_offset ) ) )
+		{
+			/* Equivalent to libsigscan_skip_table_get_block_skip_value
+			 */
+			for( block_data_offset = buffer_offset + smallest_pattern_size - skip_table->block_size;
+			     block_data_offset < buffer_offset + smallest_pattern_size;
+			     block_data_offset++ )
 			{
-				if( libsigscan_scan_result_initialize(
-				     &scan_result,
-				     data_offset,
-				     signature,
-				     identifier_index,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create scan result.",
-					 function );
+				block_hash = (uint16_t) ( ( block_hash << 7 ) ^ buffer[ block_data_offset ] );
+			}
+			*skip_value = (size_t) skip_table->block_skip_values[ block_hash % LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_SKIP_VALUES ];
 
-					goto on_error;
-				}
-				if( libcdata_array_append_entry(
-				     internal_scan_state->scan_results_array,
-				     &entry_index,
-				     (intptr_t *) scan_result,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append scan result.",
-					 function );
+			return( 1 );
+		}
+	}
+	/* The Boyer-Moore-Horspool skip value of the byte value at the end of the smallest pattern
+	 */
+	if( smallest_pattern_size > buffer_size )
+	{
+		smallest_pattern_size = buffer_size;
+	}
+	buffer_end_offset = buffer_offset + smallest_pattern_size - 1;
 
-					goto on_error;
-				}
-				scan_result = NULL;
+	if( buffer_end_offset >= buffer_size )
+	{
+		buffer_end_offset = buffer_size - 1;
+	}
+	do
+	{
+		*skip_value = skip_table->skip_values[ buffer[ buffer_end_offset ] ];
+
+		if( *skip_value == 0 )
+		{
+			if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+			{
+				*skip_value = skip_table->smallest_skip_value;
+			}
+			else
+			{
+				*skip_value = skip_table->smallest_pattern_size;
 			}
-			skip_value = signature->pattern_size;
 		}
-		if( result == 0 )
+		buffer_end_offset -= 1;
+	}
+	while( ( buffer_end_offset > buffer_offset )
+	    && ( *skip_value == 0 ) );
+
+	return( 1 );
+}
+
+/* Retrieves the first match of a specific unbounded scan tree in the buffer
+ * This function is used by the scan loops, which validate the arguments once per buffer
+ * The remainder of the buffer must be within the data size
+ * Only matches that start before the scan end offset are retrieved
+ * Returns 1 if successful, 0 if no match was found or -1 on error
+ */
+static int libsigscan_internal_scan_state_get_unbounded_match(
+            libsigscan_scan_tree_t *scan_tree,
+            const uint8_t *buffer,
+            size_t buffer_size,
+            size_t buffer_offset,
+            size_t scan_end_offset,
+            size_t *match_offset,
+            libsigscan_signature_t **signature,
+            libcerror_error_t **error )
+{
+	libsigscan_compiled_scan_tree_node_t *node          = NULL;
+	libsigscan_compiled_scan_tree_t *compiled_scan_tree = NULL;
+	libsigscan_signature_t *match_signature             = NULL;
+	static char *function                               = "libsigscan_internal_scan_state_get_unbounded_match";
+	size_t candidate_offset                             = 0;
+	size_t scan_offset                                  = 0;
+	size_t skip_value                                   = 0;
+	uint32_t node_index                                 = 0;
+	uint32_t scan_object_reference                      = 0;
+	int result                                          = 0;
+
+	compiled_scan_tree = scan_tree->compiled_scan_tree;
+
+	while( buffer_offset < scan_end_offset )
+	{
+		if( ( scan_tree->packed_matcher != NULL )
+		 || ( scan_tree->prefilter != NULL ) )
 		{
-			if( libsigscan_skip_table_get_smallest_pattern_size(
-			     scan_tree->skip_table,
-			     &smallest_pattern_size,
-			     error ) != 1 )
+			if( scan_tree->packed_matcher != NULL )
+			{
+				result = libsigscan_packed_matcher_get_candidate_offset(
+				          scan_tree->packed_matcher,
+				          buffer,
+				          buffer_size,
+				          buffer_offset,
+				          &candidate_offset,
+				          error );
+			}
+			else
+			{
+				result = libsigscan_prefilter_get_candidate_offset(
+				          scan_tree->prefilter,
+				          buffer,
+				          buffer_size,
+				          buffer_offset,
+				          &candidate_offset,
+				          error );
+			}
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve smallest pattern size.",
+				 "%s: unable to retrieve candidate offset.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
-			if( smallest_pattern_size > buffer_size )
+			else if( ( result == 0 )
+			      || ( candidate_offset >= scan_end_offset ) )
 			{
-				smallest_pattern_size = buffer_size;
+				break;
 			}
-			buffer_end_offset = buffer_offset + smallest_pattern_size - 1;
+			buffer_offset = candidate_offset;
+		}
+		/* Walk the compiled scan tree, which is equivalent to libsigscan_compiled_scan_tree_scan_buffer
+		 * and libsigscan_signature_scan_buffer for unbounded signatures
+		 */
+		node_index      = 0;
+		match_signature = NULL;
 
-			if( buffer_end_offset >= buffer_size )
+		do
+		{
+			node        = &( compiled_scan_tree->nodes[ node_index ] );
+			scan_offset = buffer_offset + (size_t) node->pattern_offset;
+
+			/* Scan tree nodes with a pattern offset beyond the buffer
+			 * continue with the default scan object
+			 */
+			if( scan_offset >= buffer_size )
 			{
-				buffer_end_offset = buffer_size - 1;
+				scan_object_reference = node->default_scan_object_reference;
 			}
-			skip_value = 0;
-
-			do
+			else
 			{
-				if( libsigscan_skip_table_get_skip_value(
-				     scan_tree->skip_table,
-				     buffer[ buffer_end_offset ],
-				     &skip_value,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve skip value.",
-					 function );
+				scan_object_reference = node->scan_object_references[ buffer[ scan_offset ] ];
 
-					goto on_error;
+				if( scan_object_reference == LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_NONE )
+				{
+					scan_object_reference = node->default_scan_object_reference;
 				}
-				if( skip_value == 0 )
+			}
+			if( scan_object_reference == LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_NONE )
+			{
+				break;
+			}
+			if( ( scan_object_reference & LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_FLAG_SIGNATURE ) == 0 )
+			{
+				node_index = scan_object_reference;
+
+				continue;
+			}
+			match_signature = compiled_scan_tree->signatures[ scan_object_reference & LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_INDEX_MASK ];
+
+			if( ( match_signature->pattern_size <= ( buffer_size - buffer_offset ) )
+			 && ( memory_compare(
+			       &( buffer[ buffer_offset ] ),
+			       match_signature->pattern,
+			       match_signature->pattern_size ) == 0 ) )
+			{
+				break;
+			}
+			match_signature = NULL;
+
+			/* If the signature does not match continue with the default scan object,
+			 * which contains the signatures without a pattern at the pattern offset of the node
+			 */
+			if( ( node->default_scan_object_reference == LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_NONE )
+			 || ( node->default_scan_object_reference == scan_object_reference ) )
+			{
+				break;
+			}
+			if( ( node->default_scan_object_reference & LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_FLAG_SIGNATURE ) != 0 )
+			{
+				match_signature = compiled_scan_tree->signatures[ node->default_scan_object_reference & LIBSIGSCAN_COMPILED_SCAN_OBJECT_REFERENCE_INDEX_MASK ];
+
+				if( ( match_signature->pattern_size > ( buffer_size - buffer_offset ) )
+				 || ( memory_compare(
+				       &( buffer[ buffer_offset ] ),
+				       match_signature->pattern,
+				       match_signature->pattern_size ) != 0 ) )
 				{
-					if( scan_tree->pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
-					{
-						if( libsigscan_skip_table_get_smallest_skip_value(
-						     scan_tree->skip_table,
-						     &skip_value,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-							 "%s: unable to retrieve smallest skip value.",
-							 function );
-
-							goto on_error;
-						}
-					}
-					else
-					{
-						if( libsigscan_skip_table_get_smallest_pattern_size(
-						     scan_tree->skip_table,
-						     &skip_value,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-							 "%s: unable to retrieve smallest pattern size.",
-							 function );
-
-							goto on_error;
-						}
-					}
+					match_signature = NULL;
 				}
-				buffer_end_offset -= 1;
+				break;
 			}
-			while( ( buffer_end_offset > buffer_offset )
-			    && ( skip_value == 0 ) );
+			node_index = node->default_scan_object_reference;
 		}
-		if( scan_tree->pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+		while( 1 );
+
+		if( match_signature != NULL )
 		{
-			break;
+			*match_offset = buffer_offset;
+			*signature    = match_signature;
+
+			return( 1 );
 		}
-		*active_node = scan_tree->root_node;
+		if( libsigscan_internal_scan_state_get_skip_value(
+		     scan_tree->skip_table,
+		     LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+		     buffer,
+		     buffer_size,
+		     buffer_offset,
+		     &skip_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve skip value.",
+			 function );
 
+			return( -1 );
+		}
 		buffer_offset += skip_value;
-		data_offset   += skip_value;
 	}
-	return( 1 );
-
-on_error:
-	if( scan_result != NULL )
+	return( 0 );
+}
+
+/* Scans the buffer using a specific unbounded scan tree and updates the scan state
+ * This function is the inner scan loop for unbounded signatures, where the arguments
+ * are validated once and the matches are retrieved one after the other
+ * The remainder of the buffer must be within the data size
+ * Only matches that start before the scan end offset are scanned, the data after it
+ * is used to complete these matches. The resume offset is set to the buffer offset
+ * from which the scan continues, which is after the end of the last match if it ends
+ * after the scan end offset
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_scan_buffer_by_unbounded_scan_tree(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_scan_tree_t *scan_tree,
+     off64_t data_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t scan_end_offset,
+     size_t *resume_offset,
+     libcerror_error_t **error )
+{
+	libsigscan_signature_t *signature = NULL;
+	static char *function             = "libsigscan_internal_scan_state_scan_buffer_by_unbounded_scan_tree";
+	size64_t data_size                = 0;
+	size_t match_end_offset           = 0;
+	size_t match_offset               = 0;
+	int result                        = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree->pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid scan tree - unsupported pattern offsets mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_tree->compiled_scan_tree == NULL )
+	 || ( scan_tree->compiled_scan_tree->number_of_nodes == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan tree - missing compiled scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree->skip_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan tree - missing skip table.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset >= buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_end_offset <= buffer_offset )
+	 || ( scan_end_offset > buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan end offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( resume_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resume offset.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = internal_scan_state->data_size;
+
+	if( ( (size64_t) data_offset > data_size )
+	 || ( (size64_t) ( buffer_size - buffer_offset ) > ( data_size - (size64_t) data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value exceeds data size.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < scan_end_offset )
+	{
+		result = libsigscan_internal_scan_state_get_unbounded_match(
+		          scan_tree,
+		          buffer,
+		          buffer_size,
+		          buffer_offset,
+		          scan_end_offset,
+		          &match_offset,
+		          &signature,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve match.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		data_offset += (off64_t) ( match_offset - buffer_offset );
+
+		if( libsigscan_internal_scan_state_append_scan_results(
+		     internal_scan_state,
+		     data_offset,
+		     signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append scan results.",
+			 function );
+
+			return( -1 );
+		}
+		buffer_offset    = match_offset + signature->pattern_size;
+		data_offset     += (off64_t) signature->pattern_size;
+		match_end_offset = buffer_offset;
+
+		if( internal_scan_state->is_complete != 0 )
+		{
+			break;
+		}
+	}
+	/* The positions from the scan end offset onwards are scanned once more data is available,
+	 * unless they are part of the last match
+	 */
+	if( match_end_offset > scan_end_offset )
+	{
+		*resume_offset = match_end_offset;
+	}
+	else
+	{
+		*resume_offset = scan_end_offset;
+	}
+	return( 1 );
+}
+
+/* Scans the buffer using a specific scan tree and updates the scan state
+ * Only matches that start before the scan end offset are scanned, where the resume offset
+ * is set to the buffer offset from which the scan continues
+ * Returns 1 if successful, 0 if data size has been reached or -1 on error
+ */
+int libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_scan_tree_t *scan_tree,
+     uint32_t *active_node_index,
+     off64_t data_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t scan_end_offset,
+     size_t *resume_offset,
+     libcerror_error_t **error )
+{
+	libsigscan_signature_t *signature = NULL;
+	static char *function             = "libsigscan_internal_scan_state_scan_buffer_by_scan_tree";
+	size_t candidate_offset           = 0;
+	size_t match_end_offset           = 0;
+	size_t skip_value                 = 0;
+	int result                        = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree->compiled_scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan tree - missing compiled scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree->skip_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan tree - missing skip table.",
+		 function );
+
+		return( -1 );
+	}
+	if( active_node_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid active node index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset >= buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_end_offset <= buffer_offset )
+	 || ( scan_end_offset > buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan end offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( resume_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resume offset.",
+		 function );
+
+		return( -1 );
+	}
+	*resume_offset = scan_end_offset;
+
+	if( ( internal_scan_state->data_size == 0 )
+	 || ( (size64_t) data_offset >= internal_scan_state->data_size ) )
+	{
+		return( 0 );
+	}
+	if( ( scan_tree->pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+	 && ( (size64_t) ( buffer_size - buffer_offset ) <= ( internal_scan_state->data_size - (size64_t) data_offset ) ) )
+	{
+		*active_node_index = 0;
+
+		if( libsigscan_internal_scan_state_scan_buffer_by_unbounded_scan_tree(
+		     internal_scan_state,
+		     scan_tree,
+		     data_offset,
+		     buffer,
+		     buffer_size,
+		     buffer_offset,
+		     scan_end_offset,
+		     resume_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan buffer by unbounded scan tree.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* The magic table looks up the bounded signatures by the values at their pattern offsets
+	 * instead of walking the scan tree
+	 */
+	if( scan_tree->magic_table != NULL )
+	{
+		result = libsigscan_magic_table_scan_buffer(
+		          scan_tree->magic_table,
+		          scan_tree->pattern_offsets_mode,
+		          data_offset,
+		          internal_scan_state->data_size,
+		          buffer,
+		          buffer_size,
+		          buffer_offset,
+		          &signature,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan buffer by magic table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libsigscan_internal_scan_state_append_scan_results(
+			     internal_scan_state,
+			     data_offset,
+			     signature,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append scan results.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		return( 1 );
+	}
+	while( buffer_offset < scan_end_offset )
+	{
+		/* The packed matcher or the prefilter skips the data up to the next position
+		 * where an unbounded signature can start, which the skip table would otherwise also reach
+		 */
+		if( ( scan_tree->packed_matcher != NULL )
+		 || ( scan_tree->prefilter != NULL ) )
+		{
+			if( scan_tree->packed_matcher != NULL )
+			{
+				result = libsigscan_packed_matcher_get_candidate_offset(
+				          scan_tree->packed_matcher,
+				          buffer,
+				          buffer_size,
+				          buffer_offset,
+				          &candidate_offset,
+				          error );
+			}
+			else
+			{
+				result = libsigscan_prefilter_get_candidate_offset(
+				          scan_tree->prefilter,
+				          buffer,
+				          buffer_size,
+				          buffer_offset,
+				          &candidate_offset,
+				          error );
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve candidate offset.",
+				 function );
+
+				return( -1 );
+			}
+			else if( ( result == 0 )
+			      || ( candidate_offset >= scan_end_offset ) )
+			{
+				break;
+			}
+			data_offset  += (off64_t) ( candidate_offset - buffer_offset );
+			buffer_offset = candidate_offset;
+		}
+		result = libsigscan_compiled_scan_tree_scan_buffer(
+		          scan_tree->compiled_scan_tree,
+		          *active_node_index,
+		          scan_tree->pattern_offsets_mode,
+		          data_offset,
+		          internal_scan_state->data_size,
+		          buffer,
+		          buffer_size,
+		          buffer_offset,
+		          &signature,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan buffer.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libsigscan_internal_scan_state_append_scan_results(
+			     internal_scan_state,
+			     data_offset,
+			     signature,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append scan results.",
+				 function );
+
+				return( -1 );
+			}
+			if( internal_scan_state->is_complete != 0 )
+			{
+				break;
+			}
+			skip_value       = signature->pattern_size;
+			match_end_offset = buffer_offset + skip_value;
+		}
+		else if( libsigscan_internal_scan_state_get_skip_value(
+		          scan_tree->skip_table,
+		          scan_tree->pattern_offsets_mode,
+		          buffer,
+		          buffer_size,
+		          buffer_offset,
+		          &skip_value,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve skip value.",
+			 function );
+
+			return( -1 );
+		}
+		if( scan_tree->pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+		{
+			break;
+		}
+		*active_node_index = 0;
+
+		buffer_offset += skip_value;
+		data_offset   += skip_value;
+	}
+	if( match_end_offset > scan_end_offset )
+	{
+		*resume_offset = match_end_offset;
+	}
+	return( 1 );
+}
+
+/* Scans the buffer by automaton and updates the scan state
+ * Only matches that start before the scan end offset are reported, where the resume offset
+ * is set to the scan end offset since the automaton reports overlapping matches
+ * Returns 1 if successful, 0 if data size has been reached or -1 on error
+ */
+int libsigscan_internal_scan_state_scan_buffer_by_automaton(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_automaton_t *automaton,
+     uint32_t *active_state_index,
+     off64_t data_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t scan_end_offset,
+     size_t *resume_offset,
+     libcerror_error_t **error )
+{
+	libsigscan_automaton_output_t *output = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	static char *function                 = "libsigscan_internal_scan_state_scan_buffer_by_automaton";
+	off64_t match_offset                  = 0;
+	size_t scan_offset                    = 0;
+	uint32_t output_index                 = 0;
+	uint32_t output_state_index           = 0;
+	int result                            = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( automaton == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid automaton.",
+		 function );
+
+		return( -1 );
+	}
+	if( active_state_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid active state index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset >= buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_end_offset <= buffer_offset )
+	 || ( scan_end_offset > buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan end offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( resume_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resume offset.",
+		 function );
+
+		return( -1 );
+	}
+	*resume_offset = scan_end_offset;
+
+	if( ( internal_scan_state->data_size == 0 )
+	 || ( (size64_t) data_offset >= internal_scan_state->data_size ) )
+	{
+		return( 0 );
+	}
+	/* A pattern that spans buffers is scanned in the carry-over buffer
+	 * hence the automaton state is not carried over between buffers
+	 */
+	*active_state_index = 0;
+	scan_offset         = buffer_offset;
+
+	do
+	{
+		result = libsigscan_automaton_scan_buffer(
+		          automaton,
+		          active_state_index,
+		          buffer,
+		          buffer_size,
+		          &scan_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan buffer.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			/* Every pattern that ends at the last consumed byte is reported,
+			 * which are the outputs of the active state and those of the states
+			 * in its output chain
+			 */
+			output_state_index = *active_state_index;
+
+			while( output_state_index != 0 )
+			{
+				output_index = automaton->states[ output_state_index ].first_output_index;
+
+				while( output_index != 0 )
+				{
+					output    = &( automaton->outputs[ output_index ] );
+					signature = output->signature;
+
+					match_offset = data_offset + (off64_t) ( scan_offset - buffer_offset ) - (off64_t) signature->pattern_size;
+
+					/* A match that starts at or after the scan end offset is reported
+					 * when the scan continues from the scan end offset
+					 */
+					if( ( scan_offset - signature->pattern_size ) >= scan_end_offset )
+					{
+						output_index = output->next_output_index;
+
+						continue;
+					}
+					if( libsigscan_internal_scan_state_append_scan_results(
+					     internal_scan_state,
+					     match_offset,
+					     signature,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append scan results.",
+						 function );
+
+						return( -1 );
+					}
+					if( internal_scan_state->is_complete != 0 )
+					{
+						return( 1 );
+					}
+					output_index = output->next_output_index;
+				}
+				output_state_index = automaton->states[ output_state_index ].output_state_index;
+			}
+		}
+	}
+	while( result != 0 );
+
+	return( 1 );
+}
+
+/* Scans the buffer using the partition scan trees of a specific scan tree and updates the scan state
+ * The matches of the partition scan trees are merged per position where a match that starts
+ * at a smaller offset goes first and of matches at the same offset the largest pattern goes first.
+ * A match that overlaps with the previous match is skipped, as in a scan tree without partitions,
+ * hence the scan results do not depend on how the signatures are partitioned
+ * Only matches that start before the scan end offset are scanned, where the resume offset
+ * is set to the buffer offset from which the scan continues
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_scan_buffer_by_partition_scan_trees(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_scan_tree_t *scan_tree,
+     off64_t data_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t scan_end_offset,
+     size_t *resume_offset,
+     libcerror_error_t **error )
+{
+	libsigscan_signature_t *signatures[ LIBSIGSCAN_SCAN_TREE_NUMBER_OF_PARTITIONS ];
+	size_t match_offsets[ LIBSIGSCAN_SCAN_TREE_NUMBER_OF_PARTITIONS ];
+
+	libsigscan_scan_tree_t *partition_scan_tree = NULL;
+	libsigscan_signature_t *signature           = NULL;
+	static char *function                       = "libsigscan_internal_scan_state_scan_buffer_by_partition_scan_trees";
+	size64_t remaining_data_size                = 0;
+	size_t match_end_offset                     = 0;
+	size_t match_offset                         = 0;
+	int match_partition_index                   = 0;
+	int partition_index                         = 0;
+	int result                                  = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_tree->number_of_partition_scan_trees <= 0 )
+	 || ( scan_tree->number_of_partition_scan_trees > LIBSIGSCAN_SCAN_TREE_NUMBER_OF_PARTITIONS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan tree - number of partition scan trees value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( partition_index = 0;
+	     partition_index < scan_tree->number_of_partition_scan_trees;
+	     partition_index++ )
+	{
+		partition_scan_tree = scan_tree->partition_scan_trees[ partition_index ];
+
+		if( ( partition_scan_tree == NULL )
+		 || ( partition_scan_tree->pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+		 || ( partition_scan_tree->compiled_scan_tree == NULL )
+		 || ( partition_scan_tree->compiled_scan_tree->number_of_nodes == 0 )
+		 || ( partition_scan_tree->skip_table == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid scan tree - invalid partition scan tree: %d.",
+			 function,
+			 partition_index );
+
+			return( -1 );
+		}
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset >= buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_end_offset <= buffer_offset )
+	 || ( scan_end_offset > buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan end offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( resume_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resume offset.",
+		 function );
+
+		return( -1 );
+	}
+	*resume_offset = scan_end_offset;
+
+	if( (size64_t) data_offset >= internal_scan_state->data_size )
+	{
+		return( 1 );
+	}
+	/* The data after the end of the data is not part of any match
+	 */
+	remaining_data_size = internal_scan_state->data_size - (size64_t) data_offset;
+
+	if( (size64_t) ( buffer_size - buffer_offset ) > remaining_data_size )
+	{
+		buffer_size = buffer_offset + (size_t) remaining_data_size;
+
+		if( scan_end_offset > buffer_size )
+		{
+			scan_end_offset = buffer_size;
+		}
+	}
+	/* Every partition scan tree keeps its first match at or after the buffer offset,
+	 * where a match offset of the scan end offset indicates no match
+	 */
+	for( partition_index = 0;
+	     partition_index < scan_tree->number_of_partition_scan_trees;
+	     partition_index++ )
+	{
+		match_offsets[ partition_index ] = buffer_offset;
+		signatures[ partition_index ]    = NULL;
+	}
+	while( buffer_offset < scan_end_offset )
+	{
+		signature = NULL;
+
+		for( partition_index = 0;
+		     partition_index < scan_tree->number_of_partition_scan_trees;
+		     partition_index++ )
+		{
+			if( match_offsets[ partition_index ] < buffer_offset )
+			{
+				match_offsets[ partition_index ] = buffer_offset;
+				signatures[ partition_index ]    = NULL;
+			}
+			if( ( signatures[ partition_index ] == NULL )
+			 && ( match_offsets[ partition_index ] < scan_end_offset ) )
+			{
+				result = libsigscan_internal_scan_state_get_unbounded_match(
+				          scan_tree->partition_scan_trees[ partition_index ],
+				          buffer,
+				          buffer_size,
+				          buffer_offset,
+				          scan_end_offset,
+				          &( match_offsets[ partition_index ] ),
+				          &( signatures[ partition_index ] ),
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve match of partition scan tree: %d.",
+					 function,
+					 partition_index );
+
+					return( -1 );
+				}
+				else if( result == 0 )
+				{
+					match_offsets[ partition_index ] = scan_end_offset;
+				}
+			}
+			if( signatures[ partition_index ] == NULL )
+			{
+				continue;
+			}
+			if( ( signature == NULL )
+			 || ( match_offsets[ partition_index ] < match_offset )
+			 || ( ( match_offsets[ partition_index ] == match_offset )
+			  && ( signatures[ partition_index ]->pattern_size > signature->pattern_size ) ) )
+			{
+				match_offset          = match_offsets[ partition_index ];
+				match_partition_index = partition_index;
+				signature             = signatures[ partition_index ];
+			}
+		}
+		if( signature == NULL )
+		{
+			break;
+		}
+		signatures[ match_partition_index ] = NULL;
+
+		if( libsigscan_internal_scan_state_append_scan_results(
+		     internal_scan_state,
+		     data_offset + (off64_t) ( match_offset - buffer_offset ),
+		     signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append scan results.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset     += (off64_t) ( match_offset + signature->pattern_size - buffer_offset );
+		buffer_offset    = match_offset + signature->pattern_size;
+		match_end_offset = buffer_offset;
+
+		if( internal_scan_state->is_complete != 0 )
+		{
+			break;
+		}
+	}
+	if( match_end_offset > scan_end_offset )
+	{
+		*resume_offset = match_end_offset;
+	}
+	return( 1 );
+}
+
+/* Scans the buffer by a scan tree, its partition scan trees or automaton and updates the scan state
+ * The scan tree continues from its resume data offset if provided, which is updated
+ * to the data offset from which it continues in the next buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_scan_buffer_by_scan_trees(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_scan_tree_t *scan_tree,
+     uint32_t *active_node_index,
+     off64_t *resume_data_offset,
+     off64_t data_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t scan_end_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scan_state_scan_buffer_by_scan_trees";
+	size_t resume_offset  = 0;
+	int result            = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_end_offset <= buffer_offset )
+	 || ( scan_end_offset > buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan end offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* A scan tree without signatures has no compiled scan tree
+	 */
+	if( ( scan_tree->automaton == NULL )
+	 && ( scan_tree->number_of_partition_scan_trees == 0 )
+	 && ( scan_tree->compiled_scan_tree == NULL ) )
+	{
+		return( 1 );
+	}
+	/* The data before the resume data offset has already been scanned
+	 * or is part of a match of the scan tree
+	 */
+	if( ( resume_data_offset != NULL )
+	 && ( *resume_data_offset > data_offset ) )
+	{
+		if( (size64_t) ( *resume_data_offset - data_offset ) >= (size64_t) ( scan_end_offset - buffer_offset ) )
+		{
+			return( 1 );
+		}
+		buffer_offset += (size_t) ( *resume_data_offset - data_offset );
+		data_offset    = *resume_data_offset;
+	}
+	if( scan_tree->automaton != NULL )
+	{
+		result = libsigscan_internal_scan_state_scan_buffer_by_automaton(
+		          internal_scan_state,
+		          scan_tree->automaton,
+		          &( internal_scan_state->active_automaton_state_index ),
+		          data_offset,
+		          buffer,
+		          buffer_size,
+		          buffer_offset,
+		          scan_end_offset,
+		          &resume_offset,
+		          error );
+	}
+	/* The matches of the partition scan trees are merged so that every partition
+	 * can use its own skip values
+	 */
+	else if( scan_tree->number_of_partition_scan_trees > 0 )
+	{
+		result = libsigscan_internal_scan_state_scan_buffer_by_partition_scan_trees(
+		          internal_scan_state,
+		          scan_tree,
+		          data_offset,
+		          buffer,
+		          buffer_size,
+		          buffer_offset,
+		          scan_end_offset,
+		          &resume_offset,
+		          error );
+	}
+	else
+	{
+		result = libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
+		          internal_scan_state,
+		          scan_tree,
+		          active_node_index,
+		          data_offset,
+		          buffer,
+		          buffer_size,
+		          buffer_offset,
+		          scan_end_offset,
+		          &resume_offset,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan buffer by scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( resume_data_offset != NULL )
+	{
+		*resume_data_offset = data_offset + (off64_t) ( resume_offset - buffer_offset );
+	}
+	return( 1 );
+}
+
+/* Scans the buffer by a header or footer scan tree and updates the scan state
+ * The range is scanned in the buffer if the buffer contains all the data of the range,
+ * otherwise the data of the range is copied into the range buffer and the range
+ * is scanned once all the data of the range has been copied
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_scan_range_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_scan_tree_t *scan_tree,
+     uint32_t *active_node_index,
+     uint64_t range_start,
+     uint64_t range_end,
+     uint8_t **range_buffer,
+     size_t *range_data_size,
+     off64_t data_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scan_state_scan_range_buffer";
+	uint64_t copy_end     = 0;
+	uint64_t copy_start   = 0;
+	uint64_t data_end     = 0;
+	size_t range_size     = 0;
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The part of the range beyond the data size is not scanned
+	 */
+	if( range_end > internal_scan_state->data_size )
+	{
+		range_end = internal_scan_state->data_size;
+	}
+	if( range_start >= range_end )
+	{
+		return( 1 );
+	}
+	if( ( range_end - range_start ) > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	range_size = (size_t) ( range_end - range_start );
+
+	/* The range has already been scanned
+	 */
+	if( *range_data_size >= range_size )
+	{
+		return( 1 );
+	}
+	data_end = (uint64_t) data_offset + buffer_size;
+
+	if( ( (uint64_t) data_offset >= range_end )
+	 || ( data_end <= range_start ) )
+	{
+		return( 1 );
+	}
+	if( ( *range_data_size == 0 )
+	 && ( (uint64_t) data_offset <= range_start )
+	 && ( data_end >= range_end ) )
+	{
+		if( libsigscan_internal_scan_state_scan_buffer_by_scan_trees(
+		     internal_scan_state,
+		     scan_tree,
+		     active_node_index,
+		     NULL,
+		     (off64_t) range_start,
+		     &( buffer[ range_start - (uint64_t) data_offset ] ),
+		     range_size,
+		     0,
+		     range_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan buffer by scan tree.",
+			 function );
+
+			return( -1 );
+		}
+		*range_data_size = range_size;
+
+		return( 1 );
+	}
+	/* The data is copied after the data of the range that has already been copied,
+	 * data that is not contiguous with it cannot be scanned as part of the range
+	 */
+	copy_start = range_start + *range_data_size;
+	copy_end   = data_end;
+
+	if( copy_end > range_end )
+	{
+		copy_end = range_end;
+	}
+	if( ( (uint64_t) data_offset > copy_start )
+	 || ( copy_end <= copy_start ) )
+	{
+		return( 1 );
+	}
+	if( *range_buffer == NULL )
+	{
+		*range_buffer = (uint8_t *) memory_allocate(
+		                             sizeof( uint8_t ) * range_size );
+
+		if( *range_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create range buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( memory_copy(
+	     &( ( *range_buffer )[ *range_data_size ] ),
+	     &( buffer[ copy_start - (uint64_t) data_offset ] ),
+	     (size_t) ( copy_end - copy_start ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy buffer to range buffer.",
+		 function );
+
+		return( -1 );
+	}
+	*range_data_size += (size_t) ( copy_end - copy_start );
+
+	if( *range_data_size == range_size )
+	{
+		if( libsigscan_internal_scan_state_scan_buffer_by_scan_trees(
+		     internal_scan_state,
+		     scan_tree,
+		     active_node_index,
+		     NULL,
+		     (off64_t) range_start,
+		     *range_buffer,
+		     range_size,
+		     0,
+		     range_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan range buffer by scan tree.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Scans the data of a header or footer range that has been copied into the range buffer
+ * This is used when not all the data of the range has been provided
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_flush_range_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_scan_tree_t *scan_tree,
+     uint32_t *active_node_index,
+     uint64_t range_start,
+     uint64_t range_end,
+     uint8_t *range_buffer,
+     size_t *range_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scan_state_flush_range_buffer";
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_end > internal_scan_state->data_size )
+	{
+		range_end = internal_scan_state->data_size;
+	}
+	if( ( range_buffer == NULL )
+	 || ( range_start >= range_end )
+	 || ( *range_data_size == 0 )
+	 || ( (uint64_t) *range_data_size >= ( range_end - range_start ) ) )
 	{
-		libsigscan_internal_scan_result_free(
-		 (libsigscan_internal_scan_result_t **) &scan_result,
-		 NULL );
+		return( 1 );
 	}
-	return( -1 );
+	if( libsigscan_internal_scan_state_scan_buffer_by_scan_trees(
+	     internal_scan_state,
+	     scan_tree,
+	     active_node_index,
+	     NULL,
+	     (off64_t) range_start,
+	     range_buffer,
+	     *range_data_size,
+	     0,
+	     *range_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan range buffer by scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	/* The range is only scanned once
+	 */
+	*range_data_size = (size_t) ( range_end - range_start );
+
+	return( 1 );
 }
 
-/* Scans the buffer and updates the scan state
+/* Scans the buffer by the unbounded and offset range scan trees and updates the scan state
+ * Only matches that start before the scan end offset are scanned, the data after it
+ * is used to complete these matches
  * Returns 1 if successful, 0 if data size has been reached or -1 on error
  */
 int libsigscan_internal_scan_state_scan_buffer(
@@ -1082,13 +3809,16 @@ int libsigscan_internal_scan_state_scan_buffer(
      const uint8_t *buffer,
      size_t buffer_size,
      size_t buffer_offset,
+     size_t scan_end_offset,
      libcerror_error_t **error )
 {
-	static char *function      = "libsigscan_internal_scan_state_scan_buffer";
-	off64_t range_end_offset   = 0;
-	off64_t range_start_offset = 0;
-	size_t range_offset        = 0;
-	size_t range_size          = 0;
+	static char *function        = "libsigscan_internal_scan_state_scan_buffer";
+	off64_t range_end_offset     = 0;
+	off64_t range_start_offset   = 0;
+	size_t match_end_offset      = 0;
+	size_t range_offset          = 0;
+	size_t range_scan_end_offset = 0;
+	size_t range_size            = 0;
 
 	if( internal_scan_state == NULL )
 	{
@@ -1146,177 +3876,191 @@ int libsigscan_internal_scan_state_scan_buffer(
 
 		return( -1 );
 	}
+	if( ( scan_end_offset <= buffer_offset )
+	 || ( scan_end_offset > buffer_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan end offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( internal_scan_state->data_size == 0 )
 	 || ( (size64_t) data_offset >= internal_scan_state->data_size ) )
 	{
 		return( 0 );
 	}
-	if( internal_scan_state->header_range_size > 0 )
+	if( internal_scan_state->is_complete != 0 )
 	{
-		range_start_offset = data_offset;
-		range_end_offset   = data_offset + buffer_size;
+		return( 1 );
+	}
+	/* A match that starts at or after the match range end is not scanned
+	 */
+	match_end_offset = buffer_size;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+	if( internal_scan_state->match_range_end >= 0 )
+	{
+		if( data_offset >= internal_scan_state->match_range_end )
 		{
-			libcnotify_printf(
-			 "%s: header range: %" PRIi64 " - %" PRIi64 ".\n",
-			 function,
-			 internal_scan_state->header_range_start,
-			 internal_scan_state->header_range_end );
+			return( 1 );
 		}
-#endif
-		/* Check if the current data range overlaps with the header range
-		 */
-		if( ( ( range_start_offset >= (off64_t) internal_scan_state->header_range_start )
-		  && ( range_start_offset <= (off64_t) internal_scan_state->header_range_end ) )
-		 ||  ( ( range_end_offset >= (off64_t) internal_scan_state->header_range_start )
-		  && ( range_end_offset <= (off64_t) internal_scan_state->header_range_end ) ) )
+		if( (size64_t) ( internal_scan_state->match_range_end - data_offset ) < (size64_t) ( buffer_size - buffer_offset ) )
 		{
-			range_offset = buffer_offset;
-			range_size   = buffer_size;
-
-			if( range_start_offset < (off64_t) internal_scan_state->header_range_start )
-			{
-				range_offset       = (size_t) ( internal_scan_state->header_range_start - range_start_offset );
-				range_start_offset = (off64_t) internal_scan_state->header_range_start;
-			}
-			if( range_end_offset > (off64_t) internal_scan_state->header_range_end )
-			{
-				range_size      -= (size_t) ( range_end_offset - internal_scan_state->header_range_end );
-#if defined( HAVE_DEBUG_OUTPUT )
-				range_end_offset = (off64_t) internal_scan_state->header_range_end;
-#endif
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: scan range: %" PRIi64 " - %" PRIi64 ".\n",
-				 function,
-				 range_start_offset,
-				 range_end_offset );
-			}
-#endif
-			if( range_offset < range_size )
-			{
-				if( libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
-				     internal_scan_state,
-				     internal_scan_state->header_scan_tree,
-				     &( internal_scan_state->active_header_node ),
-				     range_start_offset,
-				     buffer,
-				     range_size,
-				     range_offset,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GENERIC,
-					 "%s: unable to scan buffer by header scan tree.",
-					 function );
+			match_end_offset = buffer_offset + (size_t) ( internal_scan_state->match_range_end - data_offset );
+		}
+		if( scan_end_offset > match_end_offset )
+		{
+			scan_end_offset = match_end_offset;
+		}
+	}
+	if( internal_scan_state->unbounded_range_size > 0 )
+	{
+		if( libsigscan_internal_scan_state_scan_buffer_by_scan_trees(
+		     internal_scan_state,
+		     internal_scan_state->scan_tree,
+		     &( internal_scan_state->active_node_index ),
+		     &( internal_scan_state->resume_data_offsets[ 0 ] ),
+		     data_offset,
+		     buffer,
+		     buffer_size,
+		     buffer_offset,
+		     scan_end_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan buffer by unbounded scan tree.",
+			 function );
 
-					return( -1 );
-				}
-			}
+			return( -1 );
 		}
 	}
-	if( internal_scan_state->footer_range_size > 0 )
+	if( ( internal_scan_state->is_complete == 0 )
+	 && ( internal_scan_state->offset_range_size > 0 ) )
 	{
 		range_start_offset = data_offset;
-		range_end_offset   = data_offset + buffer_size;
+		range_end_offset   = data_offset + ( buffer_size - buffer_offset );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: footer range: %" PRIi64 " - %" PRIi64 ".\n",
-			 function,
-			 internal_scan_state->footer_range_start,
-			 internal_scan_state->footer_range_end );
-		}
-#endif
-		/* Check if the current data range overlaps with the footer range
+		/* Check if the current data range overlaps with the offset range
 		 */
-		if( ( ( range_start_offset >= (off64_t) internal_scan_state->footer_range_start )
-		  && ( range_start_offset <= (off64_t) internal_scan_state->footer_range_end ) )
-		 ||  ( ( range_end_offset >= (off64_t) internal_scan_state->footer_range_start )
-		  && ( range_end_offset <= (off64_t) internal_scan_state->footer_range_end ) ) )
+		if( ( range_start_offset < (off64_t) internal_scan_state->offset_range_end )
+		 && ( range_end_offset > (off64_t) internal_scan_state->offset_range_start ) )
 		{
-			range_offset = buffer_offset;
-			range_size   = buffer_size;
+			range_offset          = buffer_offset;
+			range_size            = buffer_size;
+			range_scan_end_offset = scan_end_offset;
 
-			if( range_start_offset < (off64_t) internal_scan_state->footer_range_start )
+			if( range_start_offset < (off64_t) internal_scan_state->offset_range_start )
 			{
-				range_offset       = (size_t) ( internal_scan_state->footer_range_start - range_start_offset );
-				range_start_offset = (off64_t) internal_scan_state->footer_range_start;
+				range_offset      += (size_t) ( internal_scan_state->offset_range_start - range_start_offset );
+				range_start_offset = (off64_t) internal_scan_state->offset_range_start;
 			}
-			if( range_end_offset > (off64_t) internal_scan_state->footer_range_end )
+			/* The end of the offset range is the end of the data of the offset range scan tree
+			 * hence all the matches in the remainder of the offset range are scanned
+			 */
+			if( range_end_offset > (off64_t) internal_scan_state->offset_range_end )
 			{
-				range_size      -= (size_t) ( range_end_offset - internal_scan_state->footer_range_end );
+				range_size      -= (size_t) ( range_end_offset - internal_scan_state->offset_range_end );
 #if defined( HAVE_DEBUG_OUTPUT )
-				range_end_offset = (off64_t) internal_scan_state->footer_range_end;
+				range_end_offset = (off64_t) internal_scan_state->offset_range_end;
 #endif
+				range_scan_end_offset = range_size;
+
+				if( range_scan_end_offset > match_end_offset )
+				{
+					range_scan_end_offset = match_end_offset;
+				}
 			}
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
 				libcnotify_printf(
-				 "%s: scan range: %" PRIi64 " - %" PRIi64 ".\n",
+				 "%s: offset range scan range: %" PRIi64 " - %" PRIi64 ".\n",
 				 function,
 				 range_start_offset,
 				 range_end_offset );
 			}
 #endif
-			if( range_offset < range_size )
+			/* The offset range scan tree contains unbounded patterns, where the end
+			 * of the scan range limits the matches to the offset range
+			 */
+			if( ( range_scan_end_offset > range_offset )
+			 && ( libsigscan_internal_scan_state_scan_buffer_by_scan_trees(
+			       internal_scan_state,
+			       internal_scan_state->range_scan_tree,
+			       &( internal_scan_state->active_range_node_index ),
+			       &( internal_scan_state->resume_data_offsets[ 1 ] ),
+			       range_start_offset,
+			       buffer,
+			       range_size,
+			       range_offset,
+			       range_scan_end_offset,
+			       error ) != 1 ) )
 			{
-				/* The footer scan tree uses offset values relative to the first footer signature
-				 */
-				if( libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
-				     internal_scan_state,
-				     internal_scan_state->footer_scan_tree,
-				     &( internal_scan_state->active_footer_node ),
-				     range_start_offset,
-				     &( buffer[ range_offset ] ),
-				     range_size - range_offset,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GENERIC,
-					 "%s: unable to scan buffer by footer scan tree.",
-					 function );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan buffer by offset range scan tree.",
+				 function );
 
-					return( -1 );
-				}
+				return( -1 );
 			}
 		}
 	}
-	if( internal_scan_state->unbounded_range_size > 0 )
+	return( 1 );
+}
+
+/* Scans the carry-over data of which the matches have not been scanned with the data that is available
+ * This is used when the data that follows the carry-over data is not provided
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scan_state_flush_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scan_state_flush_buffer";
+
+	if( internal_scan_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_scan_state->buffer_data_size > 0 )
+	 && ( internal_scan_state->is_complete == 0 ) )
 	{
-		if( libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
+		if( libsigscan_internal_scan_state_scan_buffer(
 		     internal_scan_state,
-		     internal_scan_state->scan_tree,
-		     &( internal_scan_state->active_node ),
-		     data_offset,
-		     buffer,
-		     buffer_size,
-		     buffer_offset,
-		     error ) != 1 )
+		     internal_scan_state->data_offset - (off64_t) internal_scan_state->buffer_data_size,
+		     internal_scan_state->buffer,
+		     internal_scan_state->buffer_data_size,
+		     0,
+		     internal_scan_state->buffer_data_size,
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to scan buffer by unbounded scan tree.",
+			 "%s: unable to scan carry-over buffer.",
 			 function );
 
 			return( -1 );
 		}
 	}
+	internal_scan_state->buffer_data_size = 0;
+
 	return( 1 );
 }
 
@@ -1332,7 +4076,11 @@ int libsigscan_scan_state_scan_buffer(
 {
 	libsigscan_internal_scan_state_t *internal_scan_state = NULL;
 	static char *function                                 = "libsigscan_scan_state_scan_buffer";
+	off64_t carry_over_data_offset                        = 0;
+	off64_t carry_over_end_offset                         = 0;
+	off64_t scan_end_offset                               = 0;
 	size_t buffer_offset                                  = 0;
+	size_t carry_over_offset                              = 0;
 	size_t read_size                                      = 0;
 	size_t scan_size                                      = 0;
 
@@ -1398,106 +4146,263 @@ int libsigscan_scan_state_scan_buffer(
 	{
 		return( 0 );
 	}
+	/* The remainder of the data is not scanned if the stop policy has been met
+	 */
+	if( internal_scan_state->is_complete != 0 )
+	{
+		return( 1 );
+	}
 	if( ( (size64_t) buffer_size > internal_scan_state->data_size )
 	 || ( (size64_t) data_offset > ( internal_scan_state->data_size - buffer_size ) ) )
 	{
 		buffer_size = (size_t) ( internal_scan_state->data_size - data_offset );
 	}
-	scan_size = buffer_size;
-
-	if( ( internal_scan_state->buffer_data_size > 0 )
-	 && ( internal_scan_state->buffer_data_size < internal_scan_state->buffer_size ) )
+	if( buffer_size == 0 )
 	{
-		read_size = internal_scan_state->buffer_size - internal_scan_state->buffer_data_size;
-
-		if( read_size > scan_size )
+		return( 1 );
+	}
+	/* The header and footer ranges are scanned separately since their scan trees
+	 * require all the data of the range
+	 */
+	if( internal_scan_state->header_range_size > 0 )
+	{
+		if( libsigscan_internal_scan_state_scan_range_buffer(
+		     internal_scan_state,
+		     internal_scan_state->header_scan_tree,
+		     &( internal_scan_state->active_header_node_index ),
+		     internal_scan_state->header_range_start,
+		     internal_scan_state->header_range_end,
+		     &( internal_scan_state->header_buffer ),
+		     &( internal_scan_state->header_data_size ),
+		     data_offset,
+		     buffer,
+		     buffer_size,
+		     error ) != 1 )
 		{
-			read_size = scan_size;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan header range.",
+			 function );
+
+			return( -1 );
 		}
-		if( memory_copy(
-		     &( internal_scan_state->buffer[ internal_scan_state->buffer_data_size ] ),
+	}
+	if( ( internal_scan_state->is_complete == 0 )
+	 && ( internal_scan_state->footer_range_size > 0 ) )
+	{
+		if( libsigscan_internal_scan_state_scan_range_buffer(
+		     internal_scan_state,
+		     internal_scan_state->footer_scan_tree,
+		     &( internal_scan_state->active_footer_node_index ),
+		     internal_scan_state->footer_range_start,
+		     internal_scan_state->footer_range_end,
+		     &( internal_scan_state->footer_buffer ),
+		     &( internal_scan_state->footer_data_size ),
+		     data_offset,
 		     buffer,
-		     read_size ) == NULL )
+		     buffer_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy buffer to scan buffer.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan footer range.",
 			 function );
 
 			return( -1 );
 		}
-		internal_scan_state->buffer_data_size += read_size;
-		buffer_offset                         += read_size;
 	}
-	if( internal_scan_state->buffer_data_size == internal_scan_state->buffer_size )
+	if( ( internal_scan_state->is_complete != 0 )
+	 || ( ( internal_scan_state->unbounded_range_size == 0 )
+	  && ( internal_scan_state->offset_range_size == 0 ) ) )
 	{
-		if( libsigscan_internal_scan_state_scan_buffer(
+		return( 1 );
+	}
+	/* The data before the data offset of the scan state has already been scanned
+	 * by the unbounded and offset range scan trees
+	 */
+	if( data_offset < internal_scan_state->data_offset )
+	{
+		if( (size64_t) buffer_size <= (size64_t) ( internal_scan_state->data_offset - data_offset ) )
+		{
+			return( 1 );
+		}
+		buffer_offset = (size_t) ( internal_scan_state->data_offset - data_offset );
+		data_offset   = internal_scan_state->data_offset;
+	}
+	/* A match can only span buffers if the data is contiguous, hence the matches
+	 * in the carry-over data are scanned with the data that is available
+	 */
+	else if( data_offset > internal_scan_state->data_offset )
+	{
+		if( libsigscan_internal_scan_state_flush_buffer(
 		     internal_scan_state,
-		     internal_scan_state->data_offset,
-		     internal_scan_state->buffer,
-		     internal_scan_state->buffer_data_size,
-		     0,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to scan buffer.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to flush carry-over buffer.",
 			 function );
 
 			return( -1 );
 		}
-		internal_scan_state->data_offset     += internal_scan_state->buffer_data_size;
-		internal_scan_state->buffer_data_size = 0;
 	}
-	if( scan_size >= internal_scan_state->buffer_size )
+	scan_size = buffer_size - buffer_offset;
+
+	/* A match is only scanned once all its data is available, hence the matches that start
+	 * in the last carry-over size bytes of the buffer are scanned with the next buffer,
+	 * unless the buffer contains the end of the data. This way the scan results do not
+	 * depend on the size of the buffers
+	 */
+	scan_end_offset = data_offset + (off64_t) scan_size;
+
+	if( (size64_t) scan_end_offset < internal_scan_state->data_size )
+	{
+		scan_end_offset -= (off64_t) internal_scan_state->buffer_size;
+	}
+	/* The buffer is scanned in place, where the matches that start in the carry-over data
+	 * are scanned in the carry-over buffer, which contains the last bytes of the previous
+	 * buffers followed by the start of the buffer
+	 */
+	if( internal_scan_state->buffer_data_size > 0 )
 	{
-		read_size  = ( scan_size / internal_scan_state->buffer_size );
-		read_size *= internal_scan_state->buffer_size;
+		read_size = internal_scan_state->buffer_size;
+
+		if( read_size > scan_size )
+		{
+			read_size = scan_size;
+		}
+		if( memory_copy(
+		     &( internal_scan_state->buffer[ internal_scan_state->buffer_data_size ] ),
+		     &( buffer[ buffer_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy buffer to carry-over buffer.",
+			 function );
+
+			return( -1 );
+		}
+		carry_over_data_offset = data_offset - (off64_t) internal_scan_state->buffer_data_size;
+		carry_over_end_offset  = data_offset;
+
+		if( carry_over_end_offset > scan_end_offset )
+		{
+			carry_over_end_offset = scan_end_offset;
+		}
+		if( carry_over_end_offset > carry_over_data_offset )
+		{
+			if( libsigscan_internal_scan_state_scan_buffer(
+			     internal_scan_state,
+			     carry_over_data_offset,
+			     internal_scan_state->buffer,
+			     internal_scan_state->buffer_data_size + read_size,
+			     0,
+			     (size_t) ( carry_over_end_offset - carry_over_data_offset ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan carry-over buffer.",
+				 function );
 
+				return( -1 );
+			}
+		}
+	}
+	if( ( internal_scan_state->is_complete == 0 )
+	 && ( scan_end_offset > data_offset ) )
+	{
 		if( libsigscan_internal_scan_state_scan_buffer(
 		     internal_scan_state,
 		     data_offset,
-		     buffer,
-		     buffer_offset + read_size,
-		     buffer_offset,
+		     &( buffer[ buffer_offset ] ),
+		     scan_size,
+		     0,
+		     (size_t) ( scan_end_offset - data_offset ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
 			 "%s: unable to scan buffer.",
 			 function );
 
 			return( -1 );
 		}
-		data_offset   += read_size;
-		buffer_offset += read_size;
-		scan_size     -= read_size;
 	}
-	internal_scan_state->data_offset = data_offset;
+	internal_scan_state->data_offset = data_offset + (off64_t) scan_size;
 
-	if( scan_size > 0 )
+	if( internal_scan_state->buffer_size == 0 )
+	{
+		return( 1 );
+	}
+	/* Keep the last carry-over size bytes of the data as the carry-over data
+	 */
+	if( scan_size >= internal_scan_state->buffer_size )
 	{
 		if( memory_copy(
 		     internal_scan_state->buffer,
-		     &( buffer[ buffer_offset ] ),
-		     scan_size ) == NULL )
+		     &( buffer[ buffer_size - internal_scan_state->buffer_size ] ),
+		     internal_scan_state->buffer_size ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_MEMORY,
 			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy buffer to scan buffer.",
+			 "%s: unable to copy buffer to carry-over buffer.",
 			 function );
 
 			return( -1 );
 		}
-		internal_scan_state->buffer_data_size = scan_size;
+		internal_scan_state->buffer_data_size = internal_scan_state->buffer_size;
+	}
+	else
+	{
+		/* The carry-over buffer already contains the buffer if it was scanned
+		 */
+		if( internal_scan_state->buffer_data_size == 0 )
+		{
+			if( memory_copy(
+			     internal_scan_state->buffer,
+			     &( buffer[ buffer_offset ] ),
+			     scan_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy buffer to carry-over buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		internal_scan_state->buffer_data_size += scan_size;
+
+		if( internal_scan_state->buffer_data_size > internal_scan_state->buffer_size )
+		{
+			read_size = internal_scan_state->buffer_data_size - internal_scan_state->buffer_size;
+
+			for( carry_over_offset = 0;
+			     carry_over_offset < internal_scan_state->buffer_size;
+			     carry_over_offset++ )
+			{
+				internal_scan_state->buffer[ carry_over_offset ] = internal_scan_state->buffer[ read_size + carry_over_offset ];
+			}
+			internal_scan_state->buffer_data_size = internal_scan_state->buffer_size;
+		}
 	}
 	return( 1 );
 }
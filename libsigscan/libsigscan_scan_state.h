@@ -25,10 +25,13 @@
 #include <common.h>
 #include <types.h>
 
+#include "libsigscan_automaton.h"
+#include "libsigscan_definitions.h"
 #include "libsigscan_extern.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_scan_tree.h"
+#include "libsigscan_signature.h"
 #include "libsigscan_types.h"
 
 #if defined( __cplusplus )
@@ -43,7 +46,7 @@ struct libsigscan_internal_scan_state
 	 */
 	int state;
 
-	/* The data offset
+	/* The data offset, which is the end of the data scanned by the unbounded and offset range scan trees
 	 */
 	off64_t data_offset;
 
@@ -55,9 +58,9 @@ struct libsigscan_internal_scan_state
 	 */
 	libsigscan_scan_tree_t *header_scan_tree;
 
-	/* The active header (scan tree) node
+	/* The active header (compiled scan tree) node index
 	 */
-	libsigscan_scan_tree_node_t *active_header_node;
+	uint32_t active_header_node_index;
 
 	/* The footer (offset relative from start) range start
 	 */
@@ -71,13 +74,21 @@ struct libsigscan_internal_scan_state
 	 */
 	uint64_t header_range_size;
 
+	/* The header range buffer, which contains the data of a header range that spans multiple buffers
+	 */
+	uint8_t *header_buffer;
+
+	/* The header range data size, which is the size of the data of the header range that has been scanned or copied
+	 */
+	size_t header_data_size;
+
 	/* The footer (offset relative from start) scan tree
 	 */
 	libsigscan_scan_tree_t *footer_scan_tree;
 
-	/* The active footer (scan tree) node
+	/* The active footer (compiled scan tree) node index
 	 */
-	libsigscan_scan_tree_node_t *active_footer_node;
+	uint32_t active_footer_node_index;
 
 	/* The footer (offset relative from start) range start
 	 */
@@ -91,33 +102,110 @@ struct libsigscan_internal_scan_state
 	 */
 	uint64_t footer_range_size;
 
+	/* The footer range buffer, which contains the data of a footer range that spans multiple buffers
+	 */
+	uint8_t *footer_buffer;
+
+	/* The footer range data size, which is the size of the data of the footer range that has been scanned or copied
+	 */
+	size_t footer_data_size;
+
 	/* The (unbounded) scan tree
 	 */
 	libsigscan_scan_tree_t *scan_tree;
 
-	/* The active (unbounded scan tree) node
+	/* The active (unbounded compiled scan tree) node index
 	 */
-	libsigscan_scan_tree_node_t *active_node;
+	uint32_t active_node_index;
+
+	/* The active (unbounded automaton) state index
+	 */
+	uint32_t active_automaton_state_index;
 
 	/* The unbounded range size
 	 */
 	uint64_t unbounded_range_size;
 
-	/* The (scan) buffer
+	/* The offset range scan tree
+	 */
+	libsigscan_scan_tree_t *range_scan_tree;
+
+	/* The active offset range (compiled scan tree) node index
+	 */
+	uint32_t active_range_node_index;
+
+	/* The (offset relative from start) offset range start
+	 */
+	uint64_t offset_range_start;
+
+	/* The (offset relative from start) offset range end
+	 */
+	uint64_t offset_range_end;
+
+	/* The offset range size
+	 */
+	uint64_t offset_range_size;
+
+	/* The carry-over buffer, which contains the carry-over data followed by the start of the next buffer
 	 */
 	uint8_t *buffer;
 
-	/* The (scan) buffer size
+	/* The carry-over size, which is the largest unbounded or offset range pattern size - 1
 	 */
 	size_t buffer_size;
 
-	/* The (scan) buffer data size
+	/* The carry-over data size
 	 */
 	size_t buffer_data_size;
 
+	/* The resume data offsets, which are the data offsets from which the unbounded
+	 * and offset range scan trees continue scanning
+	 * A scan tree continues after the end of its last match so that the scan results
+	 * do not depend on how the data is divided into buffers
+	 */
+	off64_t resume_data_offsets[ LIBSIGSCAN_SCAN_STATE_NUMBER_OF_RESUME_DATA_OFFSETS ];
+
+	/* The match range end, which is the data offset before which an unbounded or offset range
+	 * match must start or -1 if not set
+	 */
+	off64_t match_range_end;
+
 	/* The scan results array
 	 */
 	libcdata_array_t *scan_results_array;
+
+	/* The scan flags
+	 */
+	uint32_t scan_flags;
+
+	/* The stop policy
+	 */
+	int stop_policy;
+
+	/* The maximum number of results of the stop policy
+	 */
+	int maximum_number_of_results;
+
+	/* The number of results of the current scan
+	 */
+	int number_of_scan_results;
+
+	/* The number of signatures
+	 */
+	int number_of_signatures;
+
+	/* The number of signatures that have been matched
+	 */
+	int number_of_matched_signatures;
+
+	/* The matched signatures flags
+	 * Contains a value per signature index that is non-zero if the signature has been matched
+	 */
+	uint8_t *matched_signatures;
+
+	/* Value to indicate the scan is complete, which is when the stop policy has been met
+	 */
+	uint8_t is_complete;
 };
 
 LIBSIGSCAN_EXTERN \
@@ -136,6 +224,34 @@ int libsigscan_scan_state_set_data_size(
      size64_t data_size,
      libcerror_error_t **error );
 
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_set_scan_flags(
+     libsigscan_scan_state_t *scan_state,
+     uint32_t scan_flags,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_set_stop_policy(
+     libsigscan_scan_state_t *scan_state,
+     int stop_policy,
+     int maximum_number_of_results,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scan_state_is_complete(
+     libsigscan_scan_state_t *scan_state,
+     libcerror_error_t **error );
+
+int libsigscan_scan_state_get_scan_flags(
+     libsigscan_scan_state_t *scan_state,
+     uint32_t *scan_flags,
+     libcerror_error_t **error );
+
+int libsigscan_scan_state_copy_settings(
+     libsigscan_scan_state_t *destination_scan_state,
+     libsigscan_scan_state_t *source_scan_state,
+     libcerror_error_t **error );
+
 int libsigscan_scan_state_get_buffer_size(
      libsigscan_scan_state_t *scan_state,
      size_t *buffer_size,
@@ -155,12 +271,26 @@ int libsigscan_scan_state_get_footer_range(
      uint64_t *footer_range_size,
      libcerror_error_t **error );
 
+int libsigscan_scan_state_get_unbounded_range(
+     libsigscan_scan_state_t *scan_state,
+     uint64_t *unbounded_range_size,
+     libcerror_error_t **error );
+
+int libsigscan_scan_state_get_offset_range(
+     libsigscan_scan_state_t *scan_state,
+     uint64_t *offset_range_start,
+     uint64_t *offset_range_end,
+     uint64_t *offset_range_size,
+     libcerror_error_t **error );
+
 int libsigscan_scan_state_start(
      libsigscan_scan_state_t *scan_state,
      libsigscan_scan_tree_t *header_scan_tree,
      libsigscan_scan_tree_t *footer_scan_tree,
      libsigscan_scan_tree_t *scan_tree,
-     size_t scan_buffer_size,
+     libsigscan_scan_tree_t *range_scan_tree,
+     libcdata_list_t *range_signatures_list,
+     int number_of_signatures,
      libcerror_error_t **error );
 
 int libsigscan_scan_state_stop(
@@ -171,14 +301,115 @@ int libsigscan_scan_state_flush(
      libsigscan_scan_state_t *scan_state,
      libcerror_error_t **error );
 
+int libsigscan_scan_state_set_match_range_end(
+     libsigscan_scan_state_t *scan_state,
+     off64_t match_range_end,
+     libcerror_error_t **error );
+
+int libsigscan_scan_state_get_resume_data_offsets(
+     libsigscan_scan_state_t *scan_state,
+     off64_t *resume_data_offsets,
+     int number_of_resume_data_offsets,
+     libcerror_error_t **error );
+
+int libsigscan_scan_state_set_resume_data_offsets(
+     libsigscan_scan_state_t *scan_state,
+     const off64_t *resume_data_offsets,
+     int number_of_resume_data_offsets,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_state_append_scan_results(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     off64_t data_offset,
+     libsigscan_signature_t *signature,
+     libcerror_error_t **error );
+
+int libsigscan_scan_state_append_scan_results_in_range(
+     libsigscan_scan_state_t *scan_state,
+     libsigscan_scan_state_t *source_scan_state,
+     off64_t range_start,
+     off64_t range_end,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_state_scan_buffer_by_unbounded_scan_tree(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_scan_tree_t *scan_tree,
+     off64_t data_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t scan_end_offset,
+     size_t *resume_offset,
+     libcerror_error_t **error );
+
 int libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
      libsigscan_internal_scan_state_t *internal_scan_state,
      libsigscan_scan_tree_t *scan_tree,
-     libsigscan_scan_tree_node_t **active_node,
+     uint32_t *active_node_index,
+     off64_t data_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t scan_end_offset,
+     size_t *resume_offset,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_state_scan_buffer_by_automaton(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_automaton_t *automaton,
+     uint32_t *active_state_index,
+     off64_t data_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t scan_end_offset,
+     size_t *resume_offset,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_state_scan_buffer_by_partition_scan_trees(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_scan_tree_t *scan_tree,
      off64_t data_offset,
      const uint8_t *buffer,
      size_t buffer_size,
      size_t buffer_offset,
+     size_t scan_end_offset,
+     size_t *resume_offset,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_state_scan_buffer_by_scan_trees(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_scan_tree_t *scan_tree,
+     uint32_t *active_node_index,
+     off64_t *resume_data_offset,
+     off64_t data_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t buffer_offset,
+     size_t scan_end_offset,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_state_scan_range_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_scan_tree_t *scan_tree,
+     uint32_t *active_node_index,
+     uint64_t range_start,
+     uint64_t range_end,
+     uint8_t **range_buffer,
+     size_t *range_data_size,
+     off64_t data_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_state_flush_range_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
+     libsigscan_scan_tree_t *scan_tree,
+     uint32_t *active_node_index,
+     uint64_t range_start,
+     uint64_t range_end,
+     uint8_t *range_buffer,
+     size_t *range_data_size,
      libcerror_error_t **error );
 
 int libsigscan_internal_scan_state_scan_buffer(
@@ -187,6 +418,11 @@ int libsigscan_internal_scan_state_scan_buffer(
      const uint8_t *buffer,
      size_t buffer_size,
      size_t buffer_offset,
+     size_t scan_end_offset,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scan_state_flush_buffer(
+     libsigscan_internal_scan_state_t *internal_scan_state,
      libcerror_error_t **error );
 
 int libsigscan_scan_state_scan_buffer(
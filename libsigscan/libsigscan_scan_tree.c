@@ -23,14 +23,19 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libsigscan_automaton.h"
 #include "libsigscan_byte_value_group.h"
+#include "libsigscan_compiled_scan_tree.h"
 #include "libsigscan_definitions.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_libcnotify.h"
+#include "libsigscan_magic_table.h"
 #include "libsigscan_offset_group.h"
 #include "libsigscan_offsets_list.h"
+#include "libsigscan_packed_matcher.h"
 #include "libsigscan_pattern_weights.h"
+#include "libsigscan_prefilter.h"
 #include "libsigscan_scan_object.h"
 #include "libsigscan_scan_tree.h"
 #include "libsigscan_scan_tree_node.h"
@@ -39,6 +44,7 @@
 #include "libsigscan_signature_table.h"
 #include "libsigscan_signatures_list.h"
 #include "libsigscan_skip_table.h"
+#include "libsigscan_thread_pool.h"
 
 uint8_t libsigscan_common_byte_values[ 256 ] = {
 /*                           \a \b \t \n \v \f \r      */
@@ -165,6 +171,7 @@ int libsigscan_scan_tree_free(
      libcerror_error_t **error )
 {
 	static char *function = "libsigscan_scan_tree_free";
+	int partition_index   = 0;
 	int result            = 1;
 
 	if( scan_tree == NULL )
@@ -196,6 +203,105 @@ int libsigscan_scan_tree_free(
 				result = -1;
 			}
 		}
+		if( ( *scan_tree )->compiled_scan_tree != NULL )
+		{
+			if( libsigscan_compiled_scan_tree_free(
+			     &( ( *scan_tree )->compiled_scan_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free compiled scan tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scan_tree )->automaton != NULL )
+		{
+			if( libsigscan_automaton_free(
+			     &( ( *scan_tree )->automaton ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free automaton.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scan_tree )->magic_table != NULL )
+		{
+			if( libsigscan_magic_table_free(
+			     &( ( *scan_tree )->magic_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free magic table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scan_tree )->packed_matcher != NULL )
+		{
+			if( libsigscan_packed_matcher_free(
+			     &( ( *scan_tree )->packed_matcher ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free packed matcher.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scan_tree )->prefilter != NULL )
+		{
+			if( libsigscan_prefilter_free(
+			     &( ( *scan_tree )->prefilter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free prefilter.",
+				 function );
+
+				result = -1;
+			}
+		}
+		for( partition_index = 0;
+		     partition_index < ( *scan_tree )->number_of_partition_scan_trees;
+		     partition_index++ )
+		{
+			if( libsigscan_scan_tree_free(
+			     &( ( *scan_tree )->partition_scan_trees[ partition_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free partition scan tree: %d.",
+				 function,
+				 partition_index );
+
+				result = -1;
+			}
+		}
 		if( ( *scan_tree )->skip_table != NULL )
 		{
 			if( libsigscan_skip_table_free(
@@ -1178,6 +1284,14 @@ int libsigscan_scan_tree_get_spanning_range(
 }
 
 /* Builds a scan tree node
+ * For a signature table of B pattern bytes at O distinct pattern offsets building the node
+ * costs O(B log O), the byte value groups and pattern weights are kept in sorted arrays
+ * and the signatures covered by the node are removed from the remaining signatures in one pass.
+ * The total number of nodes depends on how much the signature patterns overlap,
+ * since signatures not covered by a node are replicated into its sub nodes
+ * If the scan tree has a thread pool the sub nodes of the scan tree nodes up to the maximum
+ * parallel recursion depth are built concurrently, the resulting nodes do not depend on the
+ * order in which the sub nodes were built
  * Returns 1 if successful or -1 on error
  */
 int libsigscan_scan_tree_build_node(
@@ -1190,27 +1304,33 @@ int libsigscan_scan_tree_build_node(
      int recursion_depth,
      libcerror_error_t **error )
 {
-	libcdata_list_t *remaining_signatures_list        = NULL;
-	libcdata_list_t *sub_offsets_ignore_list          = NULL;
-	libsigscan_byte_value_group_t *byte_value_group   = NULL;
-	libsigscan_pattern_weights_t *byte_value_weights  = NULL;
-	libsigscan_pattern_weights_t *occurrence_weights  = NULL;
-	libsigscan_pattern_weights_t *similarity_weights  = NULL;
-	libsigscan_scan_object_t *scan_object             = NULL;
-	libsigscan_signature_t *signature                 = NULL;
-	libsigscan_signature_group_t *signature_group     = NULL;
-	libsigscan_signature_table_t *sub_signature_table = NULL;
-	intptr_t *scan_object_value                       = NULL;
-	static char *function                             = "libsigscan_scan_tree_build_node";
-	off64_t pattern_offset                            = 0;
-	uint8_t byte_value                                = 0;
-	uint8_t scan_object_type                          = 0;
-	int number_of_remaining_signatures                = 0;
-	int number_of_signature_groups                    = 0;
-	int number_of_signatures                          = 0;
-	int result                                        = 0;
-	int signature_group_index                         = 0;
-	int signature_index                               = 0;
+	libcdata_list_t *remaining_signatures_list             = NULL;
+	libcdata_list_t *sub_offsets_ignore_list               = NULL;
+	libsigscan_byte_value_group_t *byte_value_group        = NULL;
+	libsigscan_pattern_weights_t *byte_value_weights       = NULL;
+	libsigscan_pattern_weights_t *occurrence_weights       = NULL;
+	libsigscan_pattern_weights_t *similarity_weights       = NULL;
+	libsigscan_scan_object_t *scan_object                  = NULL;
+	libsigscan_scan_tree_sub_node_build_t *sub_node_builds = NULL;
+	libsigscan_signature_group_t *signature_group          = NULL;
+	libsigscan_signature_t **covered_signatures            = NULL;
+	libsigscan_thread_pool_t *thread_pool                  = NULL;
+	intptr_t **sub_node_build_values                       = NULL;
+	intptr_t *scan_object_value                            = NULL;
+	static char *function                                  = "libsigscan_scan_tree_build_node";
+	off64_t pattern_offset                                 = 0;
+	uint8_t byte_value                                     = 0;
+	uint8_t scan_object_type                               = 0;
+	int covered_signature_index                            = 0;
+	int number_of_covered_signatures                       = 0;
+	int number_of_remaining_signatures                     = 0;
+	int number_of_signature_groups                         = 0;
+	int number_of_signatures                               = 0;
+	int number_of_sub_node_builds                          = 0;
+	int result                                             = 0;
+	int signature_group_index                              = 0;
+	int signature_index                                    = 0;
+	int sub_node_index                                     = 0;
 
 	if( scan_tree == NULL )
 	{
@@ -1470,6 +1590,73 @@ int libsigscan_scan_tree_build_node(
 
 		goto on_error;
 	}
+	for( signature_group_index = 0;
+	     signature_group_index < number_of_signature_groups;
+	     signature_group_index++ )
+	{
+		if( libsigscan_byte_value_group_get_signature_group_by_index(
+		     byte_value_group,
+		     signature_group_index,
+		     &signature_group,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - unable to retrieve signature group: %d.",
+			 function,
+			 pattern_offset,
+			 signature_group_index );
+
+			goto on_error;
+		}
+		if( libsigscan_signature_group_get_number_of_signatures(
+		     signature_group,
+		     &number_of_signatures,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve number of signatures.",
+			 function,
+			 pattern_offset,
+			 signature_group_index );
+
+			goto on_error;
+		}
+		number_of_covered_signatures += number_of_signatures;
+	}
+	if( number_of_covered_signatures > 0 )
+	{
+		if( (size_t) number_of_covered_signatures > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libsigscan_signature_t * ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of covered signatures value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		covered_signatures = (libsigscan_signature_t **) memory_allocate(
+		                                                  sizeof( libsigscan_signature_t * ) * number_of_covered_signatures );
+
+		if( covered_signatures == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create covered signatures.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	for( signature_group_index = 0;
 	     signature_group_index < number_of_signature_groups;
 	     signature_group_index++ )
@@ -1511,41 +1698,60 @@ int libsigscan_scan_tree_build_node(
 		     signature_index < number_of_signatures;
 		     signature_index++ )
 		{
-			if( libsigscan_signature_group_get_signature_by_index(
-			     signature_group,
-			     signature_index,
-			     &signature,
-			     error ) != 1 )
+			if( covered_signature_index >= number_of_covered_signatures )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 	 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve signature: %d.",
-				 function,
-				 pattern_offset,
-				 signature_group_index,
-				 signature_index );
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid covered signature index value out of bounds.",
+				 function );
 
 				goto on_error;
 			}
-			if( libsigscan_signatures_list_remove_signature(
-			     remaining_signatures_list,
-			     signature,
+			if( libsigscan_signature_group_get_signature_by_index(
+			     signature_group,
+			     signature_index,
+			     &( covered_signatures[ covered_signature_index ] ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
-				 "%s: unable to remove signature: %s.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve signature: %d.",
 				 function,
-				 signature->identifier );
+				 pattern_offset,
+				 signature_group_index,
+				 signature_index );
 
 				goto on_error;
 			}
+			covered_signature_index++;
 		}
 	}
+	if( libsigscan_signatures_list_remove_signatures(
+	     remaining_signatures_list,
+	     covered_signatures,
+	     covered_signature_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove covered signatures.",
+		 function );
+
+		goto on_error;
+	}
+	if( covered_signatures != NULL )
+	{
+		memory_free(
+		 covered_signatures );
+
+		covered_signatures = NULL;
+	}
 	if( libsigscan_scan_tree_node_initialize(
 	     scan_tree_node,
 	     pattern_offset,
@@ -1561,8 +1767,68 @@ int libsigscan_scan_tree_build_node(
 
 		goto on_error;
 	}
-	/* Determine the scan tree node byte values
+	/* Determine the sub nodes that need to be built, the sub node of the default value
+	 * is stored after the sub nodes of the signature groups. The sub nodes do not depend
+	 * on each other hence the threads of the thread pool can build them concurrently
 	 */
+	if( (size_t) number_of_signature_groups >= ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libsigscan_scan_tree_sub_node_build_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of signature groups value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	sub_node_builds = (libsigscan_scan_tree_sub_node_build_t *) memory_allocate(
+	                                                             sizeof( libsigscan_scan_tree_sub_node_build_t ) * ( number_of_signature_groups + 1 ) );
+
+	if( sub_node_builds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sub node builds.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     sub_node_builds,
+	     0,
+	     sizeof( libsigscan_scan_tree_sub_node_build_t ) * ( number_of_signature_groups + 1 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sub node builds.",
+		 function );
+
+		memory_free(
+		 sub_node_builds );
+
+		sub_node_builds = NULL;
+
+		goto on_error;
+	}
+	sub_node_build_values = (intptr_t **) memory_allocate(
+	                                       sizeof( intptr_t * ) * ( number_of_signature_groups + 1 ) );
+
+	if( sub_node_build_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sub node build values.",
+		 function );
+
+		goto on_error;
+	}
 	for( signature_group_index = 0;
 	     signature_group_index < number_of_signature_groups;
 	     signature_group_index++ )
@@ -1584,22 +1850,6 @@ int libsigscan_scan_tree_build_node(
 
 			goto on_error;
 		}
-		if( libsigscan_signature_group_get_byte_value(
-		     signature_group,
-		     &byte_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve byte value.",
-			 function,
-			 pattern_offset,
-			 signature_group_index );
-
-			goto on_error;
-		}
 		if( libsigscan_signature_group_get_number_of_signatures(
 		     signature_group,
 		     &number_of_signatures,
@@ -1629,110 +1879,143 @@ int libsigscan_scan_tree_build_node(
 
 			goto on_error;
 		}
-		if( number_of_signatures == 1 )
+		if( number_of_signatures > 1 )
 		{
-			if( libsigscan_signature_group_get_signature_by_index(
-			     signature_group,
-			     0,
-			     (libsigscan_signature_t **) &scan_object_value,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 	 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve signature: 0.",
-				 function,
-				 pattern_offset,
-				 signature_group_index );
-
-				goto on_error;
-			}
-			scan_object_type = LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE;
+			sub_node_builds[ signature_group_index ].scan_tree                  = scan_tree;
+			sub_node_builds[ signature_group_index ].signatures_list            = signature_group->signatures_list;
+			sub_node_builds[ signature_group_index ].remaining_signatures_list  = remaining_signatures_list;
+			sub_node_builds[ signature_group_index ].offsets_ignore_list        = sub_offsets_ignore_list;
+			sub_node_builds[ signature_group_index ].pattern_offsets_mode       = pattern_offsets_mode;
+			sub_node_builds[ signature_group_index ].pattern_offsets_range_size = pattern_offsets_range_size;
+			sub_node_builds[ signature_group_index ].recursion_depth            = recursion_depth + 1;
+
+			sub_node_build_values[ number_of_sub_node_builds++ ] = (intptr_t *) &( sub_node_builds[ signature_group_index ] );
 		}
-		else
-		{
-			if( libsigscan_signature_table_initialize(
-			     &sub_signature_table,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create signature table.",
-				 function );
-
-				goto on_error;
-			}
-			if( libsigscan_signature_table_fill(
-			     sub_signature_table,
-			     signature_group->signatures_list,
-			     sub_offsets_ignore_list,
-			     pattern_offsets_mode,
-			     pattern_offsets_range_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to fill signature table.",
-				 function );
-
-				goto on_error;
-			}
-			if( libsigscan_signature_table_fill(
-			     sub_signature_table,
-			     remaining_signatures_list,
-			     sub_offsets_ignore_list,
-			     pattern_offsets_mode,
-			     pattern_offsets_range_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to fill signature table.",
-				 function );
+	}
+	if( libcdata_list_get_number_of_elements(
+	     remaining_signatures_list,
+	     &number_of_remaining_signatures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of remaining signatures.",
+		 function );
 
-				goto on_error;
-			}
-			if( libsigscan_scan_tree_build_node(
-			     scan_tree,
-			     sub_signature_table,
-			     sub_offsets_ignore_list,
-			     pattern_offsets_mode,
-			     pattern_offsets_range_size,
-			     (libsigscan_scan_tree_node_t **) &scan_object_value,
-			     recursion_depth + 1,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to build scan tree node.",
-				 function );
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of remaining signatures: %d\n",
+		 function,
+		 number_of_remaining_signatures );
+	}
+#endif
+	if( number_of_remaining_signatures > 1 )
+	{
+		sub_node_builds[ number_of_signature_groups ].scan_tree                  = scan_tree;
+		sub_node_builds[ number_of_signature_groups ].signatures_list            = NULL;
+		sub_node_builds[ number_of_signature_groups ].remaining_signatures_list  = remaining_signatures_list;
+		sub_node_builds[ number_of_signature_groups ].offsets_ignore_list        = sub_offsets_ignore_list;
+		sub_node_builds[ number_of_signature_groups ].pattern_offsets_mode       = pattern_offsets_mode;
+		sub_node_builds[ number_of_signature_groups ].pattern_offsets_range_size = pattern_offsets_range_size;
+		sub_node_builds[ number_of_signature_groups ].recursion_depth            = recursion_depth + 1;
+
+		sub_node_build_values[ number_of_sub_node_builds++ ] = (intptr_t *) &( sub_node_builds[ number_of_signature_groups ] );
+	}
+	/* The sub nodes of the deeper scan tree nodes are built by the thread that builds
+	 * the scan tree node, since there are enough sub nodes to keep the threads busy
+	 */
+	if( recursion_depth < LIBSIGSCAN_SCAN_TREE_MAXIMUM_PARALLEL_RECURSION_DEPTH )
+	{
+		thread_pool = scan_tree->thread_pool;
+	}
+	if( libsigscan_thread_pool_run_values(
+	     thread_pool,
+	     (int (*)(intptr_t *, libcerror_error_t **)) &libsigscan_scan_tree_build_sub_node,
+	     sub_node_build_values,
+	     number_of_sub_node_builds,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build sub nodes.",
+		 function );
 
-				goto on_error;
-			}
-			scan_object_type = LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE;
+		goto on_error;
+	}
+	/* Determine the scan tree node byte values
+	 */
+	for( signature_group_index = 0;
+	     signature_group_index < number_of_signature_groups;
+	     signature_group_index++ )
+	{
+		if( libsigscan_byte_value_group_get_signature_group_by_index(
+		     byte_value_group,
+		     signature_group_index,
+		     &signature_group,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - unable to retrieve signature group: %d.",
+			 function,
+			 pattern_offset,
+			 signature_group_index );
+
+			goto on_error;
+		}
+		if( libsigscan_signature_group_get_byte_value(
+		     signature_group,
+		     &byte_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve byte value.",
+			 function,
+			 pattern_offset,
+			 signature_group_index );
 
-			if( libsigscan_signature_table_free(
-			     &sub_signature_table,
+			goto on_error;
+		}
+		if( sub_node_builds[ signature_group_index ].scan_tree_node == NULL )
+		{
+			if( libsigscan_signature_group_get_signature_by_index(
+			     signature_group,
+			     0,
+			     (libsigscan_signature_t **) &scan_object_value,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free signature table.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 	 "%s: invalid byte value group for pattern offset: %" PRIi64 " - invalid signature group: %d - unable to retrieve signature: 0.",
+				 function,
+				 pattern_offset,
+				 signature_group_index );
 
 				goto on_error;
 			}
+			scan_object_type = LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE;
+		}
+		else
+		{
+			scan_object_value = (intptr_t *) sub_node_builds[ signature_group_index ].scan_tree_node;
+			scan_object_type  = LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE;
+
+			sub_node_builds[ signature_group_index ].scan_tree_node = NULL;
 		}
 		if( libsigscan_scan_object_initialize(
 		     &scan_object,
@@ -1775,29 +2058,6 @@ int libsigscan_scan_tree_build_node(
 	}
 	/* Determine the scan tree node default value
 	 */
-	if( libcdata_list_get_number_of_elements(
-	     remaining_signatures_list,
-	     &number_of_remaining_signatures,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of remaining signatures.",
-		 function );
-
-		return( -1 );
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: number of remaining signatures: %d\n",
-		 function,
-		 number_of_remaining_signatures );
-	}
-#endif
 	if( number_of_remaining_signatures == 1 )
 	{
 		if( libcdata_list_get_value_by_index(
@@ -1819,70 +2079,10 @@ int libsigscan_scan_tree_build_node(
 	}
 	else if( number_of_remaining_signatures > 1 )
 	{
-		if( libsigscan_signature_table_initialize(
-		     &sub_signature_table,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create signature table.",
-			 function );
-
-			goto on_error;
-		}
-		if( libsigscan_signature_table_fill(
-		     sub_signature_table,
-		     remaining_signatures_list,
-		     sub_offsets_ignore_list,
-		     pattern_offsets_mode,
-		     pattern_offsets_range_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to fill signature table.",
-			 function );
-
-			goto on_error;
-		}
-		if( libsigscan_scan_tree_build_node(
-		     scan_tree,
-		     sub_signature_table,
-		     sub_offsets_ignore_list,
-		     pattern_offsets_mode,
-		     pattern_offsets_range_size,
-		     (libsigscan_scan_tree_node_t **) &scan_object_value,
-		     recursion_depth + 1,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to build scan tree node.",
-			 function );
-
-			goto on_error;
-		}
-		scan_object_type = LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE;
-
-		if( libsigscan_signature_table_free(
-		     &sub_signature_table,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free signature table.",
-			 function );
+		scan_object_value = (intptr_t *) sub_node_builds[ number_of_signature_groups ].scan_tree_node;
+		scan_object_type  = LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE;
 
-			goto on_error;
-		}
+		sub_node_builds[ number_of_signature_groups ].scan_tree_node = NULL;
 	}
 	if( scan_object_value != NULL )
 	{
@@ -1923,6 +2123,15 @@ int libsigscan_scan_tree_build_node(
 		 */
 		scan_object = NULL;
 	}
+	memory_free(
+	 sub_node_build_values );
+
+	sub_node_build_values = NULL;
+
+	memory_free(
+	 sub_node_builds );
+
+	sub_node_builds = NULL;
 	if( libcdata_list_free(
 	     &sub_offsets_ignore_list,
 	     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
@@ -1972,11 +2181,31 @@ int libsigscan_scan_tree_build_node(
 	return( 1 );
 
 on_error:
-	if( sub_signature_table != NULL )
+	if( covered_signatures != NULL )
 	{
-		libsigscan_signature_table_free(
-		 &sub_signature_table,
-		 NULL );
+		memory_free(
+		 covered_signatures );
+	}
+	if( sub_node_build_values != NULL )
+	{
+		memory_free(
+		 sub_node_build_values );
+	}
+	if( sub_node_builds != NULL )
+	{
+		for( sub_node_index = 0;
+		     sub_node_index <= number_of_signature_groups;
+		     sub_node_index++ )
+		{
+			if( sub_node_builds[ sub_node_index ].scan_tree_node != NULL )
+			{
+				libsigscan_scan_tree_node_free(
+				 &( sub_node_builds[ sub_node_index ].scan_tree_node ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 sub_node_builds );
 	}
 	if( ( scan_object_value != NULL )
 	 && ( scan_object_type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE ) )
@@ -2031,71 +2260,194 @@ on_error:
 	return( -1 );
 }
 
-/* Builds the scan tree
- * Returns 1 if successful, 0 if no such value or -1 on error
+/* Builds a sub scan tree node
+ * The sub scan tree node is built from a signature table of the signatures of the signature group
+ * and the remaining signatures, which are only read hence sub scan tree nodes can be built concurrently
+ * Returns 1 if successful or -1 on error
  */
-int libsigscan_scan_tree_build(
-     libsigscan_scan_tree_t *scan_tree,
-     libcdata_list_t *signatures_list,
-     int pattern_offsets_mode,
+int libsigscan_scan_tree_build_sub_node(
+     libsigscan_scan_tree_sub_node_build_t *sub_node_build,
      libcerror_error_t **error )
 {
-	libcdata_list_t *offsets_ignore_list          = NULL;
-	libsigscan_signature_table_t *signature_table = NULL;
-	static char *function                         = "libsigscan_scan_tree_build";
-	uint64_t range_size                           = 0;
-	uint64_t range_start                          = 0;
-	int number_of_pattern_ranges                  = 0;
-	int result                                    = 0;
+	libsigscan_signature_table_t *sub_signature_table = NULL;
+	static char *function                             = "libsigscan_scan_tree_build_sub_node";
 
-	if( scan_tree == NULL )
+	if( sub_node_build == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid scan tree.",
+		 "%s: invalid sub node build.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
-	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
-	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND ) )
+	if( libsigscan_signature_table_initialize(
+	     &sub_signature_table,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported pattern offsets mode.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create signature table.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libsigscan_scan_tree_fill_range_list(
-	     scan_tree,
-	     signatures_list,
-	     pattern_offsets_mode,
+	if( sub_node_build->signatures_list != NULL )
+	{
+		if( libsigscan_signature_table_fill(
+		     sub_signature_table,
+		     sub_node_build->signatures_list,
+		     sub_node_build->offsets_ignore_list,
+		     sub_node_build->pattern_offsets_mode,
+		     sub_node_build->pattern_offsets_range_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to fill signature table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_signature_table_fill(
+	     sub_signature_table,
+	     sub_node_build->remaining_signatures_list,
+	     sub_node_build->offsets_ignore_list,
+	     sub_node_build->pattern_offsets_mode,
+	     sub_node_build->pattern_offsets_range_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to fill range list.",
+		 "%s: unable to fill signature table.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcdata_range_list_get_number_of_elements(
-	     scan_tree->pattern_range_list,
-	     &number_of_pattern_ranges,
+	if( libsigscan_scan_tree_build_node(
+	     sub_node_build->scan_tree,
+	     sub_signature_table,
+	     sub_node_build->offsets_ignore_list,
+	     sub_node_build->pattern_offsets_mode,
+	     sub_node_build->pattern_offsets_range_size,
+	     &( sub_node_build->scan_tree_node ),
+	     sub_node_build->recursion_depth,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build scan tree node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_signature_table_free(
+	     &sub_signature_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free signature table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( sub_node_build->scan_tree_node != NULL )
+	{
+		libsigscan_scan_tree_node_free(
+		 &( sub_node_build->scan_tree_node ),
+		 NULL );
+	}
+	if( sub_signature_table != NULL )
+	{
+		libsigscan_signature_table_free(
+		 &sub_signature_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Builds the scan tree
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libsigscan_scan_tree_build(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     int pattern_offsets_mode,
+     libcerror_error_t **error )
+{
+	libcdata_list_t *offsets_ignore_list          = NULL;
+	libsigscan_signature_table_t *signature_table = NULL;
+	static char *function                         = "libsigscan_scan_tree_build";
+	uint64_t range_size                           = 0;
+	uint64_t range_start                          = 0;
+	int number_of_pattern_ranges                  = 0;
+	int result                                    = 0;
+
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
+	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
+	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pattern offsets mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_tree_fill_range_list(
+	     scan_tree,
+	     signatures_list,
+	     pattern_offsets_mode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to fill range list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_range_list_get_number_of_elements(
+	     scan_tree->pattern_range_list,
+	     &number_of_pattern_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 		 "%s: unable to retrieve number of pattern ranges.",
 		 function );
 
@@ -2188,6 +2540,49 @@ int libsigscan_scan_tree_build(
 
 		goto on_error;
 	}
+	/* The scan tree is compiled into a contiguous array of nodes to reduce
+	 * the number of indirections and improve cache locality while scanning
+	 */
+	if( libsigscan_compiled_scan_tree_initialize(
+	     &( scan_tree->compiled_scan_tree ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compiled scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_compiled_scan_tree_compile(
+	     scan_tree->compiled_scan_tree,
+	     scan_tree->root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to compile scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_tree_node_free(
+	     &( scan_tree->root_node ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free root scan tree node.",
+		 function );
+
+		goto on_error;
+	}
 	if( libcdata_list_free(
 	     &offsets_ignore_list,
 	     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
@@ -2215,6 +2610,89 @@ int libsigscan_scan_tree_build(
 
 		goto on_error;
 	}
+	if( libsigscan_scan_tree_build_tables(
+	     scan_tree,
+	     signatures_list,
+	     pattern_offsets_mode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build tables.",
+		 function );
+
+		goto on_error;
+	}
+	scan_tree->pattern_offsets_mode = pattern_offsets_mode;
+
+	return( 1 );
+
+on_error:
+	if( scan_tree->compiled_scan_tree != NULL )
+	{
+		libsigscan_compiled_scan_tree_free(
+		 &( scan_tree->compiled_scan_tree ),
+		 NULL );
+	}
+	if( scan_tree->root_node != NULL )
+	{
+		libsigscan_scan_tree_node_free(
+		 &( scan_tree->root_node ),
+		 NULL );
+	}
+	if( offsets_ignore_list != NULL )
+	{
+		libcdata_list_free(
+		 &offsets_ignore_list,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
+		 NULL );
+	}
+	if( signature_table != NULL )
+	{
+		libsigscan_signature_table_free(
+		 &signature_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Builds the tables of the scan tree
+ * The tables are determined from the signatures and do not depend on the scan tree nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_build_tables(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     int pattern_offsets_mode,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_build_tables";
+	int result            = 0;
+
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree->skip_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan tree - skip table value already set.",
+		 function );
+
+		return( -1 );
+	}
 	/* The skip table is determined to provide for the Boyer–Moore–Horspool skip values
 	 */
 	if( libsigscan_skip_table_initialize(
@@ -2262,28 +2740,1117 @@ int libsigscan_scan_tree_build(
 		}
 	}
 #endif
-	scan_tree->pattern_offsets_mode = pattern_offsets_mode;
+	/* The magic table is used to look up bounded signatures by the values
+	 * at their pattern offsets
+	 */
+	if( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+	{
+		if( libsigscan_magic_table_initialize(
+		     &( scan_tree->magic_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create magic table.",
+			 function );
 
-	return( 1 );
+			goto on_error;
+		}
+		result = libsigscan_magic_table_fill(
+		          scan_tree->magic_table,
+		          signatures_list,
+		          pattern_offsets_mode,
+		          error );
 
-on_error:
-	if( scan_tree->skip_table != NULL )
-	{
-		libsigscan_skip_table_free(
-		 &( scan_tree->skip_table ),
-		 NULL );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to fill magic table.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libsigscan_magic_table_free(
+			     &( scan_tree->magic_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free magic table.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		else if( libcnotify_verbose != 0 )
+		{
+			if( libsigscan_magic_table_printf(
+			     scan_tree->magic_table,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print magic table.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
 	}
-	if( offsets_ignore_list != NULL )
+	/* The packed matcher or the prefilter is used to skip data where no unbounded
+	 * signature can start
+	 */
+	if( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
 	{
-		libcdata_list_free(
-		 &offsets_ignore_list,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_offset_free,
+		if( libsigscan_packed_matcher_initialize(
+		     &( scan_tree->packed_matcher ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create packed matcher.",
+			 function );
+
+			goto on_error;
+		}
+		result = libsigscan_packed_matcher_fill(
+		          scan_tree->packed_matcher,
+		          signatures_list,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to fill packed matcher.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libsigscan_packed_matcher_free(
+			     &( scan_tree->packed_matcher ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free packed matcher.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		else if( libcnotify_verbose != 0 )
+		{
+			if( libsigscan_packed_matcher_printf(
+			     scan_tree->packed_matcher,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print packed matcher.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+	}
+	if( ( pattern_offsets_mode == LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+	 && ( scan_tree->packed_matcher == NULL ) )
+	{
+		if( libsigscan_prefilter_initialize(
+		     &( scan_tree->prefilter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create prefilter.",
+			 function );
+
+			goto on_error;
+		}
+		result = libsigscan_prefilter_fill(
+		          scan_tree->prefilter,
+		          signatures_list,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to fill prefilter.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libsigscan_prefilter_free(
+			     &( scan_tree->prefilter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free prefilter.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		else if( libcnotify_verbose != 0 )
+		{
+			if( libsigscan_prefilter_printf(
+			     scan_tree->prefilter,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print prefilter.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+	}
+	return( 1 );
+
+on_error:
+	if( scan_tree->magic_table != NULL )
+	{
+		libsigscan_magic_table_free(
+		 &( scan_tree->magic_table ),
 		 NULL );
 	}
-	if( signature_table != NULL )
+	if( scan_tree->packed_matcher != NULL )
 	{
-		libsigscan_signature_table_free(
-		 &signature_table,
+		libsigscan_packed_matcher_free(
+		 &( scan_tree->packed_matcher ),
+		 NULL );
+	}
+	if( scan_tree->prefilter != NULL )
+	{
+		libsigscan_prefilter_free(
+		 &( scan_tree->prefilter ),
+		 NULL );
+	}
+	if( scan_tree->skip_table != NULL )
+	{
+		libsigscan_skip_table_free(
+		 &( scan_tree->skip_table ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees the tables of the scan tree
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_free_tables(
+     libsigscan_scan_tree_t *scan_tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scan_tree_free_tables";
+	int result            = 1;
+
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree->magic_table != NULL )
+	{
+		if( libsigscan_magic_table_free(
+		     &( scan_tree->magic_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free magic table.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( scan_tree->packed_matcher != NULL )
+	{
+		if( libsigscan_packed_matcher_free(
+		     &( scan_tree->packed_matcher ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free packed matcher.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( scan_tree->prefilter != NULL )
+	{
+		if( libsigscan_prefilter_free(
+		     &( scan_tree->prefilter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free prefilter.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( scan_tree->skip_table != NULL )
+	{
+		if( libsigscan_skip_table_free(
+		     &( scan_tree->skip_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free skip table.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the pattern size partition index
+ * Returns the partition index
+ */
+int libsigscan_scan_tree_get_partition_index(
+     size_t pattern_size )
+{
+	if( pattern_size < 8 )
+	{
+		return( 0 );
+	}
+	else if( pattern_size < 16 )
+	{
+		return( 1 );
+	}
+	else if( pattern_size < 32 )
+	{
+		return( 2 );
+	}
+	return( 3 );
+}
+
+/* Retrieves the signatures lists of the pattern size partitions
+ * Only unbounded signatures are added to the partition signatures lists
+ * The signatures list of a partition is only created if the partition contains signatures
+ * the caller is responsible for freeing the created signatures lists
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scan_tree_get_partition_signatures_lists(
+     libcdata_list_t *signatures_list,
+     libcdata_list_t **partition_signatures_lists,
+     int *number_of_partitions,
+     int *number_of_signatures,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element = NULL;
+	libsigscan_signature_t *signature     = NULL;
+	static char *function                 = "libsigscan_scan_tree_get_partition_signatures_lists";
+	int partition_index                   = 0;
+
+	if( partition_signatures_lists == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition signatures lists.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_partitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of partitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_signatures == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of signatures.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_partitions = 0;
+	*number_of_signatures = 0;
+
+	if( libcdata_list_get_first_element(
+	     signatures_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first list element.",
+		 function );
+
+		return( -1 );
+	}
+	while( list_element != NULL )
+	{
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature.",
+			 function );
+
+			return( -1 );
+		}
+		if( signature == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing signature.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET )
+		{
+			partition_index = libsigscan_scan_tree_get_partition_index(
+			                   signature->pattern_size );
+
+			if( partition_signatures_lists[ partition_index ] == NULL )
+			{
+				if( libcdata_list_initialize(
+				     &( partition_signatures_lists[ partition_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create partition: %d signatures list.",
+					 function,
+					 partition_index );
+
+					return( -1 );
+				}
+				*number_of_partitions += 1;
+			}
+			*number_of_signatures += 1;
+
+			if( libcdata_list_append_value(
+			     partition_signatures_lists[ partition_index ],
+			     (intptr_t *) signature,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append signature to partition: %d signatures list.",
+				 function,
+				 partition_index );
+
+				return( -1 );
+			}
+		}
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next list element.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Builds the unbounded scan tree partitioned by pattern size
+ * If the unbounded signatures have pattern sizes of more than one partition
+ * and there are too many signatures for the packed matcher every partition
+ * gets its own scan tree, and with it its own skip table, so that the skip
+ * values of larger patterns are not limited by the smallest pattern
+ * Otherwise the scan tree is build as a single unbounded scan tree
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libsigscan_scan_tree_build_partitions(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error )
+{
+	libcdata_list_t *partition_signatures_lists[ LIBSIGSCAN_SCAN_TREE_NUMBER_OF_PARTITIONS ];
+
+	libsigscan_scan_tree_t *partition_scan_tree = NULL;
+	static char *function                       = "libsigscan_scan_tree_build_partitions";
+	int number_of_partitions                    = 0;
+	int number_of_signatures                    = 0;
+	int partition_index                         = 0;
+	int result                                  = 0;
+
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree->number_of_partition_scan_trees != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan tree - partition scan trees value already set.",
+		 function );
+
+		return( -1 );
+	}
+	for( partition_index = 0;
+	     partition_index < LIBSIGSCAN_SCAN_TREE_NUMBER_OF_PARTITIONS;
+	     partition_index++ )
+	{
+		partition_signatures_lists[ partition_index ] = NULL;
+	}
+	if( libsigscan_scan_tree_get_partition_signatures_lists(
+	     signatures_list,
+	     partition_signatures_lists,
+	     &number_of_partitions,
+	     &number_of_signatures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition signatures lists.",
+		 function );
+
+		goto on_error;
+	}
+	/* The packed matcher scans small sets of signatures independent of their pattern sizes
+	 * hence a single pass is faster than a pass per partition
+	 */
+	if( ( number_of_partitions <= 1 )
+	 || ( number_of_signatures <= LIBSIGSCAN_PACKED_MATCHER_MAXIMUM_NUMBER_OF_SIGNATURES ) )
+	{
+		for( partition_index = 0;
+		     partition_index < LIBSIGSCAN_SCAN_TREE_NUMBER_OF_PARTITIONS;
+		     partition_index++ )
+		{
+			if( partition_signatures_lists[ partition_index ] != NULL )
+			{
+				if( libcdata_list_free(
+				     &( partition_signatures_lists[ partition_index ] ),
+				     NULL,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free partition: %d signatures list.",
+					 function,
+					 partition_index );
+
+					goto on_error;
+				}
+			}
+		}
+		result = libsigscan_scan_tree_build(
+		          scan_tree,
+		          signatures_list,
+		          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build scan tree.",
+			 function );
+
+			return( -1 );
+		}
+		return( result );
+	}
+	/* The pattern range list of the scan tree spans the patterns of all the partitions
+	 */
+	if( libsigscan_scan_tree_fill_range_list(
+	     scan_tree,
+	     signatures_list,
+	     LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to fill range list.",
+		 function );
+
+		goto on_error;
+	}
+	for( partition_index = 0;
+	     partition_index < LIBSIGSCAN_SCAN_TREE_NUMBER_OF_PARTITIONS;
+	     partition_index++ )
+	{
+		if( partition_signatures_lists[ partition_index ] == NULL )
+		{
+			continue;
+		}
+		if( libsigscan_scan_tree_initialize(
+		     &partition_scan_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create partition: %d scan tree.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		partition_scan_tree->thread_pool = scan_tree->thread_pool;
+
+		if( libsigscan_scan_tree_build(
+		     partition_scan_tree,
+		     partition_signatures_lists[ partition_index ],
+		     LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build partition: %d scan tree.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		partition_scan_tree->thread_pool = NULL;
+
+		scan_tree->partition_scan_trees[ scan_tree->number_of_partition_scan_trees ] = partition_scan_tree;
+
+		scan_tree->number_of_partition_scan_trees += 1;
+
+		partition_scan_tree = NULL;
+
+		if( libcdata_list_free(
+		     &( partition_signatures_lists[ partition_index ] ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free partition: %d signatures list.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+	}
+	scan_tree->pattern_offsets_mode = LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND;
+
+	return( 1 );
+
+on_error:
+	if( partition_scan_tree != NULL )
+	{
+		libsigscan_scan_tree_free(
+		 &partition_scan_tree,
+		 NULL );
+	}
+	while( scan_tree->number_of_partition_scan_trees > 0 )
+	{
+		scan_tree->number_of_partition_scan_trees -= 1;
+
+		libsigscan_scan_tree_free(
+		 &( scan_tree->partition_scan_trees[ scan_tree->number_of_partition_scan_trees ] ),
+		 NULL );
+	}
+	for( partition_index = 0;
+	     partition_index < LIBSIGSCAN_SCAN_TREE_NUMBER_OF_PARTITIONS;
+	     partition_index++ )
+	{
+		if( partition_signatures_lists[ partition_index ] != NULL )
+		{
+			libcdata_list_free(
+			 &( partition_signatures_lists[ partition_index ] ),
+			 NULL,
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Inserts an unbounded signature into the scan tree
+ * The signature is inserted into the compiled scan tree, or into the partition scan tree
+ * of its pattern size, after which the tables are rebuilt from the signatures list
+ * which must contain the signature
+ * The scan tree needs to be rebuilt if it is an automaton, if it does not contain
+ * a compiled scan tree to insert into or if the signature cannot be inserted. The scan tree
+ * also needs to be rebuilt once the inserted signatures exceed the maximum of the minimum
+ * number of inserted signatures and the number of signatures divided by the divisor,
+ * since every inserted signature adds nodes that a built scan tree does not need
+ * Returns 1 if successful, 0 if the scan tree needs to be rebuilt or -1 on error
+ */
+int libsigscan_scan_tree_insert_signature(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     libsigscan_signature_t *signature,
+     libcerror_error_t **error )
+{
+	libcdata_list_t *partition_signatures_lists[ LIBSIGSCAN_SCAN_TREE_NUMBER_OF_PARTITIONS ];
+
+	libsigscan_scan_tree_t *partition_scan_tree = NULL;
+	static char *function                       = "libsigscan_scan_tree_insert_signature";
+	int maximum_number_of_inserted_signatures   = 0;
+	int number_of_partitions                    = 0;
+	int number_of_signatures                    = 0;
+	int partition_index                         = 0;
+	int result                                  = 0;
+	int signature_partition_index               = 0;
+
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( signatures_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signatures list.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) != LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid signature - unsupported signature flags.",
+		 function );
+
+		return( -1 );
+	}
+	/* The node pattern offsets of bounded scan trees depend on the pattern offsets
+	 * of all the signatures
+	 */
+	if( ( scan_tree->pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND )
+	 || ( scan_tree->automaton != NULL ) )
+	{
+		return( 0 );
+	}
+	if( scan_tree->number_of_partition_scan_trees > 0 )
+	{
+		signature_partition_index = libsigscan_scan_tree_get_partition_index(
+		                             signature->pattern_size );
+
+		for( partition_index = 0;
+		     partition_index < scan_tree->number_of_partition_scan_trees;
+		     partition_index++ )
+		{
+			partition_scan_tree = scan_tree->partition_scan_trees[ partition_index ];
+
+			if( ( partition_scan_tree != NULL )
+			 && ( partition_scan_tree->compiled_scan_tree != NULL )
+			 && ( partition_scan_tree->compiled_scan_tree->number_of_signatures > 0 ) )
+			{
+				if( libsigscan_scan_tree_get_partition_index(
+				     partition_scan_tree->compiled_scan_tree->signatures[ 0 ]->pattern_size ) == signature_partition_index )
+				{
+					break;
+				}
+			}
+			partition_scan_tree = NULL;
+		}
+		/* A signature of a partition without a scan tree changes the partitions
+		 */
+		if( partition_scan_tree == NULL )
+		{
+			return( 0 );
+		}
+		for( partition_index = 0;
+		     partition_index < LIBSIGSCAN_SCAN_TREE_NUMBER_OF_PARTITIONS;
+		     partition_index++ )
+		{
+			partition_signatures_lists[ partition_index ] = NULL;
+		}
+		if( libsigscan_scan_tree_get_partition_signatures_lists(
+		     signatures_list,
+		     partition_signatures_lists,
+		     &number_of_partitions,
+		     &number_of_signatures,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition signatures lists.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			result = libsigscan_scan_tree_insert_signature(
+			          partition_scan_tree,
+			          partition_signatures_lists[ signature_partition_index ],
+			          signature,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to insert signature into partition: %d scan tree.",
+				 function,
+				 signature_partition_index );
+			}
+		}
+		for( partition_index = 0;
+		     partition_index < LIBSIGSCAN_SCAN_TREE_NUMBER_OF_PARTITIONS;
+		     partition_index++ )
+		{
+			if( partition_signatures_lists[ partition_index ] != NULL )
+			{
+				if( libcdata_list_free(
+				     &( partition_signatures_lists[ partition_index ] ),
+				     NULL,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free partition: %d signatures list.",
+					 function,
+					 partition_index );
+
+					result = -1;
+				}
+			}
+		}
+		if( result != 1 )
+		{
+			return( result );
+		}
+	}
+	else
+	{
+		if( ( scan_tree->compiled_scan_tree == NULL )
+		 || ( scan_tree->skip_table == NULL ) )
+		{
+			return( 0 );
+		}
+		/* The skip table was filled with the signatures the scan tree was built with
+		 * and the signatures inserted since
+		 */
+		maximum_number_of_inserted_signatures = ( scan_tree->skip_table->number_of_signatures - scan_tree->number_of_inserted_signatures )
+		                                      / LIBSIGSCAN_SCAN_TREE_INSERTED_SIGNATURES_DIVISOR;
+
+		if( maximum_number_of_inserted_signatures < LIBSIGSCAN_SCAN_TREE_MINIMUM_NUMBER_OF_INSERTED_SIGNATURES )
+		{
+			maximum_number_of_inserted_signatures = LIBSIGSCAN_SCAN_TREE_MINIMUM_NUMBER_OF_INSERTED_SIGNATURES;
+		}
+		else if( maximum_number_of_inserted_signatures > LIBSIGSCAN_SCAN_TREE_MAXIMUM_NUMBER_OF_INSERTED_SIGNATURES )
+		{
+			maximum_number_of_inserted_signatures = LIBSIGSCAN_SCAN_TREE_MAXIMUM_NUMBER_OF_INSERTED_SIGNATURES;
+		}
+		if( scan_tree->number_of_inserted_signatures >= maximum_number_of_inserted_signatures )
+		{
+			return( 0 );
+		}
+		result = libsigscan_compiled_scan_tree_insert_signature(
+		          scan_tree->compiled_scan_tree,
+		          signature,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to insert signature into compiled scan tree.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		/* The tables are determined from the signatures and are cheap to rebuild
+		 * compared to the scan tree
+		 */
+		if( libsigscan_scan_tree_free_tables(
+		     scan_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free tables.",
+			 function );
+
+			return( -1 );
+		}
+		if( libsigscan_scan_tree_build_tables(
+		     scan_tree,
+		     signatures_list,
+		     LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build tables.",
+			 function );
+
+			return( -1 );
+		}
+		scan_tree->number_of_inserted_signatures += 1;
+	}
+	if( libcdata_range_list_insert_range(
+	     scan_tree->pattern_range_list,
+	     signature->pattern_offset,
+	     (size64_t) signature->pattern_size,
+	     NULL,
+	     NULL,
+	     NULL,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert pattern range.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Builds the scan tree as an Aho-Corasick automaton
+ * Only unbounded signatures are added to the automaton
+ * Returns 1 if successful, 0 if no signatures were added or -1 on error
+ */
+int libsigscan_scan_tree_build_automaton(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error )
+{
+	static char *function        = "libsigscan_scan_tree_build_automaton";
+	int number_of_pattern_ranges = 0;
+	int result                   = 0;
+
+	if( scan_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_tree->automaton != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan tree - automaton value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_tree_fill_range_list(
+	     scan_tree,
+	     signatures_list,
+	     LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to fill range list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_range_list_get_number_of_elements(
+	     scan_tree->pattern_range_list,
+	     &number_of_pattern_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of pattern ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_pattern_ranges == 0 )
+	{
+		return( 0 );
+	}
+	if( libsigscan_automaton_initialize(
+	     &( scan_tree->automaton ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create automaton.",
+		 function );
+
+		goto on_error;
+	}
+	result = libsigscan_automaton_build(
+	          scan_tree->automaton,
+	          signatures_list,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build automaton.",
+		 function );
+
+		goto on_error;
+	}
+	scan_tree->pattern_offsets_mode = LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND;
+
+	return( 1 );
+
+on_error:
+	if( scan_tree->automaton != NULL )
+	{
+		libsigscan_automaton_free(
+		 &( scan_tree->automaton ),
 		 NULL );
 	}
 	return( -1 );
@@ -25,12 +25,19 @@
 #include <common.h>
 #include <types.h>
 
+#include "libsigscan_automaton.h"
+#include "libsigscan_compiled_scan_tree.h"
+#include "libsigscan_definitions.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
+#include "libsigscan_magic_table.h"
+#include "libsigscan_packed_matcher.h"
 #include "libsigscan_pattern_weights.h"
+#include "libsigscan_prefilter.h"
 #include "libsigscan_scan_tree_node.h"
 #include "libsigscan_signature_table.h"
 #include "libsigscan_skip_table.h"
+#include "libsigscan_thread_pool.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -45,16 +52,100 @@ struct libsigscan_scan_tree
 	int pattern_offsets_mode;
 
 	/* The root (scan tree) node
+	 * The root node is only used while building the scan tree
 	 */
 	libsigscan_scan_tree_node_t *root_node;
 
+	/* The compiled scan tree
+	 */
+	libsigscan_compiled_scan_tree_t *compiled_scan_tree;
+
+	/* The (Aho-Corasick) automaton
+	 * The automaton is used instead of the compiled scan tree for unbounded signatures
+	 * if the Aho-Corasick scan engine was selected
+	 */
+	libsigscan_automaton_t *automaton;
+
 	/* The skip table
 	 */
 	libsigscan_skip_table_t *skip_table;
 
+	/* The (rare byte) prefilter
+	 * The prefilter is only used for unbounded signatures
+	 */
+	libsigscan_prefilter_t *prefilter;
+
+	/* The packed (multi-literal) matcher
+	 * The packed matcher is used instead of the prefilter for small sets of unbounded signatures
+	 */
+	libsigscan_packed_matcher_t *packed_matcher;
+
+	/* The magic table
+	 * The magic table is used instead of the compiled scan tree for bounded signatures
+	 * if the signatures can be looked up by their pattern offset and size
+	 */
+	libsigscan_magic_table_t *magic_table;
+
+	/* The pattern size partition scan trees
+	 * The partition scan trees are only used for unbounded signatures
+	 * if the signatures have pattern sizes of more than one partition
+	 */
+	libsigscan_scan_tree_t *partition_scan_trees[ LIBSIGSCAN_SCAN_TREE_NUMBER_OF_PARTITIONS ];
+
+	/* The number of partition scan trees
+	 */
+	int number_of_partition_scan_trees;
+
+	/* The number of signatures inserted after the scan tree was built
+	 */
+	int number_of_inserted_signatures;
+
 	/* The pattern range list
 	 */
 	libcdata_range_list_t *pattern_range_list;
+
+	/* The thread pool
+	 * The thread pool is only used while building the scan tree and is not managed by the scan tree
+	 */
+	libsigscan_thread_pool_t *thread_pool;
+};
+
+typedef struct libsigscan_scan_tree_sub_node_build libsigscan_scan_tree_sub_node_build_t;
+
+struct libsigscan_scan_tree_sub_node_build
+{
+	/* The scan tree
+	 */
+	libsigscan_scan_tree_t *scan_tree;
+
+	/* The signatures list of the signature group
+	 * Contains NULL for the sub node of the default value
+	 */
+	libcdata_list_t *signatures_list;
+
+	/* The remaining signatures list
+	 */
+	libcdata_list_t *remaining_signatures_list;
+
+	/* The offsets ignore list
+	 */
+	libcdata_list_t *offsets_ignore_list;
+
+	/* The pattern offsets mode
+	 */
+	int pattern_offsets_mode;
+
+	/* The pattern offsets range size
+	 */
+	uint64_t pattern_offsets_range_size;
+
+	/* The recursion depth
+	 */
+	int recursion_depth;
+
+	/* The (sub) scan tree node
+	 */
+	libsigscan_scan_tree_node_t *scan_tree_node;
 };
 
 int libsigscan_scan_tree_initialize(
@@ -111,12 +202,52 @@ int libsigscan_scan_tree_build_node(
      int recursion_depth,
      libcerror_error_t **error );
 
+int libsigscan_scan_tree_build_sub_node(
+     libsigscan_scan_tree_sub_node_build_t *sub_node_build,
+     libcerror_error_t **error );
+
 int libsigscan_scan_tree_build(
      libsigscan_scan_tree_t *scan_tree,
      libcdata_list_t *signatures_list,
      int pattern_offsets_mode,
      libcerror_error_t **error );
 
+int libsigscan_scan_tree_build_tables(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     int pattern_offsets_mode,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_free_tables(
+     libsigscan_scan_tree_t *scan_tree,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_get_partition_index(
+     size_t pattern_size );
+
+int libsigscan_scan_tree_get_partition_signatures_lists(
+     libcdata_list_t *signatures_list,
+     libcdata_list_t **partition_signatures_lists,
+     int *number_of_partitions,
+     int *number_of_signatures,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_build_partitions(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_insert_signature(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     libsigscan_signature_t *signature,
+     libcerror_error_t **error );
+
+int libsigscan_scan_tree_build_automaton(
+     libsigscan_scan_tree_t *scan_tree,
+     libcdata_list_t *signatures_list,
+     libcerror_error_t **error );
+
 int libsigscan_scan_tree_fill_pattern_weights(
      libsigscan_scan_tree_t *scan_tree,
      libsigscan_signature_table_t *signature_table,
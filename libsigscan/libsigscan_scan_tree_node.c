@@ -325,331 +325,6 @@ int libsigscan_scan_tree_node_get_scan_object(
 	return( 0 );
 }
 
-/* Scans the buffer for a scan object that matches
- * Returns 1 if successful, 0 if not or -1 on error
- */
-int libsigscan_scan_tree_node_scan_buffer(
-     libsigscan_scan_tree_node_t *scan_tree_node,
-     int pattern_offsets_mode,
-     off64_t data_offset,
-     size64_t data_size,
-     const uint8_t *buffer,
-     size_t buffer_size,
-     size_t buffer_offset,
-     libsigscan_scan_object_t **scan_object,
-     libcerror_error_t **error )
-{
-	libsigscan_scan_object_t *safe_scan_object = NULL;
-	libsigscan_signature_t *signature          = NULL;
-	static char *function                      = "libsigscan_scan_tree_node_scan_buffer";
-	off64_t scan_offset                        = 0;
-	uint8_t byte_value                         = 0;
-	uint8_t scan_object_type                   = 0;
-	int result                                 = 0;
-
-	if( scan_tree_node == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid scan tree node.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START )
-	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END )
-	 && ( pattern_offsets_mode != LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported pattern offsets mode.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( data_offset < 0 )
-	 || ( (size64_t) data_offset >= data_size ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid data offset value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	if( buffer == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
-		 function );
-
-		return( -1 );
-	}
-	if( buffer_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid buffer size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( scan_object == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid scan object.",
-		 function );
-
-		return( -1 );
-	}
-	do
-	{
-		if( buffer_offset >= buffer_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid buffer offset value out of bounds.",
-			 function );
-
-			return( -1 );
-		}
-		scan_offset = (off64_t) ( buffer_offset + scan_tree_node->pattern_offset );
-
-		if( (size64_t) scan_offset >= data_size )
-		{
-			/* If the pattern offset exceeds the data size
-			 * continue with the default scan object if available.
-			 */
-			safe_scan_object = scan_tree_node->default_scan_object;
-			result           = ( safe_scan_object != NULL );
-		}
-		else if( scan_offset >= (off64_t) buffer_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid scan offset value out of bounds.",
-			 function );
-
-			return( -1 );
-		}
-		else
-		{
-			byte_value = buffer[ scan_offset ];
-
-			result = libsigscan_scan_tree_node_get_scan_object(
-			          scan_tree_node,
-			          byte_value,
-			          &safe_scan_object,
-			          error );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( result == 1 )
-				{
-					libcnotify_printf(
-					 "%s: scanning for",
-					 function );
-
-					if( scan_tree_node->scan_objects_table[ byte_value ] != NULL )
-					{
-						libcnotify_printf(
-						 " scan object: byte value: 0x%02" PRIx8 "",
-						 byte_value );
-					}
-					else if( scan_tree_node->default_scan_object != NULL )
-					{
-						libcnotify_printf(
-						 " scan object: default" );
-					}
-					else
-					{
-						libcnotify_printf(
-						 " scan object: N/A" );
-					}
-					libcnotify_printf(
-					 " at offset: %" PRIi64 ".\n",
-					 scan_offset );
-				}
-			}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-		}
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve scan object.",
-			 function );
-
-			return( -1 );
-		}
-		else if( result != 0 )
-		{
-			if( libsigscan_scan_object_get_type(
-			     safe_scan_object,
-			     &scan_object_type,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve scan object type.",
-				 function );
-
-				return( -1 );
-			}
-			if( scan_object_type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE )
-			{
-				if( libsigscan_scan_object_get_value(
-				     safe_scan_object,
-				     (intptr_t **) &scan_tree_node,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve scan object value.",
-					 function );
-
-					return( -1 );
-				}
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: scan object: scan tree node: 0x%08" PRIjx "\n",
-					 function,
-					 (intptr_t *) scan_tree_node );
-				}
-#endif
-			}
-			else if( scan_object_type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SIGNATURE )
-			{
-				if( libsigscan_scan_object_get_value(
-				     safe_scan_object,
-				     (intptr_t **) &signature,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve scan object value.",
-					 function );
-
-					return( -1 );
-				}
-				result = libsigscan_signature_scan_buffer(
-				          signature,
-				          pattern_offsets_mode,
-				          data_offset,
-				          data_size,
-				          buffer,
-				          buffer_size,
-				          buffer_offset,
-				          error );
-
-				if( result == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to scan buffer with signature.",
-					 function );
-
-					return( -1 );
-				}
-				else if( result != 0 )
-				{
-					break;
-				}
-				if( ( scan_tree_node->default_scan_object != NULL )
-				 && ( scan_tree_node->default_scan_object != safe_scan_object ) )
-				{
-					if( libsigscan_scan_object_get_type(
-					     scan_tree_node->default_scan_object,
-					     &scan_object_type,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve default scan object type.",
-						 function );
-
-						return( -1 );
-					}
-					if( scan_object_type == LIBSIGSCAN_SCAN_OBJECT_TYPE_SCAN_TREE_NODE )
-					{
-						if( libsigscan_scan_object_get_value(
-						     scan_tree_node->default_scan_object,
-						     (intptr_t **) &scan_tree_node,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-							 "%s: unable to retrieve default scan object value.",
-							 function );
-
-							return( -1 );
-						}
-#if defined( HAVE_DEBUG_OUTPUT )
-						if( libcnotify_verbose != 0 )
-						{
-							libcnotify_printf(
-							 "%s: default scan object: scan tree node: 0x%08" PRIjx "\n",
-							 function,
-							 (intptr_t *) scan_tree_node );
-						}
-#endif
-						safe_scan_object = scan_tree_node->default_scan_object;
-						result           = 1;
-					}
-				}
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			else if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: scan object: other.\n",
-				 function );
-			}
-#endif
-		}
-	}
-	while( result != 0 );
-
-	*scan_object = safe_scan_object;
-
-	return( result );
-}
-
 #if defined( HAVE_DEBUG_OUTPUT )
 
 /* Prints the scan tree node
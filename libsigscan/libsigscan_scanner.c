@@ -25,17 +25,47 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libsigscan_compiled_file.h"
 #include "libsigscan_definitions.h"
+#include "libsigscan_file_io_handle.h"
 #include "libsigscan_libbfio.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_libcnotify.h"
+#include "libsigscan_read_ahead.h"
 #include "libsigscan_scanner.h"
 #include "libsigscan_scan_state.h"
 #include "libsigscan_scan_tree.h"
 #include "libsigscan_signature.h"
+#include "libsigscan_sparse_file.h"
+#include "libsigscan_thread_pool.h"
 #include "libsigscan_types.h"
 
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_OPEN ) && defined( HAVE_FSTAT ) && defined( HAVE_CLOSE )
+#define LIBSIGSCAN_SCANNER_HAVE_MMAP
+
+#if defined( HAVE_MADVISE ) && defined( MADV_SEQUENTIAL ) && defined( MADV_DONTNEED )
+#define LIBSIGSCAN_SCANNER_HAVE_MADVISE
+#endif
+
+#endif
+
 /* Creates a scanner
  * Make sure the value scanner is referencing, is set to NULL
  *
@@ -117,7 +147,22 @@ int libsigscan_scanner_initialize(
 
 		goto on_error;
 	}
-	internal_scanner->buffer_size = LIBSIGSCAN_DEFAULT_SCAN_BUFFER_SIZE;
+	if( libcdata_list_initialize(
+	     &( internal_scanner->range_signatures_list ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create offset range signatures list.",
+		 function );
+
+		goto on_error;
+	}
+	internal_scanner->buffer_size           = LIBSIGSCAN_DEFAULT_SCAN_BUFFER_SIZE;
+	internal_scanner->unbounded_scan_engine = LIBSIGSCAN_SCAN_ENGINE_SCAN_TREE;
+	internal_scanner->io_strategy           = LIBSIGSCAN_IO_STRATEGY_BFIO;
 
 	*scanner = (libsigscan_scanner_t *) internal_scanner;
 
@@ -126,6 +171,13 @@ int libsigscan_scanner_initialize(
 on_error:
 	if( internal_scanner != NULL )
 	{
+		if( internal_scanner->range_signatures_list != NULL )
+		{
+			libcdata_list_free(
+			 &( internal_scanner->range_signatures_list ),
+			 NULL,
+			 NULL );
+		}
 		if( internal_scanner->signatures_list != NULL )
 		{
 			libcdata_list_free(
@@ -214,6 +266,40 @@ int libsigscan_scanner_free(
 				result = -1;
 			}
 		}
+		if( internal_scanner->range_scan_tree != NULL )
+		{
+			if( libsigscan_scan_tree_free(
+			     &( internal_scanner->range_scan_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free offset range scan tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The compiled file is freed after the scan trees since the scan trees can reference its data
+		 */
+		if( internal_scanner->compiled_file != NULL )
+		{
+			if( libsigscan_compiled_file_free(
+			     &( internal_scanner->compiled_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free compiled file.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libcdata_list_free(
 		     &( internal_scanner->signatures_list ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
@@ -228,6 +314,20 @@ int libsigscan_scanner_free(
 
 			result = -1;
 		}
+		if( libcdata_list_free(
+		     &( internal_scanner->range_signatures_list ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free offset range signatures list.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 internal_scanner );
 	}
@@ -235,6 +335,7 @@ int libsigscan_scanner_free(
 }
 
 /* Signals the scanner to abort its current activity
+ * The remaining files of libsigscan_scanner_scan_files are not scanned after abort was signalled
  * Returns 1 if successful or -1 on error
  */
 int libsigscan_scanner_signal_abort(
@@ -257,12 +358,116 @@ int libsigscan_scanner_signal_abort(
 	}
 	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
 
-	internal_scanner->abort = 1;
+	if( libsigscan_internal_scanner_set_abort(
+	     internal_scanner,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set abort.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the value to indicate if abort was signalled
+ * The value is set atomically without a lock, since abort can be signalled
+ * from a signal handler while a thread is reading the value
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_set_abort(
+     libsigscan_internal_scanner_t *internal_scanner,
+     int abort,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scanner_set_abort";
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	InterlockedExchange(
+	 (LONG volatile *) &( internal_scanner->abort ),
+	 (LONG) abort );
+
+#elif defined( __GNUC__ )
+	__atomic_store_n(
+	 &( internal_scanner->abort ),
+	 abort,
+	 __ATOMIC_RELEASE );
+
+#else
+	internal_scanner->abort = abort;
+
+#endif
+	return( 1 );
+}
+
+/* Retrieves the value to indicate if abort was signalled
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_get_abort(
+     libsigscan_internal_scanner_t *internal_scanner,
+     int *abort,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scanner_get_abort";
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( abort == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid abort.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	*abort = (int) InterlockedCompareExchange(
+	                (LONG volatile *) &( internal_scanner->abort ),
+	                0,
+	                0 );
+
+#elif defined( __GNUC__ )
+	*abort = __atomic_load_n(
+	          &( internal_scanner->abort ),
+	          __ATOMIC_ACQUIRE );
 
+#else
+	*abort = internal_scanner->abort;
+
+#endif
 	return( 1 );
 }
 
 /* Sets the scan buffer size
+ * Fails if the scanner is compiled, since a compiled scanner is read-only
  * Returns 1 if successful or -1 on error
  */
 int libsigscan_scanner_set_scan_buffer_size(
@@ -286,6 +491,17 @@ int libsigscan_scanner_set_scan_buffer_size(
 	}
 	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
 
+	if( internal_scanner->is_compiled != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - scanner is compiled and read-only.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( scan_buffer_size == 0 )
 	 || ( scan_buffer_size > (size_t) SSIZE_MAX ) )
 	{
@@ -303,24 +519,17 @@ int libsigscan_scanner_set_scan_buffer_size(
 	return( 1 );
 }
 
-/* Adds a signature
- * Returns 1 if successful, 0 if signature already exists or -1 on error
+/* Sets the scan engine used for unbounded signatures
+ * Fails if the scanner is compiled, since a compiled scanner is read-only
+ * Returns 1 if successful or -1 on error
  */
-int libsigscan_scanner_add_signature(
+int libsigscan_scanner_set_unbounded_scan_engine(
      libsigscan_scanner_t *scanner,
-     const char *identifier,
-     size_t identifier_length,
-     off64_t pattern_offset,
-     const uint8_t *pattern,
-     size_t pattern_size,
-     uint32_t signature_flags,
+     int scan_engine,
      libcerror_error_t **error )
 {
 	libsigscan_internal_scanner_t *internal_scanner = NULL;
-	libsigscan_signature_t *existing_signature      = NULL;
-	libsigscan_signature_t *signature               = NULL;
-	static char *function                           = "libsigscan_scanner_add_signature";
-	int result                                      = 0;
+	static char *function                           = "libsigscan_scanner_set_unbounded_scan_engine";
 
 	if( scanner == NULL )
 	{
@@ -335,159 +544,169 @@ int libsigscan_scanner_add_signature(
 	}
 	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
 
-	if( internal_scanner->header_scan_tree != NULL )
+	if( internal_scanner->is_compiled != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid scanner - header scan tree already set.",
+		 "%s: invalid scanner - scanner is compiled and read-only.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_scanner->footer_scan_tree != NULL )
+	if( internal_scanner->scan_tree != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid scanner - footer scan tree already set.",
+		 "%s: invalid scanner - scan tree already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_scanner->scan_tree != NULL )
+	if( ( scan_engine != LIBSIGSCAN_SCAN_ENGINE_SCAN_TREE )
+	 && ( scan_engine != LIBSIGSCAN_SCAN_ENGINE_AHO_CORASICK ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid scanner - scan tree already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported scan engine.",
 		 function );
 
 		return( -1 );
 	}
-	/* For now unbound signatures should not be be smaller than 4 bytes
-	 * otherwise the skip value has little to no effect
-	 */
-	if( ( ( signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET )
-	 && ( pattern_size < 4 ) )
+	internal_scanner->unbounded_scan_engine = scan_engine;
+
+	return( 1 );
+}
+
+/* Sets the number of threads used to build the scan trees
+ * A number of threads of 0 represents the number of online processors
+ * The scan trees are built by a single thread if multi-threading is not supported
+ * Fails if the scanner is compiled, since a compiled scanner is read-only
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_set_number_of_threads(
+     libsigscan_scanner_t *scanner,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	static char *function                           = "libsigscan_scanner_set_number_of_threads";
+
+	if( scanner == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid pattern value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
 		 function );
 
 		return( -1 );
 	}
-	if( libsigscan_signature_initialize(
-	     &signature,
-	     error ) != 1 )
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( internal_scanner->is_compiled != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create signature.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - scanner is compiled and read-only.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libsigscan_signature_set(
-	     signature,
-	     identifier,
-	     identifier_length,
-	     pattern_offset,
-	     pattern,
-	     pattern_size,
-	     signature_flags,
-	     error ) != 1 )
+	if( ( number_of_threads < 0 )
+	 || ( number_of_threads > LIBSIGSCAN_THREAD_POOL_MAXIMUM_NUMBER_OF_THREADS ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set signature values.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = libcdata_list_insert_value_with_existing(
-	          internal_scanner->signatures_list,
-	          (intptr_t *) signature,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libsigscan_signature_compare_by_pattern,
-	          LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
-	          (intptr_t **) &existing_signature,
-	          error );
+	internal_scanner->number_of_threads = number_of_threads;
 
-	if( result == -1 )
+	return( 1 );
+}
+
+/* Sets the scan chunk size
+ * A file of which the unbounded range is larger than the scan chunk size is scanned
+ * in chunks of (a multiple of the scan buffer size of) this size on multiple threads
+ * A scan chunk size of 0 represents that a file is not scanned in chunks
+ * Fails if the scanner is compiled, since a compiled scanner is read-only
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_set_scan_chunk_size(
+     libsigscan_scanner_t *scanner,
+     size64_t scan_chunk_size,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	static char *function                           = "libsigscan_scanner_set_scan_chunk_size";
+
+	if( scanner == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to insert signature.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( result == 0 )
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( internal_scanner->is_compiled != 0 )
 	{
-		if( libsigscan_signature_free(
-		     &signature,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free signature.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - scanner is compiled and read-only.",
+		 function );
 
-			goto on_error;
-		}
-		if( libsigscan_signature_append_identifier(
-		     existing_signature,
-		     identifier,
-		     identifier_length,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append identifier to existing signature.",
-			 function );
-
-			goto on_error;
-		}
+		return( -1 );
 	}
-	return( 1 );
-
-on_error:
-	if( signature != NULL )
+	if( scan_chunk_size > (size64_t) INT64_MAX )
 	{
-		libsigscan_signature_free(
-		 &signature,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	internal_scanner->scan_chunk_size = scan_chunk_size;
+
+	return( 1 );
 }
 
-/* Starts the scan
+/* Sets the number of read-ahead buffers
+ * A file is read into a ring of this number of buffers by a reader thread
+ * while the buffers that were read before are scanned
+ * A number of read-ahead buffers of 0 represents that the data is not read ahead
+ * Fails if the scanner is compiled, since a compiled scanner is read-only
  * Returns 1 if successful or -1 on error
  */
-int libsigscan_scanner_scan_start(
+int libsigscan_scanner_set_number_of_read_ahead_buffers(
      libsigscan_scanner_t *scanner,
-     libsigscan_scan_state_t *scan_state,
+     int number_of_read_ahead_buffers,
      libcerror_error_t **error )
 {
 	libsigscan_internal_scanner_t *internal_scanner = NULL;
-	static char *function                           = "libsigscan_scanner_scan_start";
-	int result                                      = 0;
+	static char *function                           = "libsigscan_scanner_set_number_of_read_ahead_buffers";
 
 	if( scanner == NULL )
 	{
@@ -502,155 +721,50 @@ int libsigscan_scanner_scan_start(
 	}
 	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
 
-	if( internal_scanner->header_scan_tree == NULL )
-	{
-		if( libsigscan_scan_tree_initialize(
-		     &( internal_scanner->header_scan_tree ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create header scan tree.",
-			 function );
-
-			goto on_error;
-		}
-		result = libsigscan_scan_tree_build(
-		          internal_scanner->header_scan_tree,
-		          internal_scanner->signatures_list,
-		          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to build header scan tree.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	if( internal_scanner->footer_scan_tree == NULL )
-	{
-		if( libsigscan_scan_tree_initialize(
-		     &( internal_scanner->footer_scan_tree ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create footer scan tree.",
-			 function );
-
-			goto on_error;
-		}
-		result = libsigscan_scan_tree_build(
-		          internal_scanner->footer_scan_tree,
-		          internal_scanner->signatures_list,
-		          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to build footer scan tree.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	if( internal_scanner->scan_tree == NULL )
+	if( internal_scanner->is_compiled != 0 )
 	{
-		if( libsigscan_scan_tree_initialize(
-		     &( internal_scanner->scan_tree ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create scan tree.",
-			 function );
-
-			goto on_error;
-		}
-		result = libsigscan_scan_tree_build(
-		          internal_scanner->scan_tree,
-		          internal_scanner->signatures_list,
-		          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to build scan tree.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - scanner is compiled and read-only.",
+		 function );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
-	if( libsigscan_scan_state_start(
-	     scan_state,
-	     internal_scanner->header_scan_tree,
-	     internal_scanner->footer_scan_tree,
-	     internal_scanner->scan_tree,
-	     internal_scanner->buffer_size,
-	     error ) != 1 )
+	if( ( number_of_read_ahead_buffers < 0 )
+	 || ( number_of_read_ahead_buffers > LIBSIGSCAN_READ_AHEAD_MAXIMUM_NUMBER_OF_BUFFERS ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set scan state.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of read-ahead buffers value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
+	internal_scanner->number_of_read_ahead_buffers = number_of_read_ahead_buffers;
 
-on_error:
-	if( internal_scanner->scan_tree != NULL )
-	{
-		libsigscan_scan_tree_free(
-		 &( internal_scanner->scan_tree ),
-		 NULL );
-	}
-	if( internal_scanner->footer_scan_tree != NULL )
-	{
-		libsigscan_scan_tree_free(
-		 &( internal_scanner->footer_scan_tree ),
-		 NULL );
-	}
-	if( internal_scanner->header_scan_tree != NULL )
-	{
-		libsigscan_scan_tree_free(
-		 &( internal_scanner->header_scan_tree ),
-		 NULL );
-	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Stops the scan
+/* Sets the I/O strategy used to read the data of a file that is scanned by name
+ * The libbfio I/O strategy reads the file using a libbfio file, which is the default,
+ * the mapped I/O strategy maps the file into memory if supported by the system,
+ * the buffered I/O strategy reads the file in large blocks and releases the data
+ * that was read from the page cache and the direct I/O strategy reads the file
+ * in large blocks bypassing the page cache if supported by the file system
+ * Fails if the scanner is compiled, since a compiled scanner is read-only
  * Returns 1 if successful or -1 on error
  */
-int libsigscan_scanner_scan_stop(
+int libsigscan_scanner_set_io_strategy(
      libsigscan_scanner_t *scanner,
-     libsigscan_scan_state_t *scan_state,
+     int io_strategy,
      libcerror_error_t **error )
 {
-	static char *function = "libsigscan_scanner_scan_stop";
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	static char *function                           = "libsigscan_scanner_set_io_strategy";
 
 	if( scanner == NULL )
 	{
@@ -663,76 +777,61 @@ int libsigscan_scanner_scan_stop(
 
 		return( -1 );
 	}
-	if( libsigscan_scan_state_stop(
-	     scan_state,
-	     error ) != 1 )
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( internal_scanner->is_compiled != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set scan state.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - scanner is compiled and read-only.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Scans a buffer
- * Returns 1 if successful or -1 on error
- */
-int libsigscan_scanner_scan_buffer(
-     libsigscan_scanner_t *scanner,
-     libsigscan_scan_state_t *scan_state,
-     const uint8_t *buffer,
-     size_t buffer_size,
-     libcerror_error_t **error )
-{
-	static char *function = "libsigscan_scanner_scan_buffer";
-
-	if( scanner == NULL )
+	if( ( io_strategy != LIBSIGSCAN_IO_STRATEGY_BFIO )
+	 && ( io_strategy != LIBSIGSCAN_IO_STRATEGY_MAPPED )
+	 && ( io_strategy != LIBSIGSCAN_IO_STRATEGY_BUFFERED )
+	 && ( io_strategy != LIBSIGSCAN_IO_STRATEGY_DIRECT ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid scanner.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported I/O strategy.",
 		 function );
 
 		return( -1 );
 	}
-	if( libsigscan_scan_state_scan_buffer(
-	     scan_state,
-	     0,
-	     buffer,
-	     buffer_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 "%s: unable to scan buffer.",
-		 function );
+	internal_scanner->io_strategy = io_strategy;
 
-		return( -1 );
-	}
 	return( 1 );
 }
 
-/* Scans a file
- * Returns 1 if successful or -1 on error
+/* Adds a signature
+ * If the scan trees were already built an unbounded signature is inserted into the unbounded
+ * scan tree, which is rebuilt on the next scan start once too many signatures were inserted
+ * A header or footer signature causes the header or footer scan tree to be rebuilt on the next scan start
+ * Scan states must be stopped before signatures are added
+ * Fails if the scanner is compiled, since a compiled scanner is read-only
+ * Returns 1 if successful, 0 if signature already exists or -1 on error
  */
-int libsigscan_scanner_scan_file(
+int libsigscan_scanner_add_signature(
      libsigscan_scanner_t *scanner,
-     libsigscan_scan_state_t *scan_state,
-     const char *filename,
+     const char *identifier,
+     size_t identifier_length,
+     off64_t pattern_offset,
+     const uint8_t *pattern,
+     size_t pattern_size,
+     uint32_t signature_flags,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libsigscan_scanner_scan_file";
-	size_t filename_length           = 0;
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	libsigscan_signature_t *existing_signature      = NULL;
+	libsigscan_signature_t *signature               = NULL;
+	static char *function                           = "libsigscan_scanner_add_signature";
+	int result                                      = 0;
 
 	if( scanner == NULL )
 	{
@@ -745,119 +844,180 @@ int libsigscan_scanner_scan_file(
 
 		return( -1 );
 	}
-	if( filename == NULL )
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( internal_scanner->is_compiled != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - scanner is compiled and read-only.",
+		 function );
+
+		return( -1 );
+	}
+	/* For now unbound signatures should not be be smaller than 4 bytes
+	 * otherwise the skip value has little to no effect
+	 */
+	if( ( ( signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET )
+	 && ( pattern_size < 4 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid pattern value too small.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
+	if( libsigscan_signature_initialize(
+	     &signature,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 "%s: unable to create signature.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
+	if( libsigscan_signature_set(
+	     signature,
+	     identifier,
+	     identifier_length,
+	     pattern_offset,
+	     pattern,
+	     pattern_size,
+	     signature_flags,
 	     error ) != 1 )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set signature values.",
+		 function );
 
 		goto on_error;
 	}
-#endif
-	filename_length = narrow_string_length(
-	                   filename );
+	signature->signature_index = internal_scanner->number_of_signatures;
 
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
+	result = libcdata_list_insert_value_with_existing(
+	          internal_scanner->signatures_list,
+	          (intptr_t *) signature,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libsigscan_signature_compare_by_pattern,
+	          LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+	          (intptr_t **) &existing_signature,
+	          error );
 
-		goto on_error;
-	}
-	if( libsigscan_scanner_scan_file_io_handle(
-	     scanner,
-	     scan_state,
-	     file_io_handle,
-	     error ) != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %s.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert signature.",
+		 function );
 
 		goto on_error;
 	}
-	if( libbfio_handle_free(
-	     &file_io_handle,
-	     error ) != 1 )
+	else if( result == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file IO handle.",
-		 function );
+		if( libsigscan_signature_free(
+		     &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free signature.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( libsigscan_signature_append_identifier(
+		     existing_signature,
+		     identifier,
+		     identifier_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append identifier to existing signature.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		internal_scanner->number_of_signatures += 1;
+
+		if( libsigscan_internal_scanner_insert_signature(
+		     internal_scanner,
+		     signature,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to insert signature into scan tree.",
+			 function );
+
+			/* The signature is managed by the signatures list
+			 */
+			return( -1 );
+		}
 	}
 	return( 1 );
 
 on_error:
-	if( file_io_handle != NULL )
+	if( signature != NULL )
 	{
-		libbfio_handle_free(
-		 &file_io_handle,
+		libsigscan_signature_free(
+		 &signature,
 		 NULL );
 	}
 	return( -1 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Scans a file
- * Returns 1 if successful or -1 on error
+/* Adds a signature bound to an offset range
+ * The signature flags must contain the offset direction of the range
+ * If the range is relative from the start the range start offset must be smaller than the range end offset
+ * If the range is relative from the end the offsets are the distance to the end of the data
+ * and the range start offset must be larger than the range end offset
+ * The pattern matches anywhere within the range
+ * If the scan trees were already built the signature is inserted into the offset range scan tree
+ * which is rebuilt on the next scan start once too many signatures were inserted
+ * Scan states must be stopped before signatures are added
+ * Fails if the scanner is compiled, since a compiled scanner is read-only
+ * Returns 1 if successful, 0 if signature already exists or -1 on error
  */
-int libsigscan_scanner_scan_file_wide(
+int libsigscan_scanner_add_range_signature(
      libsigscan_scanner_t *scanner,
-     libsigscan_scan_state_t *scan_state,
-     const wchar_t *filename,
+     const char *identifier,
+     size_t identifier_length,
+     off64_t range_start_offset,
+     off64_t range_end_offset,
+     const uint8_t *pattern,
+     size_t pattern_size,
+     uint32_t signature_flags,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libsigscan_scanner_scan_file_wide";
-	size_t filename_length           = 0;
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	libsigscan_signature_t *existing_signature      = NULL;
+	libsigscan_signature_t *signature               = NULL;
+	static char *function                           = "libsigscan_scanner_add_range_signature";
+	int result                                      = 0;
 
 	if( scanner == NULL )
 	{
@@ -870,139 +1030,194 @@ int libsigscan_scanner_scan_file_wide(
 
 		return( -1 );
 	}
-	if( filename == NULL )
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( internal_scanner->is_compiled != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - scanner is compiled and read-only.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	/* The offset range signatures are scanned as unbound signatures within their range
+	 * hence the same minimum pattern size applies
+	 */
+	if( pattern_size < 4 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid pattern value too small.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
+	if( libsigscan_signature_initialize(
+	     &signature,
 	     error ) != 1 )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create signature.",
+		 function );
 
 		goto on_error;
 	}
-#endif
-	filename_length = wide_string_length(
-	                   filename );
-
-	if( libbfio_file_set_name_wide(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
+	if( libsigscan_signature_set(
+	     signature,
+	     identifier,
+	     identifier_length,
+	     0,
+	     pattern,
+	     pattern_size,
+	     LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
 	     error ) != 1 )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set signature values.",
+		 function );
 
 		goto on_error;
 	}
-	if( libsigscan_scanner_scan_file_io_handle(
-	     scanner,
-	     scan_state,
-	     file_io_handle,
+	if( libsigscan_signature_set_range(
+	     signature,
+	     range_start_offset,
+	     range_end_offset,
+	     signature_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %ls.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set signature offset range.",
+		 function );
 
 		goto on_error;
 	}
-	if( libbfio_handle_free(
-	     &file_io_handle,
-	     error ) != 1 )
+	signature->signature_index = internal_scanner->number_of_signatures;
+
+	result = libcdata_list_insert_value_with_existing(
+	          internal_scanner->range_signatures_list,
+	          (intptr_t *) signature,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libsigscan_signature_compare_by_pattern,
+	          LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+	          (intptr_t **) &existing_signature,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert signature.",
 		 function );
 
 		goto on_error;
 	}
-	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
+	else if( result == 0 )
 	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	return( -1 );
-}
-
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+		/* The offset range scan tree requires unique patterns
+		 */
+		if( ( existing_signature->range_flags != signature->range_flags )
+		 || ( existing_signature->range_start_offset != signature->range_start_offset )
+		 || ( existing_signature->range_end_offset != signature->range_end_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported pattern already bound to another offset range.",
+			 function );
 
-/* Scans a file using a Basic File IO (bfio) handle
- * Returns 1 if successful or -1 on error
- */
-int libsigscan_scanner_scan_file_io_handle(
-     libsigscan_scanner_t *scanner,
-     libsigscan_scan_state_t *scan_state,
-     libbfio_handle_t *file_io_handle,
+			goto on_error;
+		}
+		if( libsigscan_signature_free(
+		     &signature,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free signature.",
+			 function );
+
+			goto on_error;
+		}
+		if( libsigscan_signature_append_identifier(
+		     existing_signature,
+		     identifier,
+		     identifier_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append identifier to existing signature.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		internal_scanner->number_of_signatures += 1;
+
+		if( libsigscan_internal_scanner_insert_signature(
+		     internal_scanner,
+		     signature,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to insert offset range signature into scan tree.",
+			 function );
+
+			/* The signature is managed by the offset range signatures list
+			 */
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( signature != NULL )
+	{
+		libsigscan_signature_free(
+		 &signature,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees the scan trees
+ * The scan trees are rebuilt from all the signatures on the next scan start
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_free_scan_trees(
+     libsigscan_internal_scanner_t *internal_scanner,
      libcerror_error_t **error )
 {
-	libsigscan_internal_scanner_t *internal_scanner = NULL;
-	uint8_t *buffer                                 = NULL;
-	static char *function                           = "libsigscan_scanner_scan_file_io_handle";
-	size64_t file_size                              = 0;
-	size_t buffer_size                              = 0;
-	size_t read_size                                = 0;
-	ssize_t read_count                              = 0;
-	off64_t file_offset                             = 0;
-	uint64_t footer_range_end                       = 0;
-	uint64_t footer_range_size                      = 0;
-	uint64_t footer_range_start                     = 0;
-	uint64_t header_range_end                       = 0;
-	uint64_t header_range_size                      = 0;
-	uint64_t header_range_start                     = 0;
-	uint64_t unbounded_range_size                   = 0;
-	uint64_t unbounded_range_start                  = 0;
-	int file_io_handle_is_open                      = 0;
-	int has_footer_range                            = 0;
-	int has_header_range                            = 0;
-	int has_unbounded_range                         = 0;
-	int result                                      = 0;
+	static char *function = "libsigscan_internal_scanner_free_scan_trees";
+	int result            = 1;
 
-	if( scanner == NULL )
+	if( internal_scanner == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1013,421 +1228,5614 @@ int libsigscan_scanner_scan_file_io_handle(
 
 		return( -1 );
 	}
-	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+	if( internal_scanner->header_scan_tree != NULL )
+	{
+		if( libsigscan_scan_tree_free(
+		     &( internal_scanner->header_scan_tree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free header scan tree.",
+			 function );
 
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          file_io_handle,
-	                          error );
+			result = -1;
+		}
+	}
+	if( internal_scanner->footer_scan_tree != NULL )
+	{
+		if( libsigscan_scan_tree_free(
+		     &( internal_scanner->footer_scan_tree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free footer scan tree.",
+			 function );
 
-	if( file_io_handle_is_open == -1 )
+			result = -1;
+		}
+	}
+	if( internal_scanner->scan_tree != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to determine if file IO handle is open.",
-		 function );
+		if( libsigscan_scan_tree_free(
+		     &( internal_scanner->scan_tree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scan tree.",
+			 function );
 
-		goto on_error;
+			result = -1;
+		}
 	}
-	else if( file_io_handle_is_open == 0 )
+	if( internal_scanner->range_scan_tree != NULL )
 	{
-		if( libbfio_handle_open(
-		     file_io_handle,
-		     LIBBFIO_ACCESS_FLAG_READ,
+		if( libsigscan_scan_tree_free(
+		     &( internal_scanner->range_scan_tree ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free offset range scan tree.",
 			 function );
 
-			goto on_error;
+			result = -1;
 		}
 	}
-	if( libbfio_handle_get_size(
-	     file_io_handle,
-	     &file_size,
-	     error ) != 1 )
+	return( result );
+}
+
+/* Inserts a signature that was added after the scan trees were built
+ * Unbounded and offset range signatures are inserted into the unbounded and the offset range
+ * scan tree. If the signature cannot be inserted, or the scan tree needs to be rebuilt because
+ * of the signatures inserted before, the scan tree is freed and rebuilt from all its signatures
+ * on the next scan start. The header and footer scan trees are always rebuilt, since their
+ * node pattern offsets depend on the pattern offsets of all their signatures
+ * The other scan trees are kept as-is
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_insert_signature(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_signature_t *signature,
+     uint8_t is_range_signature,
+     libcerror_error_t **error )
+{
+	libcdata_list_t *signatures_list   = NULL;
+	libsigscan_scan_tree_t **scan_tree = NULL;
+	static char *function              = "libsigscan_internal_scanner_insert_signature";
+	int result                         = 0;
+
+	if( internal_scanner == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libsigscan_scan_state_set_data_size(
-	     scan_state,
-	     file_size,
-	     error ) != 1 )
+	if( signature == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set data size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libsigscan_scanner_scan_start(
-	     scanner,
-	     scan_state,
-	     error ) != 1 )
+	if( is_range_signature != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set scan state.",
-		 function );
+		scan_tree       = &( internal_scanner->range_scan_tree );
+		signatures_list = internal_scanner->range_signatures_list;
+	}
+	else if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START )
+	{
+		scan_tree = &( internal_scanner->header_scan_tree );
+	}
+	else if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END )
+	{
+		scan_tree = &( internal_scanner->footer_scan_tree );
+	}
+	else
+	{
+		scan_tree       = &( internal_scanner->scan_tree );
+		signatures_list = internal_scanner->signatures_list;
+	}
+	if( *scan_tree == NULL )
+	{
+		return( 1 );
+	}
+	if( signatures_list != NULL )
+	{
+		result = libsigscan_scan_tree_insert_signature(
+		          *scan_tree,
+		          signatures_list,
+		          signature,
+		          error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to insert signature into scan tree.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
 	}
-	if( libsigscan_scan_state_get_buffer_size(
-	     scan_state,
-	     &buffer_size,
+	if( libsigscan_scan_tree_free(
+	     scan_tree,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to retrieve scan buffer size.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free scan tree.",
 		 function );
 
 		goto on_error;
 	}
-	if( ( buffer_size == 0 )
-	 || ( buffer_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	return( 1 );
+
+on_error:
+	/* Make sure the signature is not missed by rebuilding all the scan trees
+	 */
+	libsigscan_internal_scanner_free_scan_trees(
+	 internal_scanner,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Builds a scan tree
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_build_scan_tree(
+     libsigscan_scanner_scan_tree_build_t *scan_tree_build,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scanner_build_scan_tree";
+	int result            = 0;
+
+	if( scan_tree_build == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid buffer size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan tree build.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * buffer_size );
-
-	if( buffer == NULL )
+	if( scan_tree_build->unbounded_scan_engine == LIBSIGSCAN_SCAN_ENGINE_AHO_CORASICK )
+	{
+		result = libsigscan_scan_tree_build_automaton(
+		          scan_tree_build->scan_tree,
+		          scan_tree_build->signatures_list,
+		          error );
+	}
+	else if( scan_tree_build->unbounded_scan_engine == LIBSIGSCAN_SCAN_ENGINE_SCAN_TREE )
+	{
+		result = libsigscan_scan_tree_build_partitions(
+		          scan_tree_build->scan_tree,
+		          scan_tree_build->signatures_list,
+		          error );
+	}
+	else
+	{
+		result = libsigscan_scan_tree_build(
+		          scan_tree_build->scan_tree,
+		          scan_tree_build->signatures_list,
+		          scan_tree_build->pattern_offsets_mode,
+		          error );
+	}
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create scan buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build scan tree.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = libsigscan_scan_state_get_header_range(
-	          scan_state,
-	          &header_range_start,
-	          &header_range_end,
-	          &header_range_size,
-	          error );
+	return( 1 );
+}
 
-	if( result == -1 )
+/* Builds the scan trees that are not yet set
+ * The scan trees do not depend on each other, if more than 1 thread is used
+ * the scan trees are built concurrently by the threads of a thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_build_scan_trees(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error )
+{
+	libsigscan_scanner_scan_tree_build_t scan_tree_builds[ LIBSIGSCAN_COMPILED_FILE_NUMBER_OF_SCAN_TREES ];
+	intptr_t *scan_tree_build_values[ LIBSIGSCAN_COMPILED_FILE_NUMBER_OF_SCAN_TREES ];
+
+	libsigscan_thread_pool_t *thread_pool = NULL;
+	static char *function                 = "libsigscan_internal_scanner_build_scan_trees";
+	int number_of_scan_tree_builds        = 0;
+	int number_of_threads                 = 0;
+	int result                            = 0;
+	int scan_tree_build_index             = 0;
+
+	if( internal_scanner == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve header range.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	has_header_range = result;
-
-	result = libsigscan_scan_state_get_footer_range(
-	          scan_state,
-	          &footer_range_start,
-	          &footer_range_end,
-	          &footer_range_size,
-	          error );
-
-	if( result == -1 )
+	if( internal_scanner->header_scan_tree == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve footer range.",
-		 function );
-
-		goto on_error;
-	}
-	has_footer_range = result;
-
-	result = libsigscan_scan_tree_get_spanning_range(
-	          internal_scanner->scan_tree,
-	          &unbounded_range_start,
-	          &unbounded_range_size,
-	          error );
+		if( libsigscan_scan_tree_initialize(
+		     &( internal_scanner->header_scan_tree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create header scan tree.",
+			 function );
 
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve unbounded range.",
-		 function );
+			goto on_error;
+		}
+		scan_tree_builds[ number_of_scan_tree_builds ].scan_tree             = internal_scanner->header_scan_tree;
+		scan_tree_builds[ number_of_scan_tree_builds ].signatures_list       = internal_scanner->signatures_list;
+		scan_tree_builds[ number_of_scan_tree_builds ].pattern_offsets_mode  = LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START;
+		scan_tree_builds[ number_of_scan_tree_builds ].unbounded_scan_engine = 0;
 
-		goto on_error;
+		number_of_scan_tree_builds++;
 	}
-	has_unbounded_range = result;
-
-	if( has_header_range != 0 )
+	if( internal_scanner->footer_scan_tree == NULL )
 	{
-		if( has_unbounded_range != 0 )
-		{
-			header_range_size += header_range_start;
-			header_range_start = 0;
-		}
-		if( header_range_end > file_size )
+		if( libsigscan_scan_tree_initialize(
+		     &( internal_scanner->footer_scan_tree ),
+		     error ) != 1 )
 		{
-			header_range_size -= (size64_t) header_range_end - file_size;
-			header_range_end   = (off64_t) file_size;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create footer scan tree.",
+			 function );
+
+			goto on_error;
 		}
+		scan_tree_builds[ number_of_scan_tree_builds ].scan_tree             = internal_scanner->footer_scan_tree;
+		scan_tree_builds[ number_of_scan_tree_builds ].signatures_list       = internal_scanner->signatures_list;
+		scan_tree_builds[ number_of_scan_tree_builds ].pattern_offsets_mode  = LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END;
+		scan_tree_builds[ number_of_scan_tree_builds ].unbounded_scan_engine = 0;
+
+		number_of_scan_tree_builds++;
 	}
-	if( ( has_footer_range != 0 )
-	 && ( has_header_range != 0 ) )
+	if( internal_scanner->scan_tree == NULL )
 	{
-		if( footer_range_start < header_range_start )
+		if( libsigscan_scan_tree_initialize(
+		     &( internal_scanner->scan_tree ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid footer range value out of bounds.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan tree.",
 			 function );
 
 			goto on_error;
 		}
-		if( ( footer_range_start >= header_range_start )
-		 && ( footer_range_start <= header_range_end ) )
-		{
-			/* The footer range is encapsulated in the header range
-			 */
-			if( footer_range_end <= header_range_end )
-			{
-				has_footer_range = 0;
-			}
-			/* The footer range overlaps the header range at the end
-			 */
-			else if( footer_range_end > header_range_end )
-			{
-				header_range_size += footer_range_end - header_range_end;
-				header_range_end   = footer_range_end;
-				has_footer_range   = 0;
-			}
-		}
+		scan_tree_builds[ number_of_scan_tree_builds ].scan_tree             = internal_scanner->scan_tree;
+		scan_tree_builds[ number_of_scan_tree_builds ].signatures_list       = internal_scanner->signatures_list;
+		scan_tree_builds[ number_of_scan_tree_builds ].pattern_offsets_mode  = LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND;
+		scan_tree_builds[ number_of_scan_tree_builds ].unbounded_scan_engine = internal_scanner->unbounded_scan_engine;
+
+		number_of_scan_tree_builds++;
 	}
-	if( ( has_header_range != 0 )
-	 || ( has_unbounded_range != 0 ) )
+	if( internal_scanner->range_scan_tree == NULL )
 	{
-		file_offset = (off64_t) header_range_start;
-
-		if( has_unbounded_range == 0 )
-		{
-			file_size = header_range_end;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: scanning range: %" PRIi64 " - %" PRIu64 " for signatures.\n",
-			 function,
-			 file_offset,
-			 file_size );
-		}
-#endif
-		if( libbfio_handle_seek_offset(
-		     file_io_handle,
-		     file_offset,
-		     SEEK_SET,
-		     error ) == -1 )
+		if( libsigscan_scan_tree_initialize(
+		     &( internal_scanner->range_scan_tree ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 file_offset,
-			 file_offset );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create offset range scan tree.",
+			 function );
 
 			goto on_error;
 		}
-		while( (size64_t) file_offset < file_size )
-		{
-			if( buffer_size > ( file_size - file_offset ) )
-			{
-				read_size = (size_t) ( file_size - file_offset );
-			}
-			else
-			{
-				read_size = buffer_size;
-			}
-			read_count = libbfio_handle_read_buffer(
-				      file_io_handle,
-				      buffer,
-				      read_size,
-				      error );
+		scan_tree_builds[ number_of_scan_tree_builds ].scan_tree             = internal_scanner->range_scan_tree;
+		scan_tree_builds[ number_of_scan_tree_builds ].signatures_list       = internal_scanner->range_signatures_list;
+		scan_tree_builds[ number_of_scan_tree_builds ].pattern_offsets_mode  = LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND;
+		scan_tree_builds[ number_of_scan_tree_builds ].unbounded_scan_engine = 0;
 
-			if( read_count != (ssize_t) read_size )
+		number_of_scan_tree_builds++;
+	}
+	if( number_of_scan_tree_builds > 0 )
+	{
+		number_of_threads = internal_scanner->number_of_threads;
+
+		if( number_of_threads == 0 )
+		{
+			if( libsigscan_thread_pool_get_default_number_of_threads(
+			     &number_of_threads,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read buffer.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve default number of threads.",
 				 function );
 
 				goto on_error;
 			}
-			if( libsigscan_scan_state_scan_buffer(
-			     scan_state,
-			     file_offset,
-			     buffer,
-			     read_size,
+		}
+		if( number_of_threads > 1 )
+		{
+			if( libsigscan_thread_pool_initialize(
+			     &thread_pool,
+			     number_of_threads,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to scan buffer.",
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread pool.",
 				 function );
 
 				goto on_error;
 			}
-			file_offset += read_size;
 		}
-	}
-	if( ( has_footer_range != 0 )
-	 && ( footer_range_size > 0 ) )
-	{
-		if( libsigscan_scan_state_flush(
-		     scan_state,
-		     error ) != 1 )
+		for( scan_tree_build_index = 0;
+		     scan_tree_build_index < number_of_scan_tree_builds;
+		     scan_tree_build_index++ )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to flush scan state.",
-			 function );
+			scan_tree_builds[ scan_tree_build_index ].scan_tree->thread_pool = thread_pool;
 
-			goto on_error;
+			scan_tree_build_values[ scan_tree_build_index ] = (intptr_t *) &( scan_tree_builds[ scan_tree_build_index ] );
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		result = libsigscan_thread_pool_run_values(
+		          thread_pool,
+		          (int (*)(intptr_t *, libcerror_error_t **)) &libsigscan_internal_scanner_build_scan_tree,
+		          scan_tree_build_values,
+		          number_of_scan_tree_builds,
+		          error );
+
+		for( scan_tree_build_index = 0;
+		     scan_tree_build_index < number_of_scan_tree_builds;
+		     scan_tree_build_index++ )
 		{
-			libcnotify_printf(
-			 "%s: scanning footer range: %" PRIu64 " - %" PRIu64 " for signatures.\n",
-			 function,
-			 footer_range_start,
-			 footer_range_end );
+			scan_tree_builds[ scan_tree_build_index ].scan_tree->thread_pool = NULL;
 		}
-#endif
-		file_offset = (off64_t) footer_range_start;
-
-		if( libbfio_handle_seek_offset(
-		     file_io_handle,
-		     file_offset,
-		     SEEK_SET,
-		     error ) == -1 )
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to seek footer range offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 file_offset,
-			 file_offset );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build scan trees.",
+			 function );
 
 			goto on_error;
 		}
-		while( (size64_t) file_offset < footer_range_end )
+		if( thread_pool != NULL )
 		{
-			if( buffer_size > ( footer_range_end - file_offset ) )
-			{
-				read_size = (size_t) ( footer_range_end - file_offset );
-			}
-			else
-			{
-				read_size = buffer_size;
-			}
-			read_count = libbfio_handle_read_buffer(
-				      file_io_handle,
-				      buffer,
-				      read_size,
-				      error );
-
-			if( read_count != (ssize_t) read_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read buffer.",
-				 function );
-
-				goto on_error;
-			}
-			if( libsigscan_scan_state_scan_buffer(
-			     scan_state,
-			     file_offset,
-			     buffer,
-			     read_size,
+			if( libsigscan_thread_pool_free(
+			     &thread_pool,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to scan buffer.",
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free thread pool.",
 				 function );
 
 				goto on_error;
 			}
-			file_offset += read_size;
 		}
 	}
-	if( libsigscan_scanner_scan_stop(
-	     scanner,
-	     scan_state,
+	return( 1 );
+
+on_error:
+	if( thread_pool != NULL )
+	{
+		libsigscan_thread_pool_free(
+		 &thread_pool,
+		 NULL );
+	}
+	libsigscan_internal_scanner_free_scan_trees(
+	 internal_scanner,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Compiles the scanner
+ * This builds the scan trees of all the signatures that are not yet built
+ * After compiling the scanner is read-only, functions that would change the scanner
+ * return an error. The compiled scanner can be shared by multiple threads as long as
+ * each thread uses its own scan state
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_compile(
+     libsigscan_scanner_t *scanner,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	static char *function                           = "libsigscan_scanner_compile";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( internal_scanner->is_compiled != 0 )
+	{
+		return( 1 );
+	}
+	if( libsigscan_internal_scanner_build_scan_trees(
+	     internal_scanner,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set scan state.",
+		 "%s: unable to build scan trees.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	memory_free(
+	internal_scanner->is_compiled = 1;
+
+	return( 1 );
+}
+
+/* Starts the scan
+ * The scan trees are built if the scanner was not compiled
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_start(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	static char *function                           = "libsigscan_scanner_scan_start";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	/* The scan trees of a compiled scanner are shared and must not be changed
+	 */
+	if( internal_scanner->is_compiled == 0 )
+	{
+		if( libsigscan_internal_scanner_build_scan_trees(
+		     internal_scanner,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build scan trees.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_scan_state_start(
+	     scan_state,
+	     internal_scanner->header_scan_tree,
+	     internal_scanner->footer_scan_tree,
+	     internal_scanner->scan_tree,
+	     internal_scanner->range_scan_tree,
+	     internal_scanner->range_signatures_list,
+	     internal_scanner->number_of_signatures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_scanner->is_compiled == 0 )
+	{
+		libsigscan_internal_scanner_free_scan_trees(
+		 internal_scanner,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Stops the scan
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_stop(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scanner_scan_stop";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_state_stop(
+	     scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Scans a buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_buffer(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scanner_scan_buffer";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_state_scan_buffer(
+	     scan_state,
+	     0,
+	     buffer,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Scans a file
+ * The data of the file is read using the I/O strategy of the scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_file(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                = NULL;
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	libsigscan_sparse_file_t *sparse_file           = NULL;
+	uint8_t *buffer                                 = NULL;
+	static char *function                           = "libsigscan_scanner_scan_file";
+	size_t filename_length                          = 0;
+	int result                                      = 0;
+
+#if defined( LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX )
+	libsigscan_file_io_handle_t *io_handle          = NULL;
+#endif
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	/* The holes of the file are skipped if the file is sparse
+	 */
+	if( libsigscan_sparse_file_initialize(
+	     &sparse_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sparse file.",
+		 function );
+
+		goto on_error;
+	}
+	result = libsigscan_sparse_file_open(
+	          sparse_file,
+	          filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open sparse file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libsigscan_sparse_file_free(
+		     &sparse_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sparse file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_scanner->io_strategy == LIBSIGSCAN_IO_STRATEGY_MAPPED )
+	{
+		/* The file is mapped into memory if supported by the system, so that the data
+		 * is scanned without being copied, otherwise it is read using a file IO handle
+		 */
+		result = libsigscan_internal_scanner_scan_mapped_file(
+		          internal_scanner,
+		          scan_state,
+		          filename,
+		          sparse_file,
+		          1,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( sparse_file != NULL )
+			{
+				if( libsigscan_sparse_file_free(
+				     &sparse_file,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free sparse file.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			return( 1 );
+		}
+	}
+#if defined( LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX )
+	if( ( internal_scanner->io_strategy == LIBSIGSCAN_IO_STRATEGY_BUFFERED )
+	 || ( internal_scanner->io_strategy == LIBSIGSCAN_IO_STRATEGY_DIRECT ) )
+	{
+		result = libsigscan_file_io_handle_initialize_bfio_handle(
+		          &file_io_handle,
+		          &io_handle,
+		          internal_scanner->io_strategy,
+		          error );
+	}
+	else
+#endif
+	{
+		result = libbfio_file_initialize(
+		          &file_io_handle,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+#endif
+	filename_length = narrow_string_length(
+	                   filename );
+
+#if defined( LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX )
+	if( io_handle != NULL )
+	{
+		result = libsigscan_file_io_handle_set_name(
+		          io_handle,
+		          filename,
+		          filename_length + 1,
+		          error );
+	}
+	else
+#endif
+	{
+		result = libbfio_file_set_name(
+		          file_io_handle,
+		          filename,
+		          filename_length + 1,
+		          error );
+	}
+	if( result != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( ( internal_scanner->buffer_size == 0 )
+	 || ( internal_scanner->buffer_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scanner - buffer size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * internal_scanner->buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_internal_scanner_scan_file_io_handle(
+	     internal_scanner,
+	     scan_state,
+	     file_io_handle,
+	     NULL,
+	     0,
+	     sparse_file,
+	     buffer,
+	     internal_scanner->buffer_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( sparse_file != NULL )
+	{
+		if( libsigscan_sparse_file_free(
+		     &sparse_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sparse file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( sparse_file != NULL )
+	{
+		libsigscan_sparse_file_free(
+		 &sparse_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Scans a file
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_file_wide(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libsigscan_scanner_scan_file_wide";
+	size_t filename_length           = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+#endif
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_scan_file_io_handle(
+	     scanner,
+	     scan_state,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Retrieves the spanning size
+ * The spanning size is the largest unbounded or offset range pattern size - 1,
+ * which is the size of the data after a position that a match starting at that position can span
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_get_spanning_size(
+     libsigscan_internal_scanner_t *internal_scanner,
+     size64_t *spanning_size,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_tree_t *scan_trees[ 2 ];
+
+	static char *function        = "libsigscan_internal_scanner_get_spanning_size";
+	uint64_t pattern_range_size  = 0;
+	uint64_t pattern_range_start = 0;
+	int result                   = 0;
+	int scan_tree_index          = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( spanning_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid spanning size.",
+		 function );
+
+		return( -1 );
+	}
+	*spanning_size = 0;
+
+	/* The unbounded and offset range scan trees contain the patterns that can span buffers
+	 */
+	scan_trees[ 0 ] = internal_scanner->scan_tree;
+	scan_trees[ 1 ] = internal_scanner->range_scan_tree;
+
+	for( scan_tree_index = 0;
+	     scan_tree_index < 2;
+	     scan_tree_index++ )
+	{
+		if( scan_trees[ scan_tree_index ] == NULL )
+		{
+			continue;
+		}
+		result = libsigscan_scan_tree_get_spanning_range(
+		          scan_trees[ scan_tree_index ],
+		          &pattern_range_start,
+		          &pattern_range_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve pattern spanning range.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result != 0 )
+		      && ( ( pattern_range_start + pattern_range_size ) > ( *spanning_size + 1 ) ) )
+		{
+			*spanning_size = pattern_range_start + pattern_range_size - 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Scans a chunk of a file
+ * The scan results are stored in the scan state of the chunk
+ * The scan of the chunk starts from the resume data offsets of the chunk, which are
+ * set to the data offsets from which the scan continues after the chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_scan_chunk(
+     libsigscan_scanner_scan_chunk_t *scan_chunk,
+     libcerror_error_t **error )
+{
+	const uint8_t *scan_data = NULL;
+	static char *function    = "libsigscan_internal_scanner_scan_chunk";
+	size_t read_size         = 0;
+	ssize_t read_count       = 0;
+	off64_t file_offset      = 0;
+	off64_t range_end_offset = 0;
+	off64_t scan_end_offset  = 0;
+
+	if( scan_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_chunk->scan_state != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan chunk - scan state value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_chunk->mapped_data == NULL )
+	 && ( scan_chunk->buffer == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan chunk - missing buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_chunk->buffer_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan chunk - buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_state_initialize(
+	     &( scan_chunk->scan_state ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_state_set_data_size(
+	     scan_chunk->scan_state,
+	     scan_chunk->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_state_set_scan_flags(
+	     scan_chunk->scan_state,
+	     scan_chunk->scan_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_state_start(
+	     scan_chunk->scan_state,
+	     scan_chunk->header_scan_tree,
+	     scan_chunk->footer_scan_tree,
+	     scan_chunk->scan_tree,
+	     scan_chunk->range_scan_tree,
+	     scan_chunk->range_signatures_list,
+	     scan_chunk->number_of_signatures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start scan state.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data after the chunk is only used to complete the matches that start within the chunk
+	 */
+	if( libsigscan_scan_state_set_match_range_end(
+	     scan_chunk->scan_state,
+	     scan_chunk->chunk_offset + (off64_t) scan_chunk->chunk_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set match range end.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_state_set_resume_data_offsets(
+	     scan_chunk->scan_state,
+	     scan_chunk->resume_data_offsets,
+	     LIBSIGSCAN_SCAN_STATE_NUMBER_OF_RESUME_DATA_OFFSETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set resume data offsets.",
+		 function );
+
+		return( -1 );
+	}
+	file_offset     = scan_chunk->chunk_offset;
+	scan_end_offset = scan_chunk->chunk_offset + (off64_t) scan_chunk->chunk_size + (off64_t) scan_chunk->overlap_size;
+
+	while( file_offset < scan_end_offset )
+	{
+		if( file_offset >= range_end_offset )
+		{
+			range_end_offset = scan_end_offset;
+
+			/* The holes in the chunk are skipped
+			 */
+			if( scan_chunk->sparse_file != NULL )
+			{
+				if( libsigscan_sparse_file_get_scan_range(
+				     scan_chunk->sparse_file,
+				     file_offset,
+				     scan_end_offset,
+				     &file_offset,
+				     &range_end_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve scan range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 file_offset,
+					 file_offset );
+
+					return( -1 );
+				}
+				if( file_offset >= scan_end_offset )
+				{
+					break;
+				}
+			}
+		}
+		if( (off64_t) scan_chunk->buffer_size > ( range_end_offset - file_offset ) )
+		{
+			read_size = (size_t) ( range_end_offset - file_offset );
+		}
+		else
+		{
+			read_size = scan_chunk->buffer_size;
+		}
+		if( scan_chunk->mapped_data != NULL )
+		{
+			scan_data = &( scan_chunk->mapped_data[ file_offset ] );
+		}
+		else
+		{
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              scan_chunk->file_io_handle,
+			              scan_chunk->buffer,
+			              read_size,
+			              file_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				return( -1 );
+			}
+			scan_data = scan_chunk->buffer;
+		}
+		if( libsigscan_scan_state_scan_buffer(
+		     scan_chunk->scan_state,
+		     file_offset,
+		     scan_data,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan buffer.",
+			 function );
+
+			return( -1 );
+		}
+		file_offset += read_size;
+	}
+	if( libsigscan_scan_state_stop(
+	     scan_chunk->scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to stop scan state.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_state_get_resume_data_offsets(
+	     scan_chunk->scan_state,
+	     scan_chunk->resume_data_offsets,
+	     LIBSIGSCAN_SCAN_STATE_NUMBER_OF_RESUME_DATA_OFFSETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resume data offsets.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Scans a range of a file in chunks using multiple threads
+ * Every chunk is scanned with its own file IO handle and scan state, where the data after
+ * the chunk is scanned up to the largest unbounded pattern size minus 1, so that a match that
+ * starts within the chunk but ends in the next chunk is found. Matches that start after the chunk
+ * are ignored, since these are found by the next chunk. A chunk in which a match of the previous
+ * chunk ends is scanned again from the end of that match. The scan results of the chunks are
+ * appended to the scan state in offset order. If mapped data is provided the chunks are scanned
+ * directly from the mapped data instead of being read using the file IO handle. If a sparse file
+ * is provided the holes in the chunks are skipped
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_scan_file_io_handle_in_chunks(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *mapped_data,
+     libsigscan_sparse_file_t *sparse_file,
+     size64_t data_size,
+     off64_t range_offset,
+     size64_t range_end,
+     size_t buffer_size,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	off64_t resume_data_offsets[ LIBSIGSCAN_SCAN_STATE_NUMBER_OF_RESUME_DATA_OFFSETS ];
+
+	intptr_t **scan_chunk_values                 = NULL;
+	libsigscan_scanner_scan_chunk_t *scan_chunk  = NULL;
+	libsigscan_scanner_scan_chunk_t *scan_chunks = NULL;
+	libsigscan_thread_pool_t *thread_pool        = NULL;
+	static char *function                        = "libsigscan_internal_scanner_scan_file_io_handle_in_chunks";
+	size64_t chunk_size                          = 0;
+	size64_t number_of_chunks                    = 0;
+	size64_t overlap_size                        = 0;
+	uint32_t scan_flags                          = 0;
+	off64_t chunk_offset                         = 0;
+	int file_io_handle_is_open                   = 0;
+	int number_of_scan_chunks                    = 0;
+	int resume_data_offset_index                 = 0;
+	int scan_chunk_index                         = 0;
+	int scan_is_complete                         = 0;
+
+#if defined( LIBSIGSCAN_SCANNER_HAVE_MADVISE )
+	off64_t release_size                         = 0;
+	off64_t released_offset                      = 0;
+#endif
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scanner->scan_chunk_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scanner - scan chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( range_offset < 0 )
+	 || ( (size64_t) range_offset > range_end )
+	 || ( range_end > data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBSIGSCAN_THREAD_POOL_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_state_get_scan_flags(
+	     scan_state,
+	     &scan_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve scan flags.",
+		 function );
+
+		goto on_error;
+	}
+	/* The chunk size is a multiple of the buffer size so that the chunks are read
+	 * in the same blocks as when the range is scanned by a single thread
+	 */
+	chunk_size = internal_scanner->scan_chunk_size;
+
+	if( ( chunk_size % buffer_size ) != 0 )
+	{
+		chunk_size += buffer_size - ( chunk_size % buffer_size );
+	}
+	/* The unbounded and offset range patterns can span chunks
+	 */
+	if( libsigscan_internal_scanner_get_spanning_size(
+	     internal_scanner,
+	     &overlap_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve spanning size.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_chunks = ( range_end - (size64_t) range_offset ) / chunk_size;
+
+	if( ( ( range_end - (size64_t) range_offset ) % chunk_size ) != 0 )
+	{
+		number_of_chunks += 1;
+	}
+	if( (size64_t) number_of_threads > number_of_chunks )
+	{
+		number_of_threads = (int) number_of_chunks;
+	}
+	scan_chunks = (libsigscan_scanner_scan_chunk_t *) memory_allocate(
+	                                                   sizeof( libsigscan_scanner_scan_chunk_t ) * number_of_threads );
+
+	if( scan_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     scan_chunks,
+	     0,
+	     sizeof( libsigscan_scanner_scan_chunk_t ) * number_of_threads ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan chunks.",
+		 function );
+
+		memory_free(
+		 scan_chunks );
+
+		return( -1 );
+	}
+	scan_chunk_values = (intptr_t **) memory_allocate(
+	                                   sizeof( intptr_t * ) * number_of_threads );
+
+	if( scan_chunk_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan chunk values.",
+		 function );
+
+		goto on_error;
+	}
+	for( scan_chunk_index = 0;
+	     scan_chunk_index < number_of_threads;
+	     scan_chunk_index++ )
+	{
+		scan_chunk = &( scan_chunks[ scan_chunk_index ] );
+
+		scan_chunk->header_scan_tree      = internal_scanner->header_scan_tree;
+		scan_chunk->footer_scan_tree      = internal_scanner->footer_scan_tree;
+		scan_chunk->scan_tree             = internal_scanner->scan_tree;
+		scan_chunk->range_scan_tree       = internal_scanner->range_scan_tree;
+		scan_chunk->range_signatures_list = internal_scanner->range_signatures_list;
+		scan_chunk->number_of_signatures  = internal_scanner->number_of_signatures;
+		scan_chunk->mapped_data           = mapped_data;
+		scan_chunk->sparse_file           = sparse_file;
+		scan_chunk->data_size             = data_size;
+		scan_chunk->scan_flags            = scan_flags;
+		scan_chunk->buffer_size           = buffer_size;
+
+		/* The chunks of mapped data are scanned directly from the mapping
+		 */
+		if( mapped_data == NULL )
+		{
+			/* The file IO handle is cloned so that the chunks can be read concurrently
+			 */
+			if( libbfio_handle_clone(
+			     &( scan_chunk->file_io_handle ),
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to clone file IO handle: %d.",
+				 function,
+				 scan_chunk_index );
+
+				goto on_error;
+			}
+			file_io_handle_is_open = libbfio_handle_is_open(
+			                          scan_chunk->file_io_handle,
+			                          error );
+
+			if( file_io_handle_is_open == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to determine if file IO handle: %d is open.",
+				 function,
+				 scan_chunk_index );
+
+				goto on_error;
+			}
+			else if( file_io_handle_is_open == 0 )
+			{
+				if( libbfio_handle_open(
+				     scan_chunk->file_io_handle,
+				     LIBBFIO_ACCESS_FLAG_READ,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_OPEN_FAILED,
+					 "%s: unable to open file IO handle: %d.",
+					 function,
+					 scan_chunk_index );
+
+					goto on_error;
+				}
+			}
+			scan_chunk->buffer = (uint8_t *) memory_allocate(
+			                                  sizeof( uint8_t ) * buffer_size );
+
+			if( scan_chunk->buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create scan buffer: %d.",
+				 function,
+				 scan_chunk_index );
+
+				goto on_error;
+			}
+		}
+		scan_chunk_values[ scan_chunk_index ] = (intptr_t *) scan_chunk;
+	}
+	if( libsigscan_thread_pool_initialize(
+	     &thread_pool,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	/* The chunks are scanned in rounds of a chunk per thread, which bounds the number
+	 * of scan states and allows the scan to stop when the stop policy has been met
+	 */
+	chunk_offset = range_offset;
+
+#if defined( LIBSIGSCAN_SCANNER_HAVE_MADVISE )
+	released_offset = chunk_offset - ( chunk_offset % LIBSIGSCAN_SCANNER_MAPPED_DATA_RELEASE_SIZE );
+#endif
+	while( ( scan_is_complete == 0 )
+	    && ( (size64_t) chunk_offset < range_end ) )
+	{
+		for( number_of_scan_chunks = 0;
+		     number_of_scan_chunks < number_of_threads;
+		     number_of_scan_chunks++ )
+		{
+			if( (size64_t) chunk_offset >= range_end )
+			{
+				break;
+			}
+			scan_chunk = &( scan_chunks[ number_of_scan_chunks ] );
+
+			scan_chunk->chunk_offset = chunk_offset;
+			scan_chunk->chunk_size   = range_end - (size64_t) chunk_offset;
+
+			if( scan_chunk->chunk_size > chunk_size )
+			{
+				scan_chunk->chunk_size = chunk_size;
+			}
+			chunk_offset += (off64_t) scan_chunk->chunk_size;
+
+			scan_chunk->overlap_size = range_end - (size64_t) chunk_offset;
+
+			if( scan_chunk->overlap_size > overlap_size )
+			{
+				scan_chunk->overlap_size = overlap_size;
+			}
+			for( resume_data_offset_index = 0;
+			     resume_data_offset_index < LIBSIGSCAN_SCAN_STATE_NUMBER_OF_RESUME_DATA_OFFSETS;
+			     resume_data_offset_index++ )
+			{
+				scan_chunk->resume_data_offsets[ resume_data_offset_index ] = scan_chunk->chunk_offset;
+			}
+		}
+		if( libsigscan_thread_pool_run_values(
+		     thread_pool,
+		     (int (*)(intptr_t *, libcerror_error_t **)) &libsigscan_internal_scanner_scan_chunk,
+		     scan_chunk_values,
+		     number_of_scan_chunks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan chunks.",
+			 function );
+
+			goto on_error;
+		}
+		for( scan_chunk_index = 0;
+		     scan_chunk_index < number_of_scan_chunks;
+		     scan_chunk_index++ )
+		{
+			scan_chunk = &( scan_chunks[ scan_chunk_index ] );
+
+			/* A chunk was scanned as if no match of the previous chunk ends in it. If a match
+			 * of the previous chunk ends in the chunk the chunk is scanned again from the end
+			 * of that match, as when the range is scanned by a single thread
+			 */
+			if( scan_chunk->chunk_offset > range_offset )
+			{
+				for( resume_data_offset_index = 0;
+				     resume_data_offset_index < LIBSIGSCAN_SCAN_STATE_NUMBER_OF_RESUME_DATA_OFFSETS;
+				     resume_data_offset_index++ )
+				{
+					if( resume_data_offsets[ resume_data_offset_index ] > scan_chunk->chunk_offset )
+					{
+						break;
+					}
+				}
+				if( resume_data_offset_index < LIBSIGSCAN_SCAN_STATE_NUMBER_OF_RESUME_DATA_OFFSETS )
+				{
+					if( libsigscan_scan_state_free(
+					     &( scan_chunk->scan_state ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free scan state of chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+						 function,
+						 scan_chunk->chunk_offset,
+						 scan_chunk->chunk_offset );
+
+						goto on_error;
+					}
+					for( resume_data_offset_index = 0;
+					     resume_data_offset_index < LIBSIGSCAN_SCAN_STATE_NUMBER_OF_RESUME_DATA_OFFSETS;
+					     resume_data_offset_index++ )
+					{
+						scan_chunk->resume_data_offsets[ resume_data_offset_index ] = resume_data_offsets[ resume_data_offset_index ];
+					}
+					if( libsigscan_internal_scanner_scan_chunk(
+					     scan_chunk,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to scan chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+						 function,
+						 scan_chunk->chunk_offset,
+						 scan_chunk->chunk_offset );
+
+						goto on_error;
+					}
+				}
+			}
+			for( resume_data_offset_index = 0;
+			     resume_data_offset_index < LIBSIGSCAN_SCAN_STATE_NUMBER_OF_RESUME_DATA_OFFSETS;
+			     resume_data_offset_index++ )
+			{
+				resume_data_offsets[ resume_data_offset_index ] = scan_chunk->resume_data_offsets[ resume_data_offset_index ];
+			}
+			if( libsigscan_scan_state_append_scan_results_in_range(
+			     scan_state,
+			     scan_chunk->scan_state,
+			     scan_chunk->chunk_offset,
+			     scan_chunk->chunk_offset + (off64_t) scan_chunk->chunk_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append scan results of chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 scan_chunk->chunk_offset,
+				 scan_chunk->chunk_offset );
+
+				goto on_error;
+			}
+			if( libsigscan_scan_state_free(
+			     &( scan_chunk->scan_state ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free scan state of chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 scan_chunk->chunk_offset,
+				 scan_chunk->chunk_offset );
+
+				goto on_error;
+			}
+		}
+#if defined( LIBSIGSCAN_SCANNER_HAVE_MADVISE )
+		/* The mapped data before the next round of chunks has been scanned
+		 * and is released to bound the resident memory
+		 */
+		if( ( mapped_data != NULL )
+		 && ( ( chunk_offset - released_offset ) >= LIBSIGSCAN_SCANNER_MAPPED_DATA_RELEASE_SIZE ) )
+		{
+			release_size  = chunk_offset - released_offset;
+			release_size -= release_size % LIBSIGSCAN_SCANNER_MAPPED_DATA_RELEASE_SIZE;
+
+			/* The release is advisory hence failure is ignored
+			 */
+			madvise(
+			 (void *) &( mapped_data[ released_offset ] ),
+			 (size_t) release_size,
+			 MADV_DONTNEED );
+
+			released_offset += release_size;
+		}
+#endif
+		scan_is_complete = libsigscan_scan_state_is_complete(
+		                    scan_state,
+		                    error );
+
+		if( scan_is_complete == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if scan state is complete.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_thread_pool_free(
+	     &thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( scan_chunk_index = 0;
+	     scan_chunk_index < number_of_threads;
+	     scan_chunk_index++ )
+	{
+		scan_chunk = &( scan_chunks[ scan_chunk_index ] );
+
+		if( scan_chunk->buffer != NULL )
+		{
+			memory_free(
+			 scan_chunk->buffer );
+
+			scan_chunk->buffer = NULL;
+		}
+		if( scan_chunk->file_io_handle != NULL )
+		{
+			if( libbfio_handle_close(
+			     scan_chunk->file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle: %d.",
+				 function,
+				 scan_chunk_index );
+
+				goto on_error;
+			}
+			if( libbfio_handle_free(
+			     &( scan_chunk->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle: %d.",
+				 function,
+				 scan_chunk_index );
+
+				goto on_error;
+			}
+		}
+	}
+	memory_free(
+	 scan_chunk_values );
+
+	memory_free(
+	 scan_chunks );
+
+	return( 1 );
+
+on_error:
+	if( thread_pool != NULL )
+	{
+		libsigscan_thread_pool_free(
+		 &thread_pool,
+		 NULL );
+	}
+	if( scan_chunks != NULL )
+	{
+		for( scan_chunk_index = 0;
+		     scan_chunk_index < number_of_threads;
+		     scan_chunk_index++ )
+		{
+			scan_chunk = &( scan_chunks[ scan_chunk_index ] );
+
+			if( scan_chunk->scan_state != NULL )
+			{
+				libsigscan_scan_state_free(
+				 &( scan_chunk->scan_state ),
+				 NULL );
+			}
+			if( scan_chunk->buffer != NULL )
+			{
+				memory_free(
+				 scan_chunk->buffer );
+			}
+			if( scan_chunk->file_io_handle != NULL )
+			{
+				libbfio_handle_close(
+				 scan_chunk->file_io_handle,
+				 NULL );
+				libbfio_handle_free(
+				 &( scan_chunk->file_io_handle ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 scan_chunks );
+	}
+	if( scan_chunk_values != NULL )
+	{
+		memory_free(
+		 scan_chunk_values );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Scans a range of a file of which the data is read ahead by a reader thread
+ * The reader thread reads the data into a ring of buffers while the buffers
+ * that were read before are scanned, so that reading and scanning overlap.
+ * If a sparse file is provided the reader thread skips the holes in the range
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_scan_file_io_handle_with_read_ahead(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     libsigscan_sparse_file_t *sparse_file,
+     off64_t range_offset,
+     size64_t range_end,
+     size_t buffer_size,
+     int *scan_is_complete,
+     libcerror_error_t **error )
+{
+	libsigscan_read_ahead_t *read_ahead = NULL;
+	const uint8_t *scan_data            = NULL;
+	static char *function               = "libsigscan_internal_scanner_scan_file_io_handle_with_read_ahead";
+	size_t read_size                    = 0;
+	off64_t file_offset                 = 0;
+	int result                          = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( range_offset < 0 )
+	 || ( (size64_t) range_offset > range_end )
+	 || ( range_end > (size64_t) INT64_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_is_complete == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan is complete.",
+		 function );
+
+		return( -1 );
+	}
+	*scan_is_complete = 0;
+
+	if( libsigscan_read_ahead_initialize(
+	     &read_ahead,
+	     internal_scanner->number_of_read_ahead_buffers,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_read_ahead_start(
+	     read_ahead,
+	     file_io_handle,
+	     sparse_file,
+	     range_offset,
+	     (off64_t) range_end,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	while( *scan_is_complete == 0 )
+	{
+		result = libsigscan_read_ahead_get_buffer(
+		          read_ahead,
+		          &scan_data,
+		          &file_offset,
+		          &read_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve read-ahead buffer.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libsigscan_scan_state_scan_buffer(
+		     scan_state,
+		     file_offset,
+		     scan_data,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan buffer.",
+			 function );
+
+			goto on_error;
+		}
+		if( libsigscan_read_ahead_release_buffer(
+		     read_ahead,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read-ahead buffer.",
+			 function );
+
+			goto on_error;
+		}
+		*scan_is_complete = libsigscan_scan_state_is_complete(
+		                     scan_state,
+		                     error );
+
+		if( *scan_is_complete == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if scan state is complete.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Freeing the read-ahead stops the reader thread, which discards
+	 * the data that was read ahead if the scan completed early
+	 */
+	if( libsigscan_read_ahead_free(
+	     &read_ahead,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( read_ahead != NULL )
+	{
+		libsigscan_read_ahead_free(
+		 &read_ahead,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Scans a file using a Basic File IO (bfio) handle
+ * The buffer is used to read the data and must be of the scan buffer size
+ * If mapped data is provided the data is scanned directly from the mapped data,
+ * in which case the file IO handle and buffer are not used
+ * If a sparse file is provided the holes of the file are skipped in the unbounded range,
+ * where a pattern that consists entirely of zero bytes is not matched within a hole
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_scan_file_io_handle(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *mapped_data,
+     size64_t mapped_data_size,
+     libsigscan_sparse_file_t *sparse_file,
+     uint8_t *buffer,
+     size_t buffer_size,
+     uint8_t scan_in_chunks,
+     libcerror_error_t **error )
+{
+	const uint8_t *scan_data      = NULL;
+	static char *function         = "libsigscan_internal_scanner_scan_file_io_handle";
+	size64_t file_size            = 0;
+	size64_t spanning_size        = 0;
+	size_t read_size              = 0;
+	ssize_t read_count            = 0;
+	off64_t file_offset           = 0;
+	off64_t range_end_offset      = 0;
+	uint64_t footer_range_end     = 0;
+	uint64_t footer_range_size    = 0;
+	uint64_t footer_range_start   = 0;
+	uint64_t header_range_end     = 0;
+	uint64_t header_range_size    = 0;
+	uint64_t header_range_start   = 0;
+	uint64_t offset_range_end     = 0;
+	uint64_t offset_range_size    = 0;
+	uint64_t offset_range_start   = 0;
+	uint64_t unbounded_range_size = 0;
+	int file_io_handle_is_open    = 0;
+	int has_footer_range          = 0;
+	int has_header_range          = 0;
+	int has_offset_range          = 0;
+	int has_unbounded_range       = 0;
+	int number_of_threads         = 0;
+	int result                    = 0;
+	int scan_is_complete          = 0;
+
+#if defined( LIBSIGSCAN_SCANNER_HAVE_MADVISE )
+	off64_t release_size          = 0;
+	off64_t released_offset       = 0;
+#endif
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mapped_data == NULL )
+	 && ( buffer == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size != internal_scanner->buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_data != NULL )
+	{
+		file_size = mapped_data_size;
+	}
+	else
+	{
+		file_io_handle_is_open = libbfio_handle_is_open(
+		                          file_io_handle,
+		                          error );
+
+		if( file_io_handle_is_open == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to determine if file IO handle is open.",
+			 function );
+
+			goto on_error;
+		}
+		else if( file_io_handle_is_open == 0 )
+		{
+			if( libbfio_handle_open(
+			     file_io_handle,
+			     LIBBFIO_ACCESS_FLAG_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file IO handle.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libbfio_handle_get_size(
+		     file_io_handle,
+		     &file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_scan_state_set_data_size(
+	     scan_state,
+	     file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_scan_start(
+	     (libsigscan_scanner_t *) internal_scanner,
+	     scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state.",
+		 function );
+
+		goto on_error;
+	}
+	result = libsigscan_scan_state_get_header_range(
+	          scan_state,
+	          &header_range_start,
+	          &header_range_end,
+	          &header_range_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve header range.",
+		 function );
+
+		goto on_error;
+	}
+	has_header_range = result;
+
+	result = libsigscan_scan_state_get_footer_range(
+	          scan_state,
+	          &footer_range_start,
+	          &footer_range_end,
+	          &footer_range_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve footer range.",
+		 function );
+
+		goto on_error;
+	}
+	has_footer_range = result;
+
+	result = libsigscan_scan_state_get_unbounded_range(
+	          scan_state,
+	          &unbounded_range_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve unbounded range.",
+		 function );
+
+		goto on_error;
+	}
+	has_unbounded_range = result;
+
+	result = libsigscan_scan_state_get_offset_range(
+	          scan_state,
+	          &offset_range_start,
+	          &offset_range_end,
+	          &offset_range_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve offset range.",
+		 function );
+
+		goto on_error;
+	}
+	has_offset_range = result;
+
+	/* The holes are only skipped in the unbounded range, where the header and footer
+	 * ranges are not skipped since their data is scanned as a whole
+	 */
+	if( has_unbounded_range == 0 )
+	{
+		sparse_file = NULL;
+	}
+	else if( sparse_file != NULL )
+	{
+		if( libsigscan_internal_scanner_get_spanning_size(
+		     internal_scanner,
+		     &spanning_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve spanning size.",
+			 function );
+
+			goto on_error;
+		}
+		if( libsigscan_sparse_file_set_scan_ranges(
+		     sparse_file,
+		     (size_t) spanning_size,
+		     ( has_header_range != 0 ) ? header_range_start : 0,
+		     ( has_header_range != 0 ) ? header_range_end : 0,
+		     ( has_footer_range != 0 ) ? footer_range_start : 0,
+		     ( has_footer_range != 0 ) ? footer_range_end : 0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set scan ranges of sparse file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( has_header_range != 0 )
+	{
+		if( has_unbounded_range != 0 )
+		{
+			header_range_size += header_range_start;
+			header_range_start = 0;
+		}
+		if( header_range_end > file_size )
+		{
+			header_range_size -= (size64_t) header_range_end - file_size;
+			header_range_end   = (off64_t) file_size;
+		}
+	}
+	/* The offset and footer ranges are bounded by the file size, since the data
+	 * after the end of the file cannot be read nor accessed in mapped data
+	 */
+	if( ( has_offset_range != 0 )
+	 && ( offset_range_end > file_size ) )
+	{
+		if( offset_range_start >= file_size )
+		{
+			has_offset_range = 0;
+		}
+		else
+		{
+			offset_range_size -= offset_range_end - file_size;
+			offset_range_end   = file_size;
+		}
+	}
+	if( ( has_footer_range != 0 )
+	 && ( footer_range_end > file_size ) )
+	{
+		if( footer_range_start >= file_size )
+		{
+			has_footer_range = 0;
+		}
+		else
+		{
+			footer_range_size -= footer_range_end - file_size;
+			footer_range_end   = file_size;
+		}
+	}
+	if( has_offset_range != 0 )
+	{
+		/* The offset range is scanned as part of the unbounded range
+		 */
+		if( has_unbounded_range != 0 )
+		{
+			has_offset_range = 0;
+		}
+		/* The offset range overlaps the header range
+		 */
+		else if( ( has_header_range != 0 )
+		      && ( offset_range_start <= header_range_end ) )
+		{
+			if( offset_range_end > header_range_end )
+			{
+				header_range_size += offset_range_end - header_range_end;
+				header_range_end   = offset_range_end;
+			}
+			has_offset_range = 0;
+		}
+		/* The offset range overlaps the footer range
+		 */
+		else if( ( has_footer_range != 0 )
+		      && ( offset_range_end >= footer_range_start ) )
+		{
+			if( offset_range_start < footer_range_start )
+			{
+				footer_range_size += footer_range_start - offset_range_start;
+				footer_range_start = offset_range_start;
+			}
+			if( offset_range_end > footer_range_end )
+			{
+				footer_range_size += offset_range_end - footer_range_end;
+				footer_range_end   = offset_range_end;
+			}
+			has_offset_range = 0;
+		}
+	}
+	/* The footer range is scanned as part of the unbounded range
+	 */
+	if( ( has_footer_range != 0 )
+	 && ( has_unbounded_range != 0 ) )
+	{
+		has_footer_range = 0;
+	}
+	if( ( has_footer_range != 0 )
+	 && ( has_header_range != 0 ) )
+	{
+		if( footer_range_start < header_range_start )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid footer range value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( footer_range_start >= header_range_start )
+		 && ( footer_range_start <= header_range_end ) )
+		{
+			/* The footer range is encapsulated in the header range
+			 */
+			if( footer_range_end <= header_range_end )
+			{
+				has_footer_range = 0;
+			}
+			/* The footer range overlaps the header range at the end
+			 */
+			else if( footer_range_end > header_range_end )
+			{
+				header_range_size += footer_range_end - header_range_end;
+				header_range_end   = footer_range_end;
+				has_footer_range   = 0;
+			}
+		}
+	}
+	if( ( has_header_range != 0 )
+	 || ( has_unbounded_range != 0 ) )
+	{
+		file_offset = (off64_t) header_range_start;
+
+		if( has_unbounded_range == 0 )
+		{
+			file_size = header_range_end;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: scanning range: %" PRIi64 " - %" PRIu64 " for signatures.\n",
+			 function,
+			 file_offset,
+			 file_size );
+		}
+#endif
+		/* The unbounded range is scanned in chunks on multiple threads if it is larger than the scan chunk size
+		 */
+		if( ( scan_in_chunks != 0 )
+		 && ( has_unbounded_range != 0 )
+		 && ( internal_scanner->scan_chunk_size > 0 )
+		 && ( ( file_size - (size64_t) file_offset ) > internal_scanner->scan_chunk_size ) )
+		{
+			number_of_threads = internal_scanner->number_of_threads;
+
+			if( number_of_threads == 0 )
+			{
+				if( libsigscan_thread_pool_get_default_number_of_threads(
+				     &number_of_threads,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve default number of threads.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		if( number_of_threads > 1 )
+		{
+			if( libsigscan_internal_scanner_scan_file_io_handle_in_chunks(
+			     internal_scanner,
+			     scan_state,
+			     file_io_handle,
+			     mapped_data,
+			     sparse_file,
+			     file_size,
+			     file_offset,
+			     file_size,
+			     buffer_size,
+			     number_of_threads,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan range in chunks.",
+				 function );
+
+				goto on_error;
+			}
+			scan_is_complete = libsigscan_scan_state_is_complete(
+			                    scan_state,
+			                    error );
+
+			if( scan_is_complete == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if scan state is complete.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		/* The range is read ahead by a reader thread while it is scanned
+		 */
+		else if( ( mapped_data == NULL )
+		      && ( scan_in_chunks != 0 )
+		      && ( internal_scanner->number_of_read_ahead_buffers > 0 ) )
+		{
+			if( libsigscan_internal_scanner_scan_file_io_handle_with_read_ahead(
+			     internal_scanner,
+			     scan_state,
+			     file_io_handle,
+			     sparse_file,
+			     file_offset,
+			     file_size,
+			     buffer_size,
+			     &scan_is_complete,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan range with read-ahead.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+		else
+		{
+			if( mapped_data == NULL )
+			{
+				if( libbfio_handle_seek_offset(
+				     file_io_handle,
+				     file_offset,
+				     SEEK_SET,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_SEEK_FAILED,
+					 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 file_offset,
+					 file_offset );
+
+					goto on_error;
+				}
+			}
+#if defined( LIBSIGSCAN_SCANNER_HAVE_MADVISE )
+			released_offset = file_offset - ( file_offset % LIBSIGSCAN_SCANNER_MAPPED_DATA_RELEASE_SIZE );
+#endif
+			while( (size64_t) file_offset < file_size )
+			{
+				if( file_offset >= range_end_offset )
+				{
+					range_end_offset = (off64_t) file_size;
+
+					/* The holes in the range are skipped
+					 */
+					if( sparse_file != NULL )
+					{
+						if( libsigscan_sparse_file_get_scan_range(
+						     sparse_file,
+						     file_offset,
+						     (off64_t) file_size,
+						     &file_offset,
+						     &range_end_offset,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+							 "%s: unable to retrieve scan range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+							 function,
+							 file_offset,
+							 file_offset );
+
+							goto on_error;
+						}
+						if( (size64_t) file_offset >= file_size )
+						{
+							break;
+						}
+						if( mapped_data == NULL )
+						{
+							if( libbfio_handle_seek_offset(
+							     file_io_handle,
+							     file_offset,
+							     SEEK_SET,
+							     error ) == -1 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_IO,
+								 LIBCERROR_IO_ERROR_SEEK_FAILED,
+								 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+								 function,
+								 file_offset,
+								 file_offset );
+
+								goto on_error;
+							}
+						}
+					}
+				}
+				if( (off64_t) buffer_size > ( range_end_offset - file_offset ) )
+				{
+					read_size = (size_t) ( range_end_offset - file_offset );
+				}
+				else
+				{
+					read_size = buffer_size;
+				}
+				if( mapped_data != NULL )
+				{
+					scan_data = &( mapped_data[ file_offset ] );
+				}
+				else
+				{
+					read_count = libbfio_handle_read_buffer(
+						      file_io_handle,
+						      buffer,
+						      read_size,
+						      error );
+
+					if( read_count != (ssize_t) read_size )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read buffer.",
+						 function );
+
+						goto on_error;
+					}
+					scan_data = buffer;
+				}
+				if( libsigscan_scan_state_scan_buffer(
+				     scan_state,
+				     file_offset,
+				     scan_data,
+				     read_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to scan buffer.",
+					 function );
+
+					goto on_error;
+				}
+				file_offset += read_size;
+
+#if defined( LIBSIGSCAN_SCANNER_HAVE_MADVISE )
+				/* The mapped data that has been scanned is released to bound the resident memory
+				 */
+				if( ( mapped_data != NULL )
+				 && ( ( file_offset - released_offset ) >= LIBSIGSCAN_SCANNER_MAPPED_DATA_RELEASE_SIZE ) )
+				{
+					release_size  = file_offset - released_offset;
+					release_size -= release_size % LIBSIGSCAN_SCANNER_MAPPED_DATA_RELEASE_SIZE;
+
+					/* The release is advisory hence failure is ignored
+					 */
+					madvise(
+					 (void *) &( mapped_data[ released_offset ] ),
+					 (size_t) release_size,
+					 MADV_DONTNEED );
+
+					released_offset += release_size;
+				}
+#endif
+				scan_is_complete = libsigscan_scan_state_is_complete(
+				                    scan_state,
+				                    error );
+
+				if( scan_is_complete == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine if scan state is complete.",
+					 function );
+
+					goto on_error;
+				}
+				else if( scan_is_complete != 0 )
+				{
+					break;
+				}
+			}
+		}
+	}
+	if( ( scan_is_complete == 0 )
+	 && ( has_offset_range != 0 ) )
+	{
+		if( libsigscan_scan_state_flush(
+		     scan_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to flush scan state.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: scanning offset range: %" PRIu64 " - %" PRIu64 " for signatures.\n",
+			 function,
+			 offset_range_start,
+			 offset_range_end );
+		}
+#endif
+		file_offset = (off64_t) offset_range_start;
+
+		if( mapped_data == NULL )
+		{
+			if( libbfio_handle_seek_offset(
+			     file_io_handle,
+			     file_offset,
+			     SEEK_SET,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek offset range offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+		}
+		while( (size64_t) file_offset < offset_range_end )
+		{
+			if( buffer_size > ( offset_range_end - file_offset ) )
+			{
+				read_size = (size_t) ( offset_range_end - file_offset );
+			}
+			else
+			{
+				read_size = buffer_size;
+			}
+			if( mapped_data != NULL )
+			{
+				scan_data = &( mapped_data[ file_offset ] );
+			}
+			else
+			{
+				read_count = libbfio_handle_read_buffer(
+					      file_io_handle,
+					      buffer,
+					      read_size,
+					      error );
+
+				if( read_count != (ssize_t) read_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read buffer.",
+					 function );
+
+					goto on_error;
+				}
+				scan_data = buffer;
+			}
+			if( libsigscan_scan_state_scan_buffer(
+			     scan_state,
+			     file_offset,
+			     scan_data,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan buffer.",
+				 function );
+
+				goto on_error;
+			}
+			file_offset += read_size;
+
+			scan_is_complete = libsigscan_scan_state_is_complete(
+			                    scan_state,
+			                    error );
+
+			if( scan_is_complete == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if scan state is complete.",
+				 function );
+
+				goto on_error;
+			}
+			else if( scan_is_complete != 0 )
+			{
+				break;
+			}
+		}
+	}
+	if( ( scan_is_complete == 0 )
+	 && ( has_footer_range != 0 )
+	 && ( footer_range_size > 0 ) )
+	{
+		if( libsigscan_scan_state_flush(
+		     scan_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to flush scan state.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: scanning footer range: %" PRIu64 " - %" PRIu64 " for signatures.\n",
+			 function,
+			 footer_range_start,
+			 footer_range_end );
+		}
+#endif
+		file_offset = (off64_t) footer_range_start;
+
+		if( mapped_data == NULL )
+		{
+			if( libbfio_handle_seek_offset(
+			     file_io_handle,
+			     file_offset,
+			     SEEK_SET,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek footer range offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+		}
+		while( (size64_t) file_offset < footer_range_end )
+		{
+			if( buffer_size > ( footer_range_end - file_offset ) )
+			{
+				read_size = (size_t) ( footer_range_end - file_offset );
+			}
+			else
+			{
+				read_size = buffer_size;
+			}
+			if( mapped_data != NULL )
+			{
+				scan_data = &( mapped_data[ file_offset ] );
+			}
+			else
+			{
+				read_count = libbfio_handle_read_buffer(
+					      file_io_handle,
+					      buffer,
+					      read_size,
+					      error );
+
+				if( read_count != (ssize_t) read_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read buffer.",
+					 function );
+
+					goto on_error;
+				}
+				scan_data = buffer;
+			}
+			if( libsigscan_scan_state_scan_buffer(
+			     scan_state,
+			     file_offset,
+			     scan_data,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan buffer.",
+				 function );
+
+				goto on_error;
+			}
+			file_offset += read_size;
+
+			scan_is_complete = libsigscan_scan_state_is_complete(
+			                    scan_state,
+			                    error );
+
+			if( scan_is_complete == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if scan state is complete.",
+				 function );
+
+				goto on_error;
+			}
+			else if( scan_is_complete != 0 )
+			{
+				break;
+			}
+		}
+	}
+	if( libsigscan_scanner_scan_stop(
+	     (libsigscan_scanner_t *) internal_scanner,
+	     scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan state.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( mapped_data == NULL )
+	 && ( file_io_handle_is_open == 0 ) )
+	{
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+/* TODO set scan state to error ? */
+	if( ( mapped_data == NULL )
+	 && ( file_io_handle_is_open == 0 ) )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans a file that is mapped into memory
+ * The data is scanned directly from the mapping, without being copied into a scan buffer
+ * If a sparse file is provided the holes of the file are skipped
+ * Returns 1 if successful, 0 if the file could not be mapped or -1 on error
+ */
+int libsigscan_internal_scanner_scan_mapped_file(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_scan_state_t *scan_state,
+     const char *filename,
+     libsigscan_sparse_file_t *sparse_file,
+     uint8_t scan_in_chunks,
+     libcerror_error_t **error )
+{
+#if defined( LIBSIGSCAN_SCANNER_HAVE_MMAP )
+	struct stat file_statistics;
+
+	void *data            = NULL;
+	size_t data_size      = 0;
+	int file_descriptor   = -1;
+	int result            = 0;
+#endif
+	static char *function = "libsigscan_internal_scanner_scan_mapped_file";
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBSIGSCAN_SCANNER_HAVE_MMAP )
+	/* If the file cannot be mapped it is scanned using a file IO handle instead,
+	 * which also reports why the file could not be opened if that is the case
+	 */
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	/* Only regular files of a size that can be mapped are mapped, an empty file cannot be mapped
+	 */
+	if( !S_ISREG( file_statistics.st_mode )
+	 || ( file_statistics.st_size <= 0 )
+	 || ( (size64_t) file_statistics.st_size > (size64_t) SSIZE_MAX ) )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	data_size = (size_t) file_statistics.st_size;
+
+	data = mmap(
+	        NULL,
+	        data_size,
+	        PROT_READ,
+	        MAP_PRIVATE,
+	        file_descriptor,
+	        0 );
+
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	close(
+	 file_descriptor );
+
+	if( data == MAP_FAILED )
+	{
+		return( 0 );
+	}
+#if defined( LIBSIGSCAN_SCANNER_HAVE_MADVISE )
+	/* The advice is a hint hence failure is ignored
+	 */
+	madvise(
+	 data,
+	 data_size,
+	 MADV_SEQUENTIAL );
+#endif
+	result = libsigscan_internal_scanner_scan_file_io_handle(
+	          internal_scanner,
+	          scan_state,
+	          NULL,
+	          (uint8_t *) data,
+	          (size64_t) data_size,
+	          sparse_file,
+	          NULL,
+	          internal_scanner->buffer_size,
+	          scan_in_chunks,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan mapped file: %s.",
+		 function,
+		 filename );
+
+		result = -1;
+	}
+	if( munmap(
+	     data,
+	     data_size ) != 0 )
+	{
+		if( result == 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to unmap file: %s.",
+			 function,
+			 filename );
+		}
+		result = -1;
+	}
+	return( result );
+#else
+	return( 0 );
+#endif /* defined( LIBSIGSCAN_SCANNER_HAVE_MMAP ) */
+}
+
+/* Scans a file using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_scan_file_io_handle(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	uint8_t *buffer                                 = NULL;
+	static char *function                           = "libsigscan_scanner_scan_file_io_handle";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	if( ( internal_scanner->buffer_size == 0 )
+	 || ( internal_scanner->buffer_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scanner - buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * internal_scanner->buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_internal_scanner_scan_file_io_handle(
+	     internal_scanner,
+	     scan_state,
+	     file_io_handle,
+	     NULL,
+	     0,
+	     NULL,
+	     buffer,
+	     internal_scanner->buffer_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan file IO handle.",
+		 function );
+
+		memory_free(
+		 buffer );
+
+		return( -1 );
+	}
+	memory_free(
 	 buffer );
 
-	buffer = NULL;
+	return( 1 );
+}
+
+/* Scans the files of a group
+ * Every file is scanned with its own scan state, the file IO handle and buffer
+ * of the group are reused for every file that is not mapped into memory
+ * The files that are not scanned after abort was signalled have no scan state
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_scan_file_group(
+     libsigscan_scanner_scan_file_group_t *scan_file_group,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle       = NULL;
+	libcerror_error_t *file_error          = NULL;
+	libsigscan_scan_state_t *scan_state    = NULL;
+	libsigscan_sparse_file_t *sparse_file  = NULL;
+	static char *function                  = "libsigscan_internal_scanner_scan_file_group";
+	size_t filename_length                 = 0;
+	int abort                              = 0;
+	int file_index                         = 0;
+	int result                             = 0;
+
+	if( scan_file_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan file group.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_file_group->scan_states == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan file group - missing scan states.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_file_group->filenames == NULL )
+	 && ( scan_file_group->wide_filenames == NULL )
+	 && ( scan_file_group->file_io_handles == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan file group - missing files.",
+		 function );
+
+		return( -1 );
+	}
+	for( file_index = 0;
+	     file_index < scan_file_group->number_of_files;
+	     file_index++ )
+	{
+		scan_file_group->scan_states[ file_index ] = NULL;
+	}
+	for( file_index = 0;
+	     file_index < scan_file_group->number_of_files;
+	     file_index++ )
+	{
+		/* The remaining files of the group are not scanned after abort was signalled
+		 */
+		if( libsigscan_internal_scanner_get_abort(
+		     scan_file_group->internal_scanner,
+		     &abort,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve abort.",
+			 function );
+
+			goto on_error;
+		}
+		if( abort != 0 )
+		{
+			break;
+		}
+		if( libsigscan_scan_state_initialize(
+		     &scan_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan state: %d.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( scan_file_group->settings_scan_state != NULL )
+		{
+			if( libsigscan_scan_state_copy_settings(
+			     scan_state,
+			     scan_file_group->settings_scan_state,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to copy settings to scan state: %d.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+		}
+		/* A file that cannot be opened or read does not stop the scan of the other files
+		 */
+		result = 1;
+
+		if( scan_file_group->file_io_handles != NULL )
+		{
+			file_io_handle = scan_file_group->file_io_handles[ file_index ];
+		}
+		else
+		{
+			file_io_handle = scan_file_group->file_io_handle;
+
+			if( scan_file_group->filenames != NULL )
+			{
+				result = 0;
+
+				/* The holes of the file are skipped if the file is sparse
+				 */
+				if( scan_file_group->sparse_file != NULL )
+				{
+					result = libsigscan_sparse_file_open(
+					          scan_file_group->sparse_file,
+					          scan_file_group->filenames[ file_index ],
+					          &file_error );
+
+					if( result == 1 )
+					{
+						sparse_file = scan_file_group->sparse_file;
+					}
+				}
+				/* The file is mapped into memory if supported by the system and the I/O strategy
+				 */
+				if( ( result != -1 )
+				 && ( scan_file_group->internal_scanner->io_strategy == LIBSIGSCAN_IO_STRATEGY_MAPPED ) )
+				{
+					result = libsigscan_internal_scanner_scan_mapped_file(
+					          scan_file_group->internal_scanner,
+					          scan_state,
+					          scan_file_group->filenames[ file_index ],
+					          sparse_file,
+					          0,
+					          &file_error );
+				}
+				else if( result == 1 )
+				{
+					result = 0;
+				}
+				if( result != 0 )
+				{
+					file_io_handle = NULL;
+				}
+				else
+				{
+					filename_length = narrow_string_length(
+					                   scan_file_group->filenames[ file_index ] );
+
+#if defined( LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX )
+					if( scan_file_group->io_handle != NULL )
+					{
+						result = libsigscan_file_io_handle_set_name(
+						          scan_file_group->io_handle,
+						          scan_file_group->filenames[ file_index ],
+						          filename_length + 1,
+						          &file_error );
+					}
+					else
+#endif
+					{
+						result = libbfio_file_set_name(
+						          file_io_handle,
+						          scan_file_group->filenames[ file_index ],
+						          filename_length + 1,
+						          &file_error );
+					}
+				}
+			}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+			else
+			{
+				filename_length = wide_string_length(
+				                   scan_file_group->wide_filenames[ file_index ] );
+
+				result = libbfio_file_set_name_wide(
+				          file_io_handle,
+				          scan_file_group->wide_filenames[ file_index ],
+				          filename_length + 1,
+				          &file_error );
+			}
+#endif
+		}
+		if( ( result == 1 )
+		 && ( file_io_handle != NULL ) )
+		{
+			result = libsigscan_internal_scanner_scan_file_io_handle(
+			          scan_file_group->internal_scanner,
+			          scan_state,
+			          file_io_handle,
+			          NULL,
+			          0,
+			          sparse_file,
+			          scan_file_group->buffer,
+			          scan_file_group->buffer_size,
+			          0,
+			          &file_error );
+		}
+		if( sparse_file != NULL )
+		{
+			if( libsigscan_sparse_file_close(
+			     sparse_file,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close sparse file: %d.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+			sparse_file = NULL;
+		}
+		if( result != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to scan file: %d.\n",
+				 function,
+				 file_index );
+
+				if( file_error != NULL )
+				{
+					libcnotify_print_error_backtrace(
+					 file_error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 &file_error );
+
+			if( libsigscan_scan_state_free(
+			     &scan_state,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free scan state: %d.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+		}
+		scan_file_group->scan_states[ file_index ] = scan_state;
+
+		scan_state = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( sparse_file != NULL )
+	{
+		libsigscan_sparse_file_close(
+		 sparse_file,
+		 NULL );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	for( file_index = 0;
+	     file_index < scan_file_group->number_of_files;
+	     file_index++ )
+	{
+		if( scan_file_group->scan_states[ file_index ] != NULL )
+		{
+			libsigscan_scan_state_free(
+			 &( scan_file_group->scan_states[ file_index ] ),
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Scans multiple files on multiple threads
+ * The files are scanned in groups of consecutive files, per round of groups the callback function
+ * is called by the calling thread for every file in order. The callback function is called with
+ * the scan state of the file or NULL if the file could not be scanned or was skipped after
+ * abort was signalled
+ * Returns 1 if successful, 0 if the callback function stopped the scan or -1 on error or abort
+ */
+int libsigscan_internal_scanner_scan_files(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_scan_state_t *scan_state,
+     const char **filenames,
+     const wchar_t **wide_filenames,
+     libbfio_handle_t **file_io_handles,
+     int number_of_files,
+     int (*callback_function)(
+            int file_index,
+            libsigscan_scan_state_t *scan_state,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	intptr_t **scan_file_group_values                      = NULL;
+	libsigscan_scan_state_t **scan_states                  = NULL;
+	libsigscan_scanner_scan_file_group_t *scan_file_group  = NULL;
+	libsigscan_scanner_scan_file_group_t *scan_file_groups = NULL;
+	libsigscan_thread_pool_t *thread_pool                  = NULL;
+	static char *function                                  = "libsigscan_internal_scanner_scan_files";
+	int abort                                              = 0;
+	int file_index                                         = 0;
+	int files_per_group                                    = 0;
+	int maximum_number_of_groups                           = 0;
+	int number_of_groups                                   = 0;
+	int number_of_round_files                              = 0;
+	int number_of_threads                                  = 0;
+	int result                                             = 1;
+	int round_file_index                                   = 0;
+	int scan_file_group_index                              = 0;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filenames == NULL )
+	 && ( wide_filenames == NULL )
+	 && ( file_io_handles == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid files.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_files < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of files value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_scanner->buffer_size == 0 )
+	 || ( internal_scanner->buffer_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scanner - buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The scan trees are shared by the threads hence the scanner must be read-only
+	 */
+	if( internal_scanner->is_compiled == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scanner - scanner not compiled.",
+		 function );
+
+		return( -1 );
+	}
+	/* An abort signalled during a previous scan does not affect this scan
+	 */
+	if( libsigscan_internal_scanner_set_abort(
+	     internal_scanner,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset abort.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_files == 0 )
+	{
+		return( 1 );
+	}
+	number_of_threads = internal_scanner->number_of_threads;
+
+	if( number_of_threads == 0 )
+	{
+		if( libsigscan_thread_pool_get_default_number_of_threads(
+		     &number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve default number of threads.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Small batches are spread over all the groups, large batches are scanned
+	 * in groups of the maximum group size to reduce the overhead per file
+	 */
+	maximum_number_of_groups = number_of_threads * LIBSIGSCAN_SCANNER_SCAN_FILES_NUMBER_OF_GROUPS_PER_THREAD;
+
+	files_per_group = number_of_files / maximum_number_of_groups;
+
+	if( files_per_group < 1 )
+	{
+		files_per_group = 1;
+	}
+	else if( files_per_group > LIBSIGSCAN_SCANNER_SCAN_FILES_MAXIMUM_GROUP_SIZE )
+	{
+		files_per_group = LIBSIGSCAN_SCANNER_SCAN_FILES_MAXIMUM_GROUP_SIZE;
+	}
+	if( maximum_number_of_groups > ( ( number_of_files + files_per_group - 1 ) / files_per_group ) )
+	{
+		maximum_number_of_groups = ( number_of_files + files_per_group - 1 ) / files_per_group;
+	}
+	scan_file_groups = (libsigscan_scanner_scan_file_group_t *) memory_allocate(
+	                                                             sizeof( libsigscan_scanner_scan_file_group_t ) * maximum_number_of_groups );
+
+	if( scan_file_groups == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan file groups.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     scan_file_groups,
+	     0,
+	     sizeof( libsigscan_scanner_scan_file_group_t ) * maximum_number_of_groups ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan file groups.",
+		 function );
+
+		memory_free(
+		 scan_file_groups );
+
+		scan_file_groups = NULL;
+
+		goto on_error;
+	}
+	scan_file_group_values = (intptr_t **) memory_allocate(
+	                                        sizeof( intptr_t * ) * maximum_number_of_groups );
+
+	if( scan_file_group_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan file group values.",
+		 function );
+
+		goto on_error;
+	}
+	scan_states = (libsigscan_scan_state_t **) memory_allocate(
+	                                            sizeof( libsigscan_scan_state_t * ) * maximum_number_of_groups * files_per_group );
+
+	if( scan_states == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan states.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     scan_states,
+	     0,
+	     sizeof( libsigscan_scan_state_t * ) * maximum_number_of_groups * files_per_group ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan states.",
+		 function );
+
+		goto on_error;
+	}
+	/* The buffer and file IO handle of a group are reused for every round
+	 */
+	for( scan_file_group_index = 0;
+	     scan_file_group_index < maximum_number_of_groups;
+	     scan_file_group_index++ )
+	{
+		scan_file_group = &( scan_file_groups[ scan_file_group_index ] );
+
+		scan_file_group->internal_scanner    = internal_scanner;
+		scan_file_group->settings_scan_state = scan_state;
+		scan_file_group->buffer_size         = internal_scanner->buffer_size;
+		scan_file_group->scan_states         = &( scan_states[ scan_file_group_index * files_per_group ] );
+
+		scan_file_group->buffer = (uint8_t *) memory_allocate(
+		                                       sizeof( uint8_t ) * scan_file_group->buffer_size );
+
+		if( scan_file_group->buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create scan file group: %d buffer.",
+			 function,
+			 scan_file_group_index );
+
+			goto on_error;
+		}
+		/* Files scanned by name are read using the I/O strategy of the scanner,
+		 * files scanned by wide name are read using a libbfio file
+		 */
+#if defined( LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX )
+		if( ( filenames != NULL )
+		 && ( ( internal_scanner->io_strategy == LIBSIGSCAN_IO_STRATEGY_BUFFERED )
+		  || ( internal_scanner->io_strategy == LIBSIGSCAN_IO_STRATEGY_DIRECT ) ) )
+		{
+			if( libsigscan_file_io_handle_initialize_bfio_handle(
+			     &( scan_file_group->file_io_handle ),
+			     &( scan_file_group->io_handle ),
+			     internal_scanner->io_strategy,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create scan file group: %d file IO handle.",
+				 function,
+				 scan_file_group_index );
+
+				goto on_error;
+			}
+		}
+		else
+#endif
+		if( file_io_handles == NULL )
+		{
+			if( libbfio_file_initialize(
+			     &( scan_file_group->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create scan file group: %d file IO handle.",
+				 function,
+				 scan_file_group_index );
+
+				goto on_error;
+			}
+		}
+		/* The holes of sparse files scanned by name are skipped
+		 */
+		if( filenames != NULL )
+		{
+			if( libsigscan_sparse_file_initialize(
+			     &( scan_file_group->sparse_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create scan file group: %d sparse file.",
+				 function,
+				 scan_file_group_index );
+
+				goto on_error;
+			}
+		}
+		scan_file_group_values[ scan_file_group_index ] = (intptr_t *) scan_file_group;
+	}
+	if( libsigscan_thread_pool_initialize(
+	     &thread_pool,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	file_index = 0;
+
+	while( file_index < number_of_files )
+	{
+		if( libsigscan_internal_scanner_get_abort(
+		     internal_scanner,
+		     &abort,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve abort.",
+			 function );
+
+			goto on_error;
+		}
+		if( abort != 0 )
+		{
+			break;
+		}
+		number_of_groups = 0;
+
+		for( round_file_index = file_index;
+		     ( round_file_index < number_of_files ) && ( number_of_groups < maximum_number_of_groups );
+		     round_file_index += files_per_group )
+		{
+			scan_file_group = &( scan_file_groups[ number_of_groups ] );
+
+			scan_file_group->number_of_files = number_of_files - round_file_index;
+
+			if( scan_file_group->number_of_files > files_per_group )
+			{
+				scan_file_group->number_of_files = files_per_group;
+			}
+			scan_file_group->filenames       = NULL;
+			scan_file_group->wide_filenames  = NULL;
+			scan_file_group->file_io_handles = NULL;
+
+			if( filenames != NULL )
+			{
+				scan_file_group->filenames = &( filenames[ round_file_index ] );
+			}
+			else if( wide_filenames != NULL )
+			{
+				scan_file_group->wide_filenames = &( wide_filenames[ round_file_index ] );
+			}
+			else
+			{
+				scan_file_group->file_io_handles = &( file_io_handles[ round_file_index ] );
+			}
+			number_of_groups++;
+		}
+		number_of_round_files = round_file_index - file_index;
+
+		if( number_of_round_files > ( number_of_files - file_index ) )
+		{
+			number_of_round_files = number_of_files - file_index;
+		}
+		if( libsigscan_thread_pool_run_values(
+		     thread_pool,
+		     (int (*)(intptr_t *, libcerror_error_t **)) &libsigscan_internal_scanner_scan_file_group,
+		     scan_file_group_values,
+		     number_of_groups,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan file groups.",
+			 function );
+
+			goto on_error;
+		}
+		/* The groups of a round are consecutive hence the scan states are in file order
+		 */
+		for( round_file_index = 0;
+		     round_file_index < number_of_round_files;
+		     round_file_index++ )
+		{
+			if( result == 1 )
+			{
+				result = callback_function(
+				          file_index + round_file_index,
+				          scan_states[ round_file_index ],
+				          callback_data );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to process scan results of file: %d.",
+					 function,
+					 file_index + round_file_index );
+
+					goto on_error;
+				}
+			}
+			if( scan_states[ round_file_index ] != NULL )
+			{
+				if( libsigscan_scan_state_free(
+				     &( scan_states[ round_file_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free scan state of file: %d.",
+					 function,
+					 file_index + round_file_index );
+
+					goto on_error;
+				}
+			}
+		}
+		if( result == 0 )
+		{
+			break;
+		}
+		file_index += number_of_round_files;
+	}
+	/* The files that were not scanned because abort was signalled are reported
+	 * to the callback function without a scan state
+	 */
+	if( abort != 0 )
+	{
+		while( ( result == 1 )
+		    && ( file_index < number_of_files ) )
+		{
+			result = callback_function(
+			          file_index,
+			          NULL,
+			          callback_data );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to process scan results of file: %d.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+			file_index++;
+		}
+	}
+	if( libsigscan_thread_pool_free(
+	     &thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( scan_file_group_index = 0;
+	     scan_file_group_index < maximum_number_of_groups;
+	     scan_file_group_index++ )
+	{
+		scan_file_group = &( scan_file_groups[ scan_file_group_index ] );
+
+		if( scan_file_group->file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( scan_file_group->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free scan file group: %d file IO handle.",
+				 function,
+				 scan_file_group_index );
+
+				goto on_error;
+			}
+		}
+		if( scan_file_group->sparse_file != NULL )
+		{
+			if( libsigscan_sparse_file_free(
+			     &( scan_file_group->sparse_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free scan file group: %d sparse file.",
+				 function,
+				 scan_file_group_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 scan_file_group->buffer );
+
+		scan_file_group->buffer = NULL;
+	}
+	memory_free(
+	 scan_states );
+
+	memory_free(
+	 scan_file_group_values );
+
+	memory_free(
+	 scan_file_groups );
+
+	if( ( abort != 0 )
+	 && ( result == 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: scan aborted.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	if( thread_pool != NULL )
+	{
+		libsigscan_thread_pool_free(
+		 &thread_pool,
+		 NULL );
+	}
+	if( scan_states != NULL )
+	{
+		for( round_file_index = 0;
+		     round_file_index < ( maximum_number_of_groups * files_per_group );
+		     round_file_index++ )
+		{
+			if( scan_states[ round_file_index ] != NULL )
+			{
+				libsigscan_scan_state_free(
+				 &( scan_states[ round_file_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 scan_states );
+	}
+	if( scan_file_groups != NULL )
+	{
+		for( scan_file_group_index = 0;
+		     scan_file_group_index < maximum_number_of_groups;
+		     scan_file_group_index++ )
+		{
+			scan_file_group = &( scan_file_groups[ scan_file_group_index ] );
+
+			if( scan_file_group->file_io_handle != NULL )
+			{
+				libbfio_handle_free(
+				 &( scan_file_group->file_io_handle ),
+				 NULL );
+			}
+			if( scan_file_group->sparse_file != NULL )
+			{
+				libsigscan_sparse_file_free(
+				 &( scan_file_group->sparse_file ),
+				 NULL );
+			}
+			if( scan_file_group->buffer != NULL )
+			{
+				memory_free(
+				 scan_file_group->buffer );
+			}
+		}
+		memory_free(
+		 scan_file_groups );
+	}
+	if( scan_file_group_values != NULL )
+	{
+		memory_free(
+		 scan_file_group_values );
+	}
+	return( -1 );
+}
+
+/* Scans multiple files on multiple threads
+ * Returns 1 if successful, 0 if the callback function stopped the scan or -1 on error or abort
+ */
+int libsigscan_scanner_scan_files(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     const char **filenames,
+     int number_of_files,
+     int (*callback_function)(
+            int file_index,
+            libsigscan_scan_state_t *scan_state,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scanner_scan_files";
+	int result            = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	result = libsigscan_internal_scanner_scan_files(
+	          (libsigscan_internal_scanner_t *) scanner,
+	          scan_state,
+	          filenames,
+	          NULL,
+	          NULL,
+	          number_of_files,
+	          callback_function,
+	          callback_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan files.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Scans multiple files on multiple threads
+ * Returns 1 if successful, 0 if the callback function stopped the scan or -1 on error or abort
+ */
+int libsigscan_scanner_scan_files_wide(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     const wchar_t **filenames,
+     int number_of_files,
+     int (*callback_function)(
+            int file_index,
+            libsigscan_scan_state_t *scan_state,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scanner_scan_files_wide";
+	int result            = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	result = libsigscan_internal_scanner_scan_files(
+	          (libsigscan_internal_scanner_t *) scanner,
+	          scan_state,
+	          NULL,
+	          filenames,
+	          NULL,
+	          number_of_files,
+	          callback_function,
+	          callback_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan files.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Scans multiple files using Basic File IO (bfio) handles on multiple threads
+ * Returns 1 if successful, 0 if the callback function stopped the scan or -1 on error or abort
+ */
+int libsigscan_scanner_scan_file_io_handles(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t **file_io_handles,
+     int number_of_files,
+     int (*callback_function)(
+            int file_index,
+            libsigscan_scan_state_t *scan_state,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_scanner_scan_file_io_handles";
+	int result            = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handles.",
+		 function );
+
+		return( -1 );
+	}
+	result = libsigscan_internal_scanner_scan_files(
+	          (libsigscan_internal_scanner_t *) scanner,
+	          scan_state,
+	          NULL,
+	          NULL,
+	          file_io_handles,
+	          number_of_files,
+	          callback_function,
+	          callback_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan file IO handles.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Frees the scan trees and the signatures
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_clear(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scanner_clear";
+	int result            = 1;
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_internal_scanner_free_scan_trees(
+	     internal_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free scan trees.",
+		 function );
+
+		result = -1;
+	}
+	/* The compiled file is freed after the scan trees since the scan trees can reference its data
+	 */
+	if( internal_scanner->compiled_file != NULL )
+	{
+		if( libsigscan_compiled_file_free(
+		     &( internal_scanner->compiled_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compiled file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcdata_list_empty(
+	     internal_scanner->signatures_list,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty signatures list.",
+		 function );
+
+		result = -1;
+	}
+	if( libcdata_list_empty(
+	     internal_scanner->range_signatures_list,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty offset range signatures list.",
+		 function );
+
+		result = -1;
+	}
+	internal_scanner->number_of_signatures = 0;
+
+	return( result );
+}
+
+/* Reads the signatures and scan trees from a compiled file
+ * The scanner takes over the management of the compiled file if successful
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_internal_scanner_read_compiled_file(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_compiled_file_t *compiled_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_internal_scanner_read_compiled_file";
+
+	if( internal_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_scanner->is_compiled != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - scanner is compiled and read-only.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_scanner->number_of_signatures != 0 )
+	 || ( internal_scanner->compiled_file != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - signatures already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_scanner->header_scan_tree != NULL )
+	 || ( internal_scanner->footer_scan_tree != NULL )
+	 || ( internal_scanner->scan_tree != NULL )
+	 || ( internal_scanner->range_scan_tree != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scanner - scan trees already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( compiled_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compiled file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_compiled_file_read_signatures(
+	     compiled_file,
+	     internal_scanner->signatures_list,
+	     internal_scanner->range_signatures_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read signatures.",
+		 function );
+
+		goto on_error;
+	}
+	internal_scanner->number_of_signatures  = (int) compiled_file->number_of_signatures;
+	internal_scanner->unbounded_scan_engine = compiled_file->unbounded_scan_engine;
+
+	if( libsigscan_scan_tree_initialize(
+	     &( internal_scanner->header_scan_tree ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create header scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_compiled_file_read_scan_tree(
+	     compiled_file,
+	     internal_scanner->header_scan_tree,
+	     internal_scanner->signatures_list,
+	     LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read header scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_tree_initialize(
+	     &( internal_scanner->footer_scan_tree ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create footer scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_compiled_file_read_scan_tree(
+	     compiled_file,
+	     internal_scanner->footer_scan_tree,
+	     internal_scanner->signatures_list,
+	     LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_END,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read footer scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_tree_initialize(
+	     &( internal_scanner->scan_tree ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_compiled_file_read_scan_tree(
+	     compiled_file,
+	     internal_scanner->scan_tree,
+	     internal_scanner->signatures_list,
+	     LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_tree_initialize(
+	     &( internal_scanner->range_scan_tree ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create offset range scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_compiled_file_read_scan_tree(
+	     compiled_file,
+	     internal_scanner->range_scan_tree,
+	     internal_scanner->range_signatures_list,
+	     LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read offset range scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	internal_scanner->compiled_file = compiled_file;
+
+	return( 1 );
+
+on_error:
+	libsigscan_internal_scanner_clear(
+	 internal_scanner,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads the signatures and scan trees from a compiled file
+ * The compiled file is mapped into memory if supported by the system
+ * The scanner should not contain any signatures
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_read_compiled_file(
+     libsigscan_scanner_t *scanner,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libsigscan_compiled_file_t *compiled_file = NULL;
+	static char *function                     = "libsigscan_scanner_read_compiled_file";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_compiled_file_initialize(
+	     &compiled_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compiled file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_compiled_file_open(
+	     compiled_file,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open compiled file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libsigscan_internal_scanner_read_compiled_file(
+	     (libsigscan_internal_scanner_t *) scanner,
+	     compiled_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compiled file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( compiled_file != NULL )
+	{
+		libsigscan_compiled_file_free(
+		 &compiled_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Reads the signatures and scan trees from a compiled file
+ * The scanner should not contain any signatures
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_read_compiled_file_wide(
+     libsigscan_scanner_t *scanner,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libsigscan_scanner_read_compiled_file_wide";
+	size_t filename_length           = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_read_compiled_file_io_handle(
+	     scanner,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compiled file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Reads the signatures and scan trees from a compiled file using a Basic File IO (bfio) handle
+ * The scanner should not contain any signatures
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_read_compiled_file_io_handle(
+     libsigscan_scanner_t *scanner,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libsigscan_compiled_file_t *compiled_file = NULL;
+	static char *function                     = "libsigscan_scanner_read_compiled_file_io_handle";
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_compiled_file_initialize(
+	     &compiled_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compiled file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_compiled_file_open_file_io_handle(
+	     compiled_file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open compiled file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_internal_scanner_read_compiled_file(
+	     (libsigscan_internal_scanner_t *) scanner,
+	     compiled_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compiled file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( compiled_file != NULL )
+	{
+		libsigscan_compiled_file_free(
+		 &compiled_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the signatures and scan trees to a compiled file
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_write_compiled_file(
+     libsigscan_scanner_t *scanner,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libsigscan_scanner_write_compiled_file";
+	size_t filename_length           = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_write_compiled_file_io_handle(
+	     scanner,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write compiled file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Writes the signatures and scan trees to a compiled file
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_write_compiled_file_wide(
+     libsigscan_scanner_t *scanner,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libsigscan_scanner_write_compiled_file_wide";
+	size_t filename_length           = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_write_compiled_file_io_handle(
+	     scanner,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write compiled file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Writes the signatures and scan trees to a compiled file using a Basic File IO (bfio) handle
+ * The scan trees are built if not yet set, or rebuilt if signatures were added after they were built
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_scanner_write_compiled_file_io_handle(
+     libsigscan_scanner_t *scanner,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libsigscan_internal_scanner_t *internal_scanner = NULL;
+	static char *function                           = "libsigscan_scanner_write_compiled_file_io_handle";
+	int file_io_handle_is_open                      = 0;
+
+	if( scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_scanner = (libsigscan_internal_scanner_t *) scanner;
+
+	/* The scan trees of a compiled scanner contain all the signatures
+	 */
+	if( internal_scanner->is_compiled == 0 )
+	{
+		if( libsigscan_internal_scanner_build_scan_trees(
+		     internal_scanner,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build scan trees.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_WRITE_TRUNCATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsigscan_compiled_file_write_file_header(
+	     file_io_handle,
+	     internal_scanner->unbounded_scan_engine,
+	     internal_scanner->number_of_signatures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_compiled_file_write_signatures(
+	     file_io_handle,
+	     internal_scanner->signatures_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write signatures.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_compiled_file_write_signatures(
+	     file_io_handle,
+	     internal_scanner->range_signatures_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write offset range signatures.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_compiled_file_write_scan_tree(
+	     file_io_handle,
+	     internal_scanner->header_scan_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write header scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_compiled_file_write_scan_tree(
+	     file_io_handle,
+	     internal_scanner->footer_scan_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write footer scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_compiled_file_write_scan_tree(
+	     file_io_handle,
+	     internal_scanner->scan_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write scan tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_compiled_file_write_scan_tree(
+	     file_io_handle,
+	     internal_scanner->range_scan_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write offset range scan tree.",
+		 function );
 
+		goto on_error;
+	}
 	if( file_io_handle_is_open == 0 )
 	{
+		file_io_handle_is_open = 1;
+
 		if( libbfio_handle_close(
 		     file_io_handle,
 		     error ) != 0 )
@@ -1445,12 +6853,6 @@ int libsigscan_scanner_scan_file_io_handle(
 	return( 1 );
 
 on_error:
-/* TODO set scan state to error ? */
-	if( buffer != NULL )
-	{
-		memory_free(
-		 buffer );
-	}
 	if( file_io_handle_is_open == 0 )
 	{
 		libbfio_handle_close(
@@ -25,17 +25,127 @@
 #include <common.h>
 #include <types.h>
 
+#include "libsigscan_compiled_file.h"
+#include "libsigscan_definitions.h"
 #include "libsigscan_extern.h"
+#include "libsigscan_file_io_handle.h"
 #include "libsigscan_libbfio.h"
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_scan_tree.h"
+#include "libsigscan_signature.h"
+#include "libsigscan_sparse_file.h"
 #include "libsigscan_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct libsigscan_scanner_scan_tree_build libsigscan_scanner_scan_tree_build_t;
+
+struct libsigscan_scanner_scan_tree_build
+{
+	/* The scan tree
+	 */
+	libsigscan_scan_tree_t *scan_tree;
+
+	/* The signatures list
+	 */
+	libcdata_list_t *signatures_list;
+
+	/* The pattern offsets mode
+	 */
+	int pattern_offsets_mode;
+
+	/* The scan engine used for unbounded signatures
+	 * Contains 0 if the scan tree is not the unbounded scan tree
+	 */
+	int unbounded_scan_engine;
+};
+
+typedef struct libsigscan_scanner_scan_chunk libsigscan_scanner_scan_chunk_t;
+
+struct libsigscan_scanner_scan_chunk
+{
+	/* The header (offset relative from start) scan tree
+	 */
+	libsigscan_scan_tree_t *header_scan_tree;
+
+	/* The footer (offset relative from start) scan tree
+	 */
+	libsigscan_scan_tree_t *footer_scan_tree;
+
+	/* The (unbounded) scan tree
+	 */
+	libsigscan_scan_tree_t *scan_tree;
+
+	/* The offset range scan tree
+	 */
+	libsigscan_scan_tree_t *range_scan_tree;
+
+	/* The offset range signatures list
+	 */
+	libcdata_list_t *range_signatures_list;
+
+	/* The number of signatures
+	 */
+	int number_of_signatures;
+
+	/* The file IO handle
+	 * Every chunk is read using its own file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The mapped data
+	 * Contains NULL if the chunk is read using the file IO handle
+	 */
+	const uint8_t *mapped_data;
+
+	/* The sparse file of which the holes in the chunk are skipped
+	 * Contains NULL if all the data of the chunk is scanned
+	 */
+	libsigscan_sparse_file_t *sparse_file;
+
+	/* The data size
+	 */
+	size64_t data_size;
+
+	/* The scan flags
+	 */
+	uint32_t scan_flags;
+
+	/* The chunk offset
+	 */
+	off64_t chunk_offset;
+
+	/* The chunk size
+	 */
+	size64_t chunk_size;
+
+	/* The overlap size
+	 * Contains the size of the data after the chunk that is scanned for matches that start within the chunk
+	 */
+	size64_t overlap_size;
+
+	/* The resume data offsets
+	 * Contains the data offsets from which the scan of the chunk starts, which are
+	 * the data offsets from which the scan of the chunk continues after it has been scanned
+	 */
+	off64_t resume_data_offsets[ LIBSIGSCAN_SCAN_STATE_NUMBER_OF_RESUME_DATA_OFFSETS ];
+
+	/* The (scan) buffer
+	 */
+	uint8_t *buffer;
+
+	/* The (scan) buffer size
+	 */
+	size_t buffer_size;
+
+	/* The scan state of the chunk
+	 */
+	libsigscan_scan_state_t *scan_state;
+};
+
 typedef struct libsigscan_internal_scanner libsigscan_internal_scanner_t;
 
 struct libsigscan_internal_scanner
@@ -48,6 +158,10 @@ struct libsigscan_internal_scanner
 	 */
 	libcdata_list_t *signatures_list;
 
+	/* The number of signatures
+	 */
+	int number_of_signatures;
+
 	/* The header (offset relative from start) scan tree
 	 */
 	libsigscan_scan_tree_t *header_scan_tree;
@@ -60,11 +174,116 @@ struct libsigscan_internal_scanner
 	 */
 	libsigscan_scan_tree_t *scan_tree;
 
+	/* The offset range signatures list
+	 */
+	libcdata_list_t *range_signatures_list;
+
+	/* The offset range scan tree
+	 */
+	libsigscan_scan_tree_t *range_scan_tree;
+
+	/* The compiled file the scan trees were read from
+	 */
+	libsigscan_compiled_file_t *compiled_file;
+
+	/* The scan engine used for unbounded signatures
+	 */
+	int unbounded_scan_engine;
+
+	/* The number of threads used to build the scan trees and to scan a file in chunks
+	 * 0 represents the number of online processors
+	 */
+	int number_of_threads;
+
+	/* The scan chunk size
+	 * Contains 0 if a file is not scanned in chunks
+	 */
+	size64_t scan_chunk_size;
+
+	/* The number of buffers that are read ahead by a reader thread
+	 * Contains 0 if the data is not read ahead
+	 */
+	int number_of_read_ahead_buffers;
+
+	/* The I/O strategy used to read the data of a file that is scanned by name
+	 */
+	int io_strategy;
+
+	/* Value to indicate the scanner was compiled
+	 * A compiled scanner is read-only and can be shared by multiple threads
+	 */
+	uint8_t is_compiled;
+
 	/* Value to indicate if abort was signalled
+	 * The value is accessed atomically, see libsigscan_internal_scanner_get_abort
 	 */
 	int abort;
 };
 
+typedef struct libsigscan_scanner_scan_file_group libsigscan_scanner_scan_file_group_t;
+
+struct libsigscan_scanner_scan_file_group
+{
+	/* The scanner
+	 */
+	libsigscan_internal_scanner_t *internal_scanner;
+
+	/* The scan state of which the scan flags and stop policy are used
+	 * Contains NULL if the defaults are used
+	 */
+	libsigscan_scan_state_t *settings_scan_state;
+
+	/* The filenames of the files in the group
+	 * Contains NULL if the files are not scanned by name
+	 */
+	const char **filenames;
+
+	/* The wide filenames of the files in the group
+	 * Contains NULL if the files are not scanned by wide name
+	 */
+	const wchar_t **wide_filenames;
+
+	/* The file IO handles of the files in the group
+	 * Contains NULL if the files are scanned by name
+	 */
+	libbfio_handle_t **file_io_handles;
+
+	/* The file IO handle used to scan the files by name
+	 * The file IO handle is reused for every file in the group
+	 */
+	libbfio_handle_t *file_io_handle;
+
+#if defined( LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX )
+	/* The I/O strategy file IO handle of the file IO handle
+	 * Contains NULL if the files are read using a libbfio file
+	 */
+	libsigscan_file_io_handle_t *io_handle;
+#endif
+
+	/* The sparse file used to skip the holes of the files scanned by name
+	 * The sparse file is reused for every file in the group
+	 */
+	libsigscan_sparse_file_t *sparse_file;
+
+	/* The scan states of the files in the group
+	 * A scan state contains NULL if the file could not be scanned
+	 */
+	libsigscan_scan_state_t **scan_states;
+
+	/* The number of files in the group
+	 */
+	int number_of_files;
+
+	/* The (scan) buffer
+	 * The buffer is reused for every file in the group
+	 */
+	uint8_t *buffer;
+
+	/* The (scan) buffer size
+	 */
+	size_t buffer_size;
+};
+
 LIBSIGSCAN_EXTERN \
 int libsigscan_scanner_initialize(
      libsigscan_scanner_t **scanner,
@@ -80,12 +299,52 @@ int libsigscan_scanner_signal_abort(
      libsigscan_scanner_t *scanner,
      libcerror_error_t **error );
 
+int libsigscan_internal_scanner_set_abort(
+     libsigscan_internal_scanner_t *internal_scanner,
+     int abort,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_get_abort(
+     libsigscan_internal_scanner_t *internal_scanner,
+     int *abort,
+     libcerror_error_t **error );
+
 LIBSIGSCAN_EXTERN \
 int libsigscan_scanner_set_scan_buffer_size(
      libsigscan_scanner_t *scanner,
      size_t scan_buffer_size,
      libcerror_error_t **error );
 
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_set_unbounded_scan_engine(
+     libsigscan_scanner_t *scanner,
+     int scan_engine,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_set_number_of_threads(
+     libsigscan_scanner_t *scanner,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_set_scan_chunk_size(
+     libsigscan_scanner_t *scanner,
+     size64_t scan_chunk_size,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_set_number_of_read_ahead_buffers(
+     libsigscan_scanner_t *scanner,
+     int number_of_read_ahead_buffers,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_set_io_strategy(
+     libsigscan_scanner_t *scanner,
+     int io_strategy,
+     libcerror_error_t **error );
+
 LIBSIGSCAN_EXTERN \
 int libsigscan_scanner_add_signature(
      libsigscan_scanner_t *scanner,
@@ -97,6 +356,41 @@ int libsigscan_scanner_add_signature(
      uint32_t signature_flags,
      libcerror_error_t **error );
 
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_add_range_signature(
+     libsigscan_scanner_t *scanner,
+     const char *identifier,
+     size_t identifier_length,
+     off64_t range_start_offset,
+     off64_t range_end_offset,
+     const uint8_t *pattern,
+     size_t pattern_size,
+     uint32_t signature_flags,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_free_scan_trees(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_insert_signature(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_signature_t *signature,
+     uint8_t is_range_signature,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_build_scan_tree(
+     libsigscan_scanner_scan_tree_build_t *scan_tree_build,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_build_scan_trees(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_compile(
+     libsigscan_scanner_t *scanner,
+     libcerror_error_t **error );
+
 LIBSIGSCAN_EXTERN \
 int libsigscan_scanner_scan_start(
      libsigscan_scanner_t *scanner,
@@ -135,6 +429,63 @@ int libsigscan_scanner_scan_file_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+int libsigscan_internal_scanner_get_spanning_size(
+     libsigscan_internal_scanner_t *internal_scanner,
+     size64_t *spanning_size,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_scan_chunk(
+     libsigscan_scanner_scan_chunk_t *scan_chunk,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_scan_file_io_handle_in_chunks(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *mapped_data,
+     libsigscan_sparse_file_t *sparse_file,
+     size64_t data_size,
+     off64_t range_offset,
+     size64_t range_end,
+     size_t buffer_size,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libsigscan_internal_scanner_scan_file_io_handle_with_read_ahead(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     libsigscan_sparse_file_t *sparse_file,
+     off64_t range_offset,
+     size64_t range_end,
+     size_t buffer_size,
+     int *scan_is_complete,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int libsigscan_internal_scanner_scan_file_io_handle(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *mapped_data,
+     size64_t mapped_data_size,
+     libsigscan_sparse_file_t *sparse_file,
+     uint8_t *buffer,
+     size_t buffer_size,
+     uint8_t scan_in_chunks,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_scan_mapped_file(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_scan_state_t *scan_state,
+     const char *filename,
+     libsigscan_sparse_file_t *sparse_file,
+     uint8_t scan_in_chunks,
+     libcerror_error_t **error );
+
 LIBSIGSCAN_EXTERN \
 int libsigscan_scanner_scan_file_io_handle(
      libsigscan_scanner_t *scanner,
@@ -142,6 +493,120 @@ int libsigscan_scanner_scan_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libsigscan_internal_scanner_scan_file_group(
+     libsigscan_scanner_scan_file_group_t *scan_file_group,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_scan_files(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_scan_state_t *scan_state,
+     const char **filenames,
+     const wchar_t **wide_filenames,
+     libbfio_handle_t **file_io_handles,
+     int number_of_files,
+     int (*callback_function)(
+            int file_index,
+            libsigscan_scan_state_t *scan_state,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_scan_files(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     const char **filenames,
+     int number_of_files,
+     int (*callback_function)(
+            int file_index,
+            libsigscan_scan_state_t *scan_state,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_scan_files_wide(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     const wchar_t **filenames,
+     int number_of_files,
+     int (*callback_function)(
+            int file_index,
+            libsigscan_scan_state_t *scan_state,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_scan_file_io_handles(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t **file_io_handles,
+     int number_of_files,
+     int (*callback_function)(
+            int file_index,
+            libsigscan_scan_state_t *scan_state,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_clear(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libcerror_error_t **error );
+
+int libsigscan_internal_scanner_read_compiled_file(
+     libsigscan_internal_scanner_t *internal_scanner,
+     libsigscan_compiled_file_t *compiled_file,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_read_compiled_file(
+     libsigscan_scanner_t *scanner,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_read_compiled_file_wide(
+     libsigscan_scanner_t *scanner,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_read_compiled_file_io_handle(
+     libsigscan_scanner_t *scanner,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_write_compiled_file(
+     libsigscan_scanner_t *scanner,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_write_compiled_file_wide(
+     libsigscan_scanner_t *scanner,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_write_compiled_file_io_handle(
+     libsigscan_scanner_t *scanner,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -719,6 +719,218 @@ on_error:
 	return( -1 );
 }
 
+/* Sets the signature offset range
+ * The range flags must contain the offset direction of the range
+ * If the range is relative from the start the range start offset must be smaller than the range end offset
+ * If the range is relative from the end the offsets are the distance to the end of the data
+ * and the range start offset must be larger than the range end offset
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_signature_set_range(
+     libsigscan_signature_t *signature,
+     off64_t range_start_offset,
+     off64_t range_end_offset,
+     uint32_t range_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_signature_set_range";
+	size64_t range_size   = 0;
+
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature->pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid signature - missing pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( signature->signature_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) != LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid signature - unsupported signature flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( range_start_offset < 0 )
+	 || ( range_end_offset < 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	switch( range_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK )
+	{
+		case LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START:
+			if( range_start_offset < range_end_offset )
+			{
+				range_size = (size64_t) ( range_end_offset - range_start_offset );
+			}
+			break;
+
+		case LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END:
+			if( range_start_offset > range_end_offset )
+			{
+				range_size = (size64_t) ( range_start_offset - range_end_offset );
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported range flags.",
+			 function );
+
+			return( -1 );
+	}
+	if( ( range_flags & ~( LIBSIGSCAN_SIGNATURE_FLAGS_MASK | LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RANGE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported range flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size < (size64_t) signature->pattern_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range size value too small for pattern.",
+		 function );
+
+		return( -1 );
+	}
+	signature->range_flags        = range_flags | LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RANGE;
+	signature->range_start_offset = range_start_offset;
+	signature->range_end_offset   = range_end_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the data range of the signature offset range
+ * The range start and end are relative from the start of the data
+ * Returns 1 if successful, 0 if the data does not contain the range or -1 on error
+ */
+int libsigscan_signature_get_data_range(
+     libsigscan_signature_t *signature,
+     size64_t data_size,
+     uint64_t *range_start,
+     uint64_t *range_end,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_signature_get_data_range";
+	uint64_t safe_start   = 0;
+	uint64_t safe_end     = 0;
+
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( signature->range_flags & LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RANGE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid signature - missing offset range.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_start == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range start.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_end == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range end.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( signature->range_flags & LIBSIGSCAN_SIGNATURE_FLAGS_MASK ) == LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END )
+	{
+		if( (size64_t) signature->range_end_offset >= data_size )
+		{
+			return( 0 );
+		}
+		if( (size64_t) signature->range_start_offset < data_size )
+		{
+			safe_start = data_size - (size64_t) signature->range_start_offset;
+		}
+		safe_end = data_size - (size64_t) signature->range_end_offset;
+	}
+	else
+	{
+		if( (size64_t) signature->range_start_offset >= data_size )
+		{
+			return( 0 );
+		}
+		safe_start = (uint64_t) signature->range_start_offset;
+		safe_end   = (uint64_t) signature->range_end_offset;
+
+		if( safe_end > data_size )
+		{
+			safe_end = data_size;
+		}
+	}
+	if( ( safe_end - safe_start ) < (uint64_t) signature->pattern_size )
+	{
+		return( 0 );
+	}
+	*range_start = safe_start;
+	*range_end   = safe_end;
+
+	return( 1 );
+}
+
 /* Checks if the signature matches the contents of the buffer
  * Returns 1 if successful, 0 if not or -1 on error
  */
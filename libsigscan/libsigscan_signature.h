@@ -53,6 +53,25 @@ struct libsigscan_signature
 	 */
 	uint32_t signature_flags;
 
+	/* The signature index
+	 * The index is unique within the scanner the signature was added to
+	 */
+	int signature_index;
+
+	/* The range flags
+	 * Contains LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RANGE and the offset direction
+	 * of the range or 0 if the signature is not bound to an offset range
+	 */
+	uint32_t range_flags;
+
+	/* The range start offset
+	 */
+	off64_t range_start_offset;
+
+	/* The range end offset
+	 */
+	off64_t range_end_offset;
+
 	/* The identifiers list
 	 */
 	libcdata_list_t *identifiers_list;
@@ -122,6 +141,20 @@ int libsigscan_signature_set(
      uint32_t signature_flags,
      libcerror_error_t **error );
 
+int libsigscan_signature_set_range(
+     libsigscan_signature_t *signature,
+     off64_t range_start_offset,
+     off64_t range_end_offset,
+     uint32_t range_flags,
+     libcerror_error_t **error );
+
+int libsigscan_signature_get_data_range(
+     libsigscan_signature_t *signature,
+     size64_t data_size,
+     uint64_t *range_start,
+     uint64_t *range_end,
+     libcerror_error_t **error );
+
 int libsigscan_signature_scan_buffer(
      libsigscan_signature_t *signature,
      int pattern_offsets_mode,
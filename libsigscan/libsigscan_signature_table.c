@@ -97,19 +97,22 @@ int libsigscan_signature_table_initialize(
 
 		return( -1 );
 	}
-	if( libcdata_list_initialize(
-	     &( ( *signature_table )->byte_value_groups_list ),
-	     error ) != 1 )
+	( *signature_table )->byte_value_groups = (libsigscan_byte_value_group_t **) memory_allocate(
+	                                                                              sizeof( libsigscan_byte_value_group_t * ) * 16 );
+
+	if( ( *signature_table )->byte_value_groups == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create byte values groups list.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create byte value groups.",
 		 function );
 
 		goto on_error;
 	}
+	( *signature_table )->number_of_allocated_byte_value_groups = 16;
+
 	if( libcdata_list_initialize(
 	     &( ( *signature_table )->signatures_list ),
 	     error ) != 1 )
@@ -128,12 +131,10 @@ int libsigscan_signature_table_initialize(
 on_error:
 	if( *signature_table != NULL )
 	{
-		if( ( *signature_table )->byte_value_groups_list != NULL )
+		if( ( *signature_table )->byte_value_groups != NULL )
 		{
-			libcdata_list_free(
-			 &( ( *signature_table )->byte_value_groups_list ),
-			 NULL,
-			 NULL );
+			memory_free(
+			 ( *signature_table )->byte_value_groups );
 		}
 		memory_free(
 		 *signature_table );
@@ -166,19 +167,23 @@ int libsigscan_signature_table_free(
 	}
 	if( *signature_table != NULL )
 	{
-		if( libcdata_list_free(
-		     &( ( *signature_table )->byte_value_groups_list ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_byte_value_group_free,
-		     error ) != 1 )
+		if( ( *signature_table )->byte_value_groups != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free byte value groups list.",
-			 function );
+			if( libsigscan_signature_table_empty_byte_value_groups(
+			     *signature_table,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to empty byte value groups.",
+				 function );
 
-			result = -1;
+				result = -1;
+			}
+			memory_free(
+			 ( *signature_table )->byte_value_groups );
 		}
 		if( libcdata_list_free(
 		     &( ( *signature_table )->signatures_list ),
@@ -355,11 +360,9 @@ int libsigscan_signature_table_fill(
 			}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-			if( libcdata_list_insert_value(
+			if( libcdata_list_append_value(
 			     signature_table->signatures_list,
 			     (intptr_t *) signature,
-			     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libsigscan_signature_compare_by_pattern,
-			     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -432,9 +435,8 @@ int libsigscan_signature_table_fill(
 	return( 1 );
 
 on_error:
-	libcdata_list_empty(
-	 signature_table->byte_value_groups_list,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_byte_value_group_free,
+	libsigscan_signature_table_empty_byte_value_groups(
+	 signature_table,
 	 NULL );
 
 	libcdata_list_empty(
@@ -445,6 +447,63 @@ on_error:
 	return( -1 );
 }
 
+/* Empties the byte value groups
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_signature_table_empty_byte_value_groups(
+     libsigscan_signature_table_t *signature_table,
+     libcerror_error_t **error )
+{
+	static char *function      = "libsigscan_signature_table_empty_byte_value_groups";
+	int byte_value_group_index = 0;
+	int result                 = 1;
+
+	if( signature_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature table.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature_table->byte_value_groups == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid signature table - missing byte value groups.",
+		 function );
+
+		return( -1 );
+	}
+	for( byte_value_group_index = 0;
+	     byte_value_group_index < signature_table->number_of_byte_value_groups;
+	     byte_value_group_index++ )
+	{
+		if( libsigscan_byte_value_group_free(
+		     &( signature_table->byte_value_groups[ byte_value_group_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free byte value group: %d.",
+			 function,
+			 byte_value_group_index );
+
+			result = -1;
+		}
+	}
+	signature_table->number_of_byte_value_groups = 0;
+
+	return( result );
+}
+
 /* Retrieves the number of byte value groups
  * Returns 1 if successful or -1 on error
  */
@@ -466,20 +525,19 @@ int libsigscan_signature_table_get_number_of_byte_value_groups(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_number_of_elements(
-	     signature_table->byte_value_groups_list,
-	     number_of_byte_value_groups,
-	     error ) != 1 )
+	if( number_of_byte_value_groups == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of byte value groups.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of byte value groups.",
 		 function );
 
 		return( -1 );
 	}
+	*number_of_byte_value_groups = signature_table->number_of_byte_value_groups;
+
 	return( 1 );
 }
 
@@ -505,37 +563,60 @@ int libsigscan_signature_table_get_byte_value_group_by_index(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_value_by_index(
-	     signature_table->byte_value_groups_list,
-	     byte_value_group_index,
-	     (intptr_t **) byte_value_group,
-	     error ) != 1 )
+	if( signature_table->byte_value_groups == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve byte value group: %d.",
-		 function,
-		 byte_value_group_index );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid signature table - missing byte value groups.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_value_group_index < 0 )
+	 || ( byte_value_group_index >= signature_table->number_of_byte_value_groups ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte value group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_value_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value group.",
+		 function );
 
 		return( -1 );
 	}
+	*byte_value_group = signature_table->byte_value_groups[ byte_value_group_index ];
+
 	return( 1 );
 }
 
-/* Retrieves a specific byte value group by offset
+/* Retrieves the index of the byte value group of a specific pattern offset
+ * If no such byte value group exists the index is set to where the byte value group should be inserted
  * Returns 1 if successful, 0 if no such value or -1 on error
  */
-int libsigscan_signature_table_get_byte_value_group_by_offset(
+int libsigscan_signature_table_get_byte_value_group_index(
      libsigscan_signature_table_t *signature_table,
      off64_t pattern_offset,
-     libsigscan_byte_value_group_t **byte_value_group,
+     int *byte_value_group_index,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *list_element = NULL;
-	static char *function                 = "libsigscan_signature_table_get_byte_value_group_by_offset";
-	int result                            = 0;
+	libsigscan_byte_value_group_t *byte_value_group = NULL;
+	static char *function                           = "libsigscan_signature_table_get_byte_value_group_index";
+	int first_group_index                           = 0;
+	int group_index                                 = 0;
+	int last_group_index                            = 0;
 
 	if( signature_table == NULL )
 	{
@@ -548,87 +629,154 @@ int libsigscan_signature_table_get_byte_value_group_by_offset(
 
 		return( -1 );
 	}
-	if( byte_value_group == NULL )
+	if( signature_table->byte_value_groups == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid byte value group.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid signature table - missing byte value groups.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_list_get_first_element(
-	     signature_table->byte_value_groups_list,
-	     &list_element,
-	     error ) != 1 )
+	if( byte_value_group_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first list element.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value group index.",
 		 function );
 
 		return( -1 );
 	}
-	while( list_element != NULL )
+	last_group_index = signature_table->number_of_byte_value_groups;
+
+	/* The byte value groups of a signature are inserted in pattern offset order
+	 * hence check the last byte value group first
+	 */
+	if( last_group_index > 0 )
 	{
-		if( libcdata_list_element_get_value(
-		     list_element,
-		     (intptr_t **) byte_value_group,
-		     error ) != 1 )
+		byte_value_group = signature_table->byte_value_groups[ last_group_index - 1 ];
+
+		if( byte_value_group == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve byte value group.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing byte value group: %d.",
+			 function,
+			 last_group_index - 1 );
 
 			return( -1 );
 		}
-		if( *byte_value_group == NULL )
+		if( byte_value_group->pattern_offset < pattern_offset )
+		{
+			*byte_value_group_index = last_group_index;
+
+			return( 0 );
+		}
+	}
+	while( first_group_index < last_group_index )
+	{
+		group_index = first_group_index + ( ( last_group_index - first_group_index ) / 2 );
+
+		byte_value_group = signature_table->byte_value_groups[ group_index ];
+
+		if( byte_value_group == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing byte value group.",
-			 function );
+			 "%s: missing byte value group: %d.",
+			 function,
+			 group_index );
 
 			return( -1 );
 		}
-		if( ( *byte_value_group )->pattern_offset == pattern_offset )
+		if( byte_value_group->pattern_offset == pattern_offset )
 		{
-			result = 1;
+			*byte_value_group_index = group_index;
 
-			break;
+			return( 1 );
 		}
-		if( ( *byte_value_group )->pattern_offset > pattern_offset )
+		if( byte_value_group->pattern_offset < pattern_offset )
 		{
-			break;
+			first_group_index = group_index + 1;
 		}
-		if( libcdata_list_element_get_next_element(
-		     list_element,
-		     &list_element,
-		     error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next list element.",
-			 function );
-
-			return( -1 );
+			last_group_index = group_index;
 		}
 	}
-	if( result == 0 )
+	*byte_value_group_index = first_group_index;
+
+	return( 0 );
+}
+
+/* Retrieves a specific byte value group by offset
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libsigscan_signature_table_get_byte_value_group_by_offset(
+     libsigscan_signature_table_t *signature_table,
+     off64_t pattern_offset,
+     libsigscan_byte_value_group_t **byte_value_group,
+     libcerror_error_t **error )
+{
+	static char *function      = "libsigscan_signature_table_get_byte_value_group_by_offset";
+	int byte_value_group_index = 0;
+	int result                 = 0;
+
+	if( signature_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature table.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_value_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value group.",
+		 function );
+
+		return( -1 );
+	}
+	result = libsigscan_signature_table_get_byte_value_group_index(
+	          signature_table,
+	          pattern_offset,
+	          &byte_value_group_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve byte value group index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
 	{
 		*byte_value_group = NULL;
 	}
+	else
+	{
+		*byte_value_group = signature_table->byte_value_groups[ byte_value_group_index ];
+	}
 	return( result );
 }
 
@@ -736,6 +884,114 @@ int libsigscan_signature_table_free_signatures_list_clone(
 	return( 1 );
 }
 
+/* Inserts a byte value group at a specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_signature_table_insert_byte_value_group(
+     libsigscan_signature_table_t *signature_table,
+     int byte_value_group_index,
+     libsigscan_byte_value_group_t *byte_value_group,
+     libcerror_error_t **error )
+{
+	libsigscan_byte_value_group_t **byte_value_groups = NULL;
+	static char *function                             = "libsigscan_signature_table_insert_byte_value_group";
+	size_t byte_value_groups_size                     = 0;
+	int group_index                                   = 0;
+	int number_of_allocated_byte_value_groups         = 0;
+
+	if( signature_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature table.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature_table->byte_value_groups == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid signature table - missing byte value groups.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_value_group_index < 0 )
+	 || ( byte_value_group_index > signature_table->number_of_byte_value_groups ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte value group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_value_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte value group.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature_table->number_of_byte_value_groups >= signature_table->number_of_allocated_byte_value_groups )
+	{
+		byte_value_groups_size = sizeof( libsigscan_byte_value_group_t * ) * 2 * (size_t) signature_table->number_of_allocated_byte_value_groups;
+
+		if( byte_value_groups_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid byte value groups size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_allocated_byte_value_groups = signature_table->number_of_allocated_byte_value_groups * 2;
+
+		byte_value_groups = (libsigscan_byte_value_group_t **) memory_reallocate(
+		                                                        signature_table->byte_value_groups,
+		                                                        byte_value_groups_size );
+
+		if( byte_value_groups == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize byte value groups.",
+			 function );
+
+			return( -1 );
+		}
+		signature_table->byte_value_groups                     = byte_value_groups;
+		signature_table->number_of_allocated_byte_value_groups = number_of_allocated_byte_value_groups;
+	}
+	for( group_index = signature_table->number_of_byte_value_groups;
+	     group_index > byte_value_group_index;
+	     group_index-- )
+	{
+		signature_table->byte_value_groups[ group_index ] = signature_table->byte_value_groups[ group_index - 1 ];
+	}
+	signature_table->byte_value_groups[ byte_value_group_index ] = byte_value_group;
+
+	signature_table->number_of_byte_value_groups += 1;
+
+	return( 1 );
+}
+
 /* Inserts a signature for a specific pattern offset and byte value
  * Returns 1 if successful or -1 on error
  */
@@ -749,6 +1005,7 @@ int libsigscan_signature_table_insert_signature(
 	libsigscan_byte_value_group_t *byte_value_group      = NULL;
 	libsigscan_byte_value_group_t *safe_byte_value_group = NULL;
 	static char *function                                = "libsigscan_signature_table_insert_signature";
+	int byte_value_group_index                           = 0;
 	int result                                           = 0;
 
 	if( signature_table == NULL )
@@ -762,10 +1019,10 @@ int libsigscan_signature_table_insert_signature(
 
 		return( -1 );
 	}
-	result = libsigscan_signature_table_get_byte_value_group_by_offset(
+	result = libsigscan_signature_table_get_byte_value_group_index(
 	          signature_table,
 	          pattern_offset,
-	          &safe_byte_value_group,
+	          &byte_value_group_index,
 	          error );
 
 	if( result == -1 )
@@ -774,7 +1031,7 @@ int libsigscan_signature_table_insert_signature(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve byte value group for pattern offset: %" PRIi64 ".",
+		 "%s: unable to retrieve byte value group index for pattern offset: %" PRIi64 ".",
 		 function,
 		 pattern_offset );
 
@@ -797,18 +1054,17 @@ int libsigscan_signature_table_insert_signature(
 
 			goto on_error;
 		}
-		if( libcdata_list_insert_value(
-		     signature_table->byte_value_groups_list,
-		     (intptr_t *) byte_value_group,
-		     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libsigscan_byte_value_group_compare,
-		     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+		if( libsigscan_signature_table_insert_byte_value_group(
+		     signature_table,
+		     byte_value_group_index,
+		     byte_value_group,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to insert byte value group for pattern offset: %" PRIi64 " into byte value groups list.",
+			 "%s: unable to insert byte value group for pattern offset: %" PRIi64 ".",
 			 function,
 			 pattern_offset );
 
@@ -817,6 +1073,10 @@ int libsigscan_signature_table_insert_signature(
 		safe_byte_value_group = byte_value_group;
 		byte_value_group      = 0;
 	}
+	else
+	{
+		safe_byte_value_group = signature_table->byte_value_groups[ byte_value_group_index ];
+	}
 	if( libsigscan_byte_value_group_insert_signature(
 	     safe_byte_value_group,
 	     byte_value,
@@ -842,9 +1102,8 @@ on_error:
 		 &byte_value_group,
 		 NULL );
 	}
-	libcdata_list_empty(
-	 signature_table->byte_value_groups_list,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_byte_value_group_free,
+	libsigscan_signature_table_empty_byte_value_groups(
+	 signature_table,
 	 NULL );
 
 	return( -1 );
@@ -39,9 +39,18 @@ typedef struct libsigscan_signature_table libsigscan_signature_table_t;
 
 struct libsigscan_signature_table
 {
-	/* The byte value groups list sorted by offset and byte value
+	/* The byte value groups
+	 * Sorted by pattern offset so that a byte value group can be looked up using a binary search
 	 */
-	libcdata_list_t *byte_value_groups_list;
+	libsigscan_byte_value_group_t **byte_value_groups;
+
+	/* The number of byte value groups
+	 */
+	int number_of_byte_value_groups;
+
+	/* The number of allocated byte value groups
+	 */
+	int number_of_allocated_byte_value_groups;
 
 	/* The list of signatures in the table
 	 */
@@ -64,6 +73,10 @@ int libsigscan_signature_table_fill(
      uint64_t pattern_offsets_range_size,
      libcerror_error_t **error );
 
+int libsigscan_signature_table_empty_byte_value_groups(
+     libsigscan_signature_table_t *signature_table,
+     libcerror_error_t **error );
+
 int libsigscan_signature_table_get_number_of_byte_value_groups(
      libsigscan_signature_table_t *signature_table,
      int *number_of_byte_value_groups,
@@ -75,6 +88,12 @@ int libsigscan_signature_table_get_byte_value_group_by_index(
      libsigscan_byte_value_group_t **byte_value_group,
      libcerror_error_t **error );
 
+int libsigscan_signature_table_get_byte_value_group_index(
+     libsigscan_signature_table_t *signature_table,
+     off64_t pattern_offset,
+     int *byte_value_group_index,
+     libcerror_error_t **error );
+
 int libsigscan_signature_table_get_byte_value_group_by_offset(
      libsigscan_signature_table_t *signature_table,
      off64_t pattern_offset,
@@ -95,6 +114,12 @@ int libsigscan_signature_table_free_signatures_list_clone(
      libcdata_list_t **signatures_list,
      libcerror_error_t **error );
 
+int libsigscan_signature_table_insert_byte_value_group(
+     libsigscan_signature_table_t *signature_table,
+     int byte_value_group_index,
+     libsigscan_byte_value_group_t *byte_value_group,
+     libcerror_error_t **error );
+
 int libsigscan_signature_table_insert_signature(
      libsigscan_signature_table_t *signature_table,
      off64_t pattern_offset,
@@ -20,8 +20,13 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
 #include "libsigscan_libcdata.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_signature.h"
@@ -132,3 +137,159 @@ int libsigscan_signatures_list_remove_signature(
 	return( 1 );
 }
 
+/* Compares two signature references
+ * Returns -1, 0 or 1 if the first reference is less, equal or greater than the second
+ */
+int libsigscan_signatures_list_compare_references(
+     const void *first_reference,
+     const void *second_reference )
+{
+	libsigscan_signature_t *first_signature  = *( (libsigscan_signature_t * const *) first_reference );
+	libsigscan_signature_t *second_signature = *( (libsigscan_signature_t * const *) second_reference );
+
+	if( first_signature < second_signature )
+	{
+		return( -1 );
+	}
+	else if( first_signature > second_signature )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Removes the signatures in the signatures array from the list
+ * The signatures array is sorted by reference so that every list element
+ * is looked up in O(log k) instead of scanning the list per signature
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_signatures_list_remove_signatures(
+     libcdata_list_t *signatures_list,
+     libsigscan_signature_t **signatures_array,
+     int number_of_signatures,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *list_element      = NULL;
+	libcdata_list_element_t *next_list_element = NULL;
+	intptr_t *list_value                       = NULL;
+	static char *function                      = "libsigscan_signatures_list_remove_signatures";
+
+	if( number_of_signatures < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of signatures value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_signatures == 0 )
+	{
+		return( 1 );
+	}
+	if( signatures_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signatures array.",
+		 function );
+
+		return( -1 );
+	}
+	qsort(
+	 signatures_array,
+	 (size_t) number_of_signatures,
+	 sizeof( libsigscan_signature_t * ),
+	 &libsigscan_signatures_list_compare_references );
+
+	if( libcdata_list_get_first_element(
+	     signatures_list,
+	     &list_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first list element.",
+		 function );
+
+		return( -1 );
+	}
+	while( list_element != NULL )
+	{
+		if( libcdata_list_element_get_next_element(
+		     list_element,
+		     &next_list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next list element.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_list_element_get_value(
+		     list_element,
+		     (intptr_t **) &list_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve signature.",
+			 function );
+
+			return( -1 );
+		}
+		/* Using a pointer comparison here since the signatures are cloned by reference
+		 */
+		if( bsearch(
+		     &list_value,
+		     signatures_array,
+		     (size_t) number_of_signatures,
+		     sizeof( libsigscan_signature_t * ),
+		     &libsigscan_signatures_list_compare_references ) != NULL )
+		{
+			if( libcdata_list_remove_element(
+			     signatures_list,
+			     list_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove list element.",
+				 function );
+
+				return( -1 );
+			}
+			if( libcdata_list_element_free(
+			     &list_element,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free list element.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		list_element = next_list_element;
+	}
+	return( 1 );
+}
+
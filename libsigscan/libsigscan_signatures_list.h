@@ -38,6 +38,16 @@ int libsigscan_signatures_list_remove_signature(
      libsigscan_signature_t *signature,
      libcerror_error_t **error );
 
+int libsigscan_signatures_list_compare_references(
+     const void *first_reference,
+     const void *second_reference );
+
+int libsigscan_signatures_list_remove_signatures(
+     libcdata_list_t *signatures_list,
+     libsigscan_signature_t **signatures_array,
+     int number_of_signatures,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libsigscan_definitions.h"
 #include "libsigscan_libcerror.h"
 #include "libsigscan_libcnotify.h"
 #include "libsigscan_signature.h"
@@ -128,6 +129,11 @@ int libsigscan_skip_table_free(
 	}
 	if( *skip_table != NULL )
 	{
+		if( ( *skip_table )->block_skip_values != NULL )
+		{
+			memory_free(
+			 ( *skip_table )->block_skip_values );
+		}
 		memory_free(
 		 *skip_table );
 
@@ -136,6 +142,25 @@ int libsigscan_skip_table_free(
 	return( 1 );
 }
 
+/* Retrieves the hash of a block
+ * Returns the block hash
+ */
+uint16_t libsigscan_skip_table_get_block_hash(
+          const uint8_t *block_data,
+          size_t block_size )
+{
+	size_t block_data_offset = 0;
+	uint16_t block_hash      = 0;
+
+	for( block_data_offset = 0;
+	     block_data_offset < block_size;
+	     block_data_offset++ )
+	{
+		block_hash = (uint16_t) ( ( block_hash << 7 ) ^ block_data[ block_data_offset ] );
+	}
+	return( (uint16_t) ( block_hash % LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_SKIP_VALUES ) );
+}
+
 /* Fills the skip table
  * Returns 1 if successful or -1 on error
  */
@@ -147,8 +172,11 @@ int libsigscan_skip_table_fill(
 	libcdata_list_element_t *list_element = NULL;
 	libsigscan_signature_t *signature     = NULL;
 	static char *function                 = "libsigscan_skip_table_fill";
+	size_t block_skip_value               = 0;
 	size_t pattern_index                  = 0;
 	size_t skip_value                     = 0;
+	uint16_t block_hash                   = 0;
+	int16_t byte_value_index              = 0;
 	uint8_t byte_value                    = 0;
 
 	if( skip_table == NULL )
@@ -235,7 +263,70 @@ int libsigscan_skip_table_fill(
 		}
 	}
 	/* Next fill the skip table
+	 * The skip value of a byte value that is not part of any pattern
+	 * is the smallest pattern size
 	 */
+	for( byte_value_index = 0;
+	     byte_value_index < 256;
+	     byte_value_index++ )
+	{
+		skip_table->skip_values[ byte_value_index ]          = skip_table->smallest_pattern_size;
+		skip_table->uniform_block_values[ byte_value_index ] = 0;
+	}
+	skip_table->smallest_skip_value = skip_table->smallest_pattern_size;
+
+	/* The block skip values are used when the smallest pattern is large enough
+	 * to skip more than a single block, where larger sets of signatures use
+	 * larger blocks to keep the number of blocks with a small skip value low
+	 */
+	if( ( skip_table->number_of_signatures >= LIBSIGSCAN_SKIP_TABLE_MINIMUM_NUMBER_OF_SIGNATURES_FOR_3_BYTE_BLOCKS )
+	 && ( skip_table->smallest_pattern_size >= 4 ) )
+	{
+		skip_table->block_size = 3;
+	}
+	else if( skip_table->smallest_pattern_size >= 3 )
+	{
+		skip_table->block_size = 2;
+	}
+	else
+	{
+		skip_table->block_size = 0;
+	}
+	if( skip_table->block_size != 0 )
+	{
+		if( skip_table->block_skip_values == NULL )
+		{
+			skip_table->block_skip_values = (uint16_t *) memory_allocate(
+			                                              sizeof( uint16_t ) * LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_SKIP_VALUES );
+
+			if( skip_table->block_skip_values == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create block skip values.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		/* The skip value of a block that is not part of any pattern
+		 * is the number of blocks that fit in the smallest pattern size
+		 */
+		block_skip_value = skip_table->smallest_pattern_size - skip_table->block_size + 1;
+
+		if( block_skip_value > (size_t) 0xffffUL )
+		{
+			block_skip_value = (size_t) 0xffffUL;
+		}
+		for( block_hash = 0;
+		     block_hash < LIBSIGSCAN_SKIP_TABLE_NUMBER_OF_BLOCK_SKIP_VALUES;
+		     block_hash++ )
+		{
+			skip_table->block_skip_values[ block_hash ] = (uint16_t) block_skip_value;
+		}
+	}
 	if( libcdata_list_get_first_element(
 	     signatures_list,
 	     &list_element,
@@ -277,29 +368,65 @@ int libsigscan_skip_table_fill(
 
 			return( -1 );
 		}
+		/* The last byte of the smallest pattern size is not used since the scan
+		 * position itself has already been checked, hence a skip value is never 0
+		 * and the smallest skip value over all signatures is kept for every byte value
+		 */
 		skip_value = skip_table->smallest_pattern_size;
 
-		skip_table->smallest_skip_value = skip_value;
-
 		for( pattern_index = 0;
-		     pattern_index < skip_table->smallest_pattern_size;
+		     ( pattern_index + 1 ) < skip_table->smallest_pattern_size;
 		     pattern_index++ )
 		{
 			skip_value -= 1;
 			byte_value  = signature->pattern[ pattern_index ];
 
-			if( ( skip_table->skip_values[ byte_value ] == 0 )
-			 || ( skip_value < skip_table->skip_values[ byte_value ] ) )
+			if( skip_value < skip_table->skip_values[ byte_value ] )
 			{
 				skip_table->skip_values[ byte_value ] = skip_value;
 
-				if( ( skip_value > 0 )
-				 && ( skip_value < skip_table->smallest_skip_value ) )
+				if( skip_value < skip_table->smallest_skip_value )
 				{
 					skip_table->smallest_skip_value = skip_value;
 				}
 			}
 		}
+		/* A pattern that consists of a single repeated byte value can match within a uniform block
+		 */
+		for( pattern_index = 1;
+		     pattern_index < signature->pattern_size;
+		     pattern_index++ )
+		{
+			if( signature->pattern[ pattern_index ] != signature->pattern[ 0 ] )
+			{
+				break;
+			}
+		}
+		if( pattern_index >= signature->pattern_size )
+		{
+			skip_table->uniform_block_values[ signature->pattern[ 0 ] ] = 1;
+		}
+		/* The block that ends at the last byte of the smallest pattern size is not used
+		 * for the same reason, blocks with the same hash share the smallest skip value
+		 */
+		if( skip_table->block_size != 0 )
+		{
+			for( pattern_index = skip_table->block_size - 1;
+			     ( pattern_index + 1 ) < skip_table->smallest_pattern_size;
+			     pattern_index++ )
+			{
+				block_skip_value = skip_table->smallest_pattern_size - pattern_index - 1;
+
+				block_hash = libsigscan_skip_table_get_block_hash(
+				              &( signature->pattern[ pattern_index + 1 - skip_table->block_size ] ),
+				              skip_table->block_size );
+
+				if( block_skip_value < (size_t) skip_table->block_skip_values[ block_hash ] )
+				{
+					skip_table->block_skip_values[ block_hash ] = (uint16_t) block_skip_value;
+				}
+			}
+		}
 		if( libcdata_list_element_get_next_element(
 		     list_element,
 		     &list_element,
@@ -393,6 +520,80 @@ int libsigscan_skip_table_get_skip_value(
 	return( 1 );
 }
 
+/* Retrieves the block skip value of the scan window at the start of the buffer
+ * The scan window is the size of the smallest pattern and the block is taken from
+ * the end of the scan window
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libsigscan_skip_table_get_block_skip_value(
+     libsigscan_skip_table_t *skip_table,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t *skip_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_skip_table_get_block_skip_value";
+	uint16_t block_hash   = 0;
+
+	if( skip_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip table.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( skip_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( skip_table->block_size == 0 )
+	 || ( skip_table->block_skip_values == NULL )
+	 || ( skip_table->smallest_pattern_size > buffer_size ) )
+	{
+		return( 0 );
+	}
+	block_hash = libsigscan_skip_table_get_block_hash(
+	              &( buffer[ skip_table->smallest_pattern_size - skip_table->block_size ] ),
+	              skip_table->block_size );
+
+	*skip_value = (size_t) skip_table->block_skip_values[ block_hash ];
+
+	return( 1 );
+}
+
 /* Retrieves the smallest skip value
  * Returns 1 if successful or -1 on error
  */
@@ -430,6 +631,113 @@ int libsigscan_skip_table_get_smallest_skip_value(
 	return( 1 );
 }
 
+/* Retrieves the uniform block skip value at the start of the buffer
+ * A uniform block contains a single repeated byte value. If no pattern consists entirely
+ * of that byte value, no match can start within the block unless it ends after the block,
+ * hence the block is skipped except for the last largest pattern size - 1 bytes
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libsigscan_skip_table_get_uniform_block_skip_value(
+     libsigscan_skip_table_t *skip_table,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t *skip_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_skip_table_get_uniform_block_skip_value";
+	size_t block_size     = 0;
+	uint64_t block_64bit  = 0;
+	uint64_t value_64bit  = 0;
+	uint8_t byte_value    = 0;
+
+	if( skip_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip table.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( skip_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid skip value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( skip_table->largest_pattern_size == 0 )
+	 || ( buffer_size < LIBSIGSCAN_SKIP_TABLE_UNIFORM_BLOCK_SIZE ) )
+	{
+		return( 0 );
+	}
+	byte_value = buffer[ 0 ];
+
+	if( skip_table->uniform_block_values[ byte_value ] != 0 )
+	{
+		return( 0 );
+	}
+	/* 8 bytes are compared at a time, where the block ends at the first 8 bytes
+	 * that are not all the byte value
+	 */
+	block_64bit = (uint64_t) byte_value * 0x0101010101010101ULL;
+
+	while( ( block_size + 8 ) <= buffer_size )
+	{
+		memory_copy(
+		 &value_64bit,
+		 &( buffer[ block_size ] ),
+		 8 );
+
+		if( value_64bit != block_64bit )
+		{
+			break;
+		}
+		block_size += 8;
+	}
+	while( ( block_size < buffer_size )
+	    && ( buffer[ block_size ] == byte_value ) )
+	{
+		block_size++;
+	}
+	if( ( block_size < LIBSIGSCAN_SKIP_TABLE_UNIFORM_BLOCK_SIZE )
+	 || ( block_size < skip_table->largest_pattern_size ) )
+	{
+		return( 0 );
+	}
+	*skip_value = block_size - skip_table->largest_pattern_size + 1;
+
+	return( 1 );
+}
+
 #if defined( HAVE_DEBUG_OUTPUT )
 
 /* Prints a skip table
@@ -464,7 +772,7 @@ int libsigscan_skip_table_printf(
 	     byte_value_index < 256;
 	     byte_value_index++ )
 	{
-		if( skip_table->skip_values[ byte_value_index] != 0 )
+		if( skip_table->skip_values[ byte_value_index] != skip_table->smallest_pattern_size )
 		{
 			libcnotify_printf(
 			 "\tByte value: 0x%02" PRIx16 "\t: %" PRIzd "\n",
@@ -476,6 +784,21 @@ int libsigscan_skip_table_printf(
 	 "\tDefault\t\t\t: %" PRIzd "\n",
          skip_table->smallest_pattern_size );
 
+	libcnotify_printf(
+	 "\tBlock size\t\t: %" PRIzd "\n",
+         skip_table->block_size );
+
+	for( byte_value_index = 0;
+	     byte_value_index < 256;
+	     byte_value_index++ )
+	{
+		if( skip_table->uniform_block_values[ byte_value_index ] != 0 )
+		{
+			libcnotify_printf(
+			 "\tUniform block value\t: 0x%02" PRIx16 "\n",
+			 byte_value_index );
+		}
+	}
 	libcnotify_printf(
 	 "\n" );
 
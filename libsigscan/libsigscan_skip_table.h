@@ -55,6 +55,20 @@ struct libsigscan_skip_table
 	/* The smallest skip value
 	 */
 	size_t smallest_skip_value;
+
+	/* The block size, which is the number of bytes of a block (q-gram)
+	 * 0 if the block skip values are not used
+	 */
+	size_t block_size;
+
+	/* The block skip values per block hash
+	 */
+	uint16_t *block_skip_values;
+
+	/* The uniform block values, which are non-zero for a byte value of which a pattern consists
+	 * entirely, since such a pattern can match within a block of only that byte value
+	 */
+	uint8_t uniform_block_values[ 256 ];
 };
 
 int libsigscan_skip_table_initialize(
@@ -65,6 +79,10 @@ int libsigscan_skip_table_free(
      libsigscan_skip_table_t **skip_table,
      libcerror_error_t **error );
 
+uint16_t libsigscan_skip_table_get_block_hash(
+          const uint8_t *block_data,
+          size_t block_size );
+
 int libsigscan_skip_table_fill(
      libsigscan_skip_table_t *skip_table,
      libcdata_list_t *signatures_list,
@@ -81,11 +99,25 @@ int libsigscan_skip_table_get_skip_value(
      size_t *skip_value,
      libcerror_error_t **error );
 
+int libsigscan_skip_table_get_block_skip_value(
+     libsigscan_skip_table_t *skip_table,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t *skip_value,
+     libcerror_error_t **error );
+
 int libsigscan_skip_table_get_smallest_skip_value(
      libsigscan_skip_table_t *skip_table,
      size_t *smallest_skip_value,
      libcerror_error_t **error );
 
+int libsigscan_skip_table_get_uniform_block_skip_value(
+     libsigscan_skip_table_t *skip_table,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t *skip_value,
+     libcerror_error_t **error );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 
 int libsigscan_skip_table_printf(
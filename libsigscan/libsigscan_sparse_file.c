@@ -0,0 +1,562 @@
+/*
+ * Sparse file functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* SEEK_DATA and SEEK_HOLE are only defined by the GNU C library if _GNU_SOURCE is defined
+ */
+#if !defined( _GNU_SOURCE )
+#define _GNU_SOURCE
+#endif
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include <errno.h>
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libsigscan_libcerror.h"
+#include "libsigscan_sparse_file.h"
+
+#if defined( HAVE_OPEN ) && defined( HAVE_CLOSE ) && defined( HAVE_FSTAT ) && defined( HAVE_LSEEK ) && defined( SEEK_DATA ) && defined( SEEK_HOLE )
+#define LIBSIGSCAN_SPARSE_FILE_HAVE_SEEK_DATA
+#endif
+
+/* Creates a sparse file
+ * Make sure the value sparse_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_sparse_file_initialize(
+     libsigscan_sparse_file_t **sparse_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_sparse_file_initialize";
+
+	if( sparse_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sparse file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sparse_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sparse file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*sparse_file = memory_allocate_structure(
+	                libsigscan_sparse_file_t );
+
+	if( *sparse_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sparse file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *sparse_file,
+	     0,
+	     sizeof( libsigscan_sparse_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sparse file.",
+		 function );
+
+		goto on_error;
+	}
+	( *sparse_file )->file_descriptor = -1;
+
+	return( 1 );
+
+on_error:
+	if( *sparse_file != NULL )
+	{
+		memory_free(
+		 *sparse_file );
+
+		*sparse_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a sparse file
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_sparse_file_free(
+     libsigscan_sparse_file_t **sparse_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_sparse_file_free";
+	int result            = 1;
+
+	if( sparse_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sparse file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sparse_file != NULL )
+	{
+		if( ( *sparse_file )->file_descriptor != -1 )
+		{
+			if( libsigscan_sparse_file_close(
+			     *sparse_file,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close sparse file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *sparse_file );
+
+		*sparse_file = NULL;
+	}
+	return( result );
+}
+
+/* Opens a sparse file to determine the holes in the file
+ * A file that cannot be opened, is not a regular file or does not contain holes is not opened,
+ * since its data needs to be read in its entirety
+ * Returns 1 if successful, 0 if the holes of the file cannot be determined or -1 on error
+ */
+int libsigscan_sparse_file_open(
+     libsigscan_sparse_file_t *sparse_file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+#if defined( LIBSIGSCAN_SPARSE_FILE_HAVE_SEEK_DATA )
+	struct stat file_statistics;
+
+	int file_descriptor   = -1;
+#endif
+	static char *function = "libsigscan_sparse_file_open";
+
+	if( sparse_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sparse file.",
+		 function );
+
+		return( -1 );
+	}
+	if( sparse_file->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sparse file - file already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBSIGSCAN_SPARSE_FILE_HAVE_SEEK_DATA )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	/* A file of which fewer blocks are allocated than needed for its size contains holes
+	 */
+	if( !S_ISREG( file_statistics.st_mode )
+	 || ( file_statistics.st_size <= 0 )
+	 || ( ( (size64_t) file_statistics.st_blocks * 512 ) >= (size64_t) file_statistics.st_size ) )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	/* The file system does not support determining the holes of a file
+	 */
+	if( ( lseek(
+	       file_descriptor,
+	       0,
+	       SEEK_DATA ) == -1 )
+	 && ( errno != ENXIO ) )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	sparse_file->file_descriptor = file_descriptor;
+	sparse_file->size            = (size64_t) file_statistics.st_size;
+
+	return( 1 );
+#else
+	return( 0 );
+#endif /* defined( LIBSIGSCAN_SPARSE_FILE_HAVE_SEEK_DATA ) */
+}
+
+/* Closes a sparse file
+ * Returns 0 if successful or -1 on error
+ */
+int libsigscan_sparse_file_close(
+     libsigscan_sparse_file_t *sparse_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_sparse_file_close";
+	int result            = 0;
+
+	if( sparse_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sparse file.",
+		 function );
+
+		return( -1 );
+	}
+	if( sparse_file->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sparse file - file not open.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBSIGSCAN_SPARSE_FILE_HAVE_SEEK_DATA )
+	if( close(
+	     sparse_file->file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	sparse_file->file_descriptor = -1;
+	sparse_file->size            = 0;
+
+	return( result );
+}
+
+/* Sets the scan ranges
+ * The margin size is the size of the data at the start and end of a hole that is scanned,
+ * the header and footer ranges are always scanned, since their data is scanned as a whole
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_sparse_file_set_scan_ranges(
+     libsigscan_sparse_file_t *sparse_file,
+     size_t margin_size,
+     uint64_t header_range_start,
+     uint64_t header_range_end,
+     uint64_t footer_range_start,
+     uint64_t footer_range_end,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_sparse_file_set_scan_ranges";
+
+	if( sparse_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sparse file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( margin_size > (size_t) SSIZE_MAX )
+	 || ( header_range_start > header_range_end )
+	 || ( footer_range_start > footer_range_end ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan ranges value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sparse_file->margin_size        = margin_size;
+	sparse_file->header_range_start = header_range_start;
+	sparse_file->header_range_end   = header_range_end;
+	sparse_file->footer_range_start = footer_range_start;
+	sparse_file->footer_range_end   = footer_range_end;
+
+	return( 1 );
+}
+
+/* Retrieves the range of the data that needs to be scanned at or after the offset
+ * The data of a hole reads as zero bytes, hence a hole is skipped except for the margin
+ * at the start and end of the hole and the header and footer ranges. The margin at
+ * the start of a hole is part of the scan range of the data before the hole
+ * The scan offset is the range end offset if there is no more data to scan
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_sparse_file_get_scan_range(
+     libsigscan_sparse_file_t *sparse_file,
+     off64_t offset,
+     off64_t range_end_offset,
+     off64_t *scan_offset,
+     off64_t *scan_end_offset,
+     libcerror_error_t **error )
+{
+#if defined( LIBSIGSCAN_SPARSE_FILE_HAVE_SEEK_DATA )
+	uint64_t bounded_ranges[ 4 ];
+
+	off64_t data_end_offset = 0;
+	off64_t data_offset     = 0;
+	off64_t safe_end_offset = 0;
+	off64_t safe_offset     = 0;
+	int bounded_range_index = 0;
+#endif
+	static char *function   = "libsigscan_sparse_file_get_scan_range";
+
+	if( sparse_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sparse file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( offset > range_end_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_end_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan end offset.",
+		 function );
+
+		return( -1 );
+	}
+	*scan_offset     = offset;
+	*scan_end_offset = range_end_offset;
+
+	if( ( sparse_file->file_descriptor == -1 )
+	 || ( offset == range_end_offset ) )
+	{
+		return( 1 );
+	}
+#if defined( LIBSIGSCAN_SPARSE_FILE_HAVE_SEEK_DATA )
+	data_offset = lseek(
+	               sparse_file->file_descriptor,
+	               offset,
+	               SEEK_DATA );
+
+	if( data_offset == -1 )
+	{
+		/* The holes are only used to skip data, if they cannot be determined the data is read
+		 */
+		if( errno != ENXIO )
+		{
+			return( 1 );
+		}
+		data_offset = range_end_offset;
+	}
+	else if( data_offset < offset )
+	{
+		return( 1 );
+	}
+	/* If there is no data in the range the remainder of the range is a hole,
+	 * otherwise the hole before the data is skipped up to the margin
+	 */
+	if( data_offset >= range_end_offset )
+	{
+		data_offset = range_end_offset;
+		safe_offset = range_end_offset;
+	}
+	else if( ( data_offset - offset ) > (off64_t) sparse_file->margin_size )
+	{
+		safe_offset = data_offset - (off64_t) sparse_file->margin_size;
+	}
+	else
+	{
+		safe_offset = offset;
+	}
+	bounded_ranges[ 0 ] = sparse_file->header_range_start;
+	bounded_ranges[ 1 ] = sparse_file->header_range_end;
+	bounded_ranges[ 2 ] = sparse_file->footer_range_start;
+	bounded_ranges[ 3 ] = sparse_file->footer_range_end;
+
+	/* The header and footer ranges in the hole are not skipped
+	 */
+	for( bounded_range_index = 0;
+	     bounded_range_index < 4;
+	     bounded_range_index += 2 )
+	{
+		if( ( bounded_ranges[ bounded_range_index ] < (uint64_t) safe_offset )
+		 && ( bounded_ranges[ bounded_range_index + 1 ] > (uint64_t) offset ) )
+		{
+			if( bounded_ranges[ bounded_range_index ] <= (uint64_t) offset )
+			{
+				safe_offset = offset;
+			}
+			else
+			{
+				safe_offset = (off64_t) bounded_ranges[ bounded_range_index ];
+			}
+		}
+	}
+	*scan_offset = safe_offset;
+
+	if( safe_offset >= range_end_offset )
+	{
+		return( 1 );
+	}
+	/* If the scan range contains data it ends after the margin at the start of the next hole
+	 */
+	safe_end_offset = safe_offset;
+
+	if( ( data_offset < range_end_offset )
+	 && ( ( data_offset - safe_offset ) <= (off64_t) sparse_file->margin_size ) )
+	{
+		data_end_offset = lseek(
+		                   sparse_file->file_descriptor,
+		                   data_offset,
+		                   SEEK_HOLE );
+
+		if( data_end_offset <= data_offset )
+		{
+			return( 1 );
+		}
+		safe_end_offset = data_end_offset + (off64_t) sparse_file->margin_size;
+	}
+	for( bounded_range_index = 0;
+	     bounded_range_index < 4;
+	     bounded_range_index += 2 )
+	{
+		if( ( bounded_ranges[ bounded_range_index ] <= (uint64_t) safe_offset )
+		 && ( bounded_ranges[ bounded_range_index + 1 ] > (uint64_t) safe_end_offset ) )
+		{
+			safe_end_offset = (off64_t) bounded_ranges[ bounded_range_index + 1 ];
+		}
+	}
+	if( ( safe_end_offset <= safe_offset )
+	 || ( safe_end_offset > range_end_offset ) )
+	{
+		safe_end_offset = range_end_offset;
+	}
+	*scan_end_offset = safe_end_offset;
+
+#endif /* defined( LIBSIGSCAN_SPARSE_FILE_HAVE_SEEK_DATA ) */
+
+	return( 1 );
+}
+
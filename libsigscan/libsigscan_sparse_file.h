@@ -0,0 +1,108 @@
+/*
+ * Sparse file functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_SPARSE_FILE_H )
+#define _LIBSIGSCAN_SPARSE_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_sparse_file libsigscan_sparse_file_t;
+
+struct libsigscan_sparse_file
+{
+	/* The file descriptor
+	 * Contains -1 if the file is not open
+	 */
+	int file_descriptor;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The margin size, which is the size of the data at the start and end of a hole
+	 * that is scanned, since a match that contains data can start or end in a hole
+	 */
+	size_t margin_size;
+
+	/* The header range start
+	 */
+	uint64_t header_range_start;
+
+	/* The header range end
+	 */
+	uint64_t header_range_end;
+
+	/* The footer range start
+	 */
+	uint64_t footer_range_start;
+
+	/* The footer range end
+	 */
+	uint64_t footer_range_end;
+};
+
+int libsigscan_sparse_file_initialize(
+     libsigscan_sparse_file_t **sparse_file,
+     libcerror_error_t **error );
+
+int libsigscan_sparse_file_free(
+     libsigscan_sparse_file_t **sparse_file,
+     libcerror_error_t **error );
+
+int libsigscan_sparse_file_open(
+     libsigscan_sparse_file_t *sparse_file,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libsigscan_sparse_file_close(
+     libsigscan_sparse_file_t *sparse_file,
+     libcerror_error_t **error );
+
+int libsigscan_sparse_file_set_scan_ranges(
+     libsigscan_sparse_file_t *sparse_file,
+     size_t margin_size,
+     uint64_t header_range_start,
+     uint64_t header_range_end,
+     uint64_t footer_range_start,
+     uint64_t footer_range_end,
+     libcerror_error_t **error );
+
+int libsigscan_sparse_file_get_scan_range(
+     libsigscan_sparse_file_t *sparse_file,
+     off64_t offset,
+     off64_t range_end_offset,
+     off64_t *scan_offset,
+     off64_t *scan_end_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_SPARSE_FILE_H ) */
+
@@ -0,0 +1,937 @@
+/*
+ * The thread pool functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libsigscan_definitions.h"
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcthreads.h"
+#include "libsigscan_thread_pool.h"
+
+/* Retrieves the default number of threads
+ * The default number of threads is the number of online processors
+ * or 1 if multi-threading is not supported
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_thread_pool_get_default_number_of_threads(
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( WINAPI )
+	SYSTEM_INFO system_info;
+#endif
+
+	static char *function     = "libsigscan_thread_pool_get_default_number_of_threads";
+	long number_of_processors = 1;
+
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( WINAPI )
+	GetSystemInfo(
+	 &system_info );
+
+	number_of_processors = (long) system_info.dwNumberOfProcessors;
+
+#elif defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( _SC_NPROCESSORS_ONLN )
+	number_of_processors = sysconf(
+	                        _SC_NPROCESSORS_ONLN );
+#endif
+	if( number_of_processors < 1 )
+	{
+		number_of_processors = 1;
+	}
+	else if( number_of_processors > LIBSIGSCAN_THREAD_POOL_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		number_of_processors = LIBSIGSCAN_THREAD_POOL_MAXIMUM_NUMBER_OF_THREADS;
+	}
+	*number_of_threads = (int) number_of_processors;
+
+	return( 1 );
+}
+
+/* Creates a thread pool
+ * Make sure the value thread_pool is referencing, is set to NULL
+ * The thread that runs the values is one of the threads hence number of threads - 1
+ * worker threads are created
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_thread_pool_initialize(
+     libsigscan_thread_pool_t **thread_pool,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_thread_pool_initialize";
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int thread_index      = 0;
+#endif
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid thread pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > LIBSIGSCAN_THREAD_POOL_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*thread_pool = memory_allocate_structure(
+	                libsigscan_thread_pool_t );
+
+	if( *thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *thread_pool,
+	     0,
+	     sizeof( libsigscan_thread_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear thread pool.",
+		 function );
+
+		memory_free(
+		 *thread_pool );
+
+		*thread_pool = NULL;
+
+		return( -1 );
+	}
+	( *thread_pool )->number_of_threads = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		( *thread_pool )->tasks = (libsigscan_thread_pool_task_t *) memory_allocate(
+		                                                             sizeof( libsigscan_thread_pool_task_t ) * 16 );
+
+		if( ( *thread_pool )->tasks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create tasks.",
+			 function );
+
+			goto on_error;
+		}
+		( *thread_pool )->number_of_allocated_tasks = 16;
+
+		if( libcthreads_mutex_initialize(
+		     &( ( *thread_pool )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_condition_initialize(
+		     &( ( *thread_pool )->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create condition.",
+			 function );
+
+			goto on_error;
+		}
+		( *thread_pool )->threads = (libcthreads_thread_t **) memory_allocate(
+		                                                       sizeof( libcthreads_thread_t * ) * ( number_of_threads - 1 ) );
+
+		if( ( *thread_pool )->threads == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create threads.",
+			 function );
+
+			goto on_error;
+		}
+		for( thread_index = 0;
+		     thread_index < ( number_of_threads - 1 );
+		     thread_index++ )
+		{
+			( *thread_pool )->threads[ thread_index ] = NULL;
+
+			if( libcthreads_thread_create(
+			     &( ( *thread_pool )->threads[ thread_index ] ),
+			     NULL,
+			     (int (*)(void *)) &libsigscan_thread_pool_worker,
+			     (void *) *thread_pool,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			( *thread_pool )->number_of_worker_threads += 1;
+		}
+		( *thread_pool )->number_of_threads = number_of_threads;
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+
+on_error:
+	if( *thread_pool != NULL )
+	{
+		libsigscan_thread_pool_free(
+		 thread_pool,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a thread pool
+ * The worker threads are stopped and joined
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_thread_pool_free(
+     libsigscan_thread_pool_t **thread_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libsigscan_thread_pool_free";
+	int result            = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int thread_index      = 0;
+#endif
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread_pool != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *thread_pool )->number_of_worker_threads > 0 )
+		{
+			if( libcthreads_mutex_grab(
+			     ( *thread_pool )->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab mutex.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				( *thread_pool )->stop = 1;
+
+				if( libcthreads_condition_broadcast(
+				     ( *thread_pool )->condition,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to broadcast condition.",
+					 function );
+
+					result = -1;
+				}
+				if( libcthreads_mutex_release(
+				     ( *thread_pool )->mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to release mutex.",
+					 function );
+
+					result = -1;
+				}
+				for( thread_index = 0;
+				     thread_index < ( *thread_pool )->number_of_worker_threads;
+				     thread_index++ )
+				{
+					if( libcthreads_thread_join(
+					     &( ( *thread_pool )->threads[ thread_index ] ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to join thread: %d.",
+						 function,
+						 thread_index );
+
+						result = -1;
+					}
+				}
+			}
+		}
+		if( ( *thread_pool )->threads != NULL )
+		{
+			memory_free(
+			 ( *thread_pool )->threads );
+		}
+		if( ( *thread_pool )->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *thread_pool )->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *thread_pool )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *thread_pool )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+		if( ( *thread_pool )->tasks != NULL )
+		{
+			memory_free(
+			 ( *thread_pool )->tasks );
+		}
+		memory_free(
+		 *thread_pool );
+
+		*thread_pool = NULL;
+	}
+	return( result );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Pushes tasks for the values of a batch onto the tasks stack
+ * The tasks are pushed in reverse order so that the values are taken in order
+ * The mutex must be grabbed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_thread_pool_push_tasks(
+     libsigscan_thread_pool_t *thread_pool,
+     libsigscan_thread_pool_batch_t *batch,
+     intptr_t **values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	libsigscan_thread_pool_task_t *tasks = NULL;
+	static char *function                = "libsigscan_thread_pool_push_tasks";
+	size_t tasks_size                    = 0;
+	int number_of_allocated_tasks        = 0;
+	int value_index                      = 0;
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( thread_pool->tasks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid thread pool - missing tasks.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_values < 0 )
+	 || ( number_of_values > ( INT_MAX - thread_pool->number_of_tasks ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_allocated_tasks = thread_pool->number_of_allocated_tasks;
+
+	while( ( thread_pool->number_of_tasks + number_of_values ) > number_of_allocated_tasks )
+	{
+		if( number_of_allocated_tasks > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated tasks value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_allocated_tasks *= 2;
+	}
+	if( number_of_allocated_tasks > thread_pool->number_of_allocated_tasks )
+	{
+		tasks_size = sizeof( libsigscan_thread_pool_task_t ) * (size_t) number_of_allocated_tasks;
+
+		if( tasks_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid tasks size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		tasks = (libsigscan_thread_pool_task_t *) memory_reallocate(
+		                                           thread_pool->tasks,
+		                                           tasks_size );
+
+		if( tasks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize tasks.",
+			 function );
+
+			return( -1 );
+		}
+		thread_pool->tasks                     = tasks;
+		thread_pool->number_of_allocated_tasks = number_of_allocated_tasks;
+	}
+	for( value_index = number_of_values - 1;
+	     value_index >= 0;
+	     value_index-- )
+	{
+		thread_pool->tasks[ thread_pool->number_of_tasks ].batch       = batch;
+		thread_pool->tasks[ thread_pool->number_of_tasks ].value       = values[ value_index ];
+		thread_pool->tasks[ thread_pool->number_of_tasks ].value_index = value_index;
+
+		thread_pool->number_of_tasks += 1;
+	}
+	batch->number_of_pending_values += number_of_values;
+
+	return( 1 );
+}
+
+/* Takes the task from the top of the tasks stack and runs it
+ * The mutex must be grabbed by the caller, it is released while the task runs
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_thread_pool_run_task(
+     libsigscan_thread_pool_t *thread_pool,
+     libcerror_error_t **error )
+{
+	libsigscan_thread_pool_task_t task;
+
+	libcerror_error_t *value_error = NULL;
+	static char *function          = "libsigscan_thread_pool_run_task";
+	int result                     = 0;
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( thread_pool->number_of_tasks <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid thread pool - missing tasks.",
+		 function );
+
+		return( -1 );
+	}
+	thread_pool->number_of_tasks -= 1;
+
+	task = thread_pool->tasks[ thread_pool->number_of_tasks ];
+
+	if( libcthreads_mutex_release(
+	     thread_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	result = task.batch->callback_function(
+	          task.value,
+	          &value_error );
+
+	if( ( result != 1 )
+	 && ( value_error == NULL ) )
+	{
+		libcerror_error_set(
+		 &value_error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run value: %d.",
+		 function,
+		 task.value_index );
+	}
+	if( libcthreads_mutex_grab(
+	     thread_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		if( value_error != NULL )
+		{
+			libcerror_error_free(
+			 &value_error );
+		}
+		return( -1 );
+	}
+	/* Only the error of the first value is kept, so that the error
+	 * does not depend on the order in which the values were run
+	 */
+	if( value_error != NULL )
+	{
+		if( ( task.batch->error_value_index == -1 )
+		 || ( task.value_index < task.batch->error_value_index ) )
+		{
+			if( task.batch->error != NULL )
+			{
+				libcerror_error_free(
+				 &( task.batch->error ) );
+			}
+			task.batch->error             = value_error;
+			task.batch->error_value_index = task.value_index;
+		}
+		else
+		{
+			libcerror_error_free(
+			 &value_error );
+		}
+	}
+	task.batch->number_of_pending_values -= 1;
+
+	if( libcthreads_condition_broadcast(
+	     thread_pool->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Runs the tasks of the thread pool until the thread pool is stopped
+ * This function is the callback function of the worker threads
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_thread_pool_worker(
+     libsigscan_thread_pool_t *thread_pool )
+{
+	int result = 1;
+
+	if( thread_pool == NULL )
+	{
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     thread_pool->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	while( thread_pool->stop == 0 )
+	{
+		if( thread_pool->number_of_tasks > 0 )
+		{
+			result = libsigscan_thread_pool_run_task(
+			          thread_pool,
+			          NULL );
+		}
+		else
+		{
+			result = libcthreads_condition_wait(
+			          thread_pool->condition,
+			          thread_pool->mutex,
+			          NULL );
+		}
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_release(
+	     thread_pool->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Runs the callback function for each of the values
+ * The values are distributed over the threads of the thread pool, while waiting
+ * for its values to be processed the calling thread runs tasks as well, hence
+ * a callback function can run values of its own on the same thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libsigscan_thread_pool_run_values(
+     libsigscan_thread_pool_t *thread_pool,
+     int (*callback_function)(
+            intptr_t *value,
+            libcerror_error_t **error ),
+     intptr_t **values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libsigscan_thread_pool_batch_t batch;
+#endif
+
+	static char *function = "libsigscan_thread_pool_run_values";
+	int value_index       = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int result            = 0;
+#endif
+
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( thread_pool != NULL )
+	 && ( thread_pool->number_of_threads > 1 )
+	 && ( number_of_values > 1 ) )
+	{
+		batch.callback_function        = callback_function;
+		batch.number_of_pending_values = 0;
+		batch.error_value_index        = -1;
+		batch.error                    = NULL;
+
+		if( libcthreads_mutex_grab(
+		     thread_pool->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		result = libsigscan_thread_pool_push_tasks(
+		          thread_pool,
+		          &batch,
+		          values,
+		          number_of_values,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push tasks.",
+			 function );
+		}
+		else
+		{
+			result = libcthreads_condition_broadcast(
+			          thread_pool->condition,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast condition.",
+				 function );
+			}
+		}
+		/* Once pushed the tasks reference the batch, hence wait for all of them
+		 * to be processed before returning
+		 */
+		while( batch.number_of_pending_values > 0 )
+		{
+			if( thread_pool->number_of_tasks > 0 )
+			{
+				if( libsigscan_thread_pool_run_task(
+				     thread_pool,
+				     NULL ) != 1 )
+				{
+					return( -1 );
+				}
+			}
+			else
+			{
+				if( libcthreads_condition_wait(
+				     thread_pool->condition,
+				     thread_pool->mutex,
+				     NULL ) != 1 )
+				{
+					return( -1 );
+				}
+			}
+		}
+		if( libcthreads_mutex_release(
+		     thread_pool->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			result = -1;
+		}
+		if( batch.error != NULL )
+		{
+			/* The error of the first value that could not be processed
+			 * is passed on to the caller
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = batch.error;
+			}
+			else
+			{
+				libcerror_error_free(
+				 &( batch.error ) );
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run value: %d.",
+			 function,
+			 batch.error_value_index );
+
+			result = -1;
+		}
+		return( result );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( callback_function(
+		     values[ value_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run value: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
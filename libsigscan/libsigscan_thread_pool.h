@@ -0,0 +1,163 @@
+/*
+ * The thread pool functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSIGSCAN_THREAD_POOL_H )
+#define _LIBSIGSCAN_THREAD_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsigscan_libcerror.h"
+#include "libsigscan_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsigscan_thread_pool_batch libsigscan_thread_pool_batch_t;
+
+struct libsigscan_thread_pool_batch
+{
+	/* The callback function
+	 */
+	int (*callback_function)(
+	       intptr_t *value,
+	       libcerror_error_t **error );
+
+	/* The number of values that have not yet been processed
+	 */
+	int number_of_pending_values;
+
+	/* The index of the first value that could not be processed
+	 */
+	int error_value_index;
+
+	/* The error of the first value that could not be processed
+	 */
+	libcerror_error_t *error;
+};
+
+typedef struct libsigscan_thread_pool_task libsigscan_thread_pool_task_t;
+
+struct libsigscan_thread_pool_task
+{
+	/* The batch
+	 */
+	libsigscan_thread_pool_batch_t *batch;
+
+	/* The value
+	 */
+	intptr_t *value;
+
+	/* The value index
+	 */
+	int value_index;
+};
+
+typedef struct libsigscan_thread_pool libsigscan_thread_pool_t;
+
+struct libsigscan_thread_pool
+{
+	/* The number of threads
+	 * This includes the thread that runs the values
+	 */
+	int number_of_threads;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The worker threads
+	 */
+	libcthreads_thread_t **threads;
+
+	/* The number of worker threads
+	 */
+	int number_of_worker_threads;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition
+	 */
+	libcthreads_condition_t *condition;
+#endif
+	/* The tasks stack
+	 */
+	libsigscan_thread_pool_task_t *tasks;
+
+	/* The number of tasks
+	 */
+	int number_of_tasks;
+
+	/* The number of allocated tasks
+	 */
+	int number_of_allocated_tasks;
+
+	/* Value to indicate the worker threads should stop
+	 */
+	int stop;
+};
+
+int libsigscan_thread_pool_get_default_number_of_threads(
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+int libsigscan_thread_pool_initialize(
+     libsigscan_thread_pool_t **thread_pool,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libsigscan_thread_pool_free(
+     libsigscan_thread_pool_t **thread_pool,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libsigscan_thread_pool_push_tasks(
+     libsigscan_thread_pool_t *thread_pool,
+     libsigscan_thread_pool_batch_t *batch,
+     intptr_t **values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+int libsigscan_thread_pool_run_task(
+     libsigscan_thread_pool_t *thread_pool,
+     libcerror_error_t **error );
+
+int libsigscan_thread_pool_worker(
+     libsigscan_thread_pool_t *thread_pool );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int libsigscan_thread_pool_run_values(
+     libsigscan_thread_pool_t *thread_pool,
+     int (*callback_function)(
+            intptr_t *value,
+            libcerror_error_t **error ),
+     intptr_t **values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSIGSCAN_THREAD_POOL_H ) */
+
@@ -0,0 +1,213 @@
+/*
+ * The compiled file definitions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SIGSCAN_COMPILED_FILE_H )
+#define _SIGSCAN_COMPILED_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* All values are stored in little-endian and all records are aligned to 8 bytes
+ * The compiled file consists of:
+ * the file header
+ * a signature record per signature
+ * a scan tree record per scan tree of the scanner, in order:
+ * header, footer, unbounded and offset range
+ */
+
+typedef struct sigscan_compiled_file_header sigscan_compiled_file_header_t;
+
+struct sigscan_compiled_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The header size
+	 * Consists of 4 bytes
+	 */
+	uint8_t header_size[ 4 ];
+
+	/* The unbounded scan engine
+	 * Consists of 4 bytes
+	 */
+	uint8_t unbounded_scan_engine[ 4 ];
+
+	/* The number of signatures
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_signatures[ 4 ];
+
+	/* The number of scan trees
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_scan_trees[ 4 ];
+
+	/* Unknown (reserved)
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown1[ 4 ];
+};
+
+typedef struct sigscan_compiled_file_signature_record sigscan_compiled_file_signature_record_t;
+
+struct sigscan_compiled_file_signature_record
+{
+	/* The record size
+	 * Consists of 4 bytes
+	 * Contains the size of the record including the pattern, identifiers and padding
+	 */
+	uint8_t record_size[ 4 ];
+
+	/* The signature index
+	 * Consists of 4 bytes
+	 */
+	uint8_t signature_index[ 4 ];
+
+	/* The signature flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t signature_flags[ 4 ];
+
+	/* The range flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t range_flags[ 4 ];
+
+	/* The pattern offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t pattern_offset[ 8 ];
+
+	/* The range start offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t range_start_offset[ 8 ];
+
+	/* The range end offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t range_end_offset[ 8 ];
+
+	/* The pattern size
+	 * Consists of 4 bytes
+	 */
+	uint8_t pattern_size[ 4 ];
+
+	/* The number of identifiers
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_identifiers[ 4 ];
+
+	/* The pattern followed by the identifiers
+	 * every identifier consists of a 4 byte identifier length
+	 * followed by the identifier without end-of-string character
+	 */
+};
+
+typedef struct sigscan_compiled_file_scan_tree_record sigscan_compiled_file_scan_tree_record_t;
+
+struct sigscan_compiled_file_scan_tree_record
+{
+	/* The record size
+	 * Consists of 8 bytes
+	 * Contains the size of the record including the nodes and partition scan tree records
+	 */
+	uint8_t record_size[ 8 ];
+
+	/* The scan tree type
+	 * Consists of 4 bytes
+	 */
+	uint8_t scan_tree_type[ 4 ];
+
+	/* The pattern offsets mode
+	 * Consists of 4 bytes
+	 */
+	uint8_t pattern_offsets_mode[ 4 ];
+
+	/* The number of nodes
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_nodes[ 4 ];
+
+	/* The number of signatures
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_signatures[ 4 ];
+
+	/* The number of partition scan trees
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_partition_scan_trees[ 4 ];
+
+	/* Unknown (reserved)
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown1[ 4 ];
+
+	/* The signature indexes of the compiled scan tree signatures
+	 * every signature index consists of 4 bytes
+	 * followed by padding to a multiple of 8 bytes
+	 * followed by the nodes and the partition scan tree records
+	 */
+};
+
+typedef struct sigscan_compiled_file_scan_tree_node sigscan_compiled_file_scan_tree_node_t;
+
+struct sigscan_compiled_file_scan_tree_node
+{
+	/* The pattern offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t pattern_offset[ 8 ];
+
+	/* The scan object references per byte value
+	 * Consists of 256 x 4 bytes
+	 */
+	uint8_t scan_object_references[ 256 * 4 ];
+
+	/* The default scan object reference
+	 * Consists of 4 bytes
+	 */
+	uint8_t default_scan_object_reference[ 4 ];
+
+	/* Padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t padding[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SIGSCAN_COMPILED_FILE_H ) */
+
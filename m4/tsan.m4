@@ -0,0 +1,82 @@
+dnl Functions for thread sanitizer
+dnl
+dnl Version: 20261016
+
+dnl Function to check whether libtsan is functional
+AC_DEFUN([AX_TESTS_CHECK_LIBTSAN],
+  [AC_MSG_CHECKING([whether libtsan is functional])
+
+  TSAN_CFLAGS="-fno-omit-frame-pointer -fsanitize=thread -g -O1"
+  TSAN_LDFLAGS="-fsanitize=thread"
+
+  BACKUP_CFLAGS="$CFLAGS"
+  BACKUP_LDFLAGS="$LDFLAGS"
+  CFLAGS="$CFLAGS $TSAN_CFLAGS"
+  LDFLAGS="$LDFLAGS $TSAN_LDFLAGS -lpthread"
+  AC_LANG_PUSH(C)
+
+  dnl Check if the compiler and linker support the thread sanitizer flags
+  AC_LINK_IFELSE(
+    [AC_LANG_PROGRAM(
+      [[#include <pthread.h>]],
+      [[pthread_t thread = pthread_self();
+return (int) pthread_equal(thread, thread) - 1;]] )],
+    [ac_cv_have_tsan=check],
+    [ac_cv_have_tsan=no])
+
+  dnl Check if the thread sanitizer detects a data race
+  AS_IF(
+    [test "x$ac_cv_have_tsan" = xcheck],
+    [AC_RUN_IFELSE(
+      [AC_LANG_PROGRAM(
+        [[#include <pthread.h>
+static int value = 0;
+static void *increment(void *arguments) { value++; return arguments; }]],
+        [[pthread_t thread;
+if (pthread_create(&thread, NULL, increment, NULL) != 0) { return 0; }
+value++;
+pthread_join(thread, NULL);]] )],
+        [ac_cv_have_tsan=no],
+        [ac_cv_have_tsan=yes],
+        [ac_cv_have_tsan=undetermined])
+    ])
+
+  AC_LANG_POP(C)
+  CFLAGS="$BACKUP_CFLAGS"
+  LDFLAGS="$BACKUP_LDFLAGS"
+
+  AC_MSG_RESULT(
+    [$ac_cv_have_tsan])
+  ])
+
+dnl Function to detect whether thread sanitizer support should be enabled
+AC_DEFUN([AX_TESTS_CHECK_ENABLE_THREAD_SANITIZER],
+  [AX_COMMON_ARG_ENABLE(
+    [thread-sanitizer],
+    [thread_sanitizer],
+    [build with thread sanitizer],
+    [no])
+
+  AS_IF(
+    [test "x$ac_cv_enable_thread_sanitizer" != xno],
+    [AS_IF(
+      [test "x$ac_cv_enable_asan" != xno],
+      [AC_MSG_FAILURE(
+        [Unable to build with both asan and thread sanitizer],
+        [1])
+      ])
+
+    AX_TESTS_CHECK_LIBTSAN
+
+    AS_IF(
+      [test "x$ac_cv_have_tsan" = xno],
+      [AC_MSG_FAILURE(
+        [Unable to build with functional libtsan],
+        [1])
+      ])
+
+    CFLAGS="$CFLAGS $TSAN_CFLAGS"
+    LDFLAGS="$LDFLAGS $TSAN_LDFLAGS"
+    ])
+  ])
+
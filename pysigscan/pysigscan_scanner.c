@@ -72,6 +72,13 @@ PyMethodDef pysigscan_scanner_object_methods[] = {
 	  "\n"
 	  "Adds a signature." },
 
+	{ "add_range_signature",
+	  (PyCFunction) pysigscan_scanner_add_range_signature,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "add_range_signature(identifier, range_start_offset, range_end_offset, pattern, signature_flags) -> None\n"
+	  "\n"
+	  "Adds a signature that matches anywhere within an offset range." },
+
 	/* Functions for scanning */
 
 	{ "scan_start",
@@ -109,6 +116,22 @@ PyMethodDef pysigscan_scanner_object_methods[] = {
 	  "\n"
 	  "Scans a file using a file-like object." },
 
+	/* Functions for compiled files */
+
+	{ "read_compiled_file",
+	  (PyCFunction) pysigscan_scanner_read_compiled_file,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_compiled_file(filename) -> None\n"
+	  "\n"
+	  "Reads the signatures and scan trees from a compiled file." },
+
+	{ "write_compiled_file",
+	  (PyCFunction) pysigscan_scanner_write_compiled_file,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "write_compiled_file(filename) -> None\n"
+	  "\n"
+	  "Writes the signatures and scan trees to a compiled file." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -671,6 +694,214 @@ PyObject *pysigscan_scanner_add_signature(
 	return( NULL );
 }
 
+/* Adds a signature bound to an offset range
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysigscan_scanner_add_range_signature(
+           pysigscan_scanner_t *pysigscan_scanner,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *string_object      = NULL;
+	PyObject *utf8_string_object = NULL;
+	libcerror_error_t *error     = NULL;
+	static char *function        = "pysigscan_scanner_add_range_signature";
+	static char *keyword_list[]  = { "identifier", "range_start_offset", "range_end_offset", "pattern", "signature_flags", NULL };
+	const char *identifier       = NULL;
+	char *pattern                = NULL;
+	off64_t range_end_offset     = 0;
+	off64_t range_start_offset   = 0;
+	Py_ssize_t identifier_size   = 0;
+	int result                   = 0;
+	int signature_flags          = 0;
+
+#if defined( PY_SSIZE_T_CLEAN )
+	Py_ssize_t pattern_size      = 0;
+#else
+	int pattern_size             = 0;
+#endif
+
+	if( pysigscan_scanner == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "OLLs#i",
+	     keyword_list,
+	     &string_object,
+	     &range_start_offset,
+	     &range_end_offset,
+	     &pattern,
+	     &pattern_size,
+	     &signature_flags ) == 0 )
+	{
+		return( NULL );
+	}
+	PyErr_Clear();
+
+	result = PyObject_IsInstance(
+	          string_object,
+	          (PyObject *) &PyUnicode_Type );
+
+	if( result == -1 )
+	{
+		pysigscan_error_fetch_and_raise(
+	         PyExc_RuntimeError,
+		 "%s: unable to determine if string object is of type unicode.",
+		 function );
+
+		return( NULL );
+	}
+	else if( result != 0 )
+	{
+		PyErr_Clear();
+
+		utf8_string_object = PyUnicode_AsUTF8String(
+		                      string_object );
+
+		if( utf8_string_object == NULL )
+		{
+			pysigscan_error_fetch_and_raise(
+			 PyExc_RuntimeError,
+			 "%s: unable to convert unicode string to UTF-8.",
+			 function );
+
+			return( NULL );
+		}
+#if PY_MAJOR_VERSION >= 3
+		identifier = PyBytes_AsString(
+		              utf8_string_object );
+
+		identifier_size = PyBytes_Size(
+		                   utf8_string_object );
+#else
+		identifier = PyString_AsString(
+		              utf8_string_object );
+
+		identifier_size = PyString_Size(
+		                   utf8_string_object );
+#endif
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libsigscan_scanner_add_range_signature(
+		          pysigscan_scanner->scanner,
+	                  identifier,
+	                  identifier_size,
+	                  range_start_offset,
+	                  range_end_offset,
+	                  (uint8_t *) pattern,
+	                  pattern_size,
+	                  (uint32_t) signature_flags,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		Py_DecRef(
+		 utf8_string_object );
+
+		if( result != 1 )
+		{
+			pysigscan_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to add range signature.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	PyErr_Clear();
+
+#if PY_MAJOR_VERSION >= 3
+	result = PyObject_IsInstance(
+		  string_object,
+		  (PyObject *) &PyBytes_Type );
+#else
+	result = PyObject_IsInstance(
+		  string_object,
+		  (PyObject *) &PyString_Type );
+#endif
+	if( result == -1 )
+	{
+		pysigscan_error_fetch_and_raise(
+	         PyExc_RuntimeError,
+		 "%s: unable to determine if string object is of type string.",
+		 function );
+
+		return( NULL );
+	}
+	else if( result != 0 )
+	{
+		PyErr_Clear();
+
+#if PY_MAJOR_VERSION >= 3
+		identifier = PyBytes_AsString(
+		              string_object );
+
+		identifier_size = PyBytes_Size(
+		                   string_object );
+#else
+		identifier = PyString_AsString(
+		              string_object );
+
+		identifier_size = PyString_Size(
+		                   string_object );
+#endif
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libsigscan_scanner_add_range_signature(
+		          pysigscan_scanner->scanner,
+	                  identifier,
+	                  identifier_size,
+	                  range_start_offset,
+	                  range_end_offset,
+	                  (uint8_t *) pattern,
+	                  pattern_size,
+	                  (uint32_t) signature_flags,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pysigscan_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to add range signature.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	PyErr_Format(
+	 PyExc_TypeError,
+	 "%s: unsupported string object type.",
+	 function );
+
+	return( NULL );
+}
+
 /* Starts the scan
  * Returns a Python object if successful or NULL on error
  */
@@ -1332,3 +1563,407 @@ on_error:
 	return( NULL );
 }
 
+/* Reads the signatures and scan trees from a compiled file
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysigscan_scanner_read_compiled_file(
+           pysigscan_scanner_t *pysigscan_scanner,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *string_object      = NULL;
+	libcerror_error_t *error     = NULL;
+	static char *function        = "pysigscan_scanner_read_compiled_file";
+	static char *keyword_list[]  = { "filename", NULL };
+	const char *filename_narrow  = NULL;
+	int result                   = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	wchar_t *filename_wide       = NULL;
+#else
+	PyObject *utf8_string_object = NULL;
+#endif
+
+	if( pysigscan_scanner == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( NULL );
+	}
+	/* Note that PyArg_ParseTupleAndKeywords with "s" will force Unicode strings to be converted to narrow character string.
+	 * On Windows the narrow character strings contains an extended ASCII string with a codepage. Hence we get a conversion
+	 * exception. This will also fail if the default encoding is not set correctly. We cannot use "u" here either since that
+	 * does not allow us to pass non Unicode string objects and Python (at least 2.7) does not seems to automatically upcast them.
+	 */
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &string_object ) == 0 )
+	{
+		return( NULL );
+	}
+	PyErr_Clear();
+
+	result = PyObject_IsInstance(
+	          string_object,
+	          (PyObject *) &PyUnicode_Type );
+
+	if( result == -1 )
+	{
+		pysigscan_error_fetch_and_raise(
+	         PyExc_RuntimeError,
+		 "%s: unable to determine if string object is of type unicode.",
+		 function );
+
+		return( NULL );
+	}
+	else if( result != 0 )
+	{
+		PyErr_Clear();
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#if PY_MAJOR_VERSION >= 3 && PY_MINOR_VERSION >= 3
+		filename_wide = (wchar_t *) PyUnicode_AsWideCharString(
+		                             string_object,
+		                             NULL );
+#else
+		filename_wide = (wchar_t *) PyUnicode_AsUnicode(
+		                             string_object );
+#endif
+
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libsigscan_scanner_read_compiled_file_wide(
+		          pysigscan_scanner->scanner,
+		          filename_wide,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+#if PY_MAJOR_VERSION >= 3 && PY_MINOR_VERSION >= 3
+		PyMem_Free(
+		 filename_wide );
+#endif
+#else
+		utf8_string_object = PyUnicode_AsUTF8String(
+		                      string_object );
+
+		if( utf8_string_object == NULL )
+		{
+			pysigscan_error_fetch_and_raise(
+			 PyExc_RuntimeError,
+			 "%s: unable to convert unicode string to UTF-8.",
+			 function );
+
+			return( NULL );
+		}
+#if PY_MAJOR_VERSION >= 3
+		filename_narrow = PyBytes_AsString(
+				   utf8_string_object );
+#else
+		filename_narrow = PyString_AsString(
+				   utf8_string_object );
+#endif
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libsigscan_scanner_read_compiled_file(
+		          pysigscan_scanner->scanner,
+		          filename_narrow,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		Py_DecRef(
+		 utf8_string_object );
+#endif
+		if( result != 1 )
+		{
+			pysigscan_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to read compiled file.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	PyErr_Clear();
+
+#if PY_MAJOR_VERSION >= 3
+	result = PyObject_IsInstance(
+		  string_object,
+		  (PyObject *) &PyBytes_Type );
+#else
+	result = PyObject_IsInstance(
+		  string_object,
+		  (PyObject *) &PyString_Type );
+#endif
+	if( result == -1 )
+	{
+		pysigscan_error_fetch_and_raise(
+	         PyExc_RuntimeError,
+		 "%s: unable to determine if string object is of type string.",
+		 function );
+
+		return( NULL );
+	}
+	else if( result != 0 )
+	{
+		PyErr_Clear();
+
+#if PY_MAJOR_VERSION >= 3
+		filename_narrow = PyBytes_AsString(
+				   string_object );
+#else
+		filename_narrow = PyString_AsString(
+				   string_object );
+#endif
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libsigscan_scanner_read_compiled_file(
+		          pysigscan_scanner->scanner,
+		          filename_narrow,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pysigscan_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to read compiled file.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	PyErr_Format(
+	 PyExc_TypeError,
+	 "%s: unsupported string object type.",
+	 function );
+
+	return( NULL );
+}
+
+/* Writes the signatures and scan trees to a compiled file
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysigscan_scanner_write_compiled_file(
+           pysigscan_scanner_t *pysigscan_scanner,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *string_object      = NULL;
+	libcerror_error_t *error     = NULL;
+	static char *function        = "pysigscan_scanner_write_compiled_file";
+	static char *keyword_list[]  = { "filename", NULL };
+	const char *filename_narrow  = NULL;
+	int result                   = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	wchar_t *filename_wide       = NULL;
+#else
+	PyObject *utf8_string_object = NULL;
+#endif
+
+	if( pysigscan_scanner == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid scanner.",
+		 function );
+
+		return( NULL );
+	}
+	/* Note that PyArg_ParseTupleAndKeywords with "s" will force Unicode strings to be converted to narrow character string.
+	 * On Windows the narrow character strings contains an extended ASCII string with a codepage. Hence we get a conversion
+	 * exception. This will also fail if the default encoding is not set correctly. We cannot use "u" here either since that
+	 * does not allow us to pass non Unicode string objects and Python (at least 2.7) does not seems to automatically upcast them.
+	 */
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &string_object ) == 0 )
+	{
+		return( NULL );
+	}
+	PyErr_Clear();
+
+	result = PyObject_IsInstance(
+	          string_object,
+	          (PyObject *) &PyUnicode_Type );
+
+	if( result == -1 )
+	{
+		pysigscan_error_fetch_and_raise(
+	         PyExc_RuntimeError,
+		 "%s: unable to determine if string object is of type unicode.",
+		 function );
+
+		return( NULL );
+	}
+	else if( result != 0 )
+	{
+		PyErr_Clear();
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#if PY_MAJOR_VERSION >= 3 && PY_MINOR_VERSION >= 3
+		filename_wide = (wchar_t *) PyUnicode_AsWideCharString(
+		                             string_object,
+		                             NULL );
+#else
+		filename_wide = (wchar_t *) PyUnicode_AsUnicode(
+		                             string_object );
+#endif
+
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libsigscan_scanner_write_compiled_file_wide(
+		          pysigscan_scanner->scanner,
+		          filename_wide,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+#if PY_MAJOR_VERSION >= 3 && PY_MINOR_VERSION >= 3
+		PyMem_Free(
+		 filename_wide );
+#endif
+#else
+		utf8_string_object = PyUnicode_AsUTF8String(
+		                      string_object );
+
+		if( utf8_string_object == NULL )
+		{
+			pysigscan_error_fetch_and_raise(
+			 PyExc_RuntimeError,
+			 "%s: unable to convert unicode string to UTF-8.",
+			 function );
+
+			return( NULL );
+		}
+#if PY_MAJOR_VERSION >= 3
+		filename_narrow = PyBytes_AsString(
+				   utf8_string_object );
+#else
+		filename_narrow = PyString_AsString(
+				   utf8_string_object );
+#endif
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libsigscan_scanner_write_compiled_file(
+		          pysigscan_scanner->scanner,
+		          filename_narrow,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		Py_DecRef(
+		 utf8_string_object );
+#endif
+		if( result != 1 )
+		{
+			pysigscan_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to write compiled file.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	PyErr_Clear();
+
+#if PY_MAJOR_VERSION >= 3
+	result = PyObject_IsInstance(
+		  string_object,
+		  (PyObject *) &PyBytes_Type );
+#else
+	result = PyObject_IsInstance(
+		  string_object,
+		  (PyObject *) &PyString_Type );
+#endif
+	if( result == -1 )
+	{
+		pysigscan_error_fetch_and_raise(
+	         PyExc_RuntimeError,
+		 "%s: unable to determine if string object is of type string.",
+		 function );
+
+		return( NULL );
+	}
+	else if( result != 0 )
+	{
+		PyErr_Clear();
+
+#if PY_MAJOR_VERSION >= 3
+		filename_narrow = PyBytes_AsString(
+				   string_object );
+#else
+		filename_narrow = PyString_AsString(
+				   string_object );
+#endif
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libsigscan_scanner_write_compiled_file(
+		          pysigscan_scanner->scanner,
+		          filename_narrow,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pysigscan_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to write compiled file.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	PyErr_Format(
+	 PyExc_TypeError,
+	 "%s: unsupported string object type.",
+	 function );
+
+	return( NULL );
+}
+
@@ -71,6 +71,11 @@ PyObject *pysigscan_scanner_add_signature(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pysigscan_scanner_add_range_signature(
+           pysigscan_scanner_t *pysigscan_scanner,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pysigscan_scanner_scan_start(
            pysigscan_scanner_t *pysigscan_scanner,
            PyObject *arguments,
@@ -96,6 +101,16 @@ PyObject *pysigscan_scanner_scan_file_object(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pysigscan_scanner_read_compiled_file(
+           pysigscan_scanner_t *pysigscan_scanner,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pysigscan_scanner_write_compiled_file(
+           pysigscan_scanner_t *pysigscan_scanner,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
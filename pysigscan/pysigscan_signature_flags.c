@@ -214,6 +214,20 @@ int pysigscan_signature_flags_init_type(
 	{
 		goto on_error;
 	}
+#if PY_MAJOR_VERSION >= 3
+	value_object = PyLong_FromLong(
+	                LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RANGE );
+#else
+	value_object = PyInt_FromLong(
+	                LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RANGE );
+#endif
+	if( PyDict_SetItemString(
+	     type_object->tp_dict,
+	     "OFFSET_RANGE",
+	     value_object ) != 0 )
+	{
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #include "scan_handle.h"
@@ -213,6 +214,105 @@ int scan_handle_signal_abort(
 	return( 1 );
 }
 
+/* Sets the I/O strategy
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int scan_handle_set_io_strategy(
+     scan_handle_t *scan_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_set_io_strategy";
+	size_t string_length  = 0;
+	int io_strategy       = 0;
+	int result            = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "bfio" ),
+		     4 ) == 0 )
+		{
+			io_strategy = LIBSIGSCAN_IO_STRATEGY_BFIO;
+			result      = 1;
+		}
+	}
+	else if( string_length == 6 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "direct" ),
+		     6 ) == 0 )
+		{
+			io_strategy = LIBSIGSCAN_IO_STRATEGY_DIRECT;
+			result      = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "mapped" ),
+		          6 ) == 0 )
+		{
+			io_strategy = LIBSIGSCAN_IO_STRATEGY_MAPPED;
+			result      = 1;
+		}
+	}
+	else if( string_length == 8 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "buffered" ),
+		     8 ) == 0 )
+		{
+			io_strategy = LIBSIGSCAN_IO_STRATEGY_BUFFERED;
+			result      = 1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libsigscan_scanner_set_io_strategy(
+		     scan_handle->scanner,
+		     io_strategy,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set I/O strategy in scanner.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
 /* Copies the string to an offset
  * Returns 1 if successful or -1 on error
  */
@@ -965,6 +1065,96 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the signatures from a compiled signatures file
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_read_compiled_signatures(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_read_compiled_signatures";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libsigscan_scanner_read_compiled_file_wide(
+	     scan_handle->scanner,
+	     filename,
+	     error ) != 1 )
+#else
+	if( libsigscan_scanner_read_compiled_file(
+	     scan_handle->scanner,
+	     filename,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compiled file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the signatures to a compiled signatures file
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_write_compiled_signatures(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_write_compiled_signatures";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libsigscan_scanner_write_compiled_file_wide(
+	     scan_handle->scanner,
+	     filename,
+	     error ) != 1 )
+#else
+	if( libsigscan_scanner_write_compiled_file(
+	     scan_handle->scanner,
+	     filename,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write compiled file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Scans the input
  * Returns 1 if successful or -1 on error
  */
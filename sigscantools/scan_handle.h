@@ -62,6 +62,11 @@ int scan_handle_signal_abort(
      scan_handle_t *scan_handle,
      libcerror_error_t **error );
 
+int scan_handle_set_io_strategy(
+     scan_handle_t *scan_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int scan_handle_copy_string_to_offset(
      const uint8_t *string,
      size_t string_size,
@@ -80,6 +85,16 @@ int scan_handle_read_signature_definitions(
      const system_character_t *filename,
      libcerror_error_t **error );
 
+int scan_handle_read_compiled_signatures(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int scan_handle_write_compiled_signatures(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
 int scan_handle_scan_input(
      scan_handle_t *scan_handle,
      libsigscan_scan_state_t *scan_state,
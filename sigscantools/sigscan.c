@@ -111,7 +111,10 @@ int main( int argc, char * const argv[] )
 
 	sigscantools_option_t options[ ] = {
 		{ 'c', "path", "specify the configuration file, defaults to: sigscan.conf" },
+		{ 'C', "path", "write the compiled signatures to a file, the source is optional" },
 		{ 'h', NULL, "shows this help" },
+		{ 'i', "path", "specify a compiled signatures file to use instead of the configuration file" },
+		{ 's', "strategy", "specify the I/O strategy used to read the source, options: bfio (default), buffered, direct, mapped" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
 		{ 0, "source", "the source image" },
@@ -119,12 +122,16 @@ int main( int argc, char * const argv[] )
 	system_character_t options_string[ 32 ];
 
 	libcerror_error_t *error                      = NULL;
+	system_character_t *option_compiled_file      = NULL;
 	system_character_t *option_configuration_file = _SYSTEM_STRING( "sigscan.conf" );
+	system_character_t *option_io_strategy        = NULL;
+	system_character_t *option_output_file        = NULL;
 	system_character_t *source                    = NULL;
 	libsigscan_scan_state_t *scan_state           = NULL;
 	char *program                                 = "sigscan";
 	system_integer_t option                       = 0;
 	int number_of_options                         = (int) ( sizeof( options ) / sizeof( sigscantools_option_t ) );
+	int result                                    = 0;
 	int verbose                                   = 0;
 
 #if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
@@ -202,6 +209,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'C':
+				option_output_file = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
 				sigscantools_getopt_usage_fprint(
 				 stdout,
@@ -212,6 +224,16 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'i':
+				option_compiled_file = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_io_strategy = optarg;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -224,7 +246,8 @@ int main( int argc, char * const argv[] )
 				return( EXIT_SUCCESS );
 		}
 	}
-	if( optind == argc )
+	if( ( optind == argc )
+	 && ( option_output_file == NULL ) )
 	{
 		fprintf(
 		 stderr,
@@ -239,7 +262,10 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
-	source = argv[ optind ];
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
 
 	libcnotify_verbose_set(
 	 verbose );
@@ -261,6 +287,28 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( option_io_strategy != NULL )
+	{
+		result = scan_handle_set_io_strategy(
+		          sigscan_scan_handle,
+		          option_io_strategy,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set I/O strategy.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported I/O strategy defaulting to: bfio.\n" );
+		}
+	}
 	if( libsigscan_scan_state_initialize(
 	     &scan_state,
 	     &error ) != 1 )
@@ -271,30 +319,66 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( scan_handle_read_signature_definitions(
-	     sigscan_scan_handle,
-	     option_configuration_file,
-	     &error ) != 1 )
+	if( option_compiled_file != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to read signatures from: %" PRIs_SYSTEM ".\n",
-		 option_configuration_file );
+		if( scan_handle_read_compiled_signatures(
+		     sigscan_scan_handle,
+		     option_compiled_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read compiled signatures from: %" PRIs_SYSTEM ".\n",
+			 option_compiled_file );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	if( scan_handle_scan_input(
-	     sigscan_scan_handle,
-	     scan_state,
-	     source,
-	     &error ) != 1 )
+	else
 	{
-		fprintf(
-		 stderr,
-		 "Unable to scan: %" PRIs_SYSTEM ".\n",
-		 source );
+		if( scan_handle_read_signature_definitions(
+		     sigscan_scan_handle,
+		     option_configuration_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read signatures from: %" PRIs_SYSTEM ".\n",
+			 option_configuration_file );
 
-		goto on_error;
+			goto on_error;
+		}
+	}
+	if( option_output_file != NULL )
+	{
+		if( scan_handle_write_compiled_signatures(
+		     sigscan_scan_handle,
+		     option_output_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write compiled signatures to: %" PRIs_SYSTEM ".\n",
+			 option_output_file );
+
+			goto on_error;
+		}
+	}
+	if( source != NULL )
+	{
+		if( scan_handle_scan_input(
+		     sigscan_scan_handle,
+		     scan_state,
+		     source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to scan: %" PRIs_SYSTEM ".\n",
+			 source );
+
+			goto on_error;
+		}
 	}
 	if( libsigscan_scan_state_free(
 	     &scan_state,
@@ -0,0 +1,334 @@
+/*
+ * Scanner scan tree construction benchmark program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <time.h>
+
+#include "sigscan_test_getopt.h"
+#include "sigscan_test_libsigscan.h"
+
+/* The benchmark scenarios
+ */
+enum SIGSCAN_BENCHMARK_SCENARIOS
+{
+	SIGSCAN_BENCHMARK_SCENARIO_OFFSET_ZERO,
+	SIGSCAN_BENCHMARK_SCENARIO_UNBOUNDED
+};
+
+/* Generates a pseudo random value
+ * Returns the value
+ */
+uint32_t sigscan_benchmark_random(
+          uint32_t *random_state )
+{
+	*random_state ^= *random_state << 13;
+	*random_state ^= *random_state >> 17;
+	*random_state ^= *random_state << 5;
+
+	return( *random_state );
+}
+
+/* Adds pseudo random signatures to a scanner and builds the scan trees
+ * Returns 1 if successful or -1 on error
+ */
+int sigscan_benchmark_scanner_build(
+     int scenario,
+     int number_of_signatures,
+     double *add_time,
+     double *build_time,
+     libsigscan_error_t **error )
+{
+	char identifier[ 32 ];
+	uint8_t pattern[ 16 ];
+
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	clock_t start_clock                 = 0;
+	size_t identifier_length            = 0;
+	size_t pattern_index                = 0;
+	size_t pattern_size                 = 0;
+	uint32_t random_state               = 0x12345678UL;
+	uint32_t signature_flags            = 0;
+	int signature_index                 = 0;
+
+	if( libsigscan_scanner_initialize(
+	     &scanner,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	start_clock = clock();
+
+	for( signature_index = 0;
+	     signature_index < number_of_signatures;
+	     signature_index++ )
+	{
+		pattern_size = 4 + ( sigscan_benchmark_random( &random_state ) % 12 );
+
+		for( pattern_index = 0;
+		     pattern_index < pattern_size;
+		     pattern_index++ )
+		{
+			pattern[ pattern_index ] = (uint8_t) sigscan_benchmark_random( &random_state );
+		}
+		switch( scenario )
+		{
+			case SIGSCAN_BENCHMARK_SCENARIO_UNBOUNDED:
+				signature_flags = LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET;
+				break;
+
+			default:
+				signature_flags = LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START;
+				break;
+		}
+		identifier_length = (size_t) snprintf(
+		                              identifier,
+		                              32,
+		                              "signature%d",
+		                              signature_index );
+
+		if( libsigscan_scanner_add_signature(
+		     scanner,
+		     identifier,
+		     identifier_length,
+		     0,
+		     pattern,
+		     pattern_size,
+		     signature_flags,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	*add_time = (double) ( clock() - start_clock ) / CLOCKS_PER_SEC;
+
+	if( libsigscan_scan_state_initialize(
+	     &scan_state,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	start_clock = clock();
+
+	/* Starting the first scan builds the scan trees
+	 */
+	if( libsigscan_scanner_scan_start(
+	     scanner,
+	     scan_state,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	*build_time = (double) ( clock() - start_clock ) / CLOCKS_PER_SEC;
+
+	if( libsigscan_scanner_scan_stop(
+	     scanner,
+	     scan_state,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libsigscan_scan_state_free(
+	     &scan_state,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libsigscan_scanner_free(
+	     &scanner,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	const char *scenario_names[ 2 ] = {
+		"offset 0",
+		"unbounded" };
+
+	libsigscan_error_t *error          = NULL;
+	system_character_t *option_maximum = NULL;
+	system_integer_t option            = 0;
+	double add_time                    = 0.0;
+	double build_time                  = 0.0;
+	double previous_build_time         = 0.0;
+	int maximum_number_of_signatures   = 16384;
+	int number_of_signatures           = 0;
+	int scenario                       = 0;
+
+	while( ( option = sigscan_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "n:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) 'n':
+				option_maximum = optarg;
+
+				break;
+
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( option_maximum != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		maximum_number_of_signatures = (int) wcstol(
+		                                      option_maximum,
+		                                      NULL,
+		                                      10 );
+#else
+		maximum_number_of_signatures = (int) strtol(
+		                                      option_maximum,
+		                                      NULL,
+		                                      10 );
+#endif
+		if( maximum_number_of_signatures < 1024 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported maximum number of signatures, expected 1024 or more.\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	fprintf(
+	 stdout,
+	 "%-12s %10s %10s %10s %8s\n",
+	 "scenario",
+	 "signatures",
+	 "add (s)",
+	 "build (s)",
+	 "ratio" );
+
+	for( scenario = SIGSCAN_BENCHMARK_SCENARIO_OFFSET_ZERO;
+	     scenario <= SIGSCAN_BENCHMARK_SCENARIO_UNBOUNDED;
+	     scenario++ )
+	{
+		previous_build_time = 0.0;
+
+		/* Every step doubles the number of signatures, hence a build time ratio
+		 * close to 2 indicates a build time that scales near linearly
+		 */
+		for( number_of_signatures = 1024;
+		     number_of_signatures <= maximum_number_of_signatures;
+		     number_of_signatures *= 2 )
+		{
+			if( sigscan_benchmark_scanner_build(
+			     scenario,
+			     number_of_signatures,
+			     &add_time,
+			     &build_time,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to build scanner with %d signatures.\n",
+				 number_of_signatures );
+
+				goto on_error;
+			}
+			fprintf(
+			 stdout,
+			 "%-12s %10d %10.3f %10.3f",
+			 scenario_names[ scenario ],
+			 number_of_signatures,
+			 add_time,
+			 build_time );
+
+			if( previous_build_time > 0.0 )
+			{
+				fprintf(
+				 stdout,
+				 " %8.2f",
+				 build_time / previous_build_time );
+			}
+			fprintf(
+			 stdout,
+			 "\n" );
+
+			previous_build_time = build_time;
+
+			if( number_of_signatures > ( maximum_number_of_signatures / 2 ) )
+			{
+				break;
+			}
+		}
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libsigscan_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libsigscan_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
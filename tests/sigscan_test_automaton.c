@@ -0,0 +1,1204 @@
+/*
+ * Library automaton type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "sigscan_test_libcdata.h"
+#include "sigscan_test_libcerror.h"
+#include "sigscan_test_libsigscan.h"
+#include "sigscan_test_macros.h"
+#include "sigscan_test_memory.h"
+#include "sigscan_test_unused.h"
+
+#include "../libsigscan/libsigscan_automaton.h"
+#include "../libsigscan/libsigscan_definitions.h"
+#include "../libsigscan/libsigscan_signature.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+
+/* Tests the libsigscan_automaton_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_automaton_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libsigscan_automaton_t *automaton = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int number_of_memset_fail_tests   = 2;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsigscan_automaton_initialize(
+	          &automaton,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "automaton",
+	 automaton );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_automaton_free(
+	          &automaton,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "automaton",
+	 automaton );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_automaton_initialize(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	automaton = (libsigscan_automaton_t *) 0x12345678UL;
+
+	result = libsigscan_automaton_initialize(
+	          &automaton,
+	          &error );
+
+	automaton = NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_automaton_initialize with malloc failing
+		 */
+		sigscan_test_malloc_attempts_before_fail = test_number;
+
+		result = libsigscan_automaton_initialize(
+		          &automaton,
+		          &error );
+
+		if( sigscan_test_malloc_attempts_before_fail != -1 )
+		{
+			sigscan_test_malloc_attempts_before_fail = -1;
+
+			if( automaton != NULL )
+			{
+				libsigscan_automaton_free(
+				 &automaton,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "automaton",
+			 automaton );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_automaton_initialize with memset failing
+		 */
+		sigscan_test_memset_attempts_before_fail = test_number;
+
+		result = libsigscan_automaton_initialize(
+		          &automaton,
+		          &error );
+
+		if( sigscan_test_memset_attempts_before_fail != -1 )
+		{
+			sigscan_test_memset_attempts_before_fail = -1;
+
+			if( automaton != NULL )
+			{
+				libsigscan_automaton_free(
+				 &automaton,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "automaton",
+			 automaton );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SIGSCAN_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( automaton != NULL )
+	{
+		libsigscan_automaton_free(
+		 &automaton,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_automaton_free function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_automaton_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsigscan_automaton_free(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_automaton_build function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_automaton_build(
+     void )
+{
+	libcdata_list_t *signatures_list  = NULL;
+	libcerror_error_t *error          = NULL;
+	libsigscan_automaton_t *automaton = NULL;
+	libsigscan_signature_t *signature = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_list_initialize(
+	          &signatures_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_initialize(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signature",
+	 signature );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_set(
+	          signature,
+	          "pattern",
+	          7,
+	          0,
+	          (uint8_t *) "pattern",
+	          7,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_append_value(
+	          signatures_list,
+	          (intptr_t *) signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	signature = NULL;
+
+	result = libsigscan_signature_initialize(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signature",
+	 signature );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_set(
+	          signature,
+	          "tern",
+	          4,
+	          0,
+	          (uint8_t *) "tern",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_append_value(
+	          signatures_list,
+	          (intptr_t *) signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	signature = NULL;
+
+	result = libsigscan_signature_initialize(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signature",
+	 signature );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_set(
+	          signature,
+	          "header",
+	          6,
+	          0,
+	          (uint8_t *) "header",
+	          6,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_append_value(
+	          signatures_list,
+	          (intptr_t *) signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	signature = NULL;
+
+	result = libsigscan_automaton_initialize(
+	          &automaton,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "automaton",
+	 automaton );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_automaton_build(
+	          automaton,
+	          signatures_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The root state, 7 states for "pattern" and 4 states for "tern"
+	 * the signature with an offset relative from start is not added
+	 */
+	SIGSCAN_TEST_ASSERT_EQUAL_UINT32(
+	 "automaton->number_of_states",
+	 automaton->number_of_states,
+	 (uint32_t) 12 );
+
+	/* Test error cases
+	 */
+	result = libsigscan_automaton_build(
+	          NULL,
+	          signatures_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_automaton_build(
+	          automaton,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_automaton_free(
+	          &automaton,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "automaton",
+	 automaton );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_free(
+	          &signatures_list,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( signature != NULL )
+	{
+		libsigscan_signature_free(
+		 &signature,
+		 NULL );
+	}
+	if( automaton != NULL )
+	{
+		libsigscan_automaton_free(
+		 &automaton,
+		 NULL );
+	}
+	if( signatures_list != NULL )
+	{
+		libcdata_list_free(
+		 &signatures_list,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_automaton_scan_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_automaton_scan_buffer(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcdata_list_t *signatures_list  = NULL;
+	libcerror_error_t *error          = NULL;
+	libsigscan_automaton_t *automaton = NULL;
+	libsigscan_signature_t *signature = NULL;
+	void *memcpy_result               = NULL;
+	void *memset_result               = NULL;
+	size_t buffer_offset              = 0;
+	uint32_t state_index              = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 buffer,
+	                 0,
+	                 sizeof( uint8_t ) * 16 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	memcpy_result = memory_copy(
+	                 &( buffer[ 2 ] ),
+	                 "pattern",
+	                 sizeof( uint8_t ) * 7 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	result = libcdata_list_initialize(
+	          &signatures_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_initialize(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signature",
+	 signature );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_set(
+	          signature,
+	          "pattern",
+	          7,
+	          0,
+	          (uint8_t *) "pattern",
+	          7,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_append_value(
+	          signatures_list,
+	          (intptr_t *) signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	signature = NULL;
+
+	result = libsigscan_signature_initialize(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signature",
+	 signature );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_set(
+	          signature,
+	          "tern",
+	          4,
+	          0,
+	          (uint8_t *) "tern",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_append_value(
+	          signatures_list,
+	          (intptr_t *) signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	signature = NULL;
+
+	result = libsigscan_signature_initialize(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signature",
+	 signature );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_set(
+	          signature,
+	          "header",
+	          6,
+	          0,
+	          (uint8_t *) "header",
+	          6,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_append_value(
+	          signatures_list,
+	          (intptr_t *) signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	signature = NULL;
+
+	result = libsigscan_automaton_initialize(
+	          &automaton,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "automaton",
+	 automaton );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_automaton_build(
+	          automaton,
+	          signatures_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_automaton_scan_buffer(
+	          automaton,
+	          &state_index,
+	          buffer,
+	          16,
+	          &buffer_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_offset",
+	 buffer_offset,
+	 (size_t) 9 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Both "pattern" and "tern" end at the last consumed byte
+	 */
+	SIGSCAN_TEST_ASSERT_NOT_EQUAL_INT32(
+	 "automaton->states[ state_index ].first_output_index",
+	 (int32_t) automaton->states[ state_index ].first_output_index,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_NOT_EQUAL_INT32(
+	 "automaton->states[ state_index ].output_state_index",
+	 (int32_t) automaton->states[ state_index ].output_state_index,
+	 0 );
+
+	result = libsigscan_automaton_scan_buffer(
+	          automaton,
+	          &state_index,
+	          buffer,
+	          16,
+	          &buffer_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_offset",
+	 buffer_offset,
+	 (size_t) 16 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a pattern that spans buffers
+	 */
+	state_index   = 0;
+	buffer_offset = 0;
+
+	result = libsigscan_automaton_scan_buffer(
+	          automaton,
+	          &state_index,
+	          buffer,
+	          6,
+	          &buffer_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffer_offset = 0;
+
+	result = libsigscan_automaton_scan_buffer(
+	          automaton,
+	          &state_index,
+	          &( buffer[ 6 ] ),
+	          10,
+	          &buffer_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_offset",
+	 buffer_offset,
+	 (size_t) 3 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	state_index   = 0;
+	buffer_offset = 0;
+
+	result = libsigscan_automaton_scan_buffer(
+	          NULL,
+	          &state_index,
+	          buffer,
+	          16,
+	          &buffer_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_automaton_scan_buffer(
+	          automaton,
+	          NULL,
+	          buffer,
+	          16,
+	          &buffer_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	state_index = automaton->number_of_states;
+
+	result = libsigscan_automaton_scan_buffer(
+	          automaton,
+	          &state_index,
+	          buffer,
+	          16,
+	          &buffer_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	state_index = 0;
+
+	result = libsigscan_automaton_scan_buffer(
+	          automaton,
+	          &state_index,
+	          NULL,
+	          16,
+	          &buffer_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_automaton_scan_buffer(
+	          automaton,
+	          &state_index,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          &buffer_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_automaton_scan_buffer(
+	          automaton,
+	          &state_index,
+	          buffer,
+	          16,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_automaton_free(
+	          &automaton,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "automaton",
+	 automaton );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_free(
+	          &signatures_list,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( signature != NULL )
+	{
+		libsigscan_signature_free(
+		 &signature,
+		 NULL );
+	}
+	if( automaton != NULL )
+	{
+		libsigscan_automaton_free(
+		 &automaton,
+		 NULL );
+	}
+	if( signatures_list != NULL )
+	{
+		libcdata_list_free(
+		 &signatures_list,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argc )
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_automaton_initialize",
+	 sigscan_test_automaton_initialize );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_automaton_free",
+	 sigscan_test_automaton_free );
+
+	/* TODO: add tests for libsigscan_automaton_append_state */
+
+	/* TODO: add tests for libsigscan_automaton_append_transition */
+
+	/* TODO: add tests for libsigscan_automaton_append_output */
+
+	/* TODO: add tests for libsigscan_automaton_get_transition */
+
+	/* TODO: add tests for libsigscan_automaton_add_signature */
+
+	/* TODO: add tests for libsigscan_automaton_fill_failure_states */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_automaton_build",
+	 sigscan_test_automaton_build );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_automaton_scan_buffer",
+	 sigscan_test_automaton_scan_buffer );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,696 @@
+/*
+ * Library compiled_file type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "sigscan_test_libcerror.h"
+#include "sigscan_test_libsigscan.h"
+#include "sigscan_test_macros.h"
+#include "sigscan_test_memory.h"
+#include "sigscan_test_unused.h"
+
+#include "../libsigscan/libsigscan_compiled_file.h"
+#include "../libsigscan/libsigscan_definitions.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+
+/* Tests the libsigscan_compiled_file_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_compiled_file_initialize(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libsigscan_compiled_file_t *compiled_file = NULL;
+	int result                                = 0;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+	int number_of_malloc_fail_tests           = 1;
+	int number_of_memset_fail_tests           = 1;
+	int test_number                           = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsigscan_compiled_file_initialize(
+	          &compiled_file,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "compiled_file",
+	 compiled_file );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_compiled_file_free(
+	          &compiled_file,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "compiled_file",
+	 compiled_file );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_compiled_file_initialize(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compiled_file = (libsigscan_compiled_file_t *) 0x12345678UL;
+
+	result = libsigscan_compiled_file_initialize(
+	          &compiled_file,
+	          &error );
+
+	compiled_file = NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_compiled_file_initialize with malloc failing
+		 */
+		sigscan_test_malloc_attempts_before_fail = test_number;
+
+		result = libsigscan_compiled_file_initialize(
+		          &compiled_file,
+		          &error );
+
+		if( sigscan_test_malloc_attempts_before_fail != -1 )
+		{
+			sigscan_test_malloc_attempts_before_fail = -1;
+
+			if( compiled_file != NULL )
+			{
+				libsigscan_compiled_file_free(
+				 &compiled_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "compiled_file",
+			 compiled_file );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_compiled_file_initialize with memset failing
+		 */
+		sigscan_test_memset_attempts_before_fail = test_number;
+
+		result = libsigscan_compiled_file_initialize(
+		          &compiled_file,
+		          &error );
+
+		if( sigscan_test_memset_attempts_before_fail != -1 )
+		{
+			sigscan_test_memset_attempts_before_fail = -1;
+
+			if( compiled_file != NULL )
+			{
+				libsigscan_compiled_file_free(
+				 &compiled_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "compiled_file",
+			 compiled_file );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SIGSCAN_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compiled_file != NULL )
+	{
+		libsigscan_compiled_file_free(
+		 &compiled_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_compiled_file_free function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_compiled_file_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsigscan_compiled_file_free(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_compiled_file_open function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_compiled_file_open(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libsigscan_compiled_file_t *compiled_file = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_compiled_file_initialize(
+	          &compiled_file,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "compiled_file",
+	 compiled_file );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_compiled_file_open(
+	          NULL,
+	          "test",
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_compiled_file_open(
+	          compiled_file,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_compiled_file_open(
+	          compiled_file,
+	          "sigscan_test_compiled_file_does_not_exist",
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_compiled_file_free(
+	          &compiled_file,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "compiled_file",
+	 compiled_file );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compiled_file != NULL )
+	{
+		libsigscan_compiled_file_free(
+		 &compiled_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_compiled_file_read_file_header function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_compiled_file_read_file_header(
+     void )
+{
+	uint8_t file_header_data[ 32 ] = {
+		'S', 'I', 'G', 'S', 'C', 'A', 'N', 'C', 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error                  = NULL;
+	libsigscan_compiled_file_t *compiled_file = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_compiled_file_initialize(
+	          &compiled_file,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "compiled_file",
+	 compiled_file );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compiled_file->data      = file_header_data;
+	compiled_file->data_size = 32;
+
+	/* Test regular cases
+	 */
+	result = libsigscan_compiled_file_read_file_header(
+	          compiled_file,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "compiled_file->unbounded_scan_engine",
+	 compiled_file->unbounded_scan_engine,
+	 LIBSIGSCAN_SCAN_ENGINE_SCAN_TREE );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_UINT32(
+	 "compiled_file->number_of_signatures",
+	 compiled_file->number_of_signatures,
+	 (uint32_t) 0 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "compiled_file->data_offset",
+	 compiled_file->data_offset,
+	 (size_t) 32 );
+
+	/* Test error cases
+	 */
+	result = libsigscan_compiled_file_read_file_header(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compiled_file->data_size = 16;
+
+	result = libsigscan_compiled_file_read_file_header(
+	          compiled_file,
+	          &error );
+
+	compiled_file->data_size = 32;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the signature is invalid
+	 */
+	file_header_data[ 0 ] = 0xff;
+
+	result = libsigscan_compiled_file_read_file_header(
+	          compiled_file,
+	          &error );
+
+	file_header_data[ 0 ] = 'S';
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the format version is unsupported
+	 */
+	file_header_data[ 8 ] = 0xff;
+
+	result = libsigscan_compiled_file_read_file_header(
+	          compiled_file,
+	          &error );
+
+	file_header_data[ 8 ] = 0x01;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the unbounded scan engine is unsupported
+	 */
+	file_header_data[ 16 ] = 0xff;
+
+	result = libsigscan_compiled_file_read_file_header(
+	          compiled_file,
+	          &error );
+
+	file_header_data[ 16 ] = 0x01;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the number of signatures is out of bounds
+	 */
+	file_header_data[ 23 ] = 0x01;
+
+	result = libsigscan_compiled_file_read_file_header(
+	          compiled_file,
+	          &error );
+
+	file_header_data[ 23 ] = 0x00;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the number of scan trees is unsupported
+	 */
+	file_header_data[ 24 ] = 0x03;
+
+	result = libsigscan_compiled_file_read_file_header(
+	          compiled_file,
+	          &error );
+
+	file_header_data[ 24 ] = 0x04;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	compiled_file->data      = NULL;
+	compiled_file->data_size = 0;
+
+	result = libsigscan_compiled_file_free(
+	          &compiled_file,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "compiled_file",
+	 compiled_file );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compiled_file != NULL )
+	{
+		compiled_file->data = NULL;
+
+		libsigscan_compiled_file_free(
+		 &compiled_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argc )
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_compiled_file_initialize",
+	 sigscan_test_compiled_file_initialize );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_compiled_file_free",
+	 sigscan_test_compiled_file_free );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_compiled_file_open",
+	 sigscan_test_compiled_file_open );
+
+	/* TODO: add tests for libsigscan_compiled_file_open_file_io_handle */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_compiled_file_read_file_header",
+	 sigscan_test_compiled_file_read_file_header );
+
+	/* TODO: add tests for libsigscan_compiled_file_read_signatures */
+
+	/* TODO: add tests for libsigscan_compiled_file_read_scan_tree */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1347 @@
+/*
+ * Library compiled_scan_tree type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "sigscan_test_libcdata.h"
+#include "sigscan_test_libcerror.h"
+#include "sigscan_test_libsigscan.h"
+#include "sigscan_test_macros.h"
+#include "sigscan_test_memory.h"
+#include "sigscan_test_unused.h"
+
+#include "../libsigscan/libsigscan_compiled_scan_tree.h"
+#include "../libsigscan/libsigscan_definitions.h"
+#include "../libsigscan/libsigscan_scan_tree.h"
+#include "../libsigscan/libsigscan_scan_tree_node.h"
+#include "../libsigscan/libsigscan_signature.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+
+/* Tests the libsigscan_compiled_scan_tree_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_compiled_scan_tree_initialize(
+     void )
+{
+	libcerror_error_t *error                            = NULL;
+	libsigscan_compiled_scan_tree_t *compiled_scan_tree = NULL;
+	int result                                          = 0;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+	int number_of_malloc_fail_tests                     = 1;
+	int number_of_memset_fail_tests                     = 1;
+	int test_number                                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsigscan_compiled_scan_tree_initialize(
+	          &compiled_scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "compiled_scan_tree",
+	 compiled_scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_compiled_scan_tree_free(
+	          &compiled_scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "compiled_scan_tree",
+	 compiled_scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_compiled_scan_tree_initialize(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compiled_scan_tree = (libsigscan_compiled_scan_tree_t *) 0x12345678UL;
+
+	result = libsigscan_compiled_scan_tree_initialize(
+	          &compiled_scan_tree,
+	          &error );
+
+	compiled_scan_tree = NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_compiled_scan_tree_initialize with malloc failing
+		 */
+		sigscan_test_malloc_attempts_before_fail = test_number;
+
+		result = libsigscan_compiled_scan_tree_initialize(
+		          &compiled_scan_tree,
+		          &error );
+
+		if( sigscan_test_malloc_attempts_before_fail != -1 )
+		{
+			sigscan_test_malloc_attempts_before_fail = -1;
+
+			if( compiled_scan_tree != NULL )
+			{
+				libsigscan_compiled_scan_tree_free(
+				 &compiled_scan_tree,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "compiled_scan_tree",
+			 compiled_scan_tree );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_compiled_scan_tree_initialize with memset failing
+		 */
+		sigscan_test_memset_attempts_before_fail = test_number;
+
+		result = libsigscan_compiled_scan_tree_initialize(
+		          &compiled_scan_tree,
+		          &error );
+
+		if( sigscan_test_memset_attempts_before_fail != -1 )
+		{
+			sigscan_test_memset_attempts_before_fail = -1;
+
+			if( compiled_scan_tree != NULL )
+			{
+				libsigscan_compiled_scan_tree_free(
+				 &compiled_scan_tree,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "compiled_scan_tree",
+			 compiled_scan_tree );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SIGSCAN_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compiled_scan_tree != NULL )
+	{
+		libsigscan_compiled_scan_tree_free(
+		 &compiled_scan_tree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_compiled_scan_tree_free function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_compiled_scan_tree_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsigscan_compiled_scan_tree_free(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_compiled_scan_tree_compile function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_compiled_scan_tree_compile(
+     void )
+{
+	libcerror_error_t *error                            = NULL;
+	libsigscan_compiled_scan_tree_t *compiled_scan_tree = NULL;
+	libsigscan_scan_tree_node_t *scan_tree_node         = NULL;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_compiled_scan_tree_initialize(
+	          &compiled_scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "compiled_scan_tree",
+	 compiled_scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_node_initialize(
+	          &scan_tree_node,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_tree_node",
+	 scan_tree_node );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_compiled_scan_tree_compile(
+	          compiled_scan_tree,
+	          scan_tree_node,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_UINT32(
+	 "compiled_scan_tree->number_of_nodes",
+	 compiled_scan_tree->number_of_nodes,
+	 (uint32_t) 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_UINT32(
+	 "compiled_scan_tree->number_of_signatures",
+	 compiled_scan_tree->number_of_signatures,
+	 (uint32_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libsigscan_compiled_scan_tree_compile(
+	          NULL,
+	          scan_tree_node,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the compiled scan tree already contains nodes
+	 */
+	result = libsigscan_compiled_scan_tree_compile(
+	          compiled_scan_tree,
+	          scan_tree_node,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_compiled_scan_tree_free(
+	          &compiled_scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "compiled_scan_tree",
+	 compiled_scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_compiled_scan_tree_initialize(
+	          &compiled_scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "compiled_scan_tree",
+	 compiled_scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_compiled_scan_tree_compile(
+	          compiled_scan_tree,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_compiled_scan_tree_free(
+	          &compiled_scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "compiled_scan_tree",
+	 compiled_scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_node_free(
+	          &scan_tree_node,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_tree_node",
+	 scan_tree_node );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_tree_node != NULL )
+	{
+		libsigscan_scan_tree_node_free(
+		 &scan_tree_node,
+		 NULL );
+	}
+	if( compiled_scan_tree != NULL )
+	{
+		libsigscan_compiled_scan_tree_free(
+		 &compiled_scan_tree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_compiled_scan_tree_scan_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_compiled_scan_tree_scan_buffer(
+     void )
+{
+	uint8_t buffer[ 128 ];
+
+	libcdata_list_t *signatures_list  = NULL;
+	libcerror_error_t *error          = NULL;
+	libsigscan_scan_tree_t *scan_tree = NULL;
+	libsigscan_signature_t *signature = NULL;
+	void *memcpy_result               = NULL;
+	void *memset_result               = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 buffer,
+	                 0,
+	                 sizeof( uint8_t ) * 128 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	memcpy_result = memory_copy(
+	                 buffer,
+	                 "pattern",
+	                 sizeof( uint8_t ) * 7 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	result = libcdata_list_initialize(
+	          &signatures_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_initialize(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signature",
+	 signature );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_set(
+	          signature,
+	          "test",
+	          4,
+	          0,
+	          (uint8_t *) "pattern",
+	          7,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_append_value(
+	          signatures_list,
+	          (intptr_t *) signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	signature = NULL;
+
+	result = libsigscan_scan_tree_initialize(
+	          &scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_tree",
+	 scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_build(
+	          scan_tree,
+	          signatures_list,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_tree->compiled_scan_tree",
+	 scan_tree->compiled_scan_tree );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_compiled_scan_tree_scan_buffer(
+	          scan_tree->compiled_scan_tree,
+	          0,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
+	          0,
+	          128,
+	          buffer,
+	          128,
+	          0,
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signature",
+	 signature );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffer[ 6 ] = 'x';
+
+	result = libsigscan_compiled_scan_tree_scan_buffer(
+	          scan_tree->compiled_scan_tree,
+	          0,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
+	          0,
+	          128,
+	          buffer,
+	          128,
+	          0,
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "signature",
+	 signature );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_compiled_scan_tree_scan_buffer(
+	          NULL,
+	          0,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
+	          0,
+	          128,
+	          buffer,
+	          128,
+	          0,
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_compiled_scan_tree_scan_buffer(
+	          scan_tree->compiled_scan_tree,
+	          scan_tree->compiled_scan_tree->number_of_nodes,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
+	          0,
+	          128,
+	          buffer,
+	          128,
+	          0,
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_compiled_scan_tree_scan_buffer(
+	          scan_tree->compiled_scan_tree,
+	          0,
+	          -1,
+	          0,
+	          128,
+	          buffer,
+	          128,
+	          0,
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_compiled_scan_tree_scan_buffer(
+	          scan_tree->compiled_scan_tree,
+	          0,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
+	          -1,
+	          128,
+	          buffer,
+	          128,
+	          0,
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_compiled_scan_tree_scan_buffer(
+	          scan_tree->compiled_scan_tree,
+	          0,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
+	          0,
+	          128,
+	          NULL,
+	          128,
+	          0,
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_compiled_scan_tree_scan_buffer(
+	          scan_tree->compiled_scan_tree,
+	          0,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
+	          0,
+	          128,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_compiled_scan_tree_scan_buffer(
+	          scan_tree->compiled_scan_tree,
+	          0,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
+	          0,
+	          128,
+	          buffer,
+	          128,
+	          128,
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_compiled_scan_tree_scan_buffer(
+	          scan_tree->compiled_scan_tree,
+	          0,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
+	          0,
+	          128,
+	          buffer,
+	          128,
+	          0,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_tree_free(
+	          &scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_tree",
+	 scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_free(
+	          &signatures_list,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_tree != NULL )
+	{
+		libsigscan_scan_tree_free(
+		 &scan_tree,
+		 NULL );
+	}
+	if( signatures_list != NULL )
+	{
+		libcdata_list_free(
+		 &signatures_list,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_compiled_scan_tree_insert_signature function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_compiled_scan_tree_insert_signature(
+     void )
+{
+	const char *patterns[ 3 ] = {
+		"pattern",
+		"example",
+		"patterns" };
+
+	libcdata_list_t *signatures_list           = NULL;
+	libcerror_error_t *error                   = NULL;
+	libsigscan_scan_tree_t *scan_tree          = NULL;
+	libsigscan_signature_t *inserted_signature = NULL;
+	libsigscan_signature_t *scanned_signature  = NULL;
+	libsigscan_signature_t *signature          = NULL;
+	int pattern_index                          = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_list_initialize(
+	          &signatures_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( pattern_index = 0;
+	     pattern_index < 3;
+	     pattern_index++ )
+	{
+		result = libsigscan_signature_initialize(
+		          &signature,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_signature_set(
+		          signature,
+		          "test",
+		          4,
+		          0,
+		          (uint8_t *) patterns[ pattern_index ],
+		          narrow_string_length(
+		           patterns[ pattern_index ] ),
+		          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdata_list_append_value(
+		          signatures_list,
+		          (intptr_t *) signature,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		inserted_signature = signature;
+		signature          = NULL;
+
+		/* Build the scan tree from the first 2 signatures
+		 */
+		if( pattern_index != 1 )
+		{
+			continue;
+		}
+		result = libsigscan_scan_tree_initialize(
+		          &scan_tree,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_tree_build(
+		          scan_tree,
+		          signatures_list,
+		          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "scan_tree->compiled_scan_tree",
+		 scan_tree->compiled_scan_tree );
+	}
+	/* Test regular cases
+	 */
+	result = libsigscan_compiled_scan_tree_insert_signature(
+	          scan_tree->compiled_scan_tree,
+	          inserted_signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_compiled_scan_tree_scan_buffer(
+	          scan_tree->compiled_scan_tree,
+	          0,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	          0,
+	          8,
+	          (uint8_t *) "patterns",
+	          8,
+	          0,
+	          &scanned_signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "scanned_signature == inserted_signature",
+	 (int) ( scanned_signature == inserted_signature ),
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The previously built signatures should still match
+	 */
+	result = libsigscan_compiled_scan_tree_scan_buffer(
+	          scan_tree->compiled_scan_tree,
+	          0,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	          0,
+	          8,
+	          (uint8_t *) "patternX",
+	          8,
+	          0,
+	          &scanned_signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanned_signature",
+	 scanned_signature );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "scanned_signature->pattern_size",
+	 scanned_signature->pattern_size,
+	 (size_t) 7 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_compiled_scan_tree_scan_buffer(
+	          scan_tree->compiled_scan_tree,
+	          0,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	          0,
+	          8,
+	          (uint8_t *) "example.",
+	          8,
+	          0,
+	          &scanned_signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanned_signature",
+	 scanned_signature );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_compiled_scan_tree_insert_signature(
+	          NULL,
+	          inserted_signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_compiled_scan_tree_insert_signature(
+	          scan_tree->compiled_scan_tree,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_tree_free(
+	          &scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_tree",
+	 scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_free(
+	          &signatures_list,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( signature != NULL )
+	{
+		libsigscan_signature_free(
+		 &signature,
+		 NULL );
+	}
+	if( scan_tree != NULL )
+	{
+		libsigscan_scan_tree_free(
+		 &scan_tree,
+		 NULL );
+	}
+	if( signatures_list != NULL )
+	{
+		libcdata_list_free(
+		 &signatures_list,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argc )
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_compiled_scan_tree_initialize",
+	 sigscan_test_compiled_scan_tree_initialize );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_compiled_scan_tree_free",
+	 sigscan_test_compiled_scan_tree_free );
+
+	/* TODO: add tests for libsigscan_compiled_scan_tree_append_node */
+
+	/* TODO: add tests for libsigscan_compiled_scan_tree_append_signature */
+
+	/* TODO: add tests for libsigscan_compiled_scan_tree_compile_scan_object */
+
+	/* TODO: add tests for libsigscan_compiled_scan_tree_compile_node */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_compiled_scan_tree_compile",
+	 sigscan_test_compiled_scan_tree_compile );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_compiled_scan_tree_scan_buffer",
+	 sigscan_test_compiled_scan_tree_scan_buffer );
+
+	/* TODO: add tests for libsigscan_compiled_scan_tree_insert_into_scan_object */
+
+	/* TODO: add tests for libsigscan_compiled_scan_tree_insert_into_node */
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_compiled_scan_tree_insert_signature",
+	 sigscan_test_compiled_scan_tree_insert_signature );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
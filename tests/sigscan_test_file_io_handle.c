@@ -0,0 +1,1052 @@
+/*
+ * Library file_io_handle type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "sigscan_test_functions.h"
+#include "sigscan_test_getopt.h"
+#include "sigscan_test_libbfio.h"
+#include "sigscan_test_libcerror.h"
+#include "sigscan_test_libsigscan.h"
+#include "sigscan_test_macros.h"
+#include "sigscan_test_memory.h"
+
+#include "../libsigscan/libsigscan_definitions.h"
+#include "../libsigscan/libsigscan_file_io_handle.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) && defined( LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX )
+
+/* Tests the libsigscan_file_io_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_file_io_handle_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libsigscan_file_io_handle_t *io_handle  = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 1;
+	int number_of_memset_fail_tests         = 1;
+	int test_number                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsigscan_file_io_handle_initialize(
+	          &io_handle,
+	          LIBSIGSCAN_IO_STRATEGY_BUFFERED,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_file_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_file_io_handle_initialize(
+	          NULL,
+	          LIBSIGSCAN_IO_STRATEGY_BUFFERED,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_handle = (libsigscan_file_io_handle_t *) 0x12345678UL;
+
+	result = libsigscan_file_io_handle_initialize(
+	          &io_handle,
+	          LIBSIGSCAN_IO_STRATEGY_BUFFERED,
+	          &error );
+
+	io_handle = NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The mapped I/O strategy does not use a file IO handle
+	 */
+	result = libsigscan_file_io_handle_initialize(
+	          &io_handle,
+	          LIBSIGSCAN_IO_STRATEGY_MAPPED,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_file_io_handle_initialize with malloc failing
+		 */
+		sigscan_test_malloc_attempts_before_fail = test_number;
+
+		result = libsigscan_file_io_handle_initialize(
+		          &io_handle,
+		          LIBSIGSCAN_IO_STRATEGY_BUFFERED,
+		          &error );
+
+		if( sigscan_test_malloc_attempts_before_fail != -1 )
+		{
+			sigscan_test_malloc_attempts_before_fail = -1;
+
+			if( io_handle != NULL )
+			{
+				libsigscan_file_io_handle_free(
+				 &io_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "io_handle",
+			 io_handle );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_file_io_handle_initialize with memset failing
+		 */
+		sigscan_test_memset_attempts_before_fail = test_number;
+
+		result = libsigscan_file_io_handle_initialize(
+		          &io_handle,
+		          LIBSIGSCAN_IO_STRATEGY_BUFFERED,
+		          &error );
+
+		if( sigscan_test_memset_attempts_before_fail != -1 )
+		{
+			sigscan_test_memset_attempts_before_fail = -1;
+
+			if( io_handle != NULL )
+			{
+				libsigscan_file_io_handle_free(
+				 &io_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "io_handle",
+			 io_handle );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SIGSCAN_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libsigscan_file_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_file_io_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_file_io_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsigscan_file_io_handle_free(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_file_io_handle_set_name function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_file_io_handle_set_name(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libsigscan_file_io_handle_t *io_handle  = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_file_io_handle_initialize(
+	          &io_handle,
+	          LIBSIGSCAN_IO_STRATEGY_DIRECT,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_file_io_handle_set_name(
+	          io_handle,
+	          "sigscan_test_file_io_handle_nonexistent_file",
+	          44,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_file_io_handle_set_name(
+	          NULL,
+	          "sigscan_test_file_io_handle_nonexistent_file",
+	          44,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_file_io_handle_set_name(
+	          io_handle,
+	          NULL,
+	          44,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_file_io_handle_set_name(
+	          io_handle,
+	          "sigscan_test_file_io_handle_nonexistent_file",
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_file_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libsigscan_file_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_file_io_handle_open function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_file_io_handle_open(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libsigscan_file_io_handle_t *io_handle  = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_file_io_handle_initialize(
+	          &io_handle,
+	          LIBSIGSCAN_IO_STRATEGY_BUFFERED,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_file_io_handle_open(
+	          io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_file_io_handle_set_name(
+	          io_handle,
+	          "sigscan_test_file_io_handle_nonexistent_file",
+	          44,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_file_io_handle_exists(
+	          io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_file_io_handle_open(
+	          NULL,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_file_io_handle_open(
+	          io_handle,
+	          LIBBFIO_OPEN_WRITE,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_file_io_handle_open(
+	          io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_file_io_handle_is_open(
+	          io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libsigscan_file_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libsigscan_file_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_file_io_handle_read_buffer function
+ * The data read using the I/O strategies must match the data read using a libbfio file
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_file_io_handle_read_buffer(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libbfio_handle_t *file_io_handle        = NULL;
+	libbfio_handle_t *io_strategy_handle    = NULL;
+	libcerror_error_t *error                = NULL;
+	libsigscan_file_io_handle_t *io_handle  = NULL;
+	uint8_t *expected_data                  = NULL;
+	uint8_t *data                           = NULL;
+	size64_t expected_size                  = 0;
+	size64_t size                           = 0;
+	size_t read_size                        = 0;
+	size_t source_length                    = 0;
+	ssize_t expected_read_count             = 0;
+	ssize_t read_count                      = 0;
+	off64_t offset                          = 0;
+	int io_strategy                         = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = sigscan_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_length = narrow_string_length(
+	                 narrow_source );
+
+	expected_data = (uint8_t *) memory_allocate(
+	                             sizeof( uint8_t ) * ( 2 * 1024 * 1024 ) );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "expected_data",
+	 expected_data );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ( 2 * 1024 * 1024 ) );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          narrow_source,
+	          source_length + 1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &expected_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( io_strategy = LIBSIGSCAN_IO_STRATEGY_BUFFERED;
+	     io_strategy <= LIBSIGSCAN_IO_STRATEGY_DIRECT;
+	     io_strategy++ )
+	{
+		result = libsigscan_file_io_handle_initialize_bfio_handle(
+		          &io_strategy_handle,
+		          &io_handle,
+		          io_strategy,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "io_strategy_handle",
+		 io_strategy_handle );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_file_io_handle_set_name(
+		          io_handle,
+		          narrow_source,
+		          source_length + 1,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_open(
+		          io_strategy_handle,
+		          LIBBFIO_OPEN_READ,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_get_size(
+		          io_strategy_handle,
+		          &size,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_UINT64(
+		 "size",
+		 (uint64_t) size,
+		 (uint64_t) expected_size );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Read the data in reads smaller than a block, in reads at the end of the data
+		 * and in reads larger than a block at an unaligned offset
+		 */
+		for( read_size = 3001;
+		     read_size <= ( 2 * 1024 * 1024 );
+		     read_size += ( 2 * 1024 * 1024 ) - 3001 )
+		{
+			for( offset = 1;
+			     offset <= (off64_t) expected_size;
+			     offset += (off64_t) read_size )
+			{
+				expected_read_count = libbfio_handle_read_buffer_at_offset(
+				                       file_io_handle,
+				                       expected_data,
+				                       read_size,
+				                       offset,
+				                       &error );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				read_count = libbfio_handle_read_buffer_at_offset(
+				              io_strategy_handle,
+				              data,
+				              read_size,
+				              offset,
+				              &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_SSIZE(
+				 "read_count",
+				 read_count,
+				 expected_read_count );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = memory_compare(
+				          data,
+				          expected_data,
+				          (size_t) read_count );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 0 );
+			}
+		}
+		result = libbfio_handle_close(
+		          io_strategy_handle,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test error cases
+		 */
+		read_count = libsigscan_file_io_handle_read_buffer(
+		              io_handle,
+		              data,
+		              1,
+		              &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libbfio_handle_free(
+		          &io_strategy_handle,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		io_handle = NULL;
+	}
+	/* Clean up
+	 */
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	memory_free(
+	 expected_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_strategy_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &io_strategy_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( expected_data != NULL )
+	{
+		memory_free(
+		 expected_data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) && defined( LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+
+	while( ( option = sigscan_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) && defined( LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_file_io_handle_initialize",
+	 sigscan_test_file_io_handle_initialize );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_file_io_handle_free",
+	 sigscan_test_file_io_handle_free );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_file_io_handle_set_name",
+	 sigscan_test_file_io_handle_set_name );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_file_io_handle_open",
+	 sigscan_test_file_io_handle_open );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		SIGSCAN_TEST_RUN_WITH_ARGS(
+		 "libsigscan_file_io_handle_read_buffer",
+		 sigscan_test_file_io_handle_read_buffer,
+		 source );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) && defined( LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) && defined( LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) && defined( LIBSIGSCAN_FILE_IO_HANDLE_HAVE_POSIX ) */
+}
+
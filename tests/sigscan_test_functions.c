@@ -670,3 +670,168 @@ int sigscan_test_close_file_io_handle(
 	return( result );
 }
 
+/* Writes test data to a sparse file
+ * The blocks of the data that only contain 0-byte values are not written,
+ * so that they are holes on file systems that support sparse files
+ * Returns 1 if successful or -1 on error
+ */
+int sigscan_test_write_sparse_file(
+     const char *filename,
+     const uint8_t *data,
+     size_t data_size,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	FILE *file_stream     = NULL;
+	static char *function = "sigscan_test_write_sparse_file";
+	size_t data_offset    = 0;
+	size_t byte_index     = 0;
+	size_t write_size     = 0;
+	int is_hole           = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid block size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	while( data_offset < data_size )
+	{
+		write_size = data_size - data_offset;
+
+		if( write_size > block_size )
+		{
+			write_size = block_size;
+		}
+		is_hole = 1;
+
+		for( byte_index = 0;
+		     byte_index < write_size;
+		     byte_index++ )
+		{
+			if( data[ data_offset + byte_index ] != 0 )
+			{
+				is_hole = 0;
+
+				break;
+			}
+		}
+		/* The last block is always written to set the size of the file
+		 */
+		if( ( is_hole != 0 )
+		 && ( ( data_offset + write_size ) < data_size ) )
+		{
+			if( file_stream_seek_offset(
+			     file_stream,
+			     (off64_t) write_size,
+			     SEEK_CUR ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek offset: %" PRIzu ".",
+				 function,
+				 data_offset + write_size );
+
+				goto on_error;
+			}
+		}
+		else if( file_stream_write(
+		          file_stream,
+		          &( data[ data_offset ] ),
+		          write_size ) != write_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data at offset: %" PRIzu ".",
+			 function,
+			 data_offset );
+
+			goto on_error;
+		}
+		data_offset += write_size;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	return( -1 );
+}
+
@@ -64,6 +64,13 @@ int sigscan_test_close_file_io_handle(
      libbfio_handle_t **file_io_handle,
      libcerror_error_t **error );
 
+int sigscan_test_write_sparse_file(
+     const char *filename,
+     const uint8_t *data,
+     size_t data_size,
+     size_t block_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
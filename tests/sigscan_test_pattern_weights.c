@@ -481,7 +481,7 @@ on_error:
 int sigscan_test_pattern_weights_get_largest_weight(
      void )
 {
-	libcdata_list_t *offset_groups_list           = NULL;
+	libsigscan_offset_group_t **offset_groups     = NULL;
 	libcerror_error_t *error                      = NULL;
 	libsigscan_pattern_weights_t *pattern_weights = NULL;
 	int largest_weight                            = 0;
@@ -596,16 +596,272 @@ int sigscan_test_pattern_weights_get_largest_weight(
 	libcerror_error_free(
 	 &error );
 
-	offset_groups_list = pattern_weights->offset_groups_list;
+	offset_groups = pattern_weights->offset_groups;
 
-	pattern_weights->offset_groups_list = NULL;
+	pattern_weights->offset_groups = NULL;
 
 	result = libsigscan_pattern_weights_get_largest_weight(
 	          pattern_weights,
 	          &largest_weight,
 	          &error );
 
-	pattern_weights->offset_groups_list = offset_groups_list;
+	pattern_weights->offset_groups = offset_groups;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_pattern_weights_free(
+	          &pattern_weights,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "pattern_weights",
+	 pattern_weights );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pattern_weights != NULL )
+	{
+		libsigscan_pattern_weights_free(
+		 &pattern_weights,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_pattern_weights_get_offset_group_index function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_pattern_weights_get_offset_group_index(
+     void )
+{
+	libsigscan_offset_group_t **offset_groups     = NULL;
+	libcerror_error_t *error                      = NULL;
+	libsigscan_pattern_weights_t *pattern_weights = NULL;
+	int offset_group_index                        = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_pattern_weights_initialize(
+	          &pattern_weights,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "pattern_weights",
+	 pattern_weights );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_pattern_weights_add_weight(
+	          pattern_weights,
+	          0,
+	          3,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_pattern_weights_add_weight(
+	          pattern_weights,
+	          0,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_pattern_weights_add_weight(
+	          pattern_weights,
+	          0,
+	          2,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_pattern_weights_get_offset_group_index(
+	          pattern_weights,
+	          1,
+	          &offset_group_index,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "offset_group_index",
+	 offset_group_index,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_pattern_weights_get_offset_group_index(
+	          pattern_weights,
+	          2,
+	          &offset_group_index,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "offset_group_index",
+	 offset_group_index,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_pattern_weights_get_offset_group_index(
+	          pattern_weights,
+	          3,
+	          &offset_group_index,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "offset_group_index",
+	 offset_group_index,
+	 2 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_pattern_weights_get_offset_group_index(
+	          pattern_weights,
+	          4,
+	          &offset_group_index,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "offset_group_index",
+	 offset_group_index,
+	 3 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_pattern_weights_get_offset_group_index(
+	          NULL,
+	          3,
+	          &offset_group_index,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_pattern_weights_get_offset_group_index(
+	          pattern_weights,
+	          3,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset_groups = pattern_weights->offset_groups;
+
+	pattern_weights->offset_groups = NULL;
+
+	result = libsigscan_pattern_weights_get_offset_group_index(
+	          pattern_weights,
+	          3,
+	          &offset_group_index,
+	          &error );
+
+	pattern_weights->offset_groups = offset_groups;
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -661,7 +917,7 @@ on_error:
 int sigscan_test_pattern_weights_get_offset_group(
      void )
 {
-	libcdata_list_t *offset_groups_list           = NULL;
+	libsigscan_offset_group_t **offset_groups     = NULL;
 	libcerror_error_t *error                      = NULL;
 	libsigscan_offset_group_t *offset_group       = NULL;
 	libsigscan_pattern_weights_t *pattern_weights = NULL;
@@ -785,9 +1041,9 @@ int sigscan_test_pattern_weights_get_offset_group(
 	libcerror_error_free(
 	 &error );
 
-	offset_groups_list = pattern_weights->offset_groups_list;
+	offset_groups = pattern_weights->offset_groups;
 
-	pattern_weights->offset_groups_list = NULL;
+	pattern_weights->offset_groups = NULL;
 
 	result = libsigscan_pattern_weights_get_offset_group(
 	          pattern_weights,
@@ -795,7 +1051,7 @@ int sigscan_test_pattern_weights_get_offset_group(
 	          &offset_group,
 	          &error );
 
-	pattern_weights->offset_groups_list = offset_groups_list;
+	pattern_weights->offset_groups = offset_groups;
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -851,7 +1107,7 @@ on_error:
 int sigscan_test_pattern_weights_insert_offset(
      void )
 {
-	libcdata_list_t *offset_groups_list           = NULL;
+	libsigscan_offset_group_t **offset_groups     = NULL;
 	libcerror_error_t *error                      = NULL;
 	libsigscan_pattern_weights_t *pattern_weights = NULL;
 	int result                                    = 0;
@@ -912,9 +1168,9 @@ int sigscan_test_pattern_weights_insert_offset(
 	libcerror_error_free(
 	 &error );
 
-	offset_groups_list = pattern_weights->offset_groups_list;
+	offset_groups = pattern_weights->offset_groups;
 
-	pattern_weights->offset_groups_list = NULL;
+	pattern_weights->offset_groups = NULL;
 
 	result = libsigscan_pattern_weights_insert_offset(
 	          pattern_weights,
@@ -922,7 +1178,263 @@ int sigscan_test_pattern_weights_insert_offset(
 	          1,
 	          &error );
 
-	pattern_weights->offset_groups_list = offset_groups_list;
+	pattern_weights->offset_groups = offset_groups;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_pattern_weights_free(
+	          &pattern_weights,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "pattern_weights",
+	 pattern_weights );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pattern_weights != NULL )
+	{
+		libsigscan_pattern_weights_free(
+		 &pattern_weights,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_pattern_weights_get_weight_group_index function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_pattern_weights_get_weight_group_index(
+     void )
+{
+	libsigscan_weight_group_t **weight_groups     = NULL;
+	libcerror_error_t *error                      = NULL;
+	libsigscan_pattern_weights_t *pattern_weights = NULL;
+	int weight_group_index                        = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_pattern_weights_initialize(
+	          &pattern_weights,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "pattern_weights",
+	 pattern_weights );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_pattern_weights_add_weight(
+	          pattern_weights,
+	          30,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_pattern_weights_add_weight(
+	          pattern_weights,
+	          10,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_pattern_weights_add_weight(
+	          pattern_weights,
+	          20,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_pattern_weights_get_weight_group_index(
+	          pattern_weights,
+	          10,
+	          &weight_group_index,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "weight_group_index",
+	 weight_group_index,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_pattern_weights_get_weight_group_index(
+	          pattern_weights,
+	          20,
+	          &weight_group_index,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "weight_group_index",
+	 weight_group_index,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_pattern_weights_get_weight_group_index(
+	          pattern_weights,
+	          30,
+	          &weight_group_index,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "weight_group_index",
+	 weight_group_index,
+	 2 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_pattern_weights_get_weight_group_index(
+	          pattern_weights,
+	          15,
+	          &weight_group_index,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "weight_group_index",
+	 weight_group_index,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_pattern_weights_get_weight_group_index(
+	          NULL,
+	          30,
+	          &weight_group_index,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_pattern_weights_get_weight_group_index(
+	          pattern_weights,
+	          30,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	weight_groups = pattern_weights->weight_groups;
+
+	pattern_weights->weight_groups = NULL;
+
+	result = libsigscan_pattern_weights_get_weight_group_index(
+	          pattern_weights,
+	          30,
+	          &weight_group_index,
+	          &error );
+
+	pattern_weights->weight_groups = weight_groups;
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -978,7 +1490,7 @@ on_error:
 int sigscan_test_pattern_weights_get_weight_group(
      void )
 {
-	libcdata_list_t *weight_groups_list           = NULL;
+	libsigscan_weight_group_t **weight_groups     = NULL;
 	libcerror_error_t *error                      = NULL;
 	libsigscan_pattern_weights_t *pattern_weights = NULL;
 	libsigscan_weight_group_t *weight_group       = NULL;
@@ -1102,9 +1614,9 @@ int sigscan_test_pattern_weights_get_weight_group(
 	libcerror_error_free(
 	 &error );
 
-	weight_groups_list = pattern_weights->weight_groups_list;
+	weight_groups = pattern_weights->weight_groups;
 
-	pattern_weights->weight_groups_list = NULL;
+	pattern_weights->weight_groups = NULL;
 
 	result = libsigscan_pattern_weights_get_weight_group(
 	          pattern_weights,
@@ -1112,7 +1624,7 @@ int sigscan_test_pattern_weights_get_weight_group(
 	          &weight_group,
 	          &error );
 
-	pattern_weights->weight_groups_list = weight_groups_list;
+	pattern_weights->weight_groups = weight_groups;
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1168,7 +1680,7 @@ on_error:
 int sigscan_test_pattern_weights_insert_add_weight(
      void )
 {
-	libcdata_list_t *weight_groups_list           = NULL;
+	libsigscan_weight_group_t **weight_groups     = NULL;
 	libcerror_error_t *error                      = NULL;
 	libsigscan_pattern_weights_t *pattern_weights = NULL;
 	int result                                    = 0;
@@ -1229,9 +1741,9 @@ int sigscan_test_pattern_weights_insert_add_weight(
 	libcerror_error_free(
 	 &error );
 
-	weight_groups_list = pattern_weights->weight_groups_list;
+	weight_groups = pattern_weights->weight_groups;
 
-	pattern_weights->weight_groups_list = NULL;
+	pattern_weights->weight_groups = NULL;
 
 	result = libsigscan_pattern_weights_insert_add_weight(
 	          pattern_weights,
@@ -1239,7 +1751,7 @@ int sigscan_test_pattern_weights_insert_add_weight(
 	          1,
 	          &error );
 
-	pattern_weights->weight_groups_list = weight_groups_list;
+	pattern_weights->weight_groups = weight_groups;
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1295,7 +1807,7 @@ on_error:
 int sigscan_test_pattern_weights_insert_set_weight(
      void )
 {
-	libcdata_list_t *weight_groups_list           = NULL;
+	libsigscan_weight_group_t **weight_groups     = NULL;
 	libcerror_error_t *error                      = NULL;
 	libsigscan_pattern_weights_t *pattern_weights = NULL;
 	int result                                    = 0;
@@ -1356,9 +1868,9 @@ int sigscan_test_pattern_weights_insert_set_weight(
 	libcerror_error_free(
 	 &error );
 
-	weight_groups_list = pattern_weights->weight_groups_list;
+	weight_groups = pattern_weights->weight_groups;
 
-	pattern_weights->weight_groups_list = NULL;
+	pattern_weights->weight_groups = NULL;
 
 	result = libsigscan_pattern_weights_insert_set_weight(
 	          pattern_weights,
@@ -1366,7 +1878,7 @@ int sigscan_test_pattern_weights_insert_set_weight(
 	          1,
 	          &error );
 
-	pattern_weights->weight_groups_list = weight_groups_list;
+	pattern_weights->weight_groups = weight_groups;
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1455,6 +1967,10 @@ int main(
 	 "libsigscan_pattern_weights_get_largest_weight",
 	 sigscan_test_pattern_weights_get_largest_weight );
 
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_pattern_weights_get_offset_group_index",
+	 sigscan_test_pattern_weights_get_offset_group_index );
+
 	SIGSCAN_TEST_RUN(
 	 "libsigscan_pattern_weights_get_offset_group",
 	 sigscan_test_pattern_weights_get_offset_group );
@@ -1463,6 +1979,10 @@ int main(
 	 "libsigscan_pattern_weights_insert_offset",
 	 sigscan_test_pattern_weights_insert_offset );
 
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_pattern_weights_get_weight_group_index",
+	 sigscan_test_pattern_weights_get_weight_group_index );
+
 	SIGSCAN_TEST_RUN(
 	 "libsigscan_pattern_weights_get_weight_group",
 	 sigscan_test_pattern_weights_get_weight_group );
@@ -0,0 +1,787 @@
+/*
+ * Library read_ahead type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "sigscan_test_functions.h"
+#include "sigscan_test_libbfio.h"
+#include "sigscan_test_libcerror.h"
+#include "sigscan_test_libsigscan.h"
+#include "sigscan_test_macros.h"
+#include "sigscan_test_memory.h"
+#include "sigscan_test_unused.h"
+
+#include "../libsigscan/libsigscan_definitions.h"
+#include "../libsigscan/libsigscan_read_ahead.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Tests the libsigscan_read_ahead_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_read_ahead_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsigscan_read_ahead_t *read_ahead = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 5;
+	int number_of_memset_fail_tests     = 2;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsigscan_read_ahead_initialize(
+	          &read_ahead,
+	          4,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_read_ahead_free(
+	          &read_ahead,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_read_ahead_initialize(
+	          NULL,
+	          4,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_ahead = (libsigscan_read_ahead_t *) 0x12345678UL;
+
+	result = libsigscan_read_ahead_initialize(
+	          &read_ahead,
+	          4,
+	          64,
+	          &error );
+
+	read_ahead = NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_read_ahead_initialize(
+	          &read_ahead,
+	          0,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_read_ahead_initialize(
+	          &read_ahead,
+	          LIBSIGSCAN_READ_AHEAD_MAXIMUM_NUMBER_OF_BUFFERS + 1,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_read_ahead_initialize(
+	          &read_ahead,
+	          4,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_read_ahead_initialize with malloc failing
+		 */
+		sigscan_test_malloc_attempts_before_fail = test_number;
+
+		result = libsigscan_read_ahead_initialize(
+		          &read_ahead,
+		          1,
+		          64,
+		          &error );
+
+		if( sigscan_test_malloc_attempts_before_fail != -1 )
+		{
+			sigscan_test_malloc_attempts_before_fail = -1;
+
+			if( read_ahead != NULL )
+			{
+				libsigscan_read_ahead_free(
+				 &read_ahead,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "read_ahead",
+			 read_ahead );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_read_ahead_initialize with memset failing
+		 */
+		sigscan_test_memset_attempts_before_fail = test_number;
+
+		result = libsigscan_read_ahead_initialize(
+		          &read_ahead,
+		          1,
+		          64,
+		          &error );
+
+		if( sigscan_test_memset_attempts_before_fail != -1 )
+		{
+			sigscan_test_memset_attempts_before_fail = -1;
+
+			if( read_ahead != NULL )
+			{
+				libsigscan_read_ahead_free(
+				 &read_ahead,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "read_ahead",
+			 read_ahead );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SIGSCAN_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead != NULL )
+	{
+		libsigscan_read_ahead_free(
+		 &read_ahead,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_read_ahead_free function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_read_ahead_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsigscan_read_ahead_free(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_read_ahead_get_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_read_ahead_get_buffer(
+     void )
+{
+	uint8_t data[ 1000 ];
+
+	libbfio_handle_t *file_io_handle    = NULL;
+	libcerror_error_t *error            = NULL;
+	libsigscan_read_ahead_t *read_ahead = NULL;
+	const uint8_t *buffer               = NULL;
+	off64_t data_offset                 = 0;
+	off64_t expected_data_offset        = 0;
+	size_t data_index                   = 0;
+	size_t data_size                    = 0;
+	size_t expected_data_size           = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 1000;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+	result = sigscan_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          1000,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_read_ahead_initialize(
+	          &read_ahead,
+	          3,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_read_ahead_start(
+	          read_ahead,
+	          file_io_handle,
+	          NULL,
+	          100,
+	          1000,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The buffers are provided in order of the data offset of the range
+	 */
+	expected_data_offset = 100;
+
+	while( expected_data_offset < 1000 )
+	{
+		expected_data_size = 64;
+
+		if( expected_data_size > (size_t) ( 1000 - expected_data_offset ) )
+		{
+			expected_data_size = (size_t) ( 1000 - expected_data_offset );
+		}
+		result = libsigscan_read_ahead_get_buffer(
+		          read_ahead,
+		          &buffer,
+		          &data_offset,
+		          &data_size,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "buffer",
+		 buffer );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+		 "data_offset",
+		 (int64_t) data_offset,
+		 (int64_t) expected_data_offset );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+		 "data_size",
+		 data_size,
+		 expected_data_size );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          buffer,
+		          &( data[ expected_data_offset ] ),
+		          data_size );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libsigscan_read_ahead_release_buffer(
+		          read_ahead,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		expected_data_offset += (off64_t) data_size;
+	}
+	result = libsigscan_read_ahead_get_buffer(
+	          read_ahead,
+	          &buffer,
+	          &data_offset,
+	          &data_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_read_ahead_stop(
+	          read_ahead,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test stopping the reader thread before all the data of the range was retrieved
+	 */
+	result = libsigscan_read_ahead_start(
+	          read_ahead,
+	          file_io_handle,
+	          NULL,
+	          0,
+	          1000,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_read_ahead_get_buffer(
+	          read_ahead,
+	          &buffer,
+	          &data_offset,
+	          &data_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+	 "data_offset",
+	 (int64_t) data_offset,
+	 (int64_t) 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_read_ahead_stop(
+	          read_ahead,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_read_ahead_get_buffer(
+	          NULL,
+	          &buffer,
+	          &data_offset,
+	          &data_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_read_ahead_get_buffer(
+	          read_ahead,
+	          NULL,
+	          &data_offset,
+	          &data_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_read_ahead_get_buffer(
+	          read_ahead,
+	          &buffer,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_read_ahead_get_buffer(
+	          read_ahead,
+	          &buffer,
+	          &data_offset,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reading beyond the end of the data
+	 */
+	result = libsigscan_read_ahead_start(
+	          read_ahead,
+	          file_io_handle,
+	          NULL,
+	          960,
+	          2000,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_read_ahead_get_buffer(
+	          read_ahead,
+	          &buffer,
+	          &data_offset,
+	          &data_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_read_ahead_free(
+	          &read_ahead,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = sigscan_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead != NULL )
+	{
+		libsigscan_read_ahead_free(
+		 &read_ahead,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argc )
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_read_ahead_initialize",
+	 sigscan_test_read_ahead_initialize );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_read_ahead_free",
+	 sigscan_test_read_ahead_free );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_read_ahead_get_buffer",
+	 sigscan_test_read_ahead_get_buffer );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT ) */
+}
+
@@ -391,23 +391,20 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
-
-/* Tests the libsigscan_scan_state_get_buffer_size function
+/* Tests the libsigscan_scan_state_set_scan_flags function
  * Returns 1 if successful or 0 if not
  */
-int sigscan_test_scan_state_get_buffer_size(
-     libsigscan_scan_state_t *scan_state )
+int sigscan_test_scan_state_set_scan_flags(
+     void )
 {
-	libcerror_error_t *error = NULL;
-	size_t buffer_size       = 0;
-	int result               = 0;
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	int result                          = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libsigscan_scan_state_get_buffer_size(
-	          scan_state,
-	          &buffer_size,
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -415,82 +412,39 @@ int sigscan_test_scan_state_get_buffer_size(
 	 result,
 	 1 );
 
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test regular cases
 	 */
-	result = libsigscan_scan_state_get_buffer_size(
-	          NULL,
-	          &buffer_size,
-	          &error );
-
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libsigscan_scan_state_get_buffer_size(
+	result = libsigscan_scan_state_set_scan_flags(
 	          scan_state,
-	          NULL,
+	          LIBSIGSCAN_SCAN_FLAG_HEADER | LIBSIGSCAN_SCAN_FLAG_FOOTER,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libsigscan_scan_state_get_header_range function
- * Returns 1 if successful or 0 if not
- */
-int sigscan_test_scan_state_get_header_range(
-     libsigscan_scan_state_t *scan_state )
-{
-	libcerror_error_t *error    = NULL;
-	uint64_t header_range_end   = 0;
-	uint64_t header_range_size  = 0;
-	uint64_t header_range_start = 0;
-	int result                  = 0;
-
-	/* Test regular cases
-	 */
-	result = libsigscan_scan_state_get_header_range(
+	result = libsigscan_scan_state_set_scan_flags(
 	          scan_state,
-	          &header_range_start,
-	          &header_range_end,
-	          &header_range_size,
+	          LIBSIGSCAN_SCAN_FLAGS_ALL,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -498,11 +452,9 @@ int sigscan_test_scan_state_get_header_range(
 
 	/* Test error cases
 	 */
-	result = libsigscan_scan_state_get_header_range(
+	result = libsigscan_scan_state_set_scan_flags(
 	          NULL,
-	          &header_range_start,
-	          &header_range_end,
-	          &header_range_size,
+	          LIBSIGSCAN_SCAN_FLAGS_ALL,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -517,11 +469,9 @@ int sigscan_test_scan_state_get_header_range(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scan_state_get_header_range(
+	result = libsigscan_scan_state_set_scan_flags(
 	          scan_state,
-	          NULL,
-	          &header_range_end,
-	          &header_range_size,
+	          0,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -536,11 +486,9 @@ int sigscan_test_scan_state_get_header_range(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scan_state_get_header_range(
+	result = libsigscan_scan_state_set_scan_flags(
 	          scan_state,
-	          &header_range_start,
-	          NULL,
-	          &header_range_size,
+	          0x00000010,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -555,25 +503,25 @@ int sigscan_test_scan_state_get_header_range(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scan_state_get_header_range(
-	          scan_state,
-	          &header_range_start,
-	          &header_range_end,
-	          NULL,
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -582,65 +530,112 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libsigscan_scan_state_get_footer_range function
+/* Tests the libsigscan_scan_state_set_stop_policy function
  * Returns 1 if successful or 0 if not
  */
-int sigscan_test_scan_state_get_footer_range(
-     libsigscan_scan_state_t *scan_state )
+int sigscan_test_scan_state_set_stop_policy(
+     void )
 {
-	libcerror_error_t *error    = NULL;
-	uint64_t footer_range_end   = 0;
-	uint64_t footer_range_size  = 0;
-	uint64_t footer_range_start = 0;
-	int result                  = 0;
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
-	result = libsigscan_scan_state_get_footer_range(
+	result = libsigscan_scan_state_set_stop_policy(
 	          scan_state,
-	          &footer_range_start,
-	          &footer_range_end,
-	          &footer_range_size,
+	          LIBSIGSCAN_SCAN_STOP_POLICY_FIRST_RESULT,
+	          0,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libsigscan_scan_state_get_footer_range(
-	          NULL,
-	          &footer_range_start,
-	          &footer_range_end,
-	          &footer_range_size,
+	result = libsigscan_scan_state_set_stop_policy(
+	          scan_state,
+	          LIBSIGSCAN_SCAN_STOP_POLICY_MAXIMUM_NUMBER_OF_RESULTS,
+	          8,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libsigscan_scan_state_set_stop_policy(
+	          scan_state,
+	          LIBSIGSCAN_SCAN_STOP_POLICY_EACH_SIGNATURE_ONCE,
+	          0,
+	          &error );
 
-	result = libsigscan_scan_state_get_footer_range(
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_stop_policy(
 	          scan_state,
+	          LIBSIGSCAN_SCAN_STOP_POLICY_NONE,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_state_set_stop_policy(
 	          NULL,
-	          &footer_range_end,
-	          &footer_range_size,
+	          LIBSIGSCAN_SCAN_STOP_POLICY_NONE,
+	          0,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -655,11 +650,10 @@ int sigscan_test_scan_state_get_footer_range(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scan_state_get_footer_range(
+	result = libsigscan_scan_state_set_stop_policy(
 	          scan_state,
-	          &footer_range_start,
-	          NULL,
-	          &footer_range_size,
+	          -1,
+	          0,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -674,11 +668,10 @@ int sigscan_test_scan_state_get_footer_range(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scan_state_get_footer_range(
+	result = libsigscan_scan_state_set_stop_policy(
 	          scan_state,
-	          &footer_range_start,
-	          &footer_range_end,
-	          NULL,
+	          LIBSIGSCAN_SCAN_STOP_POLICY_MAXIMUM_NUMBER_OF_RESULTS,
+	          0,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -693,6 +686,25 @@ int sigscan_test_scan_state_get_footer_range(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -701,25 +713,29 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libsigscan_scan_state_start function
+/* Tests the libsigscan_scan_state_is_complete function
  * Returns 1 if successful or 0 if not
  */
-int sigscan_test_scan_state_start(
-     libsigscan_scan_state_t *scan_state )
+int sigscan_test_scan_state_is_complete(
+     void )
 {
-	libcerror_error_t *error                 = NULL;
-	libsigscan_scan_tree_t *footer_scan_tree = NULL;
-	libsigscan_scan_tree_t *header_scan_tree = NULL;
-	libsigscan_scan_tree_t *scan_tree        = NULL;
-	int result                               = 0;
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	int result                          = 0;
 
 	/* Initialize test
 	 */
-	result = libsigscan_scan_tree_initialize(
-	          &header_scan_tree,
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -728,15 +744,904 @@ int sigscan_test_scan_state_start(
 	 1 );
 
 	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "header_scan_tree",
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_is_complete(
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_state_is_complete(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+
+/* Tests the libsigscan_scan_state_get_buffer_size function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_state_get_buffer_size(
+     libsigscan_scan_state_t *scan_state )
+{
+	libcerror_error_t *error = NULL;
+	size_t buffer_size       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_get_buffer_size(
+	          scan_state,
+	          &buffer_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_state_get_buffer_size(
+	          NULL,
+	          &buffer_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_state_get_buffer_size(
+	          scan_state,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_state_get_header_range function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_state_get_header_range(
+     libsigscan_scan_state_t *scan_state )
+{
+	libcerror_error_t *error    = NULL;
+	uint64_t header_range_end   = 0;
+	uint64_t header_range_size  = 0;
+	uint64_t header_range_start = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_get_header_range(
+	          scan_state,
+	          &header_range_start,
+	          &header_range_end,
+	          &header_range_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_state_get_header_range(
+	          NULL,
+	          &header_range_start,
+	          &header_range_end,
+	          &header_range_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_state_get_header_range(
+	          scan_state,
+	          NULL,
+	          &header_range_end,
+	          &header_range_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_state_get_header_range(
+	          scan_state,
+	          &header_range_start,
+	          NULL,
+	          &header_range_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_state_get_header_range(
+	          scan_state,
+	          &header_range_start,
+	          &header_range_end,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_state_get_footer_range function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_state_get_footer_range(
+     libsigscan_scan_state_t *scan_state )
+{
+	libcerror_error_t *error    = NULL;
+	uint64_t footer_range_end   = 0;
+	uint64_t footer_range_size  = 0;
+	uint64_t footer_range_start = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_get_footer_range(
+	          scan_state,
+	          &footer_range_start,
+	          &footer_range_end,
+	          &footer_range_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_state_get_footer_range(
+	          NULL,
+	          &footer_range_start,
+	          &footer_range_end,
+	          &footer_range_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_state_get_footer_range(
+	          scan_state,
+	          NULL,
+	          &footer_range_end,
+	          &footer_range_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_state_get_footer_range(
+	          scan_state,
+	          &footer_range_start,
+	          NULL,
+	          &footer_range_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_state_get_footer_range(
+	          scan_state,
+	          &footer_range_start,
+	          &footer_range_end,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_state_get_unbounded_range function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_state_get_unbounded_range(
+     libsigscan_scan_state_t *scan_state )
+{
+	libcerror_error_t *error      = NULL;
+	uint64_t unbounded_range_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_get_unbounded_range(
+	          scan_state,
+	          &unbounded_range_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_state_get_unbounded_range(
+	          NULL,
+	          &unbounded_range_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_state_get_unbounded_range(
+	          scan_state,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_state_start function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_state_start(
+     libsigscan_scan_state_t *scan_state )
+{
+	libcerror_error_t *error                 = NULL;
+	libsigscan_scan_tree_t *footer_scan_tree = NULL;
+	libsigscan_scan_tree_t *header_scan_tree = NULL;
+	libsigscan_scan_tree_t *scan_tree        = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scan_tree_initialize(
+	          &header_scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "header_scan_tree",
+	 header_scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_initialize(
+	          &footer_scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "footer_scan_tree",
+	 footer_scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_initialize(
+	          &scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_tree",
+	 scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_start(
+	          scan_state,
+	          header_scan_tree,
+	          footer_scan_tree,
+	          scan_tree,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_state_start(
+	          NULL,
+	          header_scan_tree,
+	          footer_scan_tree,
+	          scan_tree,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_state_start(
+	          scan_state,
+	          NULL,
+	          footer_scan_tree,
+	          scan_tree,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_state_start(
+	          scan_state,
+	          header_scan_tree,
+	          NULL,
+	          scan_tree,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_state_start(
+	          scan_state,
+	          header_scan_tree,
+	          footer_scan_tree,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_tree_free(
+	          &scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_tree",
+	 scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_free(
+	          &footer_scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "footer_scan_tree",
+	 footer_scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_free(
+	          &header_scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "header_scan_tree",
 	 header_scan_tree );
 
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_tree != NULL )
+	{
+		libsigscan_scan_tree_free(
+		 &scan_tree,
+		 NULL );
+	}
+	if( footer_scan_tree != NULL )
+	{
+		libsigscan_scan_tree_free(
+		 &footer_scan_tree,
+		 NULL );
+	}
+	if( header_scan_tree != NULL )
+	{
+		libsigscan_scan_tree_free(
+		 &header_scan_tree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_state_flush function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_state_flush(
+     libsigscan_scan_state_t *scan_state )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_flush(
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_state_flush(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_state_stop function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_state_stop(
+     libsigscan_scan_state_t *scan_state )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_stop(
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_state_stop(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_internal_scan_state_scan_buffer_by_unbounded_scan_tree function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_internal_scan_state_scan_buffer_by_unbounded_scan_tree(
+     void )
+{
+	uint8_t buffer[ 128 ];
+
+	libcdata_list_t *signatures_list    = NULL;
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scan_tree_t *scan_tree   = NULL;
+	libsigscan_signature_t *signature   = NULL;
+	void *memcpy_result                 = NULL;
+	void *memset_result                 = NULL;
+	size_t resume_offset                = 0;
+	int number_of_results               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 buffer,
+	                 0,
+	                 sizeof( uint8_t ) * 128 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	memcpy_result = memory_copy(
+	                 &( buffer[ 16 ] ),
+	                 "pattern",
+	                 sizeof( uint8_t ) * 7 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libsigscan_scan_tree_initialize(
-	          &footer_scan_tree,
+	          &scan_tree,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -745,57 +1650,225 @@ int sigscan_test_scan_state_start(
 	 1 );
 
 	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "footer_scan_tree",
-	 footer_scan_tree );
+	 "scan_tree",
+	 scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_initialize(
+	          &signatures_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_initialize(
+	          &signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signature",
+	 signature );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_set(
+	          signature,
+	          "test",
+	          4,
+	          0,
+	          (uint8_t *) "pattern",
+	          7,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_append_value(
+	          signatures_list,
+	          (intptr_t *) signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	signature = NULL;
+
+	result = libsigscan_scan_tree_build(
+	          scan_tree,
+	          signatures_list,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_internal_scan_state_scan_buffer_by_unbounded_scan_tree(
+	          (libsigscan_internal_scan_state_t *) scan_state,
+	          scan_tree,
+	          0,
+	          buffer,
+	          128,
+	          0,
+	          128,
+	          &resume_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          ( (libsigscan_internal_scan_state_t *) scan_state )->scan_results_array,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 1 );
 
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scan_tree_initialize(
-	          &scan_tree,
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "resume_offset",
+	 resume_offset,
+	 (size_t) 128 );
+
+	/* Test error cases
+	 */
+	result = libsigscan_internal_scan_state_scan_buffer_by_unbounded_scan_tree(
+	          NULL,
+	          scan_tree,
+	          0,
+	          buffer,
+	          128,
+	          0,
+	          128,
+	          &resume_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_internal_scan_state_scan_buffer_by_unbounded_scan_tree(
+	          (libsigscan_internal_scan_state_t *) scan_state,
+	          NULL,
+	          0,
+	          buffer,
+	          128,
+	          0,
+	          128,
+	          &resume_offset,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "scan_tree",
-	 scan_tree );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libsigscan_scan_state_start(
-	          scan_state,
-	          header_scan_tree,
-	          footer_scan_tree,
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_internal_scan_state_scan_buffer_by_unbounded_scan_tree(
+	          (libsigscan_internal_scan_state_t *) scan_state,
 	          scan_tree,
-	          64,
+	          0,
+	          NULL,
+	          128,
+	          0,
+	          128,
+	          &resume_offset,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the buffer exceeds the data size
 	 */
-	result = libsigscan_scan_state_start(
-	          NULL,
-	          header_scan_tree,
-	          footer_scan_tree,
+	result = libsigscan_internal_scan_state_scan_buffer_by_unbounded_scan_tree(
+	          (libsigscan_internal_scan_state_t *) scan_state,
 	          scan_tree,
 	          64,
+	          buffer,
+	          128,
+	          0,
+	          128,
+	          &resume_offset,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -810,12 +1883,15 @@ int sigscan_test_scan_state_start(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scan_state_start(
-	          scan_state,
-	          NULL,
-	          footer_scan_tree,
+	result = libsigscan_internal_scan_state_scan_buffer_by_unbounded_scan_tree(
+	          (libsigscan_internal_scan_state_t *) scan_state,
 	          scan_tree,
-	          64,
+	          0,
+	          buffer,
+	          128,
+	          0,
+	          0,
+	          &resume_offset,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -830,12 +1906,15 @@ int sigscan_test_scan_state_start(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scan_state_start(
-	          scan_state,
-	          header_scan_tree,
-	          NULL,
+	result = libsigscan_internal_scan_state_scan_buffer_by_unbounded_scan_tree(
+	          (libsigscan_internal_scan_state_t *) scan_state,
 	          scan_tree,
-	          64,
+	          0,
+	          buffer,
+	          128,
+	          0,
+	          1024,
+	          &resume_offset,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -850,12 +1929,15 @@ int sigscan_test_scan_state_start(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scan_state_start(
-	          scan_state,
-	          header_scan_tree,
-	          footer_scan_tree,
+	result = libsigscan_internal_scan_state_scan_buffer_by_unbounded_scan_tree(
+	          (libsigscan_internal_scan_state_t *) scan_state,
+	          scan_tree,
+	          0,
+	          buffer,
+	          128,
+	          0,
+	          128,
 	          NULL,
-	          64,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -872,8 +1954,9 @@ int sigscan_test_scan_state_start(
 
 	/* Clean up
 	 */
-	result = libsigscan_scan_tree_free(
-	          &scan_tree,
+	result = libcdata_list_free(
+	          &signatures_list,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -882,15 +1965,15 @@ int sigscan_test_scan_state_start(
 	 1 );
 
 	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "scan_tree",
-	 scan_tree );
+	 "signatures_list",
+	 signatures_list );
 
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	result = libsigscan_scan_tree_free(
-	          &footer_scan_tree,
+	          &scan_tree,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -899,15 +1982,15 @@ int sigscan_test_scan_state_start(
 	 1 );
 
 	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "footer_scan_tree",
-	 footer_scan_tree );
+	 "scan_tree",
+	 scan_tree );
 
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scan_tree_free(
-	          &header_scan_tree,
+	result = libsigscan_scan_state_free(
+	          &scan_state,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -916,8 +1999,8 @@ int sigscan_test_scan_state_start(
 	 1 );
 
 	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "header_scan_tree",
-	 header_scan_tree );
+	 "scan_state",
+	 scan_state );
 
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -931,129 +2014,30 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( scan_tree != NULL )
+	if( signature != NULL )
 	{
-		libsigscan_scan_tree_free(
-		 &scan_tree,
+		libsigscan_signature_free(
+		 &signature,
 		 NULL );
 	}
-	if( footer_scan_tree != NULL )
+	if( signatures_list != NULL )
 	{
-		libsigscan_scan_tree_free(
-		 &footer_scan_tree,
+		libcdata_list_free(
+		 &signatures_list,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
 		 NULL );
 	}
-	if( header_scan_tree != NULL )
+	if( scan_tree != NULL )
 	{
 		libsigscan_scan_tree_free(
-		 &header_scan_tree,
+		 &scan_tree,
 		 NULL );
 	}
-	return( 0 );
-}
-
-/* Tests the libsigscan_scan_state_flush function
- * Returns 1 if successful or 0 if not
- */
-int sigscan_test_scan_state_flush(
-     libsigscan_scan_state_t *scan_state )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-
-	/* Test regular cases
-	 */
-	result = libsigscan_scan_state_flush(
-	          scan_state,
-	          &error );
-
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test error cases
-	 */
-	result = libsigscan_scan_state_flush(
-	          NULL,
-	          &error );
-
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libsigscan_scan_state_stop function
- * Returns 1 if successful or 0 if not
- */
-int sigscan_test_scan_state_stop(
-     libsigscan_scan_state_t *scan_state )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-
-	/* Test regular cases
-	 */
-	result = libsigscan_scan_state_stop(
-	          scan_state,
-	          &error );
-
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test error cases
-	 */
-	result = libsigscan_scan_state_stop(
-	          NULL,
-	          &error );
-
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
+	if( scan_state != NULL )
 	{
-		libcerror_error_free(
-		 &error );
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
 	}
 	return( 0 );
 }
@@ -1066,14 +2050,15 @@ int sigscan_test_internal_scan_state_scan_buffer_by_scan_tree(
 {
 	uint8_t buffer[ 128 ];
 
-	libcdata_list_t *signatures_list         = NULL;
-	libcerror_error_t *error                 = NULL;
-	libsigscan_scan_tree_t *scan_tree        = NULL;
-	libsigscan_scan_tree_node_t *active_node = NULL;
-	libsigscan_signature_t *signature        = NULL;
-	void *memcpy_result                      = NULL;
-	void *memset_result                      = NULL;
-	int result                               = 0;
+	libcdata_list_t *signatures_list  = NULL;
+	libcerror_error_t *error          = NULL;
+	libsigscan_scan_tree_t *scan_tree = NULL;
+	libsigscan_signature_t *signature = NULL;
+	void *memcpy_result               = NULL;
+	void *memset_result               = NULL;
+	uint32_t active_node_index        = 0;
+	size_t resume_offset              = 0;
+	int result                        = 0;
 
 	/* Initialize test
 	 */
@@ -1198,16 +2183,18 @@ int sigscan_test_internal_scan_state_scan_buffer_by_scan_tree(
 
 	/* Test regular cases
 	 */
-	active_node = scan_tree->root_node;
+	active_node_index = 0;
 
 	result = libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
 	          (libsigscan_internal_scan_state_t *) scan_state,
 	          scan_tree,
-	          &active_node,
+	          &active_node_index,
 	          0,
 	          buffer,
 	          128,
 	          0,
+	          128,
+	          &resume_offset,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1224,11 +2211,13 @@ int sigscan_test_internal_scan_state_scan_buffer_by_scan_tree(
 	result = libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
 	          NULL,
 	          scan_tree,
-	          &active_node,
+	          &active_node_index,
 	          0,
 	          buffer,
 	          128,
 	          0,
+	          128,
+	          &resume_offset,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1246,11 +2235,13 @@ int sigscan_test_internal_scan_state_scan_buffer_by_scan_tree(
 	result = libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
 	          (libsigscan_internal_scan_state_t *) scan_state,
 	          NULL,
-	          &active_node,
+	          &active_node_index,
 	          0,
 	          buffer,
 	          128,
 	          0,
+	          128,
+	          &resume_offset,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1273,6 +2264,8 @@ int sigscan_test_internal_scan_state_scan_buffer_by_scan_tree(
 	          buffer,
 	          128,
 	          0,
+	          128,
+	          &resume_offset,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1290,11 +2283,13 @@ int sigscan_test_internal_scan_state_scan_buffer_by_scan_tree(
 	result = libsigscan_internal_scan_state_scan_buffer_by_scan_tree(
 	          (libsigscan_internal_scan_state_t *) scan_state,
 	          scan_tree,
-	          &active_node,
+	          &active_node_index,
 	          0,
 	          NULL,
 	          128,
 	          0,
+	          128,
+	          &resume_offset,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1417,6 +2412,7 @@ int sigscan_test_internal_scan_state_scan_buffer(
 	          buffer,
 	          128,
 	          0,
+	          128,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1436,6 +2432,7 @@ int sigscan_test_internal_scan_state_scan_buffer(
 	          buffer,
 	          128,
 	          0,
+	          128,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1456,6 +2453,7 @@ int sigscan_test_internal_scan_state_scan_buffer(
 	          NULL,
 	          128,
 	          0,
+	          128,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1476,6 +2474,7 @@ int sigscan_test_internal_scan_state_scan_buffer(
 	          buffer,
 	          0,
 	          0,
+	          128,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1496,6 +2495,7 @@ int sigscan_test_internal_scan_state_scan_buffer(
 	          buffer,
 	          (size_t) SSIZE_MAX + 1,
 	          0,
+	          128,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1516,6 +2516,7 @@ int sigscan_test_internal_scan_state_scan_buffer(
 	          buffer,
 	          128,
 	          1024,
+	          128,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1914,6 +2915,18 @@ int main(
 	 "libsigscan_scan_state_set_data_size",
 	 sigscan_test_scan_state_set_data_size );
 
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_state_set_scan_flags",
+	 sigscan_test_scan_state_set_scan_flags );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_state_set_stop_policy",
+	 sigscan_test_scan_state_set_stop_policy );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_state_is_complete",
+	 sigscan_test_scan_state_is_complete );
+
 #if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
@@ -1977,6 +2990,15 @@ int main(
 	 sigscan_test_scan_state_get_footer_range,
 	 scan_state );
 
+	SIGSCAN_TEST_RUN_WITH_ARGS(
+	 "libsigscan_scan_state_get_unbounded_range",
+	 sigscan_test_scan_state_get_unbounded_range,
+	 scan_state );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_internal_scan_state_scan_buffer_by_unbounded_scan_tree",
+	 sigscan_test_internal_scan_state_scan_buffer_by_unbounded_scan_tree );
+
 	SIGSCAN_TEST_RUN_WITH_ARGS(
 	 "libsigscan_internal_scan_state_scan_buffer_by_scan_tree",
 	 sigscan_test_internal_scan_state_scan_buffer_by_scan_tree,
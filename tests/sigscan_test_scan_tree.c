@@ -21,6 +21,8 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -41,6 +43,7 @@
 #include "../libsigscan/libsigscan_scan_tree.h"
 #include "../libsigscan/libsigscan_scan_tree_node.h"
 #include "../libsigscan/libsigscan_signature.h"
+#include "../libsigscan/libsigscan_thread_pool.h"
 
 #if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
 
@@ -517,6 +520,981 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libsigscan_scan_tree_get_partition_index function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_tree_get_partition_index(
+     void )
+{
+	int partition_index = 0;
+
+	/* Test regular cases
+	 */
+	partition_index = libsigscan_scan_tree_get_partition_index(
+	                   4 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "partition_index",
+	 partition_index,
+	 0 );
+
+	partition_index = libsigscan_scan_tree_get_partition_index(
+	                   8 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "partition_index",
+	 partition_index,
+	 1 );
+
+	partition_index = libsigscan_scan_tree_get_partition_index(
+	                   31 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "partition_index",
+	 partition_index,
+	 2 );
+
+	partition_index = libsigscan_scan_tree_get_partition_index(
+	                   1024 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "partition_index",
+	 partition_index,
+	 3 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_tree_build function with a thread pool
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_tree_build_with_thread_pool(
+     void )
+{
+	uint8_t pattern[ 6 ];
+
+	libcdata_list_t *signatures_list                  = NULL;
+	libcerror_error_t *error                          = NULL;
+	libsigscan_compiled_scan_tree_node_t *first_node  = NULL;
+	libsigscan_compiled_scan_tree_node_t *second_node = NULL;
+	libsigscan_scan_tree_t *first_scan_tree           = NULL;
+	libsigscan_scan_tree_t *second_scan_tree          = NULL;
+	libsigscan_signature_t *signature                 = NULL;
+	libsigscan_thread_pool_t *thread_pool             = NULL;
+	size_t pattern_index                              = 0;
+	uint32_t node_index                               = 0;
+	uint32_t signature_index                          = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_list_initialize(
+	          &signatures_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The patterns share byte values so that the scan tree nodes have sub nodes
+	 */
+	for( signature_index = 0;
+	     signature_index < 48;
+	     signature_index++ )
+	{
+		for( pattern_index = 0;
+		     pattern_index < 6;
+		     pattern_index++ )
+		{
+			pattern[ pattern_index ] = (uint8_t) ( ( ( signature_index * 7 ) + ( pattern_index * 13 ) + ( signature_index / ( pattern_index + 1 ) ) ) & 0x0f );
+		}
+		result = libsigscan_signature_initialize(
+		          &signature,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_signature_set(
+		          signature,
+		          "test",
+		          4,
+		          (off64_t) ( signature_index % 3 ),
+		          pattern,
+		          6,
+		          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdata_list_append_value(
+		          signatures_list,
+		          (intptr_t *) signature,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		signature = NULL;
+	}
+	result = libsigscan_scan_tree_initialize(
+	          &first_scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_initialize(
+	          &second_scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_thread_pool_initialize(
+	          &thread_pool,
+	          4,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_tree_build(
+	          first_scan_tree,
+	          signatures_list,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	second_scan_tree->thread_pool = thread_pool;
+
+	result = libsigscan_scan_tree_build(
+	          second_scan_tree,
+	          signatures_list,
+	          LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START,
+	          &error );
+
+	second_scan_tree->thread_pool = NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The scan tree built by the thread pool must be identical to the one built by a single thread
+	 */
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "first_scan_tree->compiled_scan_tree",
+	 first_scan_tree->compiled_scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "second_scan_tree->compiled_scan_tree",
+	 second_scan_tree->compiled_scan_tree );
+
+	SIGSCAN_TEST_ASSERT_GREATER_THAN_INT(
+	 "first_scan_tree->compiled_scan_tree->number_of_nodes",
+	 (int) first_scan_tree->compiled_scan_tree->number_of_nodes,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_UINT32(
+	 "second_scan_tree->compiled_scan_tree->number_of_nodes",
+	 second_scan_tree->compiled_scan_tree->number_of_nodes,
+	 first_scan_tree->compiled_scan_tree->number_of_nodes );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_UINT32(
+	 "second_scan_tree->compiled_scan_tree->number_of_signatures",
+	 second_scan_tree->compiled_scan_tree->number_of_signatures,
+	 first_scan_tree->compiled_scan_tree->number_of_signatures );
+
+	for( node_index = 0;
+	     node_index < first_scan_tree->compiled_scan_tree->number_of_nodes;
+	     node_index++ )
+	{
+		first_node  = &( first_scan_tree->compiled_scan_tree->nodes[ node_index ] );
+		second_node = &( second_scan_tree->compiled_scan_tree->nodes[ node_index ] );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+		 "second_node->pattern_offset",
+		 (int64_t) second_node->pattern_offset,
+		 (int64_t) first_node->pattern_offset );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_UINT32(
+		 "second_node->default_scan_object_reference",
+		 second_node->default_scan_object_reference,
+		 first_node->default_scan_object_reference );
+
+		result = memory_compare(
+		          second_node->scan_object_references,
+		          first_node->scan_object_references,
+		          sizeof( uint32_t ) * 256 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	for( signature_index = 0;
+	     signature_index < first_scan_tree->compiled_scan_tree->number_of_signatures;
+	     signature_index++ )
+	{
+		result = ( second_scan_tree->compiled_scan_tree->signatures[ signature_index ] == first_scan_tree->compiled_scan_tree->signatures[ signature_index ] );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	/* Clean up
+	 */
+	result = libsigscan_thread_pool_free(
+	          &thread_pool,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_free(
+	          &second_scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_tree_free(
+	          &first_scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_free(
+	          &signatures_list,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		libsigscan_thread_pool_free(
+		 &thread_pool,
+		 NULL );
+	}
+	if( second_scan_tree != NULL )
+	{
+		second_scan_tree->thread_pool = NULL;
+
+		libsigscan_scan_tree_free(
+		 &second_scan_tree,
+		 NULL );
+	}
+	if( first_scan_tree != NULL )
+	{
+		libsigscan_scan_tree_free(
+		 &first_scan_tree,
+		 NULL );
+	}
+	if( signature != NULL )
+	{
+		libsigscan_signature_free(
+		 &signature,
+		 NULL );
+	}
+	if( signatures_list != NULL )
+	{
+		libcdata_list_free(
+		 &signatures_list,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_tree_build_partitions function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_tree_build_partitions(
+     void )
+{
+	libcdata_list_t *signatures_list  = NULL;
+	libcerror_error_t *error          = NULL;
+	libsigscan_scan_tree_t *scan_tree = NULL;
+	libsigscan_signature_t *signature = NULL;
+	uint64_t range_size               = 0;
+	uint8_t pattern_data[ 7 ]         = { 'p', 'a', 't', 't', 'e', 'r', 'n' };
+	uint64_t range_start              = 0;
+	int result                        = 0;
+	int signature_index               = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scan_tree_initialize(
+	          &scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_tree",
+	 scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_initialize(
+	          &signatures_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The packed matcher is used instead of partitions for small sets of signatures
+	 */
+	for( signature_index = 0;
+	     signature_index <= LIBSIGSCAN_PACKED_MATCHER_MAXIMUM_NUMBER_OF_SIGNATURES;
+	     signature_index++ )
+	{
+		result = libsigscan_signature_initialize(
+		          &signature,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "signature",
+		 signature );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( signature_index == 0 )
+		{
+			result = libsigscan_signature_set(
+			          signature,
+			          "long",
+			          4,
+			          0,
+			          (uint8_t *) "a much longer pattern",
+			          21,
+			          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+			          &error );
+		}
+		else
+		{
+			pattern_data[ 6 ] = (uint8_t) signature_index;
+
+			result = libsigscan_signature_set(
+			          signature,
+			          "short",
+			          5,
+			          0,
+			          pattern_data,
+			          7,
+			          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+			          &error );
+		}
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdata_list_append_value(
+		          signatures_list,
+		          (intptr_t *) signature,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		signature = NULL;
+	}
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_tree_build_partitions(
+	          scan_tree,
+	          signatures_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "scan_tree->number_of_partition_scan_trees",
+	 scan_tree->number_of_partition_scan_trees,
+	 2 );
+
+	result = libsigscan_scan_tree_get_spanning_range(
+	          scan_tree,
+	          &range_start,
+	          &range_size,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 range_size,
+	 (uint64_t) 21 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_tree_build_partitions(
+	          NULL,
+	          signatures_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_tree_build_partitions(
+	          scan_tree,
+	          signatures_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_tree_free(
+	          &scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_tree",
+	 scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_free(
+	          &signatures_list,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( signature != NULL )
+	{
+		libsigscan_signature_free(
+		 &signature,
+		 NULL );
+	}
+	if( signatures_list != NULL )
+	{
+		libcdata_list_free(
+		 &signatures_list,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+		 NULL );
+	}
+	if( scan_tree != NULL )
+	{
+		libsigscan_scan_tree_free(
+		 &scan_tree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scan_tree_insert_signature function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scan_tree_insert_signature(
+     void )
+{
+	const char *patterns[ 3 ] = {
+		"pattern",
+		"example",
+		"sample" };
+
+	libcdata_list_t *signatures_list           = NULL;
+	libcerror_error_t *error                   = NULL;
+	libsigscan_scan_tree_t *scan_tree          = NULL;
+	libsigscan_signature_t *inserted_signature = NULL;
+	libsigscan_signature_t *signature          = NULL;
+	int pattern_index                          = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_list_initialize(
+	          &signatures_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( pattern_index = 0;
+	     pattern_index < 3;
+	     pattern_index++ )
+	{
+		result = libsigscan_signature_initialize(
+		          &signature,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_signature_set(
+		          signature,
+		          "test",
+		          4,
+		          0,
+		          (uint8_t *) patterns[ pattern_index ],
+		          narrow_string_length(
+		           patterns[ pattern_index ] ),
+		          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdata_list_append_value(
+		          signatures_list,
+		          (intptr_t *) signature,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		inserted_signature = signature;
+		signature          = NULL;
+
+		/* Build the scan tree from the first 2 signatures
+		 */
+		if( pattern_index != 1 )
+		{
+			continue;
+		}
+		result = libsigscan_scan_tree_initialize(
+		          &scan_tree,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_tree_build(
+		          scan_tree,
+		          signatures_list,
+		          LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_tree_insert_signature(
+	          scan_tree,
+	          signatures_list,
+	          inserted_signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "scan_tree->number_of_inserted_signatures",
+	 scan_tree->number_of_inserted_signatures,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_tree->skip_table",
+	 scan_tree->skip_table );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "scan_tree->skip_table->number_of_signatures",
+	 scan_tree->skip_table->number_of_signatures,
+	 3 );
+
+	/* Signatures cannot be inserted into a bounded scan tree
+	 */
+	scan_tree->pattern_offsets_mode = LIBSIGSCAN_PATTERN_OFFSET_MODE_BOUND_TO_START;
+
+	result = libsigscan_scan_tree_insert_signature(
+	          scan_tree,
+	          signatures_list,
+	          inserted_signature,
+	          &error );
+
+	scan_tree->pattern_offsets_mode = LIBSIGSCAN_PATTERN_OFFSET_MODE_UNBOUND;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scan_tree_insert_signature(
+	          NULL,
+	          signatures_list,
+	          inserted_signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_tree_insert_signature(
+	          scan_tree,
+	          NULL,
+	          inserted_signature,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scan_tree_insert_signature(
+	          scan_tree,
+	          signatures_list,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	inserted_signature->signature_flags = LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START;
+
+	result = libsigscan_scan_tree_insert_signature(
+	          scan_tree,
+	          signatures_list,
+	          inserted_signature,
+	          &error );
+
+	inserted_signature->signature_flags = LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_tree_free(
+	          &scan_tree,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_tree",
+	 scan_tree );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_free(
+	          &signatures_list,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( signature != NULL )
+	{
+		libsigscan_signature_free(
+		 &signature,
+		 NULL );
+	}
+	if( scan_tree != NULL )
+	{
+		libsigscan_scan_tree_free(
+		 &scan_tree,
+		 NULL );
+	}
+	if( signatures_list != NULL )
+	{
+		libcdata_list_free(
+		 &signatures_list,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libsigscan_signature_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libsigscan_scan_tree_get_pattern_offset_by_byte_value_weights function
  * Returns 1 if successful or 0 if not
  */
@@ -1327,6 +2305,22 @@ int main(
 	 "libsigscan_scan_tree_build",
 	 sigscan_test_scan_tree_build );
 
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_tree_build_with_thread_pool",
+	 sigscan_test_scan_tree_build_with_thread_pool );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_tree_get_partition_index",
+	 sigscan_test_scan_tree_get_partition_index );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_tree_build_partitions",
+	 sigscan_test_scan_tree_build_partitions );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scan_tree_insert_signature",
+	 sigscan_test_scan_tree_insert_signature );
+
 	/* TODO: add tests for libsigscan_scan_tree_fill_pattern_weights */
 
 	/* TODO: add tests for libsigscan_scan_tree_fill_range_list */
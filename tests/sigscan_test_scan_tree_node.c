@@ -106,8 +106,6 @@ int main(
 
 	/* TODO: add tests for libsigscan_scan_tree_node_get_scan_object */
 
-	/* TODO: add tests for libsigscan_scan_tree_node_scan_buffer */
-
 	/* TODO: add tests for libsigscan_scan_tree_node_printf */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
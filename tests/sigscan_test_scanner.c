@@ -35,11 +35,14 @@
 #include "sigscan_test_getopt.h"
 #include "sigscan_test_libbfio.h"
 #include "sigscan_test_libcerror.h"
+#include "sigscan_test_libcthreads.h"
 #include "sigscan_test_libsigscan.h"
 #include "sigscan_test_macros.h"
 #include "sigscan_test_memory.h"
 
+#include "../libsigscan/libsigscan_scan_result.h"
 #include "../libsigscan/libsigscan_scan_state.h"
+#include "../libsigscan/libsigscan_scan_tree.h"
 #include "../libsigscan/libsigscan_scanner.h"
 
 #if !defined( LIBSIGSCAN_HAVE_BFIO )
@@ -51,6 +54,19 @@ int libsigscan_scanner_scan_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+LIBSIGSCAN_EXTERN \
+int libsigscan_scanner_scan_file_io_handles(
+     libsigscan_scanner_t *scanner,
+     libsigscan_scan_state_t *scan_state,
+     libbfio_handle_t **file_io_handles,
+     int number_of_files,
+     int (*callback_function)(
+            int file_index,
+            libsigscan_scan_state_t *scan_state,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
 #endif /* !defined( LIBSIGSCAN_HAVE_BFIO ) */
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
@@ -61,6 +77,56 @@ int libsigscan_scanner_scan_file_io_handle(
  */
 #define SIGSCAN_TEST_SCANNER_VERBOSE
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+#define SIGSCAN_TEST_SCANNER_NUMBER_OF_ITERATIONS	16
+#define SIGSCAN_TEST_SCANNER_NUMBER_OF_STRESS_ITERATIONS	64
+#define SIGSCAN_TEST_SCANNER_NUMBER_OF_THREADS		4
+
+#define SIGSCAN_TEST_SCANNER_SPARSE_FILE_FILENAME	"sigscan_test_scanner_sparse_file.tmp"
+
+enum SIGSCAN_TEST_SCANNER_SCAN_MODES
+{
+	SIGSCAN_TEST_SCANNER_SCAN_MODE_BUFFER,
+	SIGSCAN_TEST_SCANNER_SCAN_MODE_FILE_IO_HANDLE,
+	SIGSCAN_TEST_SCANNER_SCAN_MODE_FILE
+};
+
+typedef struct sigscan_test_scanner_thread_values sigscan_test_scanner_thread_values_t;
+
+struct sigscan_test_scanner_thread_values
+{
+	/* The (shared) scanner
+	 */
+	libsigscan_scanner_t *scanner;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The filename or NULL if not available
+	 */
+	const char *filename;
+
+	/* The expected results strings per scan mode
+	 */
+	char (*results_strings)[ 512 ];
+
+	/* The number of iterations
+	 */
+	int number_of_iterations;
+
+	/* The result of the thread
+	 */
+	int result;
+};
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 uint8_t sigscan_test_scanner_data1[ 128 ] = {
 	0x43, 0x6c, 0x69, 0x65, 0x6e, 0x74, 0x20, 0x55, 0x72, 0x6c, 0x43, 0x61, 0x63, 0x68, 0x65, 0x20,
 	0x4d, 0x4d, 0x46, 0x20, 0x56, 0x65, 0x72, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -466,10 +532,10 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libsigscan_scanner_add_signature function
+/* Tests the libsigscan_scanner_set_number_of_threads function
  * Returns 1 if successful or 0 if not
  */
-int sigscan_test_scanner_add_signature(
+int sigscan_test_scanner_set_number_of_threads(
      libsigscan_scanner_t *scanner )
 {
 	libcerror_error_t *error = NULL;
@@ -477,14 +543,26 @@ int sigscan_test_scanner_add_signature(
 
 	/* Test regular cases
 	 */
-	result = libsigscan_scanner_add_signature(
+	result = libsigscan_scanner_set_number_of_threads(
 	          scanner,
-	          "test1",
-	          6,
 	          0,
-	          (uint8_t *) "pattern",
-	          7,
-	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Leave the scanner with multiple threads so that the scan trees
+	 * in the remaining tests are built by a thread pool
+	 */
+	result = libsigscan_scanner_set_number_of_threads(
+	          scanner,
+	          4,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -498,14 +576,9 @@ int sigscan_test_scanner_add_signature(
 
 	/* Test error cases
 	 */
-	result = libsigscan_scanner_add_signature(
+	result = libsigscan_scanner_set_number_of_threads(
 	          NULL,
-	          "test1",
-	          6,
-	          0,
-	          (uint8_t *) "pattern",
-	          7,
-	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          4,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -520,14 +593,9 @@ int sigscan_test_scanner_add_signature(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scanner_add_signature(
+	result = libsigscan_scanner_set_number_of_threads(
 	          scanner,
-	          NULL,
-	          5,
-	          0,
-	          (uint8_t *) "pattern",
-	          7,
-	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          -1,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -542,14 +610,9 @@ int sigscan_test_scanner_add_signature(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scanner_add_signature(
+	result = libsigscan_scanner_set_number_of_threads(
 	          scanner,
-	          "test1",
-	          6,
-	          0,
-	          NULL,
-	          7,
-	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          65,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -575,20 +638,20 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libsigscan_scanner_scan_start function
+/* Tests the libsigscan_scanner_set_scan_chunk_size function
  * Returns 1 if successful or 0 if not
  */
-int sigscan_test_scanner_scan_start(
+int sigscan_test_scanner_set_scan_chunk_size(
      libsigscan_scanner_t *scanner )
 {
-	libcerror_error_t *error            = NULL;
-	libsigscan_scan_state_t *scan_state = NULL;
-	int result                          = 0;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
-	/* Initialize test
+	/* Test regular cases
 	 */
-	result = libsigscan_scan_state_initialize(
-	          &scan_state,
+	result = libsigscan_scanner_set_scan_chunk_size(
+	          scanner,
+	          1024 * 1024,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -596,19 +659,13 @@ int sigscan_test_scanner_scan_start(
 	 result,
 	 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "scan_state",
-	 scan_state );
-
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libsigscan_scanner_scan_start(
+	result = libsigscan_scanner_set_scan_chunk_size(
 	          scanner,
-	          scan_state,
+	          0,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -622,9 +679,9 @@ int sigscan_test_scanner_scan_start(
 
 	/* Test error cases
 	 */
-	result = libsigscan_scanner_scan_start(
+	result = libsigscan_scanner_set_scan_chunk_size(
 	          NULL,
-	          scan_state,
+	          1024 * 1024,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -639,9 +696,9 @@ int sigscan_test_scanner_scan_start(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scanner_scan_start(
+	result = libsigscan_scanner_set_scan_chunk_size(
 	          scanner,
-	          NULL,
+	          (size64_t) INT64_MAX + 1,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -656,25 +713,6 @@ int sigscan_test_scanner_scan_start(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libsigscan_scan_state_free(
-	          &scan_state,
-	          &error );
-
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "scan_state",
-	 scan_state );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	return( 1 );
 
 on_error:
@@ -683,47 +721,23 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( scan_state != NULL )
-	{
-		libsigscan_scan_state_free(
-		 &scan_state,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libsigscan_scanner_scan_stop function
+/* Tests the libsigscan_scanner_set_number_of_read_ahead_buffers function
  * Returns 1 if successful or 0 if not
  */
-int sigscan_test_scanner_scan_stop(
+int sigscan_test_scanner_set_number_of_read_ahead_buffers(
      libsigscan_scanner_t *scanner )
 {
-	libcerror_error_t *error            = NULL;
-	libsigscan_scan_state_t *scan_state = NULL;
-	int result                          = 0;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
-	/* Initialize test
+	/* Test regular cases
 	 */
-	result = libsigscan_scan_state_initialize(
-	          &scan_state,
-	          &error );
-
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "scan_state",
-	 scan_state );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libsigscan_scanner_scan_start(
+	result = libsigscan_scanner_set_number_of_read_ahead_buffers(
 	          scanner,
-	          scan_state,
+	          4,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -735,11 +749,9 @@ int sigscan_test_scanner_scan_stop(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libsigscan_scanner_scan_stop(
+	result = libsigscan_scanner_set_number_of_read_ahead_buffers(
 	          scanner,
-	          scan_state,
+	          0,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -753,9 +765,9 @@ int sigscan_test_scanner_scan_stop(
 
 	/* Test error cases
 	 */
-	result = libsigscan_scanner_scan_stop(
+	result = libsigscan_scanner_set_number_of_read_ahead_buffers(
 	          NULL,
-	          scan_state,
+	          4,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -770,9 +782,9 @@ int sigscan_test_scanner_scan_stop(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scanner_scan_stop(
+	result = libsigscan_scanner_set_number_of_read_ahead_buffers(
 	          scanner,
-	          NULL,
+	          -1,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -787,25 +799,23 @@ int sigscan_test_scanner_scan_stop(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libsigscan_scan_state_free(
-	          &scan_state,
+	result = libsigscan_scanner_set_number_of_read_ahead_buffers(
+	          scanner,
+	          LIBSIGSCAN_READ_AHEAD_MAXIMUM_NUMBER_OF_BUFFERS + 1,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "scan_state",
-	 scan_state );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -814,59 +824,23 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( scan_state != NULL )
-	{
-		libsigscan_scan_state_free(
-		 &scan_state,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libsigscan_scanner_scan_buffer function
+/* Tests the libsigscan_scanner_set_io_strategy function
  * Returns 1 if successful or 0 if not
  */
-int sigscan_test_scanner_scan_buffer(
+int sigscan_test_scanner_set_io_strategy(
      libsigscan_scanner_t *scanner )
 {
-	uint8_t buffer[ 128 ];
-
-	libcerror_error_t *error            = NULL;
-	libsigscan_scan_state_t *scan_state = NULL;
-	void *memset_result                 = NULL;
-	int result                          = 0;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
-	/* Initialize test
+	/* Test regular cases
 	 */
-	memset_result = memory_set(
-	                 buffer,
-	                 0,
-	                 sizeof( uint8_t ) * 128 );
-
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "memset_result",
-	 memset_result );
-
-	result = libsigscan_scan_state_initialize(
-	          &scan_state,
-	          &error );
-
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "scan_state",
-	 scan_state );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libsigscan_scan_state_set_data_size(
-	          scan_state,
-	          64,
+	result = libsigscan_scanner_set_io_strategy(
+	          scanner,
+	          LIBSIGSCAN_IO_STRATEGY_DIRECT,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -878,9 +852,9 @@ int sigscan_test_scanner_scan_buffer(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_scan_start(
+	result = libsigscan_scanner_set_io_strategy(
 	          scanner,
-	          scan_state,
+	          LIBSIGSCAN_IO_STRATEGY_MAPPED,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -892,13 +866,9 @@ int sigscan_test_scanner_scan_buffer(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libsigscan_scanner_scan_buffer(
+	result = libsigscan_scanner_set_io_strategy(
 	          scanner,
-	          scan_state,
-	          buffer,
-	          128,
+	          LIBSIGSCAN_IO_STRATEGY_BFIO,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -912,11 +882,9 @@ int sigscan_test_scanner_scan_buffer(
 
 	/* Test error cases
 	 */
-	result = libsigscan_scanner_scan_buffer(
+	result = libsigscan_scanner_set_io_strategy(
 	          NULL,
-	          scan_state,
-	          buffer,
-	          128,
+	          LIBSIGSCAN_IO_STRATEGY_BUFFERED,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -931,11 +899,9 @@ int sigscan_test_scanner_scan_buffer(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scanner_scan_buffer(
+	result = libsigscan_scanner_set_io_strategy(
 	          scanner,
-	          NULL,
-	          buffer,
-	          128,
+	          -1,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -950,11 +916,9 @@ int sigscan_test_scanner_scan_buffer(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scanner_scan_buffer(
+	result = libsigscan_scanner_set_io_strategy(
 	          scanner,
-	          scan_state,
-	          NULL,
-	          128,
+	          LIBSIGSCAN_IO_STRATEGY_DIRECT + 1,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -969,40 +933,7 @@ int sigscan_test_scanner_scan_buffer(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libsigscan_scanner_scan_stop(
-	          scanner,
-	          scan_state,
-	          &error );
-
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libsigscan_scan_state_free(
-	          &scan_state,
-	          &error );
-
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "scan_state",
-	 scan_state );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	return( 1 );
+	return( 1 );
 
 on_error:
 	if( error != NULL )
@@ -1010,85 +941,28 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( scan_state != NULL )
-	{
-		libsigscan_scan_state_free(
-		 &scan_state,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libsigscan_scanner_scan_file function
+/* Tests the libsigscan_scanner_add_signature function
  * Returns 1 if successful or 0 if not
  */
-int sigscan_test_scanner_scan_file(
-     const system_character_t *source )
+int sigscan_test_scanner_add_signature(
+     libsigscan_scanner_t *scanner )
 {
-	char narrow_source[ 256 ];
-
-	libcerror_error_t *error            = NULL;
-	libsigscan_scan_state_t *scan_state = NULL;
-	libsigscan_scanner_t *scanner       = NULL;
-	int result                          = 0;
-
-	/* Initialize test
-	 */
-	result = sigscan_test_get_narrow_source(
-	          source,
-	          narrow_source,
-	          256,
-	          &error );
-
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libsigscan_scanner_initialize(
-	          &scanner,
-	          &error );
-
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "scanner",
-	 scanner );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libsigscan_scan_state_initialize(
-	          &scan_state,
-	          &error );
-
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "scan_state",
-	 scan_state );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libsigscan_scanner_scan_file(
+	result = libsigscan_scanner_add_signature(
 	          scanner,
-	          scan_state,
-	          narrow_source,
+	          "test1",
+	          6,
+	          0,
+	          (uint8_t *) "pattern",
+	          7,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1102,10 +976,14 @@ int sigscan_test_scanner_scan_file(
 
 	/* Test error cases
 	 */
-	result = libsigscan_scanner_scan_file(
+	result = libsigscan_scanner_add_signature(
 	          NULL,
-	          scan_state,
-	          narrow_source,
+	          "test1",
+	          6,
+	          0,
+	          (uint8_t *) "pattern",
+	          7,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1120,10 +998,14 @@ int sigscan_test_scanner_scan_file(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scanner_scan_file(
+	result = libsigscan_scanner_add_signature(
 	          scanner,
 	          NULL,
-	          narrow_source,
+	          5,
+	          0,
+	          (uint8_t *) "pattern",
+	          7,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1138,10 +1020,14 @@ int sigscan_test_scanner_scan_file(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scanner_scan_file(
+	result = libsigscan_scanner_add_signature(
 	          scanner,
-	          scan_state,
+	          "test1",
+	          6,
+	          0,
 	          NULL,
+	          7,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1156,42 +1042,6 @@ int sigscan_test_scanner_scan_file(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libsigscan_scan_state_free(
-	          &scan_state,
-	          &error );
-
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "scan_state",
-	 scan_state );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libsigscan_scanner_free(
-	          &scanner,
-	          &error );
-
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "scanner",
-	 scanner );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	return( 1 );
 
 on_error:
@@ -1200,42 +1050,29 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( scan_state != NULL )
-	{
-		libsigscan_scan_state_free(
-		 &scan_state,
-		 NULL );
-	}
-	if( scanner != NULL )
-	{
-		libsigscan_scanner_free(
-		 &scanner,
-		 NULL );
-	}
 	return( 0 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Tests the libsigscan_scanner_scan_file_wide function
+/* Tests the libsigscan_scanner_add_range_signature function
  * Returns 1 if successful or 0 if not
  */
-int sigscan_test_scanner_scan_file_wide(
-     const system_character_t *source )
+int sigscan_test_scanner_add_range_signature(
+     libsigscan_scanner_t *scanner )
 {
-	wchar_t wide_source[ 256 ];
-
-	libcerror_error_t *error            = NULL;
-	libsigscan_scan_state_t *scan_state = NULL;
-	libsigscan_scanner_t *scanner       = NULL;
-	int result                          = 0;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
-	/* Initialize test
+	/* Test regular cases
 	 */
-	result = sigscan_test_get_wide_source(
-	          source,
-	          wide_source,
-	          256,
+	result = libsigscan_scanner_add_range_signature(
+	          scanner,
+	          "range1",
+	          6,
+	          0,
+	          1024,
+	          (uint8_t *) "range pattern",
+	          13,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1247,8 +1084,15 @@ int sigscan_test_scanner_scan_file_wide(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_initialize(
-	          &scanner,
+	result = libsigscan_scanner_add_range_signature(
+	          scanner,
+	          "range2",
+	          6,
+	          0,
+	          1024,
+	          (uint8_t *) "range pattern",
+	          13,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START | LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RANGE,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1256,16 +1100,19 @@ int sigscan_test_scanner_scan_file_wide(
 	 result,
 	 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "scanner",
-	 scanner );
-
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scan_state_initialize(
-	          &scan_state,
+	result = libsigscan_scanner_add_range_signature(
+	          scanner,
+	          "range3",
+	          6,
+	          65557,
+	          0,
+	          (uint8_t *) "PK\x05\x06",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1273,37 +1120,44 @@ int sigscan_test_scanner_scan_file_wide(
 	 result,
 	 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "scan_state",
-	 scan_state );
-
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test error cases
 	 */
-	result = libsigscan_scanner_scan_file_wide(
-	          scanner,
-	          scan_state,
-	          wide_source,
+	result = libsigscan_scanner_add_range_signature(
+	          NULL,
+	          "range1",
+	          6,
+	          0,
+	          1024,
+	          (uint8_t *) "range pattern",
+	          13,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libsigscan_scanner_scan_file_wide(
-	          NULL,
-	          scan_state,
-	          wide_source,
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_add_range_signature(
+	          scanner,
+	          "range1",
+	          6,
+	          0,
+	          1024,
+	          (uint8_t *) "ran",
+	          3,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1318,10 +1172,15 @@ int sigscan_test_scanner_scan_file_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scanner_scan_file_wide(
+	result = libsigscan_scanner_add_range_signature(
 	          scanner,
-	          NULL,
-	          wide_source,
+	          "range1",
+	          6,
+	          0,
+	          1024,
+	          (uint8_t *) "range pattern",
+	          13,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1336,10 +1195,15 @@ int sigscan_test_scanner_scan_file_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libsigscan_scanner_scan_file_wide(
+	result = libsigscan_scanner_add_range_signature(
 	          scanner,
-	          scan_state,
-	          NULL,
+	          "range1",
+	          6,
+	          1024,
+	          0,
+	          (uint8_t *) "range pattern",
+	          13,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1354,41 +1218,30 @@ int sigscan_test_scanner_scan_file_wide(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
+	/* Test error case with the same pattern bound to another offset range
 	 */
-	result = libsigscan_scan_state_free(
-	          &scan_state,
+	result = libsigscan_scanner_add_range_signature(
+	          scanner,
+	          "range4",
+	          6,
+	          0,
+	          2048,
+	          (uint8_t *) "range pattern",
+	          13,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "scan_state",
-	 scan_state );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_free(
-	          &scanner,
-	          &error );
-
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "scanner",
-	 scanner );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	libcerror_error_free(
+	 &error );
 
 	return( 1 );
 
@@ -1398,40 +1251,27 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( scan_state != NULL )
-	{
-		libsigscan_scan_state_free(
-		 &scan_state,
-		 NULL );
-	}
-	if( scanner != NULL )
-	{
-		libsigscan_scanner_free(
-		 &scanner,
-		 NULL );
-	}
 	return( 0 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Tests the libsigscan_scanner_scan_file_io_handle function
+/* Tests the libsigscan_scanner_compile function
  * Returns 1 if successful or 0 if not
  */
-int sigscan_test_scanner_scan_file_io_handle(
-     const system_character_t *source )
+int sigscan_test_scanner_compile(
+     void )
 {
-	libbfio_handle_t *file_io_handle    = NULL;
+	uint8_t buffer[ 64 ];
+
 	libcerror_error_t *error            = NULL;
 	libsigscan_scan_state_t *scan_state = NULL;
 	libsigscan_scanner_t *scanner       = NULL;
-	size_t string_length                = 0;
+	int number_of_results               = 0;
 	int result                          = 0;
 
 	/* Initialize test
 	 */
-	result = libbfio_file_initialize(
-	          &file_io_handle,
+	result = libsigscan_scanner_initialize(
+	          &scanner,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1439,41 +1279,22 @@ int sigscan_test_scanner_scan_file_io_handle(
 	 result,
 	 1 );
 
-        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-         "file_io_handle",
-         file_io_handle );
-
-        SIGSCAN_TEST_ASSERT_IS_NULL(
-         "error",
-         error );
-
-	string_length = system_string_length(
-	                 source );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libbfio_file_set_name_wide(
-	          file_io_handle,
-	          source,
-	          string_length,
-	          &error );
-#else
-	result = libbfio_file_set_name(
-	          file_io_handle,
-	          source,
-	          string_length,
-	          &error );
-#endif
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
 
-        SIGSCAN_TEST_ASSERT_IS_NULL(
-         "error",
-         error );
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	result = libsigscan_scanner_initialize(
-	          &scanner,
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "test1",
+	          5,
+	          0,
+	          (uint8_t *) "header",
+	          6,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1481,10 +1302,6 @@ int sigscan_test_scanner_scan_file_io_handle(
 	 result,
 	 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "scanner",
-	 scanner );
-
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
@@ -1506,12 +1323,12 @@ int sigscan_test_scanner_scan_file_io_handle(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Build the scan trees before adding another signature
+	 * to test that compiling rebuilds the scan trees
 	 */
-	result = libsigscan_scanner_scan_file_io_handle(
+	result = libsigscan_scanner_scan_start(
 	          scanner,
 	          scan_state,
-	          file_io_handle,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1523,66 +1340,58 @@ int sigscan_test_scanner_scan_file_io_handle(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libsigscan_scanner_scan_file_io_handle(
-	          NULL,
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
 	          scan_state,
-	          file_io_handle,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libsigscan_scanner_scan_file_io_handle(
+	result = libsigscan_scanner_add_signature(
 	          scanner,
-	          NULL,
-	          file_io_handle,
+	          "test2",
+	          5,
+	          0,
+	          (uint8_t *) "pattern",
+	          7,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libsigscan_scanner_scan_file_io_handle(
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_compile(
 	          scanner,
-	          scan_state,
-	          NULL,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Clean up
+	/* Compiling a compiled scanner has no effect
 	 */
-	result = libsigscan_scan_state_free(
-	          &scan_state,
+	result = libsigscan_scanner_compile(
+	          scanner,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1590,93 +1399,43 @@ int sigscan_test_scanner_scan_file_io_handle(
 	 result,
 	 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "scan_state",
-	 scan_state );
-
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_free(
-	          &scanner,
-	          &error );
+	result = memory_set(
+	          buffer,
+	          (int) '.',
+	          64 ) == NULL;
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "scanner",
-	 scanner );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	 0 );
 
-	result = libbfio_handle_free(
-	          &file_io_handle,
-	          &error );
+	result = memory_copy(
+	          buffer,
+	          "header",
+	          6 ) == NULL;
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-         "file_io_handle",
-         file_io_handle );
-
-        SIGSCAN_TEST_ASSERT_IS_NULL(
-         "error",
-         error );
-
-	return( 1 );
+	 0 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( scan_state != NULL )
-	{
-		libsigscan_scan_state_free(
-		 &scan_state,
-		 NULL );
-	}
-	if( scanner != NULL )
-	{
-		libsigscan_scanner_free(
-		 &scanner,
-		 NULL );
-	}
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	return( 0 );
-}
+	result = memory_copy(
+	          &( buffer[ 32 ] ),
+	          "pattern",
+	          7 ) == NULL;
 
-/* Tests scanning a header signature
- * Returns 1 if successful or 0 if not
- */
-int sigscan_test_scanner1(
-     void )
-{
-	libcerror_error_t *error            = NULL;
-	libsigscan_scan_state_t *scan_state = NULL;
-	libsigscan_scanner_t *scanner       = NULL;
-	int number_of_results               = 0;
-	int result                          = 0;
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	/* Initialize test
-	 */
-	result = libsigscan_scanner_initialize(
-	          &scanner,
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          64,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1684,22 +1443,13 @@ int sigscan_test_scanner1(
 	 result,
 	 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "scanner",
-	 scanner );
-
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_add_signature(
+	result = libsigscan_scanner_scan_start(
 	          scanner,
-	          "test1",
-	          6,
-	          0,
-	          (uint8_t *) "Client UrlCache MMF Ver ",
-	          24,
-	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          scan_state,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1711,8 +1461,10 @@ int sigscan_test_scanner1(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_set_scan_buffer_size(
+	result = libsigscan_scanner_scan_buffer(
 	          scanner,
+	          scan_state,
+	          buffer,
 	          64,
 	          &error );
 
@@ -1725,8 +1477,9 @@ int sigscan_test_scanner1(
 	 "error",
 	 error );
 
-	result = libsigscan_scan_state_initialize(
-	          &scan_state,
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1734,19 +1487,13 @@ int sigscan_test_scanner1(
 	 result,
 	 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "scan_state",
-	 scan_state );
-
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libsigscan_scan_state_set_data_size(
+	result = libsigscan_scan_state_get_number_of_results(
 	          scan_state,
-	          64,
+	          &number_of_results,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1754,73 +1501,182 @@ int sigscan_test_scanner1(
 	 result,
 	 1 );
 
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 2 );
+
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_scan_start(
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_compile(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that a compiled scanner cannot be changed
+	 */
+	result = libsigscan_scanner_add_signature(
 	          scanner,
-	          scan_state,
+	          "test3",
+	          5,
+	          0,
+	          (uint8_t *) "footer",
+	          6,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_scan_buffer(
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_add_range_signature(
+	          scanner,
+	          "test4",
+	          5,
+	          0,
+	          1024,
+	          (uint8_t *) "range pattern",
+	          13,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_set_scan_buffer_size(
 	          scanner,
-	          scan_state,
-	          sigscan_test_scanner_data1,
 	          128,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_scan_stop(
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_set_number_of_threads(
 	          scanner,
-	          scan_state,
+	          1,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scan_state_get_number_of_results(
-	          scan_state,
-	          &number_of_results,
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_set_unbounded_scan_engine(
+	          scanner,
+	          LIBSIGSCAN_SCAN_ENGINE_AHO_CORASICK,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_set_scan_chunk_size(
+	          scanner,
+	          16384,
+	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "number_of_results",
-	 number_of_results,
-	 1 );
+	 "result",
+	 result,
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_set_number_of_read_ahead_buffers(
+	          scanner,
+	          4,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_set_io_strategy(
+	          scanner,
+	          LIBSIGSCAN_IO_STRATEGY_BUFFERED,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	/* Clean up
 	 */
 	result = libsigscan_scan_state_free(
@@ -1880,22 +1736,20 @@ on_error:
 	return( 0 );
 }
 
-/* Tests scanning a footer signature
+/* Tests the libsigscan_scanner_scan_start function
  * Returns 1 if successful or 0 if not
  */
-int sigscan_test_scanner2(
-     void )
+int sigscan_test_scanner_scan_start(
+     libsigscan_scanner_t *scanner )
 {
 	libcerror_error_t *error            = NULL;
 	libsigscan_scan_state_t *scan_state = NULL;
-	libsigscan_scanner_t *scanner       = NULL;
-	int number_of_results               = 0;
 	int result                          = 0;
 
 	/* Initialize test
 	 */
-	result = libsigscan_scanner_initialize(
-	          &scanner,
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1904,16 +1758,18 @@ int sigscan_test_scanner2(
 	 1 );
 
 	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "scanner",
-	 scanner );
+	 "scan_state",
+	 scan_state );
 
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_set_scan_buffer_size(
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_scan_start(
 	          scanner,
-	          64,
+	          scan_state,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1925,26 +1781,45 @@ int sigscan_test_scanner2(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_add_signature(
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_scan_start(
+	          NULL,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_start(
 	          scanner,
-	          "test1",
-	          6,
-	          8,
-	          (uint8_t *) "conectix",
-	          8,
-	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END,
+	          NULL,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scan_state_initialize(
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
 	          &scan_state,
 	          &error );
 
@@ -1953,7 +1828,7 @@ int sigscan_test_scanner2(
 	 result,
 	 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "scan_state",
 	 scan_state );
 
@@ -1961,11 +1836,37 @@ int sigscan_test_scanner2(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_scan_stop function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_stop(
+     libsigscan_scanner_t *scanner )
+{
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	int result                          = 0;
+
+	/* Initialize test
 	 */
-	result = libsigscan_scan_state_set_data_size(
-	          scan_state,
-	          64,
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -1973,6 +1874,10 @@ int sigscan_test_scanner2(
 	 result,
 	 1 );
 
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
@@ -1991,11 +1896,11 @@ int sigscan_test_scanner2(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_scan_buffer(
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_scan_stop(
 	          scanner,
 	          scan_state,
-	          sigscan_test_scanner_data2,
-	          128,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2007,39 +1912,42 @@ int sigscan_test_scanner2(
 	 "error",
 	 error );
 
+	/* Test error cases
+	 */
 	result = libsigscan_scanner_scan_stop(
-	          scanner,
+	          NULL,
 	          scan_state,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scan_state_get_number_of_results(
-	          scan_state,
-	          &number_of_results,
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          NULL,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "number_of_results",
-	 number_of_results,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	/* Clean up
 	 */
 	result = libsigscan_scan_state_free(
@@ -2059,23 +1967,6 @@ int sigscan_test_scanner2(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_free(
-	          &scanner,
-	          &error );
-
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "scanner",
-	 scanner );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	return( 1 );
 
 on_error:
@@ -2090,31 +1981,35 @@ on_error:
 		 &scan_state,
 		 NULL );
 	}
-	if( scanner != NULL )
-	{
-		libsigscan_scanner_free(
-		 &scanner,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests scanning an unbounded signature
+/* Tests the libsigscan_scanner_scan_buffer function
  * Returns 1 if successful or 0 if not
  */
-int sigscan_test_scanner3(
-     void )
+int sigscan_test_scanner_scan_buffer(
+     libsigscan_scanner_t *scanner )
 {
+	uint8_t buffer[ 128 ];
+
 	libcerror_error_t *error            = NULL;
 	libsigscan_scan_state_t *scan_state = NULL;
-	libsigscan_scanner_t *scanner       = NULL;
-	int number_of_results               = 0;
+	void *memset_result                 = NULL;
 	int result                          = 0;
 
 	/* Initialize test
 	 */
-	result = libsigscan_scanner_initialize(
-	          &scanner,
+	memset_result = memory_set(
+	                 buffer,
+	                 0,
+	                 sizeof( uint8_t ) * 128 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2123,15 +2018,15 @@ int sigscan_test_scanner3(
 	 1 );
 
 	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "scanner",
-	 scanner );
+	 "scan_state",
+	 scan_state );
 
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_set_scan_buffer_size(
-	          scanner,
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
 	          64,
 	          &error );
 
@@ -2144,14 +2039,9 @@ int sigscan_test_scanner3(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_add_signature(
+	result = libsigscan_scanner_scan_start(
 	          scanner,
-	          "test1",
-	          6,
-	          0,
-	          (uint8_t *) "example of unbounded pattern",
-	          28,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          scan_state,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2163,8 +2053,13 @@ int sigscan_test_scanner3(
 	 "error",
 	 error );
 
-	result = libsigscan_scan_state_initialize(
-	          &scan_state,
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_scan_buffer(
+	          scanner,
+	          scan_state,
+	          buffer,
+	          128,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2172,60 +2067,71 @@ int sigscan_test_scanner3(
 	 result,
 	 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "scan_state",
-	 scan_state );
-
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Test error cases
 	 */
-	result = libsigscan_scan_state_set_data_size(
+	result = libsigscan_scanner_scan_buffer(
+	          NULL,
 	          scan_state,
-	          64,
+	          buffer,
+	          128,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_scan_start(
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_buffer(
 	          scanner,
-	          scan_state,
+	          NULL,
+	          buffer,
+	          128,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	result = libsigscan_scanner_scan_buffer(
 	          scanner,
 	          scan_state,
-	          sigscan_test_scanner_data3,
+	          NULL,
 	          128,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
 	result = libsigscan_scanner_scan_stop(
 	          scanner,
 	          scan_state,
@@ -2240,9 +2146,8 @@ int sigscan_test_scanner3(
 	 "error",
 	 error );
 
-	result = libsigscan_scan_state_get_number_of_results(
-	          scan_state,
-	          &number_of_results,
+	result = libsigscan_scan_state_free(
+	          &scan_state,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2250,19 +2155,50 @@ int sigscan_test_scanner3(
 	 result,
 	 1 );
 
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "number_of_results",
-	 number_of_results,
-	 1 );
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
 
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Clean up
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_scan_file function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_file(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	int result                          = 0;
+
+	/* Initialize test
 	 */
-	result = libsigscan_scan_state_free(
-	          &scan_state,
+	result = sigscan_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2270,15 +2206,11 @@ int sigscan_test_scanner3(
 	 result,
 	 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "scan_state",
-	 scan_state );
-
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_free(
+	result = libsigscan_scanner_initialize(
 	          &scanner,
 	          &error );
 
@@ -2287,7 +2219,7 @@ int sigscan_test_scanner3(
 	 result,
 	 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "scanner",
 	 scanner );
 
@@ -2295,10 +2227,8 @@ int sigscan_test_scanner3(
 	 "error",
 	 error );
 
-	/* Initialize test
-	 */
-	result = libsigscan_scanner_initialize(
-	          &scanner,
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2307,16 +2237,19 @@ int sigscan_test_scanner3(
 	 1 );
 
 	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "scanner",
-	 scanner );
+	 "scan_state",
+	 scan_state );
 
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_set_scan_buffer_size(
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_scan_file(
 	          scanner,
-	          64,
+	          scan_state,
+	          narrow_source,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2328,45 +2261,65 @@ int sigscan_test_scanner3(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_add_signature(
-	          scanner,
-	          "test1",
-	          6,
-	          0,
-	          (uint8_t *) "example of unbounded pattern",
-	          28,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_scan_file(
+	          NULL,
+	          scan_state,
+	          narrow_source,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_add_signature(
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_file(
 	          scanner,
-	          "test2",
-	          6,
-	          0,
-	          (uint8_t *) "another example",
-	          15,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          NULL,
+	          narrow_source,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scan_state_initialize(
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_file(
+	          scanner,
+	          scan_state,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
 	          &scan_state,
 	          &error );
 
@@ -2375,7 +2328,7 @@ int sigscan_test_scanner3(
 	 result,
 	 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "scan_state",
 	 scan_state );
 
@@ -2383,11 +2336,67 @@ int sigscan_test_scanner3(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libsigscan_scanner_scan_file_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_file_wide(
+     const system_character_t *source )
+{
+	wchar_t wide_source[ 256 ];
+
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	int result                          = 0;
+
+	/* Initialize test
 	 */
-	result = libsigscan_scan_state_set_data_size(
-	          scan_state,
-	          64,
+	result = sigscan_test_get_wide_source(
+	          source,
+	          wide_source,
+	          256,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2399,9 +2408,8 @@ int sigscan_test_scanner3(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_scan_start(
-	          scanner,
-	          scan_state,
+	result = libsigscan_scanner_initialize(
+	          &scanner,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2409,15 +2417,16 @@ int sigscan_test_scanner3(
 	 result,
 	 1 );
 
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_scan_buffer(
-	          scanner,
-	          scan_state,
-	          sigscan_test_scanner_data3,
-	          128,
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2425,13 +2434,20 @@ int sigscan_test_scanner3(
 	 result,
 	 1 );
 
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_scan_stop(
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_scan_file_wide(
 	          scanner,
 	          scan_state,
+	          wide_source,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2443,25 +2459,62 @@ int sigscan_test_scanner3(
 	 "error",
 	 error );
 
-	result = libsigscan_scan_state_get_number_of_results(
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_scan_file_wide(
+	          NULL,
 	          scan_state,
-	          &number_of_results,
+	          wide_source,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_file_wide(
+	          scanner,
+	          NULL,
+	          wide_source,
+	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "number_of_results",
-	 number_of_results,
-	 1 );
+	 "result",
+	 result,
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_file_wide(
+	          scanner,
+	          scan_state,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	/* Clean up
 	 */
 	result = libsigscan_scan_state_free(
@@ -2521,20 +2574,65 @@ on_error:
 	return( 0 );
 }
 
-/* Tests scanning an unbounded signature
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Tests the libsigscan_scanner_scan_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
-int sigscan_test_scanner4(
-     void )
+int sigscan_test_scanner_scan_file_io_handle(
+     const system_character_t *source )
 {
+	libbfio_handle_t *file_io_handle    = NULL;
 	libcerror_error_t *error            = NULL;
 	libsigscan_scan_state_t *scan_state = NULL;
 	libsigscan_scanner_t *scanner       = NULL;
-	int number_of_results               = 0;
+	size_t string_length                = 0;
 	int result                          = 0;
 
 	/* Initialize test
 	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+         "file_io_handle",
+         file_io_handle );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
 	result = libsigscan_scanner_initialize(
 	          &scanner,
 	          &error );
@@ -2552,9 +2650,8 @@ int sigscan_test_scanner4(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_set_scan_buffer_size(
-	          scanner,
-	          64,
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2562,18 +2659,20 @@ int sigscan_test_scanner4(
 	 result,
 	 1 );
 
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_add_signature(
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_scan_file_io_handle(
 	          scanner,
-	          "apache_access0",
-	          15,
-	          0,
-	          (uint8_t *) "\"CONNECT ",
-	          9,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          scan_state,
+	          file_io_handle,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2585,71 +2684,66 @@ int sigscan_test_scanner4(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_add_signature(
-	          scanner,
-	          "apache_access1",
-	          15,
-	          0,
-	          (uint8_t *) "\"DELETE ",
-	          8,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_scan_file_io_handle(
+	          NULL,
+	          scan_state,
+	          file_io_handle,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_add_signature(
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_file_io_handle(
 	          scanner,
-	          "apache_access2",
-	          15,
-	          0,
-	          (uint8_t *) "\"GET ",
-	          5,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          NULL,
+	          file_io_handle,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_add_signature(
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_file_io_handle(
 	          scanner,
-	          "apache_access3",
-	          15,
-	          0,
-	          (uint8_t *) "\"HEAD ",
-	          6,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          scan_state,
+	          NULL,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_add_signature(
-	          scanner,
-	          "apache_access4",
-	          15,
-	          0,
-	          (uint8_t *) " HTTP/",
-	          6,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2657,18 +2751,16 @@ int sigscan_test_scanner4(
 	 result,
 	 1 );
 
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_add_signature(
-	          scanner,
-	          "apache_access5",
-	          15,
-	          0,
-	          (uint8_t *) "\"OPTIONS ",
-	          9,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	result = libsigscan_scanner_free(
+	          &scanner,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2676,18 +2768,16 @@ int sigscan_test_scanner4(
 	 result,
 	 1 );
 
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
 	SIGSCAN_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_add_signature(
-	          scanner,
-	          "apache_access6",
-	          15,
-	          0,
-	          (uint8_t *) "\"PATCH ",
-	          7,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	result = libbfio_handle_free(
+	          &file_io_handle,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2696,151 +2786,734 @@ int sigscan_test_scanner4(
 	 1 );
 
 	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+         "file_io_handle",
+         file_io_handle );
 
-	result = libsigscan_scanner_add_signature(
-	          scanner,
-	          "apache_access7",
-	          15,
-	          0,
-	          (uint8_t *) "\"POST ",
-	          6,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
-	          &error );
+        SIGSCAN_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
 
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	return( 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
 
-	result = libsigscan_scanner_add_signature(
-	          scanner,
-	          "apache_access8",
-	          15,
-	          0,
-	          (uint8_t *) "\"PUT ",
-	          5,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+/* Tests the libsigscan_scanner_read_compiled_file function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_read_compiled_file(
+     libsigscan_scanner_t *scanner )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_read_compiled_file(
+	          NULL,
+	          "test",
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_add_signature(
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_read_compiled_file(
 	          scanner,
-	          "apache_access9",
-	          15,
-	          0,
-	          (uint8_t *) "\"TRACE ",
-	          7,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          NULL,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_add_signature(
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the scanner already contains signatures
+	 */
+	result = libsigscan_scanner_read_compiled_file(
 	          scanner,
-	          "confluence_access0",
-	          19,
-	          0,
-	          (uint8_t *) " CONNECT ",
-	          9,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          "test",
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_add_signature(
-	          scanner,
-	          "confluence_access1",
-	          19,
-	          0,
-	          (uint8_t *) " DELETE ",
-	          8,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
-	          &error );
+	libcerror_error_free(
+	 &error );
 
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	return( 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
 
-	result = libsigscan_scanner_add_signature(
-	          scanner,
-	          "confluence_access2",
-	          19,
-	          0,
-	          (uint8_t *) " GET ",
-	          5,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+/* Tests the libsigscan_scanner_write_compiled_file function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_write_compiled_file(
+     libsigscan_scanner_t *scanner )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_write_compiled_file(
+	          NULL,
+	          "test",
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_add_signature(
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_write_compiled_file(
 	          scanner,
-	          "confluence_access3",
-	          19,
-	          0,
-	          (uint8_t *) " HEAD ",
-	          6,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          NULL,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libsigscan_scanner_add_signature(
-	          scanner,
-	          "confluence_access4",
-	          19,
-	          0,
-	          (uint8_t *) " HTTP/",
-	          6,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
-	          &error );
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Retrieves a string of the identifiers of the scan results
+ * Returns 1 if successful or -1 on error
+ */
+int sigscan_test_scanner_get_results_string(
+     libsigscan_scan_state_t *scan_state,
+     char *results_string,
+     size_t results_string_size,
+     libcerror_error_t **error )
+{
+	libsigscan_scan_result_t *scan_result = NULL;
+	static char *function                 = "sigscan_test_scanner_get_results_string";
+	size_t identifier_size                = 0;
+	size_t results_string_index           = 0;
+	int number_of_results                 = 0;
+	int result_index                      = 0;
+
+	if( results_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid results string.",
+		 function );
+
+		return( -1 );
+	}
+	if( results_string_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid results string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsigscan_scan_state_get_number_of_results(
+	     scan_state,
+	     &number_of_results,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of scan results.",
+		 function );
+
+		return( -1 );
+	}
+	for( result_index = 0;
+	     result_index < number_of_results;
+	     result_index++ )
+	{
+		if( libsigscan_scan_state_get_result(
+		     scan_state,
+		     result_index,
+		     &scan_result,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan result: %d.",
+			 function,
+			 result_index );
+
+			return( -1 );
+		}
+		if( libsigscan_scan_result_get_identifier_size(
+		     scan_result,
+		     &identifier_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan result: %d identifier size.",
+			 function,
+			 result_index );
+
+			return( -1 );
+		}
+		if( identifier_size > ( results_string_size - results_string_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid results string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( libsigscan_scan_result_get_identifier(
+		     scan_result,
+		     &( results_string[ results_string_index ] ),
+		     identifier_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan result: %d identifier.",
+			 function,
+			 result_index );
+
+			return( -1 );
+		}
+		/* Replace the end of string character by a separator
+		 */
+		results_string_index += identifier_size;
+
+		results_string[ results_string_index - 1 ] = ';';
+	}
+	if( results_string_index >= results_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid results string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	results_string[ results_string_index ] = 0;
+
+	return( 1 );
+}
+
+/* Scans data or a file with a (shared) scanner and retrieves a string of the identifiers of the scan results
+ * Returns 1 if successful or -1 on error
+ */
+int sigscan_test_scanner_get_scan_results(
+     libsigscan_scanner_t *scanner,
+     int scan_mode,
+     uint8_t *data,
+     size_t data_size,
+     const char *filename,
+     char *results_string,
+     size_t results_string_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle    = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	static char *function               = "sigscan_test_scanner_get_scan_results";
+	size_t data_offset                  = 0;
+	size_t read_size                    = 0;
+
+	if( libsigscan_scan_state_initialize(
+	     &scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan state.",
+		 function );
+
+		goto on_error;
+	}
+	switch( scan_mode )
+	{
+		case SIGSCAN_TEST_SCANNER_SCAN_MODE_BUFFER:
+			if( libsigscan_scan_state_set_data_size(
+			     scan_state,
+			     (size64_t) data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set data size.",
+				 function );
+
+				goto on_error;
+			}
+			if( libsigscan_scanner_scan_start(
+			     scanner,
+			     scan_state,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to start scan.",
+				 function );
+
+				goto on_error;
+			}
+			/* Scan the data in parts that do not align with the scan buffer size
+			 */
+			for( data_offset = 0;
+			     data_offset < data_size;
+			     data_offset += read_size )
+			{
+				read_size = data_size - data_offset;
+
+				if( read_size > 300 )
+				{
+					read_size = 300;
+				}
+				if( libsigscan_scanner_scan_buffer(
+				     scanner,
+				     scan_state,
+				     &( data[ data_offset ] ),
+				     read_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to scan buffer.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libsigscan_scanner_scan_stop(
+			     scanner,
+			     scan_state,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to stop scan.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case SIGSCAN_TEST_SCANNER_SCAN_MODE_FILE_IO_HANDLE:
+			if( sigscan_test_open_file_io_handle(
+			     &file_io_handle,
+			     data,
+			     data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file IO handle.",
+				 function );
+
+				goto on_error;
+			}
+			if( libsigscan_scanner_scan_file_io_handle(
+			     scanner,
+			     scan_state,
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan file IO handle.",
+				 function );
+
+				goto on_error;
+			}
+			if( sigscan_test_close_file_io_handle(
+			     &file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case SIGSCAN_TEST_SCANNER_SCAN_MODE_FILE:
+			if( libsigscan_scanner_scan_file(
+			     scanner,
+			     scan_state,
+			     filename,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan file.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported scan mode.",
+			 function );
+
+			goto on_error;
+	}
+	if( sigscan_test_scanner_get_results_string(
+	     scan_state,
+	     results_string,
+	     results_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve results string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scan_state_free(
+	     &scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free scan state.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Repeatedly scans with a shared scanner and compares the scan results
+ * Returns 1 if successful or -1 on error
+ */
+int sigscan_test_scanner_scan_thread(
+     sigscan_test_scanner_thread_values_t *thread_values )
+{
+	char results_string[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	int iteration            = 0;
+	int scan_mode            = 0;
+
+	if( thread_values == NULL )
+	{
+		return( -1 );
+	}
+	for( iteration = 0;
+	     iteration < thread_values->number_of_iterations;
+	     iteration++ )
+	{
+		for( scan_mode = SIGSCAN_TEST_SCANNER_SCAN_MODE_BUFFER;
+		     scan_mode <= SIGSCAN_TEST_SCANNER_SCAN_MODE_FILE;
+		     scan_mode++ )
+		{
+			if( ( scan_mode == SIGSCAN_TEST_SCANNER_SCAN_MODE_FILE )
+			 && ( thread_values->filename == NULL ) )
+			{
+				continue;
+			}
+			if( sigscan_test_scanner_get_scan_results(
+			     thread_values->scanner,
+			     scan_mode,
+			     thread_values->data,
+			     thread_values->data_size,
+			     thread_values->filename,
+			     results_string,
+			     512,
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+			/* The comparison includes the end of string character
+			 */
+			if( narrow_string_compare(
+			     results_string,
+			     thread_values->results_strings[ scan_mode ],
+			     narrow_string_length( thread_values->results_strings[ scan_mode ] ) + 1 ) != 0 )
+			{
+				goto on_error;
+			}
+		}
+	}
+	thread_values->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	thread_values->result = 0;
+
+	return( -1 );
+}
+
+/* Tests the libsigscan_scanner_scan_buffer, libsigscan_scanner_scan_file_io_handle
+ * and libsigscan_scanner_scan_file functions with a compiled scanner shared by multiple threads
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_compiled_concurrently(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+	char results_strings[ 3 ][ 512 ];
+	uint8_t data[ 4096 ];
+
+	sigscan_test_scanner_thread_values_t thread_values[ SIGSCAN_TEST_SCANNER_NUMBER_OF_THREADS ];
+	libcthreads_thread_t *threads[ SIGSCAN_TEST_SCANNER_NUMBER_OF_THREADS ];
+
+	libcerror_error_t *error      = NULL;
+	libsigscan_scanner_t *scanner = NULL;
+	const char *filename          = NULL;
+	size_t data_offset            = 0;
+	int result                    = 0;
+	int scan_mode                 = 0;
+	int thread_index              = 0;
+
+	for( thread_index = 0;
+	     thread_index < SIGSCAN_TEST_SCANNER_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		threads[ thread_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	if( source != NULL )
+	{
+		result = sigscan_test_get_narrow_source(
+		          source,
+		          narrow_source,
+		          256,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		filename = narrow_source;
+	}
+	for( data_offset = 0;
+	     data_offset < 4096;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( 'a' + ( data_offset % 13 ) );
+	}
+	result = memory_copy(
+	          data,
+	          "HEADER01",
+	          8 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_copy(
+	          &( data[ 4096 - 8 ] ),
+	          "FOOTER01",
+	          8 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Store the unbounded pattern on a scan buffer boundary as well
+	 */
+	result = memory_copy(
+	          &( data[ 100 ] ),
+	          "UNBOUNDED",
+	          9 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_copy(
+	          &( data[ 2044 ] ),
+	          "UNBOUNDED",
+	          9 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_copy(
+	          &( data[ 1500 ] ),
+	          "RANGEPAT",
+	          8 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_set_scan_buffer_size(
+	          scanner,
+	          256,
+	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -2853,12 +3526,12 @@ int sigscan_test_scanner4(
 
 	result = libsigscan_scanner_add_signature(
 	          scanner,
-	          "confluence_access5",
-	          19,
+	          "header",
+	          6,
 	          0,
-	          (uint8_t *) " OPTIONS ",
-	          9,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          (uint8_t *) "HEADER01",
+	          8,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2872,12 +3545,12 @@ int sigscan_test_scanner4(
 
 	result = libsigscan_scanner_add_signature(
 	          scanner,
-	          "confluence_access6",
-	          19,
-	          0,
-	          (uint8_t *) " PATCH ",
-	          7,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          "footer",
+	          6,
+	          8,
+	          (uint8_t *) "FOOTER01",
+	          8,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
@@ -2891,195 +3564,6362 @@ int sigscan_test_scanner4(
 
 	result = libsigscan_scanner_add_signature(
 	          scanner,
-	          "confluence_access7",
-	          19,
+	          "unbounded",
+	          9,
 	          0,
-	          (uint8_t *) " POST ",
-	          6,
+	          (uint8_t *) "UNBOUNDED",
+	          9,
 	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
 	          &error );
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_range_signature(
+	          scanner,
+	          "range",
+	          5,
+	          1024,
+	          2048,
+	          (uint8_t *) "RANGEPAT",
+	          8,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_compile(
+	          scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Determine the expected scan results with a single thread
+	 */
+	for( scan_mode = SIGSCAN_TEST_SCANNER_SCAN_MODE_BUFFER;
+	     scan_mode <= SIGSCAN_TEST_SCANNER_SCAN_MODE_FILE;
+	     scan_mode++ )
+	{
+		results_strings[ scan_mode ][ 0 ] = 0;
+
+		if( ( scan_mode == SIGSCAN_TEST_SCANNER_SCAN_MODE_FILE )
+		 && ( filename == NULL ) )
+		{
+			continue;
+		}
+		result = sigscan_test_scanner_get_scan_results(
+		          scanner,
+		          scan_mode,
+		          data,
+		          4096,
+		          filename,
+		          results_strings[ scan_mode ],
+		          512,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	SIGSCAN_TEST_ASSERT_NOT_EQUAL_INT(
+	 "results_strings[ SIGSCAN_TEST_SCANNER_SCAN_MODE_BUFFER ][ 0 ]",
+	 (int) results_strings[ SIGSCAN_TEST_SCANNER_SCAN_MODE_BUFFER ][ 0 ],
+	 0 );
+
+	/* Test regular cases
+	 */
+	for( thread_index = 0;
+	     thread_index < SIGSCAN_TEST_SCANNER_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		thread_values[ thread_index ].scanner              = scanner;
+		thread_values[ thread_index ].data                 = data;
+		thread_values[ thread_index ].data_size            = 4096;
+		thread_values[ thread_index ].filename             = filename;
+		thread_values[ thread_index ].results_strings      = results_strings;
+		thread_values[ thread_index ].number_of_iterations = SIGSCAN_TEST_SCANNER_NUMBER_OF_ITERATIONS;
+		thread_values[ thread_index ].result               = 0;
+
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          (int (*)(void *)) &sigscan_test_scanner_scan_thread,
+		          (void *) &( thread_values[ thread_index ] ),
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < SIGSCAN_TEST_SCANNER_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "thread_values[ thread_index ].result",
+		 thread_values[ thread_index ].result,
+		 1 );
+	}
+	/* Clean up
+	 */
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < SIGSCAN_TEST_SCANNER_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Creates a scanner to compare scanning a file in chunks with scanning it by a single thread
+ * Returns 1 if successful or -1 on error
+ */
+int sigscan_test_scanner_initialize_chunked_scanner(
+     libsigscan_scanner_t **scanner,
+     int unbounded_scan_engine,
+     int number_of_threads,
+     size64_t scan_chunk_size,
+     libcerror_error_t **error )
+{
+	static char *function = "sigscan_test_scanner_initialize_chunked_scanner";
+
+	if( libsigscan_scanner_initialize(
+	     scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scanner.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_set_unbounded_scan_engine(
+	     *scanner,
+	     unbounded_scan_engine,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set unbounded scan engine.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_set_number_of_threads(
+	     *scanner,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_set_scan_chunk_size(
+	     *scanner,
+	     scan_chunk_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set scan chunk size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_add_signature(
+	     *scanner,
+	     "header",
+	     6,
+	     0,
+	     (uint8_t *) "HEADER01",
+	     8,
+	     LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add header signature.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_add_signature(
+	     *scanner,
+	     "footer",
+	     6,
+	     8,
+	     (uint8_t *) "FOOTER01",
+	     8,
+	     LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add footer signature.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_add_signature(
+	     *scanner,
+	     "unbounded",
+	     9,
+	     0,
+	     (uint8_t *) "UNBOUND1",
+	     8,
+	     LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add unbounded signature.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsigscan_scanner_add_range_signature(
+	     *scanner,
+	     "range",
+	     5,
+	     1024,
+	     2048,
+	     (uint8_t *) "RANGEPAT",
+	     8,
+	     LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add range signature.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 scanner,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libsigscan_scanner_scan_file_io_handle function scanning a file in chunks on multiple threads
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_file_io_handle_in_chunks(
+     void )
+{
+	char chunked_results_string[ 512 ];
+	char results_string[ 512 ];
+	uint8_t data[ 65536 ];
+
+	size_t unbounded_offsets[ 6 ] = {
+		100, 16380, 20000, 32760, 40000, 49148 };
+
+	libcerror_error_t *error      = NULL;
+	libsigscan_scanner_t *scanner = NULL;
+	size_t data_offset            = 0;
+	size_t string_index           = 0;
+	uint32_t random_state         = 0x12345678UL;
+	int number_of_unbounded       = 0;
+	int offset_index              = 0;
+	int result                    = 0;
+	int unbounded_scan_engine     = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 65536;
+	     data_offset++ )
+	{
+		random_state ^= random_state << 13;
+		random_state ^= random_state >> 17;
+		random_state ^= random_state << 5;
+
+		data[ data_offset ] = (uint8_t) random_state;
+	}
+	result = memory_copy(
+	          data,
+	          "HEADER01",
+	          8 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_copy(
+	          &( data[ 1500 ] ),
+	          "RANGEPAT",
+	          8 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Store the unbounded pattern on a scan buffer and a scan chunk boundary as well
+	 */
+	for( offset_index = 0;
+	     offset_index < 6;
+	     offset_index++ )
+	{
+		result = memory_copy(
+		          &( data[ unbounded_offsets[ offset_index ] ] ),
+		          "UNBOUND1",
+		          8 ) == NULL;
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = memory_copy(
+	          &( data[ 65536 - 8 ] ),
+	          "FOOTER01",
+	          8 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	for( unbounded_scan_engine = LIBSIGSCAN_SCAN_ENGINE_SCAN_TREE;
+	     unbounded_scan_engine <= LIBSIGSCAN_SCAN_ENGINE_AHO_CORASICK;
+	     unbounded_scan_engine++ )
+	{
+		/* Determine the expected scan results with a single thread
+		 */
+		result = sigscan_test_scanner_initialize_chunked_scanner(
+		          &scanner,
+		          unbounded_scan_engine,
+		          1,
+		          0,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = sigscan_test_scanner_get_scan_results(
+		          scanner,
+		          SIGSCAN_TEST_SCANNER_SCAN_MODE_FILE_IO_HANDLE,
+		          data,
+		          65536,
+		          NULL,
+		          results_string,
+		          512,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_free(
+		          &scanner,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 * The scan chunk size is rounded up to a multiple of the scan buffer size
+		 */
+		result = sigscan_test_scanner_initialize_chunked_scanner(
+		          &scanner,
+		          unbounded_scan_engine,
+		          4,
+		          10000,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = sigscan_test_scanner_get_scan_results(
+		          scanner,
+		          SIGSCAN_TEST_SCANNER_SCAN_MODE_FILE_IO_HANDLE,
+		          data,
+		          65536,
+		          NULL,
+		          chunked_results_string,
+		          512,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_free(
+		          &scanner,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The comparison includes the end of string character
+		 */
+		result = narrow_string_compare(
+		          chunked_results_string,
+		          results_string,
+		          narrow_string_length( results_string ) + 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* The Aho-Corasick engine finds the unbounded patterns that span scan buffer
+		 * and scan chunk boundaries
+		 */
+		if( unbounded_scan_engine == LIBSIGSCAN_SCAN_ENGINE_AHO_CORASICK )
+		{
+			number_of_unbounded = 0;
+
+			for( string_index = 0;
+			     chunked_results_string[ string_index ] != 0;
+			     string_index++ )
+			{
+				if( narrow_string_compare(
+				     &( chunked_results_string[ string_index ] ),
+				     "unbounded;",
+				     10 ) == 0 )
+				{
+					number_of_unbounded++;
+				}
+			}
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "number_of_unbounded",
+			 number_of_unbounded,
+			 6 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_scan_file_io_handle function reading a file ahead on a reader thread
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_file_io_handle_with_read_ahead(
+     void )
+{
+	char read_ahead_results_string[ 512 ];
+	char results_string[ 512 ];
+	uint8_t data[ 65536 ];
+
+	libcerror_error_t *error      = NULL;
+	libsigscan_scanner_t *scanner = NULL;
+	size_t data_offset            = 0;
+	uint32_t random_state         = 0x87654321UL;
+	int number_of_buffers         = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 65536;
+	     data_offset++ )
+	{
+		random_state ^= random_state << 13;
+		random_state ^= random_state >> 17;
+		random_state ^= random_state << 5;
+
+		data[ data_offset ] = (uint8_t) random_state;
+	}
+	result = memory_copy(
+	          data,
+	          "HEADER01",
+	          8 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_copy(
+	          &( data[ 1500 ] ),
+	          "RANGEPAT",
+	          8 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_copy(
+	          &( data[ 40000 ] ),
+	          "UNBOUND1",
+	          8 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_copy(
+	          &( data[ 65536 - 8 ] ),
+	          "FOOTER01",
+	          8 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Determine the expected scan results without read-ahead
+	 */
+	result = sigscan_test_scanner_initialize_chunked_scanner(
+	          &scanner,
+	          LIBSIGSCAN_SCAN_ENGINE_SCAN_TREE,
+	          1,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = sigscan_test_scanner_get_scan_results(
+	          scanner,
+	          SIGSCAN_TEST_SCANNER_SCAN_MODE_FILE_IO_HANDLE,
+	          data,
+	          65536,
+	          NULL,
+	          results_string,
+	          512,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * A single read-ahead buffer makes the reader thread wait for every buffer to be scanned
+	 */
+	for( number_of_buffers = 1;
+	     number_of_buffers <= 4;
+	     number_of_buffers += 3 )
+	{
+		result = sigscan_test_scanner_initialize_chunked_scanner(
+		          &scanner,
+		          LIBSIGSCAN_SCAN_ENGINE_SCAN_TREE,
+		          1,
+		          0,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_set_number_of_read_ahead_buffers(
+		          scanner,
+		          number_of_buffers,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = sigscan_test_scanner_get_scan_results(
+		          scanner,
+		          SIGSCAN_TEST_SCANNER_SCAN_MODE_FILE_IO_HANDLE,
+		          data,
+		          65536,
+		          NULL,
+		          read_ahead_results_string,
+		          512,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_free(
+		          &scanner,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The comparison includes the end of string character
+		 */
+		result = narrow_string_compare(
+		          read_ahead_results_string,
+		          results_string,
+		          narrow_string_length( results_string ) + 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests scanning with compiled scanners shared by multiple threads that scan files in chunks
+ * and read files ahead on their own threads, to be run with a thread sanitizer
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_stress(
+     void )
+{
+	char results_strings[ 3 ][ 512 ];
+	uint8_t data[ 65536 ];
+
+	sigscan_test_scanner_thread_values_t thread_values[ SIGSCAN_TEST_SCANNER_NUMBER_OF_THREADS ];
+	libcthreads_thread_t *threads[ SIGSCAN_TEST_SCANNER_NUMBER_OF_THREADS ];
+
+	libcerror_error_t *error      = NULL;
+	libsigscan_scanner_t *scanner = NULL;
+	size_t data_offset            = 0;
+	uint32_t random_state         = 0x13579bdfUL;
+	int read_ahead                = 0;
+	int result                    = 0;
+	int scan_mode                 = 0;
+	int thread_index              = 0;
+
+	for( thread_index = 0;
+	     thread_index < SIGSCAN_TEST_SCANNER_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		threads[ thread_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 65536;
+	     data_offset++ )
+	{
+		random_state ^= random_state << 13;
+		random_state ^= random_state >> 17;
+		random_state ^= random_state << 5;
+
+		data[ data_offset ] = (uint8_t) random_state;
+	}
+	result = memory_copy(
+	          data,
+	          "HEADER01",
+	          8 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_copy(
+	          &( data[ 1500 ] ),
+	          "RANGEPAT",
+	          8 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Store the unbounded pattern on a scan chunk boundary as well
+	 */
+	result = memory_copy(
+	          &( data[ 16380 ] ),
+	          "UNBOUND1",
+	          8 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_copy(
+	          &( data[ 40000 ] ),
+	          "UNBOUND1",
+	          8 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_copy(
+	          &( data[ 65536 - 8 ] ),
+	          "FOOTER01",
+	          8 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test regular cases
+	 * The first scanner scans a file in chunks on multiple threads, the second scanner
+	 * reads a file ahead on a reader thread
+	 */
+	for( read_ahead = 0;
+	     read_ahead <= 1;
+	     read_ahead++ )
+	{
+		result = sigscan_test_scanner_initialize_chunked_scanner(
+		          &scanner,
+		          LIBSIGSCAN_SCAN_ENGINE_SCAN_TREE,
+		          ( read_ahead == 0 ) ? SIGSCAN_TEST_SCANNER_NUMBER_OF_THREADS : 1,
+		          ( read_ahead == 0 ) ? 16384 : 0,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_set_number_of_read_ahead_buffers(
+		          scanner,
+		          ( read_ahead == 0 ) ? 0 : 4,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_compile(
+		          scanner,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Determine the expected scan results with a single thread
+		 */
+		for( scan_mode = SIGSCAN_TEST_SCANNER_SCAN_MODE_BUFFER;
+		     scan_mode <= SIGSCAN_TEST_SCANNER_SCAN_MODE_FILE;
+		     scan_mode++ )
+		{
+			results_strings[ scan_mode ][ 0 ] = 0;
+
+			if( scan_mode == SIGSCAN_TEST_SCANNER_SCAN_MODE_FILE )
+			{
+				continue;
+			}
+			result = sigscan_test_scanner_get_scan_results(
+			          scanner,
+			          scan_mode,
+			          data,
+			          65536,
+			          NULL,
+			          results_strings[ scan_mode ],
+			          512,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		for( thread_index = 0;
+		     thread_index < SIGSCAN_TEST_SCANNER_NUMBER_OF_THREADS;
+		     thread_index++ )
+		{
+			thread_values[ thread_index ].scanner              = scanner;
+			thread_values[ thread_index ].data                 = data;
+			thread_values[ thread_index ].data_size            = 65536;
+			thread_values[ thread_index ].filename             = NULL;
+			thread_values[ thread_index ].results_strings      = results_strings;
+			thread_values[ thread_index ].number_of_iterations = SIGSCAN_TEST_SCANNER_NUMBER_OF_STRESS_ITERATIONS;
+			thread_values[ thread_index ].result               = 0;
+
+			result = libcthreads_thread_create(
+			          &( threads[ thread_index ] ),
+			          NULL,
+			          (int (*)(void *)) &sigscan_test_scanner_scan_thread,
+			          (void *) &( thread_values[ thread_index ] ),
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		for( thread_index = 0;
+		     thread_index < SIGSCAN_TEST_SCANNER_NUMBER_OF_THREADS;
+		     thread_index++ )
+		{
+			result = libcthreads_thread_join(
+			          &( threads[ thread_index ] ),
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "thread_values[ thread_index ].result",
+			 thread_values[ thread_index ].result,
+			 1 );
+		}
+		result = libsigscan_scanner_free(
+		          &scanner,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "scanner",
+		 scanner );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < SIGSCAN_TEST_SCANNER_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The scan files callback values
+ */
+typedef struct sigscan_test_scanner_scan_files_values sigscan_test_scanner_scan_files_values_t;
+
+struct sigscan_test_scanner_scan_files_values
+{
+	/* The results strings per file
+	 */
+	char (*results_strings)[ 512 ];
+
+	/* The number of times the callback function was called
+	 */
+	int number_of_calls;
+
+	/* The index of the file after which the scan is stopped
+	 * Contains -1 if the scan is not stopped
+	 */
+	int stop_file_index;
+
+	/* The scanner that is signalled to abort
+	 */
+	libsigscan_scanner_t *scanner;
+
+	/* The index of the file after which abort is signalled
+	 * Contains -1 if abort is not signalled
+	 */
+	int abort_file_index;
+};
+
+/* Stores the scan results of a file
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int sigscan_test_scanner_scan_files_callback(
+     int file_index,
+     libsigscan_scan_state_t *scan_state,
+     sigscan_test_scanner_scan_files_values_t *scan_files_values )
+{
+	if( scan_files_values == NULL )
+	{
+		return( -1 );
+	}
+	/* The callback function is called for the files in order
+	 */
+	if( file_index != scan_files_values->number_of_calls )
+	{
+		return( -1 );
+	}
+	scan_files_values->number_of_calls += 1;
+
+	if( scan_state == NULL )
+	{
+		scan_files_values->results_strings[ file_index ][ 0 ] = '!';
+		scan_files_values->results_strings[ file_index ][ 1 ] = 0;
+	}
+	else if( sigscan_test_scanner_get_results_string(
+	          scan_state,
+	          scan_files_values->results_strings[ file_index ],
+	          512,
+	          NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( file_index == scan_files_values->abort_file_index )
+	{
+		if( libsigscan_scanner_signal_abort(
+		     scan_files_values->scanner,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	if( file_index == scan_files_values->stop_file_index )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libsigscan_scanner_scan_file_io_handles function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_file_io_handles(
+     void )
+{
+	char results_strings[ 40 ][ 512 ];
+	char expected_results_strings[ 40 ][ 512 ];
+	uint8_t data[ 40 ][ 1024 ];
+
+	libbfio_handle_t *file_io_handles[ 40 ];
+
+	sigscan_test_scanner_scan_files_values_t scan_files_values;
+
+	libcerror_error_t *error      = NULL;
+	libsigscan_scanner_t *scanner = NULL;
+	size_t data_offset            = 0;
+	int file_index                = 0;
+	int result                    = 0;
+
+	for( file_index = 0;
+	     file_index < 40;
+	     file_index++ )
+	{
+		file_io_handles[ file_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	for( file_index = 0;
+	     file_index < 40;
+	     file_index++ )
+	{
+		for( data_offset = 0;
+		     data_offset < 1024;
+		     data_offset++ )
+		{
+			data[ file_index ][ data_offset ] = (uint8_t) ( 'a' + ( ( file_index + data_offset ) % 13 ) );
+		}
+		if( ( file_index % 2 ) == 0 )
+		{
+			result = memory_copy(
+			          data[ file_index ],
+			          "HEADER01",
+			          8 ) == NULL;
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		if( ( file_index % 3 ) == 0 )
+		{
+			result = memory_copy(
+			          &( data[ file_index ][ 16 + ( file_index * 17 ) ] ),
+			          "UNBOUND1",
+			          8 ) == NULL;
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		result = sigscan_test_open_file_io_handle(
+		          &( file_io_handles[ file_index ] ),
+		          data[ file_index ],
+		          1024,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_set_number_of_threads(
+	          scanner,
+	          4,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "header",
+	          6,
+	          0,
+	          (uint8_t *) "HEADER01",
+	          8,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "unbounded",
+	          9,
+	          0,
+	          (uint8_t *) "UNBOUND1",
+	          8,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Determine the expected scan results by scanning the files one by one
+	 */
+	for( file_index = 0;
+	     file_index < 40;
+	     file_index++ )
+	{
+		result = sigscan_test_scanner_get_scan_results(
+		          scanner,
+		          SIGSCAN_TEST_SCANNER_SCAN_MODE_FILE_IO_HANDLE,
+		          data[ file_index ],
+		          1024,
+		          NULL,
+		          expected_results_strings[ file_index ],
+		          512,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error case where the scanner is not compiled
+	 */
+	scan_files_values.results_strings  = results_strings;
+	scan_files_values.number_of_calls  = 0;
+	scan_files_values.stop_file_index  = -1;
+	scan_files_values.scanner          = NULL;
+	scan_files_values.abort_file_index = -1;
+
+	result = libsigscan_scanner_scan_file_io_handles(
+	          scanner,
+	          NULL,
+	          file_io_handles,
+	          40,
+	          (int (*)(int, libsigscan_scan_state_t *, void *)) &sigscan_test_scanner_scan_files_callback,
+	          (void *) &scan_files_values,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "scan_files_values.number_of_calls",
+	 scan_files_values.number_of_calls,
+	 0 );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_compile(
+	          scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+
+	result = libsigscan_scanner_scan_file_io_handles(
+	          scanner,
+	          NULL,
+	          file_io_handles,
+	          40,
+	          (int (*)(int, libsigscan_scan_state_t *, void *)) &sigscan_test_scanner_scan_files_callback,
+	          (void *) &scan_files_values,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "scan_files_values.number_of_calls",
+	 scan_files_values.number_of_calls,
+	 40 );
+
+	for( file_index = 0;
+	     file_index < 40;
+	     file_index++ )
+	{
+		/* The comparison includes the end of string character
+		 */
+		result = narrow_string_compare(
+		          results_strings[ file_index ],
+		          expected_results_strings[ file_index ],
+		          narrow_string_length( expected_results_strings[ file_index ] ) + 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test stopping the scan from the callback function
+	 */
+	scan_files_values.number_of_calls = 0;
+	scan_files_values.stop_file_index = 5;
+
+	result = libsigscan_scanner_scan_file_io_handles(
+	          scanner,
+	          NULL,
+	          file_io_handles,
+	          40,
+	          (int (*)(int, libsigscan_scan_state_t *, void *)) &sigscan_test_scanner_scan_files_callback,
+	          (void *) &scan_files_values,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "scan_files_values.number_of_calls",
+	 scan_files_values.number_of_calls,
+	 6 );
+
+	/* Test signalling abort from the callback function, the files that
+	 * were not scanned are passed to the callback function without scan state
+	 */
+	scan_files_values.number_of_calls  = 0;
+	scan_files_values.stop_file_index  = -1;
+	scan_files_values.scanner          = scanner;
+	scan_files_values.abort_file_index = 0;
+
+	result = libsigscan_scanner_scan_file_io_handles(
+	          scanner,
+	          NULL,
+	          file_io_handles,
+	          40,
+	          (int (*)(int, libsigscan_scan_state_t *, void *)) &sigscan_test_scanner_scan_files_callback,
+	          (void *) &scan_files_values,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	          LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "scan_files_values.number_of_calls",
+	 scan_files_values.number_of_calls,
+	 40 );
+
+	/* Test that abort does not affect the next scan
+	 */
+	scan_files_values.number_of_calls  = 0;
+	scan_files_values.abort_file_index = -1;
+
+	result = libsigscan_scanner_scan_file_io_handles(
+	          scanner,
+	          NULL,
+	          file_io_handles,
+	          40,
+	          (int (*)(int, libsigscan_scan_state_t *, void *)) &sigscan_test_scanner_scan_files_callback,
+	          (void *) &scan_files_values,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "scan_files_values.number_of_calls",
+	 scan_files_values.number_of_calls,
+	 40 );
+
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_scan_file_io_handles(
+	          NULL,
+	          NULL,
+	          file_io_handles,
+	          40,
+	          (int (*)(int, libsigscan_scan_state_t *, void *)) &sigscan_test_scanner_scan_files_callback,
+	          (void *) &scan_files_values,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_file_io_handles(
+	          scanner,
+	          NULL,
+	          NULL,
+	          40,
+	          (int (*)(int, libsigscan_scan_state_t *, void *)) &sigscan_test_scanner_scan_files_callback,
+	          (void *) &scan_files_values,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_file_io_handles(
+	          scanner,
+	          NULL,
+	          file_io_handles,
+	          -1,
+	          (int (*)(int, libsigscan_scan_state_t *, void *)) &sigscan_test_scanner_scan_files_callback,
+	          (void *) &scan_files_values,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_file_io_handles(
+	          scanner,
+	          NULL,
+	          file_io_handles,
+	          40,
+	          NULL,
+	          (void *) &scan_files_values,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a callback function that fails
+	 */
+	scan_files_values.number_of_calls = 1;
+	scan_files_values.stop_file_index = -1;
+
+	result = libsigscan_scanner_scan_file_io_handles(
+	          scanner,
+	          NULL,
+	          file_io_handles,
+	          40,
+	          (int (*)(int, libsigscan_scan_state_t *, void *)) &sigscan_test_scanner_scan_files_callback,
+	          (void *) &scan_files_values,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( file_index = 0;
+	     file_index < 40;
+	     file_index++ )
+	{
+		result = sigscan_test_close_file_io_handle(
+		          &( file_io_handles[ file_index ] ),
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	for( file_index = 0;
+	     file_index < 40;
+	     file_index++ )
+	{
+		if( file_io_handles[ file_index ] != NULL )
+		{
+			libbfio_handle_free(
+			 &( file_io_handles[ file_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_scan_files function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_files(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+	char results_strings[ 3 ][ 512 ];
+
+	const char *filenames[ 3 ];
+
+	sigscan_test_scanner_scan_files_values_t scan_files_values;
+
+	libcerror_error_t *error      = NULL;
+	libsigscan_scanner_t *scanner = NULL;
+	int number_of_files           = 1;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	filenames[ 0 ] = "sigscan_test_scanner_nonexistent_file";
+
+	if( source != NULL )
+	{
+		result = sigscan_test_get_narrow_source(
+		          source,
+		          narrow_source,
+		          256,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		filenames[ 1 ] = narrow_source;
+		filenames[ 2 ] = narrow_source;
+
+		number_of_files = 3;
+	}
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "test",
+	          4,
+	          0,
+	          (uint8_t *) "test",
+	          4,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_set_number_of_threads(
+	          scanner,
+	          2,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_compile(
+	          scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	scan_files_values.results_strings  = results_strings;
+	scan_files_values.number_of_calls  = 0;
+	scan_files_values.stop_file_index  = -1;
+	scan_files_values.scanner          = NULL;
+	scan_files_values.abort_file_index = -1;
+
+	result = libsigscan_scanner_scan_files(
+	          scanner,
+	          NULL,
+	          filenames,
+	          number_of_files,
+	          (int (*)(int, libsigscan_scan_state_t *, void *)) &sigscan_test_scanner_scan_files_callback,
+	          (void *) &scan_files_values,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "scan_files_values.number_of_calls",
+	 scan_files_values.number_of_calls,
+	 number_of_files );
+
+	/* A file that could not be scanned is passed to the callback function without scan state
+	 */
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "results_strings[ 0 ][ 0 ]",
+	 (int) results_strings[ 0 ][ 0 ],
+	 (int) '!' );
+
+	if( number_of_files == 3 )
+	{
+		result = narrow_string_compare(
+		          results_strings[ 1 ],
+		          results_strings[ 2 ],
+		          narrow_string_length( results_strings[ 1 ] ) + 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libsigscan_scanner_scan_files(
+	          NULL,
+	          NULL,
+	          filenames,
+	          number_of_files,
+	          (int (*)(int, libsigscan_scan_state_t *, void *)) &sigscan_test_scanner_scan_files_callback,
+	          (void *) &scan_files_values,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_scanner_scan_files(
+	          scanner,
+	          NULL,
+	          NULL,
+	          number_of_files,
+	          (int (*)(int, libsigscan_scan_state_t *, void *)) &sigscan_test_scanner_scan_files_callback,
+	          (void *) &scan_files_values,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_scan_file function scanning a file that is mapped into memory
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_file_mapped(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+	char file_io_handle_results_string[ 512 ];
+	char results_string[ 512 ];
+
+	libbfio_handle_t *file_io_handle    = NULL;
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	size_t source_length                = 0;
+	int number_of_threads               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = sigscan_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_length = narrow_string_length(
+	                 narrow_source );
+
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          narrow_source,
+	          source_length + 1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The scan results of the mapped file must match those of the file read
+	 * using a file IO handle, by a single thread and in chunks on multiple threads
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 2;
+	     number_of_threads++ )
+	{
+		result = sigscan_test_scanner_initialize_chunked_scanner(
+		          &scanner,
+		          LIBSIGSCAN_SCAN_ENGINE_SCAN_TREE,
+		          number_of_threads,
+		          16384,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_set_io_strategy(
+		          scanner,
+		          LIBSIGSCAN_IO_STRATEGY_MAPPED,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_state_initialize(
+		          &scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_scan_file_io_handle(
+		          scanner,
+		          scan_state,
+		          file_io_handle,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = sigscan_test_scanner_get_results_string(
+		          scan_state,
+		          file_io_handle_results_string,
+		          512,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_state_free(
+		          &scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_state_initialize(
+		          &scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_scan_file(
+		          scanner,
+		          scan_state,
+		          narrow_source,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = sigscan_test_scanner_get_results_string(
+		          scan_state,
+		          results_string,
+		          512,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The comparison includes the end of string character
+		 */
+		result = narrow_string_compare(
+		          results_string,
+		          file_io_handle_results_string,
+		          narrow_string_length( file_io_handle_results_string ) + 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libsigscan_scan_state_free(
+		          &scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_free(
+		          &scanner,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_scan_file and libsigscan_scanner_scan_files functions
+ * reading a file using the buffered and direct I/O strategies
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_file_with_io_strategy(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+	char file_io_handle_results_string[ 512 ];
+	char results_string[ 512 ];
+	char results_strings[ 2 ][ 512 ];
+
+	const char *filenames[ 2 ];
+
+	sigscan_test_scanner_scan_files_values_t scan_files_values;
+
+	libbfio_handle_t *file_io_handle    = NULL;
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	size_t source_length                = 0;
+	int file_index                      = 0;
+	int io_strategy                     = 0;
+	int number_of_threads               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = sigscan_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_length = narrow_string_length(
+	                 narrow_source );
+
+	filenames[ 0 ] = narrow_source;
+	filenames[ 1 ] = narrow_source;
+
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          narrow_source,
+	          source_length + 1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The scan results of the file read using an I/O strategy must match those of the file read
+	 * using a file IO handle, by a single thread and in chunks on multiple threads
+	 */
+	for( io_strategy = LIBSIGSCAN_IO_STRATEGY_BUFFERED;
+	     io_strategy <= LIBSIGSCAN_IO_STRATEGY_DIRECT;
+	     io_strategy++ )
+	{
+		for( number_of_threads = 1;
+		     number_of_threads <= 2;
+		     number_of_threads++ )
+		{
+			result = sigscan_test_scanner_initialize_chunked_scanner(
+			          &scanner,
+			          LIBSIGSCAN_SCAN_ENGINE_SCAN_TREE,
+			          number_of_threads,
+			          16384,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scanner_set_io_strategy(
+			          scanner,
+			          io_strategy,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_state_initialize(
+			          &scan_state,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scanner_scan_file_io_handle(
+			          scanner,
+			          scan_state,
+			          file_io_handle,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = sigscan_test_scanner_get_results_string(
+			          scan_state,
+			          file_io_handle_results_string,
+			          512,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_state_free(
+			          &scan_state,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_state_initialize(
+			          &scan_state,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scanner_scan_file(
+			          scanner,
+			          scan_state,
+			          narrow_source,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = sigscan_test_scanner_get_results_string(
+			          scan_state,
+			          results_string,
+			          512,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			/* The comparison includes the end of string character
+			 */
+			result = narrow_string_compare(
+			          results_string,
+			          file_io_handle_results_string,
+			          narrow_string_length( file_io_handle_results_string ) + 1 );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			result = libsigscan_scan_state_free(
+			          &scan_state,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scanner_compile(
+			          scanner,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			/* The files scanned by name reuse the file IO handle of their group
+			 */
+			scan_files_values.results_strings  = results_strings;
+			scan_files_values.number_of_calls  = 0;
+			scan_files_values.stop_file_index  = -1;
+			scan_files_values.scanner          = NULL;
+			scan_files_values.abort_file_index = -1;
+
+			result = libsigscan_scanner_scan_files(
+			          scanner,
+			          NULL,
+			          filenames,
+			          2,
+			          (int (*)(int, libsigscan_scan_state_t *, void *)) &sigscan_test_scanner_scan_files_callback,
+			          (void *) &scan_files_values,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "scan_files_values.number_of_calls",
+			 scan_files_values.number_of_calls,
+			 2 );
+
+			for( file_index = 0;
+			     file_index < 2;
+			     file_index++ )
+			{
+				result = narrow_string_compare(
+				          results_strings[ file_index ],
+				          file_io_handle_results_string,
+				          narrow_string_length( file_io_handle_results_string ) + 1 );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 0 );
+			}
+			result = libsigscan_scanner_free(
+			          &scanner,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_scanner_scan_file and libsigscan_scanner_scan_files functions
+ * scanning a sparse file of which the holes are skipped
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner_scan_sparse_file(
+     void )
+{
+	char file_io_handle_results_string[ 512 ];
+	char results_string[ 512 ];
+	char results_strings[ 1 ][ 512 ];
+
+	const char *filenames[ 1 ];
+
+	sigscan_test_scanner_scan_files_values_t scan_files_values;
+
+	libbfio_handle_t *file_io_handle    = NULL;
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	uint8_t *data                       = NULL;
+	size_t string_index                 = 0;
+	int io_strategy                     = 0;
+	int number_of_read_ahead_buffers    = 0;
+	int number_of_threads               = 0;
+	int number_of_zero_end              = 0;
+	int number_of_zero_start            = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 * The data of 3 MiB contains signatures in 4 blocks of data separated by holes,
+	 * of which the signatures with 0-byte values span the start and end of a hole
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * 0x300000 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = 0;
+
+	if( memory_set(
+	     data,
+	     0,
+	     0x300000 ) != NULL )
+	{
+		result = 1;
+	}
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_copy(
+	 data,
+	 "HEADER01",
+	 8 );
+
+	memory_copy(
+	 &( data[ 1500 ] ),
+	 "RANGEPAT",
+	 8 );
+
+	memory_copy(
+	 &( data[ 0x100800 ] ),
+	 "UNBOUND1",
+	 8 );
+
+	memory_copy(
+	 &( data[ 0x100ffc ] ),
+	 "ZERO",
+	 4 );
+
+	memory_copy(
+	 &( data[ 0x200000 ] ),
+	 "OREZ",
+	 4 );
+
+	memory_copy(
+	 &( data[ 0x200010 ] ),
+	 "UNBOUND1",
+	 8 );
+
+	memory_copy(
+	 &( data[ 0x300000 - 8 ] ),
+	 "FOOTER01",
+	 8 );
+
+	result = sigscan_test_write_sparse_file(
+	          SIGSCAN_TEST_SCANNER_SPARSE_FILE_FILENAME,
+	          data,
+	          0x300000,
+	          0x1000,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = sigscan_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          0x300000,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	filenames[ 0 ] = SIGSCAN_TEST_SCANNER_SPARSE_FILE_FILENAME;
+
+	/* Test regular cases
+	 * The scan results of the sparse file must match those of its data read in its entirety
+	 */
+	for( io_strategy = LIBSIGSCAN_IO_STRATEGY_BFIO;
+	     io_strategy <= LIBSIGSCAN_IO_STRATEGY_DIRECT;
+	     io_strategy++ )
+	{
+		for( number_of_threads = 1;
+		     number_of_threads <= 2;
+		     number_of_threads++ )
+		{
+			for( number_of_read_ahead_buffers = 0;
+			     number_of_read_ahead_buffers <= 2;
+			     number_of_read_ahead_buffers += 2 )
+			{
+				result = sigscan_test_scanner_initialize_chunked_scanner(
+				          &scanner,
+				          LIBSIGSCAN_SCAN_ENGINE_AHO_CORASICK,
+				          number_of_threads,
+				          16384,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libsigscan_scanner_add_signature(
+				          scanner,
+				          "zero_end",
+				          8,
+				          0,
+				          (uint8_t *) "ZERO\0\0\0\0",
+				          8,
+				          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libsigscan_scanner_add_signature(
+				          scanner,
+				          "zero_start",
+				          10,
+				          0,
+				          (uint8_t *) "\0\0\0\0OREZ",
+				          8,
+				          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libsigscan_scanner_set_io_strategy(
+				          scanner,
+				          io_strategy,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libsigscan_scanner_set_number_of_read_ahead_buffers(
+				          scanner,
+				          number_of_read_ahead_buffers,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libsigscan_scan_state_initialize(
+				          &scan_state,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libsigscan_scanner_scan_file_io_handle(
+				          scanner,
+				          scan_state,
+				          file_io_handle,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = sigscan_test_scanner_get_results_string(
+				          scan_state,
+				          file_io_handle_results_string,
+				          512,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libsigscan_scan_state_free(
+				          &scan_state,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				/* The signatures that span the start and end of a hole are found
+				 */
+				number_of_zero_end   = 0;
+				number_of_zero_start = 0;
+
+				for( string_index = 0;
+				     file_io_handle_results_string[ string_index ] != 0;
+				     string_index++ )
+				{
+					if( narrow_string_compare(
+					     &( file_io_handle_results_string[ string_index ] ),
+					     "zero_end;",
+					     9 ) == 0 )
+					{
+						number_of_zero_end++;
+					}
+					else if( narrow_string_compare(
+					          &( file_io_handle_results_string[ string_index ] ),
+					          "zero_start;",
+					          11 ) == 0 )
+					{
+						number_of_zero_start++;
+					}
+				}
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "number_of_zero_end",
+				 number_of_zero_end,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "number_of_zero_start",
+				 number_of_zero_start,
+				 1 );
+
+				result = libsigscan_scan_state_initialize(
+				          &scan_state,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libsigscan_scanner_scan_file(
+				          scanner,
+				          scan_state,
+				          SIGSCAN_TEST_SCANNER_SPARSE_FILE_FILENAME,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = sigscan_test_scanner_get_results_string(
+				          scan_state,
+				          results_string,
+				          512,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				/* The comparison includes the end of string character
+				 */
+				result = narrow_string_compare(
+				          results_string,
+				          file_io_handle_results_string,
+				          narrow_string_length( file_io_handle_results_string ) + 1 );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 0 );
+
+				result = libsigscan_scan_state_free(
+				          &scan_state,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libsigscan_scanner_compile(
+				          scanner,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				scan_files_values.results_strings  = results_strings;
+				scan_files_values.number_of_calls  = 0;
+				scan_files_values.stop_file_index  = -1;
+				scan_files_values.scanner          = NULL;
+				scan_files_values.abort_file_index = -1;
+
+				result = libsigscan_scanner_scan_files(
+				          scanner,
+				          NULL,
+				          filenames,
+				          1,
+				          (int (*)(int, libsigscan_scan_state_t *, void *)) &sigscan_test_scanner_scan_files_callback,
+				          (void *) &scan_files_values,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = narrow_string_compare(
+				          results_strings[ 0 ],
+				          file_io_handle_results_string,
+				          narrow_string_length( file_io_handle_results_string ) + 1 );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 0 );
+
+				result = libsigscan_scanner_free(
+				          &scanner,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+		}
+	}
+	/* Clean up
+	 */
+	result = sigscan_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	remove(
+	 SIGSCAN_TEST_SCANNER_SPARSE_FILE_FILENAME );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		sigscan_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	remove(
+	 SIGSCAN_TEST_SCANNER_SPARSE_FILE_FILENAME );
+
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Tests scanning a header signature
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner1(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	int number_of_results               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "test1",
+	          6,
+	          0,
+	          (uint8_t *) "Client UrlCache MMF Ver ",
+	          24,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_set_scan_buffer_size(
+	          scanner,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_buffer(
+	          scanner,
+	          scan_state,
+	          sigscan_test_scanner_data1,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests scanning a footer signature
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner2(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	int number_of_results               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_set_scan_buffer_size(
+	          scanner,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "test1",
+	          6,
+	          8,
+	          (uint8_t *) "conectix",
+	          8,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_buffer(
+	          scanner,
+	          scan_state,
+	          sigscan_test_scanner_data2,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests scanning an unbounded signature
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner3(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	int number_of_results               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_set_scan_buffer_size(
+	          scanner,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "test1",
+	          6,
+	          0,
+	          (uint8_t *) "example of unbounded pattern",
+	          28,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_buffer(
+	          scanner,
+	          scan_state,
+	          sigscan_test_scanner_data3,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_set_scan_buffer_size(
+	          scanner,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "test1",
+	          6,
+	          0,
+	          (uint8_t *) "example of unbounded pattern",
+	          28,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "test2",
+	          6,
+	          0,
+	          (uint8_t *) "another example",
+	          15,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_buffer(
+	          scanner,
+	          scan_state,
+	          sigscan_test_scanner_data3,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests scanning an unbounded signature
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner4(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	int number_of_results               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_set_scan_buffer_size(
+	          scanner,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "apache_access0",
+	          15,
+	          0,
+	          (uint8_t *) "\"CONNECT ",
+	          9,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "apache_access1",
+	          15,
+	          0,
+	          (uint8_t *) "\"DELETE ",
+	          8,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "apache_access2",
+	          15,
+	          0,
+	          (uint8_t *) "\"GET ",
+	          5,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "apache_access3",
+	          15,
+	          0,
+	          (uint8_t *) "\"HEAD ",
+	          6,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "apache_access4",
+	          15,
+	          0,
+	          (uint8_t *) " HTTP/",
+	          6,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "apache_access5",
+	          15,
+	          0,
+	          (uint8_t *) "\"OPTIONS ",
+	          9,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "apache_access6",
+	          15,
+	          0,
+	          (uint8_t *) "\"PATCH ",
+	          7,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "apache_access7",
+	          15,
+	          0,
+	          (uint8_t *) "\"POST ",
+	          6,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "apache_access8",
+	          15,
+	          0,
+	          (uint8_t *) "\"PUT ",
+	          5,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "apache_access9",
+	          15,
+	          0,
+	          (uint8_t *) "\"TRACE ",
+	          7,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "confluence_access0",
+	          19,
+	          0,
+	          (uint8_t *) " CONNECT ",
+	          9,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "confluence_access1",
+	          19,
+	          0,
+	          (uint8_t *) " DELETE ",
+	          8,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "confluence_access2",
+	          19,
+	          0,
+	          (uint8_t *) " GET ",
+	          5,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "confluence_access3",
+	          19,
+	          0,
+	          (uint8_t *) " HEAD ",
+	          6,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "confluence_access4",
+	          19,
+	          0,
+	          (uint8_t *) " HTTP/",
+	          6,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "confluence_access5",
+	          19,
+	          0,
+	          (uint8_t *) " OPTIONS ",
+	          9,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "confluence_access6",
+	          19,
+	          0,
+	          (uint8_t *) " PATCH ",
+	          7,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "confluence_access7",
+	          19,
+	          0,
+	          (uint8_t *) " POST ",
+	          6,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "confluence_access8",
+	          19,
+	          0,
+	          (uint8_t *) " PUT ",
+	          5,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "confluence_access9",
+	          19,
+	          0,
+	          (uint8_t *) " TRACE ",
+	          7,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+SIGSCAN_TEST_FPRINT_ERROR( error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_buffer(
+	          scanner,
+	          scan_state,
+	          sigscan_test_scanner_data3,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests scanning a signature added after the scan trees were built
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner5(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	int number_of_results               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "test1",
+	          6,
+	          0,
+	          (uint8_t *) "Client UrlCache MMF Ver ",
+	          24,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_set_scan_buffer_size(
+	          scanner,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_buffer(
+	          scanner,
+	          scan_state,
+	          sigscan_test_scanner_data1,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scanning a signature added after the scan trees were built
+	 */
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "test2",
+	          6,
+	          0,
+	          (uint8_t *) "UrlCache",
+	          8,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_set_data_size(
+	          scan_state,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_start(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_buffer(
+	          scanner,
+	          scan_state,
+	          sigscan_test_scanner_data1,
+	          128,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_scan_stop(
+	          scanner,
+	          scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 2 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests scanning signatures that are on the boundaries of the scan buffers
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner6(
+     void )
+{
+	uint8_t buffer[ 64 ];
+
+	libbfio_handle_t *file_io_handle    = NULL;
+	libcerror_error_t *error            = NULL;
+	libsigscan_scan_state_t *scan_state = NULL;
+	libsigscan_scanner_t *scanner       = NULL;
+	void *memset_result                 = NULL;
+	int number_of_results               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 buffer,
+	                 (int) '.',
+	                 sizeof( uint8_t ) * 64 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = memory_copy(
+	          buffer,
+	          "header",
+	          6 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_copy(
+	          &( buffer[ 29 ] ),
+	          "pattern",
+	          7 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_copy(
+	          &( buffer[ 58 ] ),
+	          "footer",
+	          6 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "test1",
+	          5,
+	          0,
+	          (uint8_t *) "header",
+	          6,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "test2",
+	          5,
+	          0,
+	          (uint8_t *) "pattern",
+	          7,
+	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_add_signature(
+	          scanner,
+	          "test3",
+	          5,
+	          6,
+	          (uint8_t *) "footer",
+	          6,
+	          LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_END,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A scan buffer size smaller than the signatures so that every signature
+	 * is scanned in multiple parts
+	 */
+	result = libsigscan_scanner_set_scan_buffer_size(
+	          scanner,
+	          3,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = sigscan_test_open_file_io_handle(
+	          &file_io_handle,
+	          buffer,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scan_state_initialize(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_scanner_scan_file_io_handle(
+	          scanner,
+	          scan_state,
+	          file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Every signature is expected to be found once
+	 */
+	result = libsigscan_scan_state_get_number_of_results(
+	          scan_state,
+	          &number_of_results,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 3 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libsigscan_scan_state_free(
+	          &scan_state,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scan_state",
+	 scan_state );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = sigscan_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests that scanning signatures added after the scan trees were built gives the same
+ * scan results as scanning with scan trees built from all the signatures
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner7(
+     void )
+{
+	char identifiers[ 2 ][ 16 ][ 16 ];
+	uint8_t buffer[ 64 ];
+
+	const char *signature_identifiers[ 4 ] = {
+		"header1", "unbounded1", "header2", "unbounded2" };
+
+	const char *signature_patterns[ 4 ] = {
+		"abcd", "ghijkl", "abcdef", "ijklmn" };
+
+	uint32_t signature_flags[ 4 ] = {
+		LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+		LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+		LIBSIGSCAN_SIGNATURE_FLAG_OFFSET_RELATIVE_FROM_START,
+		LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET };
+
+	int number_of_results[ 2 ] = { 0, 0 };
+
+	libcerror_error_t *error              = NULL;
+	libsigscan_scan_result_t *scan_result = NULL;
+	libsigscan_scan_state_t *scan_state   = NULL;
+	libsigscan_scanner_t *scanner         = NULL;
+	void *memset_result                   = NULL;
+	int result                            = 0;
+	int result_index                      = 0;
+	int scanner_index                     = 0;
+	int signature_index                   = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 buffer,
+	                 0,
+	                 sizeof( uint8_t ) * 64 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = memory_copy(
+	          buffer,
+	          "abcdef",
+	          6 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_copy(
+	          &( buffer[ 16 ] ),
+	          "ghijklmn",
+	          8 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The first scanner builds its scan trees before the last signatures are added
+	 * the second scanner builds its scan trees from all the signatures
+	 */
+	for( scanner_index = 0;
+	     scanner_index < 2;
+	     scanner_index++ )
+	{
+		result = libsigscan_scanner_initialize(
+		          &scanner,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "scanner",
+		 scanner );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( signature_index = 0;
+		     signature_index < 4;
+		     signature_index++ )
+		{
+			if( ( scanner_index == 0 )
+			 && ( signature_index == 2 ) )
+			{
+				result = libsigscan_scan_state_initialize(
+				          &scan_state,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libsigscan_scanner_scan_start(
+				          scanner,
+				          scan_state,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libsigscan_scanner_scan_stop(
+				          scanner,
+				          scan_state,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libsigscan_scan_state_free(
+				          &scan_state,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+			result = libsigscan_scanner_add_signature(
+			          scanner,
+			          signature_identifiers[ signature_index ],
+			          narrow_string_length( signature_identifiers[ signature_index ] ) + 1,
+			          0,
+			          (uint8_t *) signature_patterns[ signature_index ],
+			          narrow_string_length( signature_patterns[ signature_index ] ),
+			          signature_flags[ signature_index ],
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libsigscan_scan_state_initialize(
+		          &scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_state_set_data_size(
+		          scan_state,
+		          64,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_scan_start(
+		          scanner,
+		          scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_scan_buffer(
+		          scanner,
+		          scan_state,
+		          buffer,
+		          64,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_scan_stop(
+		          scanner,
+		          scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_state_get_number_of_results(
+		          scan_state,
+		          &( number_of_results[ scanner_index ] ),
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_LESS_THAN_INT(
+		 "number_of_results",
+		 number_of_results[ scanner_index ],
+		 16 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( result_index = 0;
+		     result_index < number_of_results[ scanner_index ];
+		     result_index++ )
+		{
+			result = libsigscan_scan_state_get_result(
+			          scan_state,
+			          result_index,
+			          &scan_result,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_result_get_identifier(
+			          scan_result,
+			          identifiers[ scanner_index ][ result_index ],
+			          16,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_result_free(
+			          &scan_result,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libsigscan_scan_state_free(
+		          &scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_free(
+		          &scanner,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test that the scan results are the same
+	 */
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results[ 0 ],
+	 number_of_results[ 1 ] );
+
+	for( result_index = 0;
+	     result_index < number_of_results[ 0 ];
+	     result_index++ )
+	{
+		result = narrow_string_compare(
+		          identifiers[ 0 ][ result_index ],
+		          identifiers[ 1 ][ result_index ],
+		          narrow_string_length( identifiers[ 1 ][ result_index ] ) + 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_result != NULL )
+	{
+		libsigscan_scan_result_free(
+		 &scan_result,
+		 NULL );
+	}
+	if( scan_state != NULL )
+	{
+		libsigscan_scan_state_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests that scanning with different scan buffer sizes gives the same scan results
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner8(
+     void )
+{
+	char identifier[ 16 ];
+	char reference_identifier[ 16 ];
+	uint8_t buffer[ 1024 ];
+
+	const char *signature_identifiers[ 4 ] = {
+		"unbounded1", "unbounded2", "unbounded3", "unbounded4" };
+
+	const char *signature_patterns[ 4 ] = {
+		"abaabaa", "aabaa", "baab", "abba" };
+
+	size_t scan_buffer_sizes[ 3 ] = { 1, 7, 4096 };
+
+	libsigscan_scan_state_t *scan_states[ 3 ] = { NULL, NULL, NULL };
+
+	int number_of_results[ 3 ] = { 0, 0, 0 };
+
+	libbfio_handle_t *file_io_handle                = NULL;
+	libcerror_error_t *error                        = NULL;
+	libsigscan_scan_result_t *reference_scan_result = NULL;
+	libsigscan_scan_result_t *scan_result           = NULL;
+	libsigscan_scanner_t *scanner                   = NULL;
+	size_t buffer_index                             = 0;
+	uint32_t random_value                           = 1;
+	int reference_result_index                      = 0;
+	int result                                      = 0;
+	int result_index                                = 0;
+	int scan_index                                  = 0;
+	int signature_index                             = 0;
+
+	/* Initialize test
+	 * The data consists of pseudo random 'a' and 'b' characters so that
+	 * the signatures match at many, often overlapping, offsets
+	 */
+	for( buffer_index = 0;
+	     buffer_index < 1024;
+	     buffer_index++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345;
+
+		if( ( ( random_value >> 16 ) & 0x00000001UL ) == 0 )
+		{
+			buffer[ buffer_index ] = (uint8_t) 'a';
+		}
+		else
+		{
+			buffer[ buffer_index ] = (uint8_t) 'b';
+		}
+	}
+	result = libsigscan_scanner_initialize(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( signature_index = 0;
+	     signature_index < 4;
+	     signature_index++ )
+	{
+		result = libsigscan_scanner_add_signature(
+		          scanner,
+		          signature_identifiers[ signature_index ],
+		          narrow_string_length( signature_identifiers[ signature_index ] ) + 1,
+		          0,
+		          (uint8_t *) signature_patterns[ signature_index ],
+		          narrow_string_length( signature_patterns[ signature_index ] ),
+		          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Scan the same data with a scan buffer size smaller than the signatures,
+	 * a scan buffer size that is not a multiple of the signature sizes and
+	 * a scan buffer size larger than the data
+	 */
+	for( scan_index = 0;
+	     scan_index < 3;
+	     scan_index++ )
+	{
+		result = libsigscan_scanner_set_scan_buffer_size(
+		          scanner,
+		          scan_buffer_sizes[ scan_index ],
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = sigscan_test_open_file_io_handle(
+		          &file_io_handle,
+		          buffer,
+		          1024,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_state_initialize(
+		          &( scan_states[ scan_index ] ),
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_scan_file_io_handle(
+		          scanner,
+		          scan_states[ scan_index ],
+		          file_io_handle,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = sigscan_test_close_file_io_handle(
+		          &file_io_handle,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_state_get_number_of_results(
+		          scan_states[ scan_index ],
+		          &( number_of_results[ scan_index ] ),
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	SIGSCAN_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_results",
+	 number_of_results[ 0 ],
+	 0 );
+
+	/* Test that the scan results are the same, the order in which the scan results
+	 * are stored can differ per scan buffer size
+	 */
+	for( scan_index = 1;
+	     scan_index < 3;
+	     scan_index++ )
+	{
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "number_of_results",
+		 number_of_results[ scan_index ],
+		 number_of_results[ 0 ] );
+
+		for( result_index = 0;
+		     result_index < number_of_results[ scan_index ];
+		     result_index++ )
+		{
+			result = libsigscan_scan_state_get_result(
+			          scan_states[ scan_index ],
+			          result_index,
+			          &scan_result,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libsigscan_scan_result_get_identifier(
+			          scan_result,
+			          identifier,
+			          16,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			for( reference_result_index = 0;
+			     reference_result_index < number_of_results[ 0 ];
+			     reference_result_index++ )
+			{
+				result = libsigscan_scan_state_get_result(
+				          scan_states[ 0 ],
+				          reference_result_index,
+				          &reference_scan_result,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libsigscan_scan_result_get_identifier(
+				          reference_scan_result,
+				          reference_identifier,
+				          16,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				if( ( (libsigscan_internal_scan_result_t *) reference_scan_result )->offset
+				 != ( (libsigscan_internal_scan_result_t *) scan_result )->offset )
+				{
+					result = -1;
+				}
+				else
+				{
+					result = narrow_string_compare(
+					          reference_identifier,
+					          identifier,
+					          narrow_string_length( identifier ) + 1 );
+				}
+				if( libsigscan_scan_result_free(
+				     &reference_scan_result,
+				     &error ) != 1 )
+				{
+					goto on_error;
+				}
+				if( result == 0 )
+				{
+					break;
+				}
+			}
+			/* Every scan result is expected to have a corresponding reference scan result
+			 */
+			SIGSCAN_TEST_ASSERT_LESS_THAN_INT(
+			 "reference_result_index",
+			 reference_result_index,
+			 number_of_results[ 0 ] );
+
+			result = libsigscan_scan_result_free(
+			          &scan_result,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Clean up
+	 */
+	for( scan_index = 0;
+	     scan_index < 3;
+	     scan_index++ )
+	{
+		result = libsigscan_scan_state_free(
+		          &( scan_states[ scan_index ] ),
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libsigscan_scanner_free(
+	          &scanner,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "scanner",
+	 scanner );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( reference_scan_result != NULL )
+	{
+		libsigscan_scan_result_free(
+		 &reference_scan_result,
+		 NULL );
+	}
+	if( scan_result != NULL )
+	{
+		libsigscan_scan_result_free(
+		 &scan_result,
+		 NULL );
+	}
+	for( scan_index = 0;
+	     scan_index < 3;
+	     scan_index++ )
+	{
+		if( scan_states[ scan_index ] != NULL )
+		{
+			libsigscan_scan_state_free(
+			 &( scan_states[ scan_index ] ),
+			 NULL );
+		}
+	}
+	if( scanner != NULL )
+	{
+		libsigscan_scanner_free(
+		 &scanner,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests that scanning with and without partition scan trees gives the same scan results
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_scanner9(
+     void )
+{
+	char filler_identifier[ 9 ];
+	char filler_pattern[ 19 ];
+	char identifier[ 16 ];
+	uint8_t buffer[ 256 ];
+
+	const char *expected_identifiers[ 4 ] = {
+		"long", "short", "prefix", "short" };
+
+	off64_t expected_offsets[ 4 ] = { 40, 100, 150, 158 };
+
+	libcerror_error_t *error              = NULL;
+	libsigscan_scan_result_t *scan_result = NULL;
+	libsigscan_scan_state_t *scan_state   = NULL;
+	libsigscan_scanner_t *scanner         = NULL;
+	size_t filler_pattern_size            = 0;
+	int expected_result_index             = 0;
+	int filler_index                      = 0;
+	int number_of_fillers                 = 0;
+	int number_of_partition_scan_trees    = 0;
+	int number_of_results                 = 0;
+	int result                            = 0;
+	int result_index                      = 0;
+
+	/* Initialize test
+	 * The long signature overlaps with a match of the short signature and
+	 * the prefix signature matches where the long signature does not
+	 */
+	result = memory_set(
+	          buffer,
+	          (int) '.',
+	          256 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_copy(
+	          &( buffer[ 40 ] ),
+	          "abcdefghijkl",
+	          12 ) == NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	result = libsigscan_scanner_add_signature(
-	          scanner,
-	          "confluence_access8",
-	          19,
-	          0,
-	          (uint8_t *) " PUT ",
-	          5,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
-	          &error );
+	result = memory_copy(
+	          &( buffer[ 100 ] ),
+	          "cdefghij",
+	          8 ) == NULL;
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	 0 );
 
-	result = libsigscan_scanner_add_signature(
-	          scanner,
-	          "confluence_access9",
-	          19,
-	          0,
-	          (uint8_t *) " TRACE ",
-	          7,
-	          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
-	          &error );
+	result = memory_copy(
+	          &( buffer[ 150 ] ),
+	          "abcdefgXcdef",
+	          12 ) == NULL;
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	 0 );
 
-	result = libsigscan_scan_state_initialize(
-	          &scan_state,
-	          &error );
+	result = memory_copy(
+	          filler_identifier,
+	          "filler00",
+	          9 ) == NULL;
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
-	 "scan_state",
-	 scan_state );
-
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	 0 );
 
-	/* Test regular cases
-	 */
-	result = libsigscan_scan_state_set_data_size(
-	          scan_state,
-	          64,
-	          &error );
+	result = memory_copy(
+	          filler_pattern,
+	          "Q00Zxxxxxxxxxxxxxxx",
+	          19 ) == NULL;
 
 	SIGSCAN_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	/* Scan with 64 signatures, which does not use partition scan trees,
+	 * and with 65 signatures, which does
+	 */
+	for( number_of_fillers = 61;
+	     number_of_fillers <= 62;
+	     number_of_fillers++ )
+	{
+		result = libsigscan_scanner_initialize(
+		          &scanner,
+		          &error );
 
-	result = libsigscan_scanner_scan_start(
-	          scanner,
-	          scan_state,
-	          &error );
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-SIGSCAN_TEST_FPRINT_ERROR( error );
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		/* The filler signatures have pattern sizes of different partitions
+		 */
+		for( filler_index = 0;
+		     filler_index < number_of_fillers;
+		     filler_index++ )
+		{
+			filler_identifier[ 6 ] = (char) ( '0' + ( filler_index / 10 ) );
+			filler_identifier[ 7 ] = (char) ( '0' + ( filler_index % 10 ) );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+			filler_pattern[ 1 ] = filler_identifier[ 6 ];
+			filler_pattern[ 2 ] = filler_identifier[ 7 ];
 
-	result = libsigscan_scanner_scan_buffer(
-	          scanner,
-	          scan_state,
-	          sigscan_test_scanner_data3,
-	          128,
-	          &error );
+			if( ( filler_index % 2 ) == 0 )
+			{
+				filler_pattern_size = 4;
+			}
+			else
+			{
+				filler_pattern_size = 19;
+			}
+			result = libsigscan_scanner_add_signature(
+			          scanner,
+			          filler_identifier,
+			          9,
+			          0,
+			          (uint8_t *) filler_pattern,
+			          filler_pattern_size,
+			          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+			          &error );
 
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libsigscan_scanner_add_signature(
+		          scanner,
+		          "short",
+		          6,
+		          0,
+		          (uint8_t *) "cdef",
+		          4,
+		          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+		          &error );
 
-	result = libsigscan_scanner_scan_stop(
-	          scanner,
-	          scan_state,
-	          &error );
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_add_signature(
+		          scanner,
+		          "prefix",
+		          7,
+		          0,
+		          (uint8_t *) "abcd",
+		          4,
+		          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+		          &error );
 
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_add_signature(
+		          scanner,
+		          "long",
+		          5,
+		          0,
+		          (uint8_t *) "abcdefghijkl",
+		          12,
+		          LIBSIGSCAN_SIGNATURE_FLAG_NO_OFFSET,
+		          &error );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	result = libsigscan_scan_state_get_number_of_results(
-	          scan_state,
-	          &number_of_results,
-	          &error );
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		result = libsigscan_scan_state_initialize(
+		          &scan_state,
+		          &error );
 
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "number_of_results",
-	 number_of_results,
-	 0 );
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	/* Clean up
-	 */
-	result = libsigscan_scan_state_free(
-	          &scan_state,
-	          &error );
+		result = libsigscan_scan_state_set_data_size(
+		          scan_state,
+		          256,
+		          &error );
 
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "scan_state",
-	 scan_state );
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		result = libsigscan_scanner_scan_start(
+		          scanner,
+		          scan_state,
+		          &error );
 
-	result = libsigscan_scanner_free(
-	          &scanner,
-	          &error );
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	SIGSCAN_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "scanner",
-	 scanner );
+		SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+		 "scanner->scan_tree",
+		 ( (libsigscan_internal_scanner_t *) scanner )->scan_tree );
 
-	SIGSCAN_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		number_of_partition_scan_trees = ( (libsigscan_internal_scanner_t *) scanner )->scan_tree->number_of_partition_scan_trees;
+
+		if( number_of_fillers == 61 )
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "number_of_partition_scan_trees",
+			 number_of_partition_scan_trees,
+			 0 );
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_GREATER_THAN_INT(
+			 "number_of_partition_scan_trees",
+			 number_of_partition_scan_trees,
+			 1 );
+		}
+		result = libsigscan_scanner_scan_buffer(
+		          scanner,
+		          scan_state,
+		          buffer,
+		          256,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_scan_stop(
+		          scanner,
+		          scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scan_state_get_number_of_results(
+		          scan_state,
+		          &number_of_results,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "number_of_results",
+		 number_of_results,
+		 4 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test that every expected scan result is found, the order in which the scan results
+		 * are stored can differ
+		 */
+		for( expected_result_index = 0;
+		     expected_result_index < 4;
+		     expected_result_index++ )
+		{
+			for( result_index = 0;
+			     result_index < number_of_results;
+			     result_index++ )
+			{
+				result = libsigscan_scan_state_get_result(
+				          scan_state,
+				          result_index,
+				          &scan_result,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				result = libsigscan_scan_result_get_identifier(
+				          scan_result,
+				          identifier,
+				          16,
+				          &error );
+
+				SIGSCAN_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SIGSCAN_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				if( ( (libsigscan_internal_scan_result_t *) scan_result )->offset != expected_offsets[ expected_result_index ] )
+				{
+					result = -1;
+				}
+				else
+				{
+					result = narrow_string_compare(
+					          expected_identifiers[ expected_result_index ],
+					          identifier,
+					          narrow_string_length( identifier ) + 1 );
+				}
+				if( libsigscan_scan_result_free(
+				     &scan_result,
+				     &error ) != 1 )
+				{
+					goto on_error;
+				}
+				if( result == 0 )
+				{
+					break;
+				}
+			}
+			SIGSCAN_TEST_ASSERT_LESS_THAN_INT(
+			 "result_index",
+			 result_index,
+			 number_of_results );
+		}
+		/* Clean up
+		 */
+		result = libsigscan_scan_state_free(
+		          &scan_state,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsigscan_scanner_free(
+		          &scanner,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
 	return( 1 );
 
 on_error:
@@ -3088,6 +9928,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( scan_result != NULL )
+	{
+		libsigscan_scan_result_free(
+		 &scan_result,
+		 NULL );
+	}
 	if( scan_state != NULL )
 	{
 		libsigscan_scan_state_free(
@@ -3192,11 +10038,50 @@ int main(
 	 sigscan_test_scanner_set_scan_buffer_size,
 	 scanner );
 
+	SIGSCAN_TEST_RUN_WITH_ARGS(
+	 "libsigscan_scanner_set_number_of_threads",
+	 sigscan_test_scanner_set_number_of_threads,
+	 scanner );
+
+	SIGSCAN_TEST_RUN_WITH_ARGS(
+	 "libsigscan_scanner_set_scan_chunk_size",
+	 sigscan_test_scanner_set_scan_chunk_size,
+	 scanner );
+
+	SIGSCAN_TEST_RUN_WITH_ARGS(
+	 "libsigscan_scanner_set_number_of_read_ahead_buffers",
+	 sigscan_test_scanner_set_number_of_read_ahead_buffers,
+	 scanner );
+
+	SIGSCAN_TEST_RUN_WITH_ARGS(
+	 "libsigscan_scanner_set_io_strategy",
+	 sigscan_test_scanner_set_io_strategy,
+	 scanner );
+
 	SIGSCAN_TEST_RUN_WITH_ARGS(
 	 "libsigscan_scanner_add_signature",
 	 sigscan_test_scanner_add_signature,
 	 scanner );
 
+	SIGSCAN_TEST_RUN_WITH_ARGS(
+	 "libsigscan_scanner_add_range_signature",
+	 sigscan_test_scanner_add_range_signature,
+	 scanner );
+
+	SIGSCAN_TEST_RUN_WITH_ARGS(
+	 "libsigscan_scanner_read_compiled_file",
+	 sigscan_test_scanner_read_compiled_file,
+	 scanner );
+
+	SIGSCAN_TEST_RUN_WITH_ARGS(
+	 "libsigscan_scanner_write_compiled_file",
+	 sigscan_test_scanner_write_compiled_file,
+	 scanner );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_compile",
+	 sigscan_test_scanner_compile );
+
 	/* Make sure to run the start test before libsigscan_scanner_scan_buffer
 	 */
 	SIGSCAN_TEST_RUN_WITH_ARGS(
@@ -3256,6 +10141,51 @@ int main(
 		 sigscan_test_scanner_scan_file_io_handle,
 		 source );
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	SIGSCAN_TEST_RUN_WITH_ARGS(
+	 "sigscan_test_scanner_scan_compiled_concurrently",
+	 sigscan_test_scanner_scan_compiled_concurrently,
+	 source );
+
+	SIGSCAN_TEST_RUN(
+	 "sigscan_test_scanner_scan_file_io_handle_in_chunks",
+	 sigscan_test_scanner_scan_file_io_handle_in_chunks );
+
+	SIGSCAN_TEST_RUN(
+	 "sigscan_test_scanner_scan_file_io_handle_with_read_ahead",
+	 sigscan_test_scanner_scan_file_io_handle_with_read_ahead );
+
+	SIGSCAN_TEST_RUN(
+	 "sigscan_test_scanner_scan_stress",
+	 sigscan_test_scanner_scan_stress );
+
+	SIGSCAN_TEST_RUN_WITH_ARGS(
+	 "libsigscan_scanner_scan_files",
+	 sigscan_test_scanner_scan_files,
+	 source );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_scanner_scan_file_io_handles",
+	 sigscan_test_scanner_scan_file_io_handles );
+
+	SIGSCAN_TEST_RUN(
+	 "sigscan_test_scanner_scan_sparse_file",
+	 sigscan_test_scanner_scan_sparse_file );
+
+	if( source != NULL )
+	{
+		SIGSCAN_TEST_RUN_WITH_ARGS(
+		 "sigscan_test_scanner_scan_file_mapped",
+		 sigscan_test_scanner_scan_file_mapped,
+		 source );
+
+		SIGSCAN_TEST_RUN_WITH_ARGS(
+		 "sigscan_test_scanner_scan_file_with_io_strategy",
+		 sigscan_test_scanner_scan_file_with_io_strategy,
+		 source );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
 #endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
 
 	SIGSCAN_TEST_RUN(
@@ -3274,7 +10204,25 @@ int main(
 	 "sigscan_test_scanner4",
 	 sigscan_test_scanner4 );
 
-	/* TODO add test to scan for unbounded signature on buffer boundary */
+	SIGSCAN_TEST_RUN(
+	 "sigscan_test_scanner5",
+	 sigscan_test_scanner5 );
+
+	SIGSCAN_TEST_RUN(
+	 "sigscan_test_scanner6",
+	 sigscan_test_scanner6 );
+
+	SIGSCAN_TEST_RUN(
+	 "sigscan_test_scanner7",
+	 sigscan_test_scanner7 );
+
+	SIGSCAN_TEST_RUN(
+	 "sigscan_test_scanner8",
+	 sigscan_test_scanner8 );
+
+	SIGSCAN_TEST_RUN(
+	 "sigscan_test_scanner9",
+	 sigscan_test_scanner9 );
 
 	return( EXIT_SUCCESS );
 
@@ -445,6 +445,127 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libsigscan_signature_table_get_byte_value_group_index function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_signature_table_get_byte_value_group_index(
+     libsigscan_signature_table_t *signature_table )
+{
+	libcerror_error_t *error   = NULL;
+	int byte_value_group_index = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libsigscan_signature_table_get_byte_value_group_index(
+	          signature_table,
+	          3,
+	          &byte_value_group_index,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "byte_value_group_index",
+	 byte_value_group_index,
+	 3 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_table_get_byte_value_group_index(
+	          signature_table,
+	          7,
+	          &byte_value_group_index,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "byte_value_group_index",
+	 byte_value_group_index,
+	 7 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signature_table_get_byte_value_group_index(
+	          signature_table,
+	          -1,
+	          &byte_value_group_index,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "byte_value_group_index",
+	 byte_value_group_index,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_signature_table_get_byte_value_group_index(
+	          NULL,
+	          0,
+	          &byte_value_group_index,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_signature_table_get_byte_value_group_index(
+	          signature_table,
+	          0,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libsigscan_signature_table_get_byte_value_group_by_offset function
  * Returns 1 if successful or 0 if not
  */
@@ -1150,6 +1271,11 @@ int main(
 	 sigscan_test_signature_table_get_byte_value_group_by_index,
 	 signature_table );
 
+	SIGSCAN_TEST_RUN_WITH_ARGS(
+	 "libsigscan_signature_table_get_byte_value_group_index",
+	 sigscan_test_signature_table_get_byte_value_group_index,
+	 signature_table );
+
 	SIGSCAN_TEST_RUN_WITH_ARGS(
 	 "libsigscan_signature_table_get_byte_value_group_by_offset",
 	 sigscan_test_signature_table_get_byte_value_group_by_offset,
@@ -231,6 +231,280 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libsigscan_signatures_list_remove_signatures function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_signatures_list_remove_signatures(
+     void )
+{
+	libsigscan_signature_t *signatures_array[ 2 ];
+
+	libcdata_list_t *signatures_list = NULL;
+	libcerror_error_t *error         = NULL;
+	int number_of_elements           = 0;
+	int result                       = 0;
+	int signature_index              = 0;
+
+	signatures_array[ 0 ] = NULL;
+	signatures_array[ 1 ] = NULL;
+
+	/* Initialize test
+	 */
+	result = libcdata_list_initialize(
+	          &signatures_list,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( signature_index = 0;
+	     signature_index < 2;
+	     signature_index++ )
+	{
+		result = libsigscan_signature_initialize(
+		          &( signatures_array[ signature_index ] ),
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdata_list_append_value(
+		          signatures_list,
+		          (intptr_t *) signatures_array[ signature_index ],
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libsigscan_signatures_list_remove_signatures(
+	          signatures_list,
+	          signatures_array,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signatures_list_remove_signatures(
+	          signatures_list,
+	          &( signatures_array[ 1 ] ),
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_get_number_of_elements(
+	          signatures_list,
+	          &number_of_elements,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_signatures_list_remove_signatures(
+	          signatures_list,
+	          signatures_array,
+	          2,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_list_get_number_of_elements(
+	          signatures_list,
+	          &number_of_elements,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_signatures_list_remove_signatures(
+	          NULL,
+	          signatures_array,
+	          2,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_signatures_list_remove_signatures(
+	          signatures_list,
+	          NULL,
+	          2,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_signatures_list_remove_signatures(
+	          signatures_list,
+	          signatures_array,
+	          -1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	for( signature_index = 0;
+	     signature_index < 2;
+	     signature_index++ )
+	{
+		result = libsigscan_signature_free(
+		          &( signatures_array[ signature_index ] ),
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcdata_list_free(
+	          &signatures_list,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "signatures_list",
+	 signatures_list );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( signature_index = 0;
+	     signature_index < 2;
+	     signature_index++ )
+	{
+		if( signatures_array[ signature_index ] != NULL )
+		{
+			libsigscan_signature_free(
+			 &( signatures_array[ signature_index ] ),
+			 NULL );
+		}
+	}
+	if( signatures_list != NULL )
+	{
+		libcdata_list_free(
+		 &signatures_list,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
 
 /* The main program
@@ -254,6 +528,10 @@ int main(
 	 "libsigscan_signatures_list_remove_signature",
 	 sigscan_test_signatures_list_remove_signature );
 
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_signatures_list_remove_signatures",
+	 sigscan_test_signatures_list_remove_signatures );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -34,6 +35,7 @@
 #include "sigscan_test_memory.h"
 #include "sigscan_test_unused.h"
 
+#include "../libsigscan/libsigscan_definitions.h"
 #include "../libsigscan/libsigscan_signature.h"
 #include "../libsigscan/libsigscan_skip_table.h"
 
@@ -640,6 +642,171 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libsigscan_skip_table_get_block_skip_value function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_skip_table_get_block_skip_value(
+     libsigscan_skip_table_t *skip_table )
+{
+	libcerror_error_t *error = NULL;
+	size_t skip_value        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	/* The block "er" ends 1 byte before the end of "pattern"
+	 */
+	result = libsigscan_skip_table_get_block_skip_value(
+	          skip_table,
+	          (uint8_t *) "xpatter",
+	          7,
+	          &skip_value,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "skip_value",
+	 skip_value,
+	 (size_t) 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The block "rn" at the end of "pattern" is not used
+	 */
+	result = libsigscan_skip_table_get_block_skip_value(
+	          skip_table,
+	          (uint8_t *) "pattern",
+	          7,
+	          &skip_value,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "skip_value",
+	 skip_value,
+	 (size_t) 6 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The buffer is smaller than the smallest pattern
+	 */
+	result = libsigscan_skip_table_get_block_skip_value(
+	          skip_table,
+	          (uint8_t *) "patt",
+	          4,
+	          &skip_value,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_skip_table_get_block_skip_value(
+	          NULL,
+	          (uint8_t *) "pattern",
+	          7,
+	          &skip_value,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_skip_table_get_block_skip_value(
+	          skip_table,
+	          NULL,
+	          7,
+	          &skip_value,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_skip_table_get_block_skip_value(
+	          skip_table,
+	          (uint8_t *) "pattern",
+	          (size_t) SSIZE_MAX + 1,
+	          &skip_value,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_skip_table_get_block_skip_value(
+	          skip_table,
+	          (uint8_t *) "pattern",
+	          7,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libsigscan_skip_table_get_smallest_skip_value function
  * Returns 1 if successful or 0 if not
  */
@@ -713,6 +880,206 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libsigscan_skip_table_get_uniform_block_skip_value function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_skip_table_get_uniform_block_skip_value(
+     libsigscan_skip_table_t *skip_table )
+{
+	uint8_t buffer[ 128 ];
+
+	libcerror_error_t *error = NULL;
+	size_t skip_value        = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = 0;
+
+	if( memory_set(
+	     buffer,
+	     0,
+	     128 ) != NULL )
+	{
+		result = 1;
+	}
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	buffer[ 100 ] = (uint8_t) 'p';
+
+	/* Test regular cases
+	 */
+	/* A match of "pattern" can start in the last 6 bytes of the uniform block of 100 bytes
+	 */
+	result = libsigscan_skip_table_get_uniform_block_skip_value(
+	          skip_table,
+	          buffer,
+	          128,
+	          &skip_value,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "skip_value",
+	 skip_value,
+	 (size_t) 94 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The uniform block is smaller than LIBSIGSCAN_SKIP_TABLE_UNIFORM_BLOCK_SIZE
+	 */
+	result = libsigscan_skip_table_get_uniform_block_skip_value(
+	          skip_table,
+	          &( buffer[ 40 ] ),
+	          88,
+	          &skip_value,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_skip_table_get_uniform_block_skip_value(
+	          skip_table,
+	          buffer,
+	          LIBSIGSCAN_SKIP_TABLE_UNIFORM_BLOCK_SIZE - 1,
+	          &skip_value,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A pattern that consists of the byte value can match within the uniform block
+	 */
+	skip_table->uniform_block_values[ 0 ] = 1;
+
+	result = libsigscan_skip_table_get_uniform_block_skip_value(
+	          skip_table,
+	          buffer,
+	          128,
+	          &skip_value,
+	          &error );
+
+	skip_table->uniform_block_values[ 0 ] = 0;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_skip_table_get_uniform_block_skip_value(
+	          NULL,
+	          buffer,
+	          128,
+	          &skip_value,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_skip_table_get_uniform_block_skip_value(
+	          skip_table,
+	          NULL,
+	          128,
+	          &skip_value,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_skip_table_get_uniform_block_skip_value(
+	          skip_table,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          &skip_value,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_skip_table_get_uniform_block_skip_value(
+	          skip_table,
+	          buffer,
+	          128,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #if defined( HAVE_DEBUG_OUTPUT )
 
 /* Tests the libsigscan_skip_table_printf function
@@ -927,11 +1294,21 @@ int main(
 	 sigscan_test_skip_table_get_skip_value,
 	 skip_table );
 
+	SIGSCAN_TEST_RUN_WITH_ARGS(
+	 "libsigscan_skip_table_get_block_skip_value",
+	 sigscan_test_skip_table_get_block_skip_value,
+	 skip_table );
+
 	SIGSCAN_TEST_RUN_WITH_ARGS(
 	 "libsigscan_skip_table_get_smallest_skip_value",
 	 sigscan_test_skip_table_get_smallest_skip_value,
 	 skip_table );
 
+	SIGSCAN_TEST_RUN_WITH_ARGS(
+	 "libsigscan_skip_table_get_uniform_block_skip_value",
+	 sigscan_test_skip_table_get_uniform_block_skip_value,
+	 skip_table );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 
 	SIGSCAN_TEST_RUN_WITH_ARGS(
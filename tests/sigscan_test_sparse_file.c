@@ -0,0 +1,1079 @@
+/*
+ * Library sparse_file type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "sigscan_test_functions.h"
+#include "sigscan_test_libcerror.h"
+#include "sigscan_test_libsigscan.h"
+#include "sigscan_test_macros.h"
+#include "sigscan_test_memory.h"
+#include "sigscan_test_unused.h"
+
+#include "../libsigscan/libsigscan_sparse_file.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+
+#define SIGSCAN_TEST_SPARSE_FILE_FILENAME	"sigscan_test_sparse_file.tmp"
+
+/* Tests the libsigscan_sparse_file_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_sparse_file_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libsigscan_sparse_file_t *sparse_file = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsigscan_sparse_file_initialize(
+	          &sparse_file,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "sparse_file",
+	 sparse_file );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_sparse_file_free(
+	          &sparse_file,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "sparse_file",
+	 sparse_file );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_sparse_file_initialize(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sparse_file = (libsigscan_sparse_file_t *) 0x12345678UL;
+
+	result = libsigscan_sparse_file_initialize(
+	          &sparse_file,
+	          &error );
+
+	sparse_file = NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_sparse_file_initialize with malloc failing
+		 */
+		sigscan_test_malloc_attempts_before_fail = test_number;
+
+		result = libsigscan_sparse_file_initialize(
+		          &sparse_file,
+		          &error );
+
+		if( sigscan_test_malloc_attempts_before_fail != -1 )
+		{
+			sigscan_test_malloc_attempts_before_fail = -1;
+
+			if( sparse_file != NULL )
+			{
+				libsigscan_sparse_file_free(
+				 &sparse_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "sparse_file",
+			 sparse_file );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_sparse_file_initialize with memset failing
+		 */
+		sigscan_test_memset_attempts_before_fail = test_number;
+
+		result = libsigscan_sparse_file_initialize(
+		          &sparse_file,
+		          &error );
+
+		if( sigscan_test_memset_attempts_before_fail != -1 )
+		{
+			sigscan_test_memset_attempts_before_fail = -1;
+
+			if( sparse_file != NULL )
+			{
+				libsigscan_sparse_file_free(
+				 &sparse_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "sparse_file",
+			 sparse_file );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SIGSCAN_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sparse_file != NULL )
+	{
+		libsigscan_sparse_file_free(
+		 &sparse_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_sparse_file_free function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_sparse_file_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsigscan_sparse_file_free(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_sparse_file_open function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_sparse_file_open(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libsigscan_sparse_file_t *sparse_file = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_sparse_file_initialize(
+	          &sparse_file,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "sparse_file",
+	 sparse_file );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * A file that does not exist or is not a regular file is not opened
+	 */
+	result = libsigscan_sparse_file_open(
+	          sparse_file,
+	          "sigscan_test_sparse_file_nonexistent_file",
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_sparse_file_open(
+	          sparse_file,
+	          ".",
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "sparse_file->file_descriptor",
+	 sparse_file->file_descriptor,
+	 -1 );
+
+	/* Test error cases
+	 */
+	result = libsigscan_sparse_file_open(
+	          NULL,
+	          "sigscan_test_sparse_file_nonexistent_file",
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_sparse_file_open(
+	          sparse_file,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_sparse_file_close(
+	          sparse_file,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_sparse_file_free(
+	          &sparse_file,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "sparse_file",
+	 sparse_file );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sparse_file != NULL )
+	{
+		libsigscan_sparse_file_free(
+		 &sparse_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_sparse_file_set_scan_ranges function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_sparse_file_set_scan_ranges(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libsigscan_sparse_file_t *sparse_file = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libsigscan_sparse_file_initialize(
+	          &sparse_file,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "sparse_file",
+	 sparse_file );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsigscan_sparse_file_set_scan_ranges(
+	          sparse_file,
+	          15,
+	          0,
+	          1024,
+	          4096,
+	          8192,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_SIZE(
+	 "sparse_file->margin_size",
+	 sparse_file->margin_size,
+	 (size_t) 15 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_UINT64(
+	 "sparse_file->header_range_end",
+	 sparse_file->header_range_end,
+	 (uint64_t) 1024 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_UINT64(
+	 "sparse_file->footer_range_start",
+	 sparse_file->footer_range_start,
+	 (uint64_t) 4096 );
+
+	/* Test error cases
+	 */
+	result = libsigscan_sparse_file_set_scan_ranges(
+	          NULL,
+	          15,
+	          0,
+	          1024,
+	          4096,
+	          8192,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_sparse_file_set_scan_ranges(
+	          sparse_file,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          1024,
+	          4096,
+	          8192,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_sparse_file_set_scan_ranges(
+	          sparse_file,
+	          15,
+	          1024,
+	          0,
+	          4096,
+	          8192,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_sparse_file_set_scan_ranges(
+	          sparse_file,
+	          15,
+	          0,
+	          1024,
+	          8192,
+	          4096,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_sparse_file_free(
+	          &sparse_file,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "sparse_file",
+	 sparse_file );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sparse_file != NULL )
+	{
+		libsigscan_sparse_file_free(
+		 &sparse_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_sparse_file_get_scan_range function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_sparse_file_get_scan_range(
+     void )
+{
+	/* The offset, range end offset, expected scan offset and expected scan end offset
+	 * of a file of 1 MiB with data at 0x10000, 0x80000 and in its last block
+	 */
+	off64_t expected_scan_ranges[ 5 ][ 4 ] = {
+		{ 0x00000, 0x100000, 0x0fff0, 0x11010 },
+		{ 0x11010, 0x100000, 0x7fff0, 0x81010 },
+		{ 0x81010, 0x100000, 0xfeff0, 0x100000 },
+		{ 0x11010, 0x020000, 0x20000, 0x20000 },
+		{ 0x10800, 0x100000, 0x10800, 0x11010 } };
+
+	/* The same file with a header range of [0, 0x400) and a footer range of [0xc0000, 0xc0100)
+	 */
+	off64_t expected_bounded_scan_ranges[ 4 ][ 4 ] = {
+		{ 0x00000, 0x100000, 0x00000, 0x00400 },
+		{ 0x00400, 0x100000, 0x0fff0, 0x11010 },
+		{ 0x81010, 0x100000, 0xc0000, 0xc0100 },
+		{ 0xc0100, 0x100000, 0xfeff0, 0x100000 } };
+
+	libcerror_error_t *error              = NULL;
+	libsigscan_sparse_file_t *sparse_file = NULL;
+	uint8_t *data                         = NULL;
+	off64_t scan_end_offset               = 0;
+	off64_t scan_offset                   = 0;
+	int range_index                       = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * 0x100000 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = 0;
+
+	if( memory_set(
+	     data,
+	     0,
+	     0x100000 ) != NULL )
+	{
+		result = 1;
+	}
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_set(
+	 &( data[ 0x10000 ] ),
+	 'A',
+	 0x1000 );
+
+	memory_set(
+	 &( data[ 0x80000 ] ),
+	 'B',
+	 0x1000 );
+
+	data[ 0xfffff ] = 'C';
+
+	result = sigscan_test_write_sparse_file(
+	          SIGSCAN_TEST_SPARSE_FILE_FILENAME,
+	          data,
+	          0x100000,
+	          0x1000,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	result = libsigscan_sparse_file_initialize(
+	          &sparse_file,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "sparse_file",
+	 sparse_file );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_sparse_file_set_scan_ranges(
+	          sparse_file,
+	          16,
+	          0,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The entire range is scanned if the sparse file is not open
+	 */
+	result = libsigscan_sparse_file_get_scan_range(
+	          sparse_file,
+	          0,
+	          0x100000,
+	          &scan_offset,
+	          &scan_end_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+	 "scan_offset",
+	 (int64_t) scan_offset,
+	 (int64_t) 0 );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+	 "scan_end_offset",
+	 (int64_t) scan_end_offset,
+	 (int64_t) 0x100000 );
+
+	result = libsigscan_sparse_file_open(
+	          sparse_file,
+	          SIGSCAN_TEST_SPARSE_FILE_FILENAME,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The holes can only be skipped on file systems that support sparse files
+	 */
+	if( result == 1 )
+	{
+		for( range_index = 0;
+		     range_index < 5;
+		     range_index++ )
+		{
+			result = libsigscan_sparse_file_get_scan_range(
+			          sparse_file,
+			          expected_scan_ranges[ range_index ][ 0 ],
+			          expected_scan_ranges[ range_index ][ 1 ],
+			          &scan_offset,
+			          &scan_end_offset,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+			 "scan_offset",
+			 (int64_t) scan_offset,
+			 (int64_t) expected_scan_ranges[ range_index ][ 2 ] );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+			 "scan_end_offset",
+			 (int64_t) scan_end_offset,
+			 (int64_t) expected_scan_ranges[ range_index ][ 3 ] );
+		}
+		result = libsigscan_sparse_file_set_scan_ranges(
+		          sparse_file,
+		          16,
+		          0,
+		          0x400,
+		          0xc0000,
+		          0xc0100,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( range_index = 0;
+		     range_index < 4;
+		     range_index++ )
+		{
+			result = libsigscan_sparse_file_get_scan_range(
+			          sparse_file,
+			          expected_bounded_scan_ranges[ range_index ][ 0 ],
+			          expected_bounded_scan_ranges[ range_index ][ 1 ],
+			          &scan_offset,
+			          &scan_end_offset,
+			          &error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+			 "scan_offset",
+			 (int64_t) scan_offset,
+			 (int64_t) expected_bounded_scan_ranges[ range_index ][ 2 ] );
+
+			SIGSCAN_TEST_ASSERT_EQUAL_INT64(
+			 "scan_end_offset",
+			 (int64_t) scan_end_offset,
+			 (int64_t) expected_bounded_scan_ranges[ range_index ][ 3 ] );
+		}
+		result = libsigscan_sparse_file_close(
+		          sparse_file,
+		          &error );
+
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		SIGSCAN_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libsigscan_sparse_file_get_scan_range(
+	          NULL,
+	          0,
+	          0x100000,
+	          &scan_offset,
+	          &scan_end_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_sparse_file_get_scan_range(
+	          sparse_file,
+	          -1,
+	          0x100000,
+	          &scan_offset,
+	          &scan_end_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_sparse_file_get_scan_range(
+	          sparse_file,
+	          0x100001,
+	          0x100000,
+	          &scan_offset,
+	          &scan_end_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_sparse_file_get_scan_range(
+	          sparse_file,
+	          0,
+	          0x100000,
+	          NULL,
+	          &scan_end_offset,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_sparse_file_get_scan_range(
+	          sparse_file,
+	          0,
+	          0x100000,
+	          &scan_offset,
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsigscan_sparse_file_free(
+	          &sparse_file,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "sparse_file",
+	 sparse_file );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 SIGSCAN_TEST_SPARSE_FILE_FILENAME );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sparse_file != NULL )
+	{
+		libsigscan_sparse_file_free(
+		 &sparse_file,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	remove(
+	 SIGSCAN_TEST_SPARSE_FILE_FILENAME );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argc )
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_sparse_file_initialize",
+	 sigscan_test_sparse_file_initialize );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_sparse_file_free",
+	 sigscan_test_sparse_file_free );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_sparse_file_open",
+	 sigscan_test_sparse_file_open );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_sparse_file_set_scan_ranges",
+	 sigscan_test_sparse_file_set_scan_ranges );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_sparse_file_get_scan_range",
+	 sigscan_test_sparse_file_get_scan_range );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,829 @@
+/*
+ * Library thread_pool type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "sigscan_test_libcerror.h"
+#include "sigscan_test_libsigscan.h"
+#include "sigscan_test_macros.h"
+#include "sigscan_test_memory.h"
+#include "sigscan_test_unused.h"
+
+#include "../libsigscan/libsigscan_definitions.h"
+#include "../libsigscan/libsigscan_thread_pool.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+
+typedef struct sigscan_test_thread_pool_nested_value sigscan_test_thread_pool_nested_value_t;
+
+struct sigscan_test_thread_pool_nested_value
+{
+	/* The thread pool
+	 */
+	libsigscan_thread_pool_t *thread_pool;
+
+	/* The values
+	 */
+	int values[ 8 ];
+};
+
+/* Increments a value
+ * Returns 1 if successful or -1 on error
+ */
+int sigscan_test_thread_pool_increment_value(
+     int *value,
+     libcerror_error_t **error )
+{
+	static char *function = "sigscan_test_thread_pool_increment_value";
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*value += 1;
+
+	return( 1 );
+}
+
+/* Increments the values of a nested value using the thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int sigscan_test_thread_pool_increment_nested_value(
+     sigscan_test_thread_pool_nested_value_t *nested_value,
+     libcerror_error_t **error )
+{
+	intptr_t *values[ 8 ];
+
+	static char *function = "sigscan_test_thread_pool_increment_nested_value";
+	int value_index       = 0;
+
+	if( nested_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid nested value.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		values[ value_index ] = (intptr_t *) &( nested_value->values[ value_index ] );
+	}
+	if( libsigscan_thread_pool_run_values(
+	     nested_value->thread_pool,
+	     (int (*)(intptr_t *, libcerror_error_t **)) &sigscan_test_thread_pool_increment_value,
+	     values,
+	     8,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libsigscan_thread_pool_get_default_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_thread_pool_get_default_number_of_threads(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libsigscan_thread_pool_get_default_number_of_threads(
+	          &number_of_threads,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 0 );
+
+	SIGSCAN_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 LIBSIGSCAN_THREAD_POOL_MAXIMUM_NUMBER_OF_THREADS + 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_thread_pool_get_default_number_of_threads(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_thread_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_thread_pool_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libsigscan_thread_pool_t *thread_pool = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsigscan_thread_pool_initialize(
+	          &thread_pool,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_thread_pool_free(
+	          &thread_pool,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_thread_pool_initialize(
+	          &thread_pool,
+	          4,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsigscan_thread_pool_free(
+	          &thread_pool,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsigscan_thread_pool_initialize(
+	          NULL,
+	          1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	thread_pool = (libsigscan_thread_pool_t *) 0x12345678UL;
+
+	result = libsigscan_thread_pool_initialize(
+	          &thread_pool,
+	          1,
+	          &error );
+
+	thread_pool = NULL;
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_thread_pool_initialize(
+	          &thread_pool,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_thread_pool_initialize(
+	          &thread_pool,
+	          LIBSIGSCAN_THREAD_POOL_MAXIMUM_NUMBER_OF_THREADS + 1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SIGSCAN_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_thread_pool_initialize with malloc failing
+		 */
+		sigscan_test_malloc_attempts_before_fail = test_number;
+
+		result = libsigscan_thread_pool_initialize(
+		          &thread_pool,
+		          1,
+		          &error );
+
+		if( sigscan_test_malloc_attempts_before_fail != -1 )
+		{
+			sigscan_test_malloc_attempts_before_fail = -1;
+
+			if( thread_pool != NULL )
+			{
+				libsigscan_thread_pool_free(
+				 &thread_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "thread_pool",
+			 thread_pool );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsigscan_thread_pool_initialize with memset failing
+		 */
+		sigscan_test_memset_attempts_before_fail = test_number;
+
+		result = libsigscan_thread_pool_initialize(
+		          &thread_pool,
+		          1,
+		          &error );
+
+		if( sigscan_test_memset_attempts_before_fail != -1 )
+		{
+			sigscan_test_memset_attempts_before_fail = -1;
+
+			if( thread_pool != NULL )
+			{
+				libsigscan_thread_pool_free(
+				 &thread_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SIGSCAN_TEST_ASSERT_IS_NULL(
+			 "thread_pool",
+			 thread_pool );
+
+			SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SIGSCAN_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		libsigscan_thread_pool_free(
+		 &thread_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_thread_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_thread_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsigscan_thread_pool_free(
+	          NULL,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsigscan_thread_pool_run_values function
+ * Returns 1 if successful or 0 if not
+ */
+int sigscan_test_thread_pool_run_values(
+     libsigscan_thread_pool_t *thread_pool )
+{
+	sigscan_test_thread_pool_nested_value_t nested_values[ 4 ];
+	intptr_t *nested_values_array[ 4 ];
+	intptr_t *values_array[ 64 ];
+	int values[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int nested_value_index   = 0;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Initialize test
+	 */
+	for( value_index = 0;
+	     value_index < 64;
+	     value_index++ )
+	{
+		values[ value_index ]       = value_index;
+		values_array[ value_index ] = (intptr_t *) &( values[ value_index ] );
+	}
+	/* Test regular cases
+	 */
+	result = libsigscan_thread_pool_run_values(
+	          thread_pool,
+	          (int (*)(intptr_t *, libcerror_error_t **)) &sigscan_test_thread_pool_increment_value,
+	          values_array,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 64;
+	     value_index++ )
+	{
+		SIGSCAN_TEST_ASSERT_EQUAL_INT(
+		 "values[ value_index ]",
+		 values[ value_index ],
+		 value_index + 1 );
+	}
+	result = libsigscan_thread_pool_run_values(
+	          thread_pool,
+	          (int (*)(intptr_t *, libcerror_error_t **)) &sigscan_test_thread_pool_increment_value,
+	          values_array,
+	          0,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test running values from within a value that is run by the same thread pool
+	 */
+	for( nested_value_index = 0;
+	     nested_value_index < 4;
+	     nested_value_index++ )
+	{
+		nested_values[ nested_value_index ].thread_pool = thread_pool;
+
+		for( value_index = 0;
+		     value_index < 8;
+		     value_index++ )
+		{
+			nested_values[ nested_value_index ].values[ value_index ] = nested_value_index;
+		}
+		nested_values_array[ nested_value_index ] = (intptr_t *) &( nested_values[ nested_value_index ] );
+	}
+	result = libsigscan_thread_pool_run_values(
+	          thread_pool,
+	          (int (*)(intptr_t *, libcerror_error_t **)) &sigscan_test_thread_pool_increment_nested_value,
+	          nested_values_array,
+	          4,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( nested_value_index = 0;
+	     nested_value_index < 4;
+	     nested_value_index++ )
+	{
+		for( value_index = 0;
+		     value_index < 8;
+		     value_index++ )
+		{
+			SIGSCAN_TEST_ASSERT_EQUAL_INT(
+			 "nested_values[ nested_value_index ].values[ value_index ]",
+			 nested_values[ nested_value_index ].values[ value_index ],
+			 nested_value_index + 1 );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libsigscan_thread_pool_run_values(
+	          thread_pool,
+	          NULL,
+	          values_array,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_thread_pool_run_values(
+	          thread_pool,
+	          (int (*)(intptr_t *, libcerror_error_t **)) &sigscan_test_thread_pool_increment_value,
+	          NULL,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsigscan_thread_pool_run_values(
+	          thread_pool,
+	          (int (*)(intptr_t *, libcerror_error_t **)) &sigscan_test_thread_pool_increment_value,
+	          values_array,
+	          -1,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libsigscan_thread_pool_run_values with a value that cannot be processed
+	 */
+	values[ 17 ] = -1;
+
+	result = libsigscan_thread_pool_run_values(
+	          thread_pool,
+	          (int (*)(intptr_t *, libcerror_error_t **)) &sigscan_test_thread_pool_increment_value,
+	          values_array,
+	          64,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SIGSCAN_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SIGSCAN_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	libcerror_error_t *error              = NULL;
+	libsigscan_thread_pool_t *thread_pool = NULL;
+	int result                            = 0;
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
+
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argc )
+	SIGSCAN_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_thread_pool_get_default_number_of_threads",
+	 sigscan_test_thread_pool_get_default_number_of_threads );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_thread_pool_initialize",
+	 sigscan_test_thread_pool_initialize );
+
+	SIGSCAN_TEST_RUN(
+	 "libsigscan_thread_pool_free",
+	 sigscan_test_thread_pool_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize thread_pool for tests
+	 */
+	result = libsigscan_thread_pool_initialize(
+	          &thread_pool,
+	          4,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SIGSCAN_TEST_RUN_WITH_ARGS(
+	 "libsigscan_thread_pool_run_values",
+	 sigscan_test_thread_pool_run_values,
+	 thread_pool );
+
+	/* Clean up
+	 */
+	result = libsigscan_thread_pool_free(
+	          &thread_pool,
+	          &error );
+
+	SIGSCAN_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	SIGSCAN_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT )
+
+on_error:
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		libsigscan_thread_pool_free(
+		 &thread_pool,
+		 NULL );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSIGSCAN_DLL_IMPORT ) */
+}
+
@@ -1,7 +1,7 @@
 # Tests library functions and types.
 
-$LibraryTests = "byte_value_group error identifier notify offset_group offsets_list pattern_weights scan_object scan_result scan_state scan_tree scan_tree_node signature signature_group signature_table signatures_list skip_table support weight_group"
-$LibraryTestsWithInput = "scanner"
+$LibraryTests = "automaton byte_value_group compiled_file compiled_scan_tree error identifier magic_table notify offset_group offsets_list packed_matcher pattern_weights prefilter read_ahead scan_object scan_result scan_state scan_tree scan_tree_node signature signature_group signature_table signatures_list skip_table sparse_file support thread_pool weight_group"
+$LibraryTestsWithInput = "file_io_handle scanner"
 $OptionSets = "" -split " "
 
 . .\test_functions.ps1